@@ -23,10 +23,12 @@ limitations under the License.
 
 #include <fcntl.h>
 #include <math.h>
+#include <poll.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/select.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -51,6 +53,10 @@ static unsigned char NGT_STARTUP_SEQ[] = {
 };
 
 #define BUFFER_SIZE 900
+#define NGT_READ_SIZE (65536)
+#define NGT_PING_INTERVAL_S (20) /* Repeat NGT_STARTUP_SEQ, so the NGT-1 keeps sending all PGNs */
+#define INGEST_READ_SIZE (1024 * 1024)  /* read() size when a replay file cannot be mapped */
+#define OUTPUT_FLUSH_SIZE (256 * 1024) /* Bytes of output collected before writing them in bulk */
 
 static int      verbose        = 0;
 static int      readonly       = 0;
@@ -63,6 +69,48 @@ static bool     isRegularFile; // a real on-disk file (replay), not a serial/TCP
 static bool     isEBL;
 static bool     isJson; // W2K-1 JSON capture: one {"pgn":..,"payload":[..]} per line
 static uint64_t timestamp = 0;
+static bool     useDeviceTime;
+static bool     bulkIngest; // Converting a regular NGT-1/EBL file: no device, no stdin, output written in bulk
+
+/* -devtime: time N2K messages by the NGT-1's own millisecond clock (bytes
+ * 6-9 of a received message) instead of by when our read completed, which
+ * bunches everything that arrived in one read onto the same moment.
+ *
+ * The device clock is mapped onto host (or, replaying an EBL file, logger)
+ * time as host = anchorHostUs + (deviceUs - anchorDeviceUs) * rate. Host
+ * times lag the device by a varying latency, so the mapping follows the lower
+ * envelope: within a window the line is fixed, and a message that arrives
+ * earlier than the line predicts pulls the output down at once. At the end of
+ * every DEVICE_CLOCK_WINDOW_US the sample with the smallest (signed) lag is
+ * the new anchor, and the slope from the previous anchor to it corrects the
+ * rate (the drift between the two crystals) in either direction.
+ *
+ * A fast packet carries the time of its first frame, so it can be stamped a
+ * few frames earlier than a single-frame message received before it. Such
+ * small steps back are mapped like any other time; only a larger one means
+ * the device was reset or its clock wrapped. */
+#define DEVICE_CLOCK_WINDOW_US (10000000)
+#define DEVICE_CLOCK_MAX_DRIFT (0.001) /* Crystals are good to 100 ppm; this allows for ten times that */
+#define DEVICE_CLOCK_RATE_GAIN (0.5)
+#define DEVICE_CLOCK_MAX_BACK_MS (1000)
+#define DEVICE_CLOCK_QUIET_US (1000000)
+
+static struct
+{
+  bool     synced;
+  uint32_t lastRaw;  /* Newest device milliseconds as sent, wrapping every 49.7 days */
+  uint64_t deviceUs; /* lastRaw, unwrapped */
+  uint64_t anchorDeviceUs;
+  double   anchorHostUs;
+  double   rate;
+  bool     anchorOnEnvelope; /* The anchor is a window minimum, not just the first sample */
+  uint64_t windowStartUs;    /* Device time */
+  double   windowMinLagUs;   /* Host minus line, before any correction; may be negative */
+  uint64_t windowMinDeviceUs;
+  uint64_t lastOutputUs;
+  uint64_t lastHostUs; /* Host time when lastOutputUs was produced */
+  bool     eblSample;  /* An EBL timestamp arrived and has not been used yet */
+} deviceClock;
 
 /* NMEA 2000 gateway: network status (synthetic PGN 262400 / IKONVERT_BEM).
  * Emitted to stdout every NETWORK_STATUS_INTERVAL_S so a downstream consumer
@@ -88,13 +136,47 @@ enum MSG_State
   MSG_MESSAGE
 };
 
+/*
+ * The DLE/STX framing is taken apart a whole read at a time. Outside an
+ * escape only one or two byte values matter, so runs of ordinary bytes are
+ * skipped or copied in one go, with ngtStops[] telling per state which bytes
+ * end a run. The byte after an escape is looked up in ngtEscapeAction[].
+ * Both tables depend on isEBL and are built by initNGT1Scanner().
+ */
+enum NGT_EscapeAction
+{
+  NGT_ESC_INVALID,
+  NGT_ESC_LITERAL,      /* DLE DLE (or ESC ESC in EBL): the byte itself */
+  NGT_ESC_FRAME_START,  /* DLE STX */
+  NGT_ESC_FRAME_END,    /* DLE ETX */
+  NGT_ESC_HEADER_START, /* ESC SOH, EBL only */
+  NGT_ESC_HEADER_END    /* ESC LF, EBL only */
+};
+
+#define NGT_STOP_FRAME (1) /* Ends a run in MSG_START and MSG_MESSAGE */
+#define NGT_STOP_HEADER (2) /* Ends a run in MSG_HEADER */
+
+static uint8_t ngtStops[256];
+static uint8_t ngtEscapeAction[256];
+
+static struct
+{
+  enum MSG_State state;
+  enum MSG_State prevState;
+  unsigned char  buf[500];
+  size_t         len;
+} ngt = {.state = MSG_START, .prevState = MSG_MESSAGE};
+
+static size_t ngtFramesReceived; /* Frames and EBL headers completed */
+
 int baudRate = B115200;
 
 static bool readIn(void);
 static bool getInMsg(char *msg, size_t len);
 static void parseAndWriteIn(int handle, const char *cmd);
 static void writeMessage(int handle, unsigned char command, const unsigned char *cmd, const size_t len, uint64_t when);
-static bool readNGT1Byte(unsigned char c);
+static void initNGT1Scanner(void);
+static void readNGT1Bytes(const unsigned char *data, size_t len);
 static int  readNGT1(int handle);
 static int  readW2K(int handle);
 static void w2kMessageReceived(const char *line);
@@ -103,6 +185,14 @@ static void messageReceived(const unsigned char *msg, size_t msgLen);
 static void n2kMessageReceived(const unsigned char *msg, size_t msgLen, unsigned char command);
 static void ngtMessageReceived(const unsigned char *msg, size_t msgLen);
 static void emitNetworkStatus(void);
+static int  pollTimeoutMs(time_t lastPing, time_t lastActivity);
+static uint64_t    deviceTimeUs(uint32_t raw);
+static uint64_t    deviceClockNowUs(void);
+static const char *fmtGatewayTimestamp(char *dateStr);
+static void        ingestFile(int handle);
+static void        emitLine(const char *line, size_t len);
+static void        flushOutput(void);
+static char       *appendHexBytes(char *p, const unsigned char *data, size_t len);
 
 int main(int argc, char **argv)
 {
@@ -112,8 +202,8 @@ int main(int argc, char **argv)
   char          *device = 0;
   struct stat    statbuf;
   int            speed = 115200;
-  int            i;
   time_t         lastPing     = time(0);
+  time_t         lastActivity = time(0);
 
   naStartTime  = time(0);
   naLastStatus = time(0);
@@ -192,6 +282,10 @@ int main(int argc, char **argv)
     {
       outputCommands = 1;
     }
+    else if (strcasecmp(argv[1], "-devtime") == 0)
+    {
+      useDeviceTime = true;
+    }
     else if (!device)
     {
       device = argv[1];
@@ -208,7 +302,7 @@ int main(int argc, char **argv)
   if (!device)
   {
     fprintf(stderr,
-            "Usage: %s [-w] -[-p] [-r] [-v] [-d] [-s <n>] [-t <n>] device\n"
+            "Usage: %s [-w] -[-p] [-r] [-v] [-d] [-s <n>] [-t <n>] [-devtime] device\n"
             "\n"
             "Options:\n"
             "  -w      writeonly mode, no data is read from device\n"
@@ -226,6 +320,8 @@ int main(int argc, char **argv)
             "\n"
             "  -t <n>  timeout, if no message is received after <n> seconds the program quits\n"
             "  -o      alias for -p (kept for backward compatibility; -p is preferred)\n"
+            "  -devtime  time received messages by the NGT-1's own clock, tracked against the\n"
+            "          host (or EBL log) clock, rather than by when they were read\n"
             "  <device> can be a serial device, a normal file containing a raw log,\n"
             "  an Actisense .ebl log, a W2K-1 JSON capture (auto-detected),\n"
             "  or the address of a TCP server in the format tcp://<host>[:<port>]\n"
@@ -351,6 +447,19 @@ int main(int argc, char **argv)
     sleep(2);
   }
 
+  initNGT1Scanner();
+
+  // A regular file has nothing to wait for: stdin commands cannot reach a
+  // replay handle, and nothing is due on a timer. Convert it in one go unless
+  // stdin has to be echoed (-p).
+  bulkIngest = isRegularFile && !isJson && !passthru && !outputCommands;
+  if (bulkIngest)
+  {
+    ingestFile(handle);
+    close(handle);
+    return 0;
+  }
+
   if (readonly)
   {
     // Defensive: pin fd 0 to /dev/null. The main loop's isReady
@@ -369,7 +478,7 @@ int main(int argc, char **argv)
   if (!isFile && !writeonly)
   {
     // Do not read anything until we have seen 10 messages on bus
-    for (i = 0; i < 10;)
+    while (ngtFramesReceived < 10)
     {
       int r = isReady(handle, INVALID_SOCKET, INVALID_SOCKET, timeout);
 
@@ -379,21 +488,51 @@ int main(int argc, char **argv)
         {
           break;
         }
-        i++;
       }
     }
   }
 
   for (;;)
   {
-    char msg[BUFFER_SIZE];
+    char          msg[BUFFER_SIZE];
+    struct pollfd fds[2];
+    nfds_t        nfds     = 0;
+    int           deviceFd = -1;
+    int           stdinFd  = -1;
+    bool          deviceIn = false;
+    bool          stdinIn  = false;
+    int           r;
+
     // File-capture mode (-w to a regular file) has an O_WRONLY
     // handle — don't poll it for read. Serial -w opens R/W and
     // does need polling so we can drain the device's output.
-    int r = isReady(
-        (writeonly && isFile) ? INVALID_SOCKET : handle, readonly ? INVALID_SOCKET : STDIN_FILENO, INVALID_SOCKET, timeout);
+    if (!(writeonly && isFile))
+    {
+      deviceFd    = nfds;
+      fds[nfds++] = (struct pollfd) {.fd = handle, .events = POLLIN};
+    }
+    if (!readonly)
+    {
+      stdinFd     = nfds;
+      fds[nfds++] = (struct pollfd) {.fd = STDIN_FILENO, .events = POLLIN};
+    }
+    r = poll(fds, nfds, pollTimeoutMs(lastPing, lastActivity));
+    if (r < 0 && errno != EINTR)
+    {
+      logAbort("I/O error; restart by quit\n");
+    }
+    if (r > 0)
+    {
+      deviceIn     = deviceFd >= 0 && (fds[deviceFd].revents & (POLLIN | POLLHUP | POLLERR)) != 0;
+      stdinIn      = stdinFd >= 0 && (fds[stdinFd].revents & (POLLIN | POLLHUP | POLLERR)) != 0;
+      lastActivity = time(0);
+    }
+    else if (timeout && time(0) - lastActivity >= timeout)
+    {
+      logAbort("Timeout %ld seconds; restart by quit\n", timeout);
+    }
 
-    if ((r & FD1_ReadReady) > 0)
+    if (deviceIn)
     {
       if (writeonly)
       {
@@ -413,7 +552,7 @@ int main(int argc, char **argv)
         break;
       }
     }
-    if ((r & FD2_ReadReady) > 0)
+    if (stdinIn)
     {
       if (!readIn())
       {
@@ -434,7 +573,7 @@ int main(int argc, char **argv)
         fflush(stdout);
       }
     }
-    if (!isRegularFile && time(0) - lastPing > 20)
+    if (!isRegularFile && time(0) - lastPing > NGT_PING_INTERVAL_S)
     {
       writeMessage(handle, NGT_MSG_SEND, NGT_STARTUP_SEQ, sizeof(NGT_STARTUP_SEQ), UINT64_C(0));
       lastPing = time(0);
@@ -453,6 +592,36 @@ int main(int argc, char **argv)
   return 0;
 }
 
+/*
+ * How long the main loop may block in poll(): until the next keep-alive ping,
+ * network status or -t timeout is due, whichever is first; -1 if none is.
+ * The deadlines are whole seconds of time(), so wake just as one passes.
+ */
+static int pollTimeoutMs(time_t lastPing, time_t lastActivity)
+{
+  time_t   due = 0;
+  uint64_t nowMs;
+
+  if (!isRegularFile)
+  {
+    due = lastPing + NGT_PING_INTERVAL_S + 1;
+    if (!writeonly)
+    {
+      due = CB_MIN(due, naLastStatus + NETWORK_STATUS_INTERVAL_S);
+    }
+  }
+  if (timeout)
+  {
+    due = due ? CB_MIN(due, lastActivity + timeout) : lastActivity + timeout;
+  }
+  if (!due)
+  {
+    return -1;
+  }
+  nowMs = getNow();
+  return ((uint64_t) due * 1000 > nowMs) ? (int) ((uint64_t) due * 1000 - nowMs) : 0;
+}
+
 static void parseAndWriteIn(int handle, const char *cmd)
 {
   unsigned char  msg[500];
@@ -634,7 +803,7 @@ static void writeMessage(int handle, unsigned char command, const unsigned char
   logDebug("Written command %X len %d\n", command, (int) len);
 }
 
-static StringBuffer inBuffer;
+static ReadBuffer inBuffer;
 
 /**
  * Read from stdin, until we have a complete message and store it in msg.
@@ -663,7 +832,7 @@ static bool readIn(void)
     }
   }
 
-  sbAppendData(&inBuffer, buf, r);
+  rbAppendData(&inBuffer, buf, r);
   return true;
 }
 
@@ -673,18 +842,10 @@ static bool readIn(void)
  */
 static bool getInMsg(char *msg, size_t msgLen)
 {
-  char  *p;
-  size_t len;
-
-  p = strchr(sbGet(&inBuffer), '\n');
-  if (!p)
+  if (!rbGetLine(&inBuffer, msg, msgLen))
   {
     return false;
   }
-  len = p - sbGet(&inBuffer) + 1;
-  memcpy(msg, sbGet(&inBuffer), len);
-  msg[len] = 0;
-  sbDelete(&inBuffer, 0, len);
 
   logDebug("getInMsg => '%s'\n", msg);
 
@@ -696,132 +857,132 @@ static bool getInMsg(char *msg, size_t msgLen)
  *
  */
 
-static bool readNGT1Byte(unsigned char c)
+static void initNGT1Scanner(void)
 {
-  static enum MSG_State prev_state = MSG_MESSAGE;
-  static enum MSG_State state      = MSG_START;
-  static unsigned char  buf[500];
-  static unsigned char *head = buf;
+  memset(ngtStops, 0, sizeof(ngtStops));
+  memset(ngtEscapeAction, NGT_ESC_INVALID, sizeof(ngtEscapeAction));
+
+  ngtStops[DLE] |= NGT_STOP_FRAME;
+  ngtStops[ESC] |= NGT_STOP_HEADER;
+  ngtEscapeAction[DLE] = NGT_ESC_LITERAL;
+  ngtEscapeAction[STX] = NGT_ESC_FRAME_START;
+  ngtEscapeAction[ETX] = NGT_ESC_FRAME_END;
+  if (isEBL)
+  {
+    ngtStops[ESC] |= NGT_STOP_FRAME;
+    ngtEscapeAction[ESC] = NGT_ESC_LITERAL;
+    ngtEscapeAction[SOH] = NGT_ESC_HEADER_START;
+    ngtEscapeAction[LF]  = NGT_ESC_HEADER_END;
+  }
+}
 
-  logDebug("readNGT1Byte isFile=%d isEBL=%d state=%d c=0x%02x\n", isFile, isEBL, state, c);
+static void readNGT1Bytes(const unsigned char *data, size_t len)
+{
+  const unsigned char *end = data + len;
 
-  if (state == MSG_ESCAPE)
+  while (data < end)
   {
-    if (c == SOH && isEBL)
+    if (ngt.state == MSG_ESCAPE)
     {
-      head  = buf;
-      state = MSG_HEADER;
-    }
-    else if (c == LF && isEBL)
-    {
-      headerReceived(buf, head - buf);
-      head  = buf;
-      state = MSG_START;
-    }
-    else if (c == ETX)
-    {
-      messageReceived(buf, head - buf);
-      head  = buf;
-      state = MSG_START;
-    }
-    else if (c == STX)
-    {
-      head  = buf;
-      state = MSG_MESSAGE;
-    }
-    else if ((c == DLE) || ((c == ESC) && isEBL))
-    {
-      if (head < buf + sizeof(buf))
+      unsigned char c = *data++;
+
+      switch (ngtEscapeAction[c])
       {
-        *head++ = c;
+        case NGT_ESC_HEADER_START:
+          ngt.len   = 0;
+          ngt.state = MSG_HEADER;
+          break;
+        case NGT_ESC_HEADER_END:
+          headerReceived(ngt.buf, ngt.len);
+          ngtFramesReceived++;
+          ngt.len   = 0;
+          ngt.state = MSG_START;
+          break;
+        case NGT_ESC_FRAME_END:
+          messageReceived(ngt.buf, ngt.len);
+          ngtFramesReceived++;
+          ngt.len   = 0;
+          ngt.state = MSG_START;
+          break;
+        case NGT_ESC_FRAME_START:
+          ngt.len   = 0;
+          ngt.state = MSG_MESSAGE;
+          break;
+        case NGT_ESC_LITERAL:
+          if (ngt.len < sizeof(ngt.buf))
+          {
+            ngt.buf[ngt.len++] = c;
+          }
+          ngt.state = ngt.prevState;
+          break;
+        default:
+          logError("DLE followed by unexpected char %02X, ignore message\n", c);
+          ngt.state = MSG_START;
+          break;
       }
-      state = prev_state;
     }
     else
     {
-      logError("DLE followed by unexpected char %02X, ignore message\n", c);
-      state = MSG_START;
-    }
-  }
-  else if (state == MSG_MESSAGE)
-  {
-    if (c == DLE || ((c == ESC) && isEBL))
-    {
-      prev_state = state;
-      state      = MSG_ESCAPE;
-    }
-    else if (head < buf + sizeof(buf))
-    {
-      *head++ = c;
-    }
-  }
-  else if (state == MSG_HEADER)
-  {
-    if (c == ESC)
-    {
-      prev_state = state;
-      state      = MSG_ESCAPE;
-    }
-    else if (head < buf + sizeof(buf))
-    {
-      *head++ = c;
-    }
-  }
-  else
-  {
-    if (c == DLE || ((c == ESC) && isEBL))
-    {
-      prev_state = state;
-      state      = MSG_ESCAPE;
+      uint8_t              stop = (ngt.state == MSG_HEADER) ? NGT_STOP_HEADER : NGT_STOP_FRAME;
+      const unsigned char *run  = data;
+
+      while (data < end && (ngtStops[*data] & stop) == 0)
+      {
+        data++;
+      }
+      if (ngt.state != MSG_START)
+      {
+        size_t n = CB_MIN((size_t) (data - run), sizeof(ngt.buf) - ngt.len);
+
+        memcpy(ngt.buf + ngt.len, run, n);
+        ngt.len += n;
+      }
+      if (data < end)
+      {
+        ngt.prevState = ngt.state;
+        ngt.state     = MSG_ESCAPE;
+        data++;
+      }
     }
   }
-
-  return state == MSG_START;
 }
 
+/*
+ * Read what the device has for us, as much as fits, and scan all of it.
+ * Called when poll() says the device is readable; a spurious wakeup
+ * (EAGAIN) is not an error.
+ */
 static int readNGT1(int handle)
 {
-  size_t        i;
-  ssize_t       r;
-  unsigned char c;
-  unsigned char buf[500];
-  bool          finish;
+  static unsigned char buf[NGT_READ_SIZE];
+  ssize_t              r;
 
-  do
-  {
-    r = read(handle, buf, sizeof(buf));
-    logDebug("NGT read = %d\n", (int) r);
+  r = read(handle, buf, sizeof(buf));
+  logDebug("NGT read = %d\n", (int) r);
 
-    if (r < 0 && errno == EAGAIN)
-    {
-      usleep(25000);
-      continue;
-    }
-    if (r <= 0) /* No char read, abort message read */
+  if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+  {
+    return 1;
+  }
+  if (r <= 0) /* No char read, abort message read */
+  {
+    if (!isFile)
     {
-      if (!isFile)
-      {
-        logAbort("Unable to read from NGT1 device, errno=%d\n", errno);
-      }
-      exit(0);
+      logAbort("Unable to read from NGT1 device, errno=%d\n", errno);
     }
+    exit(0);
+  }
 
-    if (isLogLevelEnabled(LOGLEVEL_DEBUG))
-    {
-      StringBuffer sb = sbNew;
-
-      sbAppendEncodeHex(&sb, buf, r, ' ');
-      logDebug("NGT data: %s\n", sbGet(&sb));
-      sbClean(&sb);
-    }
+  if (isLogLevelEnabled(LOGLEVEL_DEBUG))
+  {
+    StringBuffer sb = sbNew;
 
-    for (i = 0; i < r; i++)
-    {
-      c      = buf[i];
-      finish = readNGT1Byte(c);
-    }
-  } while (!finish);
+    sbAppendEncodeHex(&sb, buf, r, ' ');
+    logDebug("NGT data: %s\n", sbGet(&sb));
+    sbClean(&sb);
+  }
 
+  readNGT1Bytes(buf, (size_t) r);
   return r;
 }
 
@@ -897,9 +1058,8 @@ static int readW2K(int handle)
   r = read(handle, buf, sizeof(buf));
   logDebug("W2K read = %d\n", (int) r);
 
-  if (r < 0 && errno == EAGAIN)
+  if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
   {
-    usleep(25000);
     return 1;
   }
   if (r <= 0)
@@ -954,7 +1114,8 @@ static void headerReceived(const unsigned char *msg, size_t msgLen)
 
       ft = ft / 10000;
       ft -= 11644473600000;
-      timestamp = ft;
+      timestamp             = ft;
+      deviceClock.eblSample = true;
       logDebug("EBL timestamp %" PRIu64 "\n", timestamp);
     }
   }
@@ -1008,10 +1169,9 @@ static void messageReceived(const unsigned char *msg, size_t msgLen)
 
 static void ngtMessageReceived(const unsigned char *msg, size_t msgLen)
 {
-  size_t i;
-  char   line[1000];
-  char  *p;
-  char   dateStr[DATE_LENGTH];
+  char  line[1000];
+  char *p;
+  char  dateStr[DATE_LENGTH];
 
   if (msgLen < 12)
   {
@@ -1039,17 +1199,9 @@ static void ngtMessageReceived(const unsigned char *msg, size_t msgLen)
     emitNetworkStatus();
   }
 
-  sprintf(line, "%s,%u,%u,%u,%u,%u", fmtTimestamp(dateStr, timestamp), 0, ACTISENSE_BEM + msg[0], 0, 0, (unsigned int) msgLen - 1);
-  p = line + strlen(line);
-  for (i = 1; i < msgLen && p < line + sizeof(line) - 5; i++)
-  {
-    sprintf(p, ",%02x", msg[i]);
-    p += 3;
-  }
-  *p++ = 0;
-
-  puts(line);
-  fflush(stdout);
+  p = line + sprintf(line, "%s,%u,%u,%u,%u,%u", fmtGatewayTimestamp(dateStr), 0, ACTISENSE_BEM + msg[0], 0, 0, (unsigned int) msgLen - 1);
+  p = appendHexBytes(p, msg + 1, CB_MIN(msgLen - 1, (size_t) (line + sizeof(line) - p - 1) / 3));
+  emitLine(line, p - line);
 }
 
 /*
@@ -1099,16 +1251,9 @@ static void emitNetworkStatus(void)
   data[8] = (uint8_t) (uptime >> 16);
   data[9] = (uint8_t) (uptime >> 24);
 
-  snprintf(line, sizeof(line), "%s,7,%u,0,255,15", fmtTimestamp(dateStr, timestamp), (unsigned int) IKONVERT_BEM);
-  p = line + strlen(line);
-  for (int b = 0; b < 15; b++)
-  {
-    snprintf(p, line + sizeof(line) - p, ",%02x", data[b]);
-    p += strlen(p);
-  }
-
-  puts(line);
-  fflush(stdout);
+  p = line + snprintf(line, sizeof(line), "%s,7,%u,0,255,15", fmtGatewayTimestamp(dateStr), (unsigned int) IKONVERT_BEM);
+  p = appendHexBytes(p, data, sizeof(data));
+  emitLine(line, p - line);
 
   naLastStatus = time(0);
 }
@@ -1117,12 +1262,12 @@ static void n2kMessageReceived(const unsigned char *msg, size_t msgLen, const un
 {
   unsigned int prio, src, dst;
   unsigned int pgn;
-  size_t       i;
   unsigned int len;
   char         line[800];
   char        *p;
   char         dateStr[DATE_LENGTH];
   size_t       headerLen = (command == N2K_MSG_SEND) ? 6 : 11;
+  uint64_t     whenUs    = 0;
 
   if (msgLen < headerLen)
   {
@@ -1140,7 +1285,11 @@ static void n2kMessageReceived(const unsigned char *msg, size_t msgLen, const un
   else
   {
     src = msg[5];
-    /* Skip the timestamp logged by the NGT-1-A in bytes 6-9 */
+    /* The NGT-1-A logs its own millisecond timestamp in bytes 6-9 */
+    if (useDeviceTime)
+    {
+      whenUs = deviceTimeUs((uint32_t) msg[6] | (uint32_t) msg[7] << 8 | (uint32_t) msg[8] << 16 | (uint32_t) msg[9] << 24);
+    }
     len = msg[10];
     /* Remember every source we hear from, for the network-status device count. */
     naSeenAddr[src & 0xff] = true;
@@ -1152,22 +1301,224 @@ static void n2kMessageReceived(const unsigned char *msg, size_t msgLen, const un
     return;
   }
 
-  p = line;
-  snprintf(p, sizeof(line), "%s,%u,%u,%u,%u,%u", fmtTimestamp(dateStr, timestamp), prio, pgn, src, dst, len);
-  p += strlen(line);
+  p = line
+      + snprintf(line,
+                 sizeof(line),
+                 "%s,%u,%u,%u,%u,%u",
+                 whenUs != 0 ? fmtTimestampUs(dateStr, whenUs) : fmtTimestamp(dateStr, timestamp),
+                 prio,
+                 pgn,
+                 src,
+                 dst,
+                 len);
+  p = appendHexBytes(p, msg + headerLen, CB_MIN((size_t) len, msgLen - headerLen));
+  emitLine(line, p - line);
+}
+
+/*
+ * Map the device timestamp of a received message onto host time, see
+ * deviceClock. The reference is the host clock for a live device. Replaying
+ * an EBL log it is each EBL timestamp record, taken as the time of the message
+ * that follows it. Other files have no reference at all; they keep the
+ * device's spacing from when replay started.
+ * Messages that fall in the same device millisecond keep their order, a
+ * microsecond apart; a message stamped before its predecessor keeps its own,
+ * earlier, time.
+ */
+static uint64_t deviceTimeUs(uint32_t raw)
+{
+  uint64_t hostUs = isEBL ? timestamp * 1000 : getNowUs();
+  int32_t  delta  = (int32_t) (raw - deviceClock.lastRaw);
+  uint64_t msgDeviceUs;
+  double   predictedUs;
+  double   lagUs;
+  uint64_t whenUs;
+
+  if (deviceClock.synced && delta < -DEVICE_CLOCK_MAX_BACK_MS)
+  {
+    logInfo("NGT-1 clock went back %d ms, resynchronising\n", -delta);
+    deviceClock.synced = false;
+  }
+  if (!deviceClock.synced || (isEBL && timestamp == 0))
+  {
+    deviceClock.eblSample        = false;
+    deviceClock.synced           = true;
+    deviceClock.lastRaw          = raw;
+    deviceClock.deviceUs         = (uint64_t) raw * 1000;
+    deviceClock.anchorDeviceUs   = deviceClock.deviceUs;
+    deviceClock.anchorHostUs     = (double) hostUs;
+    deviceClock.rate             = 1.0;
+    deviceClock.anchorOnEnvelope = false;
+    deviceClock.windowStartUs    = deviceClock.deviceUs;
+    deviceClock.windowMinLagUs   = HUGE_VAL;
+    delta                        = 0;
+  }
+  else if (delta >= 0)
+  {
+    deviceClock.lastRaw = raw;
+    deviceClock.deviceUs += (uint64_t) delta * 1000;
+  }
+  msgDeviceUs = deviceClock.deviceUs + (int64_t) CB_MIN(delta, 0) * 1000;
+
+  predictedUs = deviceClock.anchorHostUs + (double) (int64_t) (msgDeviceUs - deviceClock.anchorDeviceUs) * deviceClock.rate;
+  if (!isRegularFile || deviceClock.eblSample)
+  {
+    deviceClock.eblSample = false;
+    lagUs                 = (double) hostUs - predictedUs;
+    if (lagUs < deviceClock.windowMinLagUs)
+    {
+      deviceClock.windowMinLagUs    = lagUs;
+      deviceClock.windowMinDeviceUs = msgDeviceUs;
+    }
+    if (deviceClock.deviceUs - deviceClock.windowStartUs >= DEVICE_CLOCK_WINDOW_US)
+    {
+      /* The slope from the anchor to this window's lowest sample is the true
+       * rate; the lag of that sample is how far the line is off it. */
+      double spanUs = (double) (int64_t) (deviceClock.windowMinDeviceUs - deviceClock.anchorDeviceUs);
+      double minUs  = deviceClock.anchorHostUs + spanUs * deviceClock.rate + deviceClock.windowMinLagUs;
 
-  i = headerLen;
-  len += i;
-  if (len > msgLen)
+      if (deviceClock.anchorOnEnvelope && spanUs >= DEVICE_CLOCK_WINDOW_US / 2)
+      {
+        deviceClock.rate += DEVICE_CLOCK_RATE_GAIN * deviceClock.windowMinLagUs / spanUs;
+        deviceClock.rate = CB_MIN(CB_MAX(deviceClock.rate, 1.0 - DEVICE_CLOCK_MAX_DRIFT), 1.0 + DEVICE_CLOCK_MAX_DRIFT);
+      }
+      deviceClock.anchorDeviceUs   = deviceClock.windowMinDeviceUs;
+      deviceClock.anchorHostUs     = minUs;
+      deviceClock.anchorOnEnvelope = true;
+      deviceClock.windowStartUs    = deviceClock.deviceUs;
+      deviceClock.windowMinLagUs   = HUGE_VAL;
+      predictedUs                  = deviceClock.anchorHostUs + (double) (int64_t) (msgDeviceUs - deviceClock.anchorDeviceUs) * deviceClock.rate;
+    }
+  }
+  if (deviceClock.windowMinLagUs < 0.0)
   {
-    len = msgLen;
+    predictedUs += deviceClock.windowMinLagUs;
   }
-  for (; i < len; i++)
+
+  whenUs = (uint64_t) predictedUs;
+  if (delta >= 0)
   {
-    snprintf(p, line + sizeof(line) - p, ",%02x", msg[i]);
-    p += strlen(p);
+    if (whenUs <= deviceClock.lastOutputUs)
+    {
+      whenUs = deviceClock.lastOutputUs + 1;
+    }
+    deviceClock.lastOutputUs = whenUs;
+    deviceClock.lastHostUs   = hostUs;
   }
+  return whenUs;
+}
 
-  puts(line);
+/*
+ * The current time on the -devtime clock, 0 until it is synced. Lines the
+ * NGT-1 originates carry no device time; while messages are flowing they are
+ * stamped with the newest message's time, as messages received after them
+ * may well have been stamped before them. On a quiet bus the host time that
+ * has passed since the last message is added.
+ */
+static uint64_t deviceClockNowUs(void)
+{
+  uint64_t hostUs;
+  uint64_t elapsedUs;
+
+  if (!useDeviceTime || !deviceClock.synced || deviceClock.lastOutputUs == 0)
+  {
+    return 0;
+  }
+  hostUs    = isEBL ? timestamp * 1000 : getNowUs();
+  elapsedUs = hostUs > deviceClock.lastHostUs ? hostUs - deviceClock.lastHostUs : 0;
+  return deviceClock.lastOutputUs + (elapsedUs > DEVICE_CLOCK_QUIET_US ? elapsedUs : 0);
+}
+
+/*
+ * Timestamp for a line the NGT-1 itself originates, on the same clock as the
+ * N2K messages around it.
+ */
+static const char *fmtGatewayTimestamp(char *dateStr)
+{
+  uint64_t whenUs = deviceClockNowUs();
+
+  return whenUs != 0 ? fmtTimestampUs(dateStr, whenUs) : fmtTimestamp(dateStr, timestamp);
+}
+
+/*
+ * Convert a whole NGT-1 or EBL capture file. The file is mapped and scanned in
+ * one pass, so the frame scanner sees long runs instead of read()-sized
+ * pieces; files that cannot be mapped are read in large chunks instead.
+ */
+static void ingestFile(int handle)
+{
+  struct stat statbuf;
+  void       *map = MAP_FAILED;
+
+  if (fstat(handle, &statbuf) == 0 && statbuf.st_size > 0 && (uint64_t) statbuf.st_size <= SIZE_MAX)
+  {
+    map = mmap(NULL, (size_t) statbuf.st_size, PROT_READ, MAP_PRIVATE, handle, 0);
+  }
+  if (map != MAP_FAILED)
+  {
+    madvise(map, (size_t) statbuf.st_size, MADV_SEQUENTIAL);
+    readNGT1Bytes(map, (size_t) statbuf.st_size);
+    munmap(map, (size_t) statbuf.st_size);
+  }
+  else
+  {
+    unsigned char *buf = malloc(INGEST_READ_SIZE);
+    ssize_t        r;
+
+    if (buf == NULL)
+    {
+      die("Out of memory");
+    }
+    while ((r = read(handle, buf, INGEST_READ_SIZE)) > 0 || (r < 0 && errno == EINTR))
+    {
+      if (r > 0)
+      {
+        readNGT1Bytes(buf, (size_t) r);
+      }
+    }
+    if (r < 0)
+    {
+      logAbort("Unable to read NGT-1 file, errno=%d\n", errno);
+    }
+    free(buf);
+  }
+  flushOutput();
+}
+
+static StringBuffer outBuffer;
+
+/*
+ * Write a line of output. A live device gets every line out at once; a bulk
+ * file conversion collects OUTPUT_FLUSH_SIZE bytes before writing them.
+ */
+static void emitLine(const char *line, size_t len)
+{
+  sbAppendData(&outBuffer, line, len);
+  sbAppendChar(&outBuffer, '\n');
+  if (!bulkIngest || sbGetLength(&outBuffer) >= OUTPUT_FLUSH_SIZE)
+  {
+    flushOutput();
+  }
+}
+
+static void flushOutput(void)
+{
+  fwrite(sbGet(&outBuffer), 1, sbGetLength(&outBuffer), stdout);
   fflush(stdout);
+  sbEmpty(&outBuffer);
+}
+
+/* Append ",xx" for each byte, and terminate the string. */
+static char *appendHexBytes(char *p, const unsigned char *data, size_t len)
+{
+  static const char hexDigits[] = "0123456789abcdef";
+
+  for (size_t i = 0; i < len; i++)
+  {
+    *p++ = ',';
+    *p++ = hexDigits[data[i] >> 4];
+    *p++ = hexDigits[data[i] & 0x0f];
+  }
+  *p = '\0';
+  return p;
 }
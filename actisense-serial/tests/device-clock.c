@@ -0,0 +1,143 @@
+/*
+
+Feeds synthetic NGT-1 timestamps through the -devtime clock without a
+device: a device crystal that runs fast or slow against the logger, EBL
+timestamp records with a varying latency, and fast packets stamped with the
+time of their first frame, so they arrive after messages stamped later.
+After the clock has had a minute to settle, every message must map to within
+a few milliseconds of when it really happened. actisense-serial.c is
+included rather than linked so its static functions are reachable; its
+main() is renamed out of the way.
+
+(C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+
+This file is part of CANboat.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#define main actisenseSerialMain
+#include "actisense-serial.c"
+#undef main
+
+#define TEST_START_US (UINT64_C(1745234337000000))
+#define TEST_DURATION_US (300000000)
+#define TEST_SETTLE_US (60000000)
+#define TEST_INTERVAL_US (20000)
+#define TEST_FAST_EARLY_US (12000) /* A fast packet is stamped when its first frame arrived */
+#define TEST_MIN_LATENCY_US (1000)
+#define TEST_MAX_LATENCY_US (25000)
+#define TEST_TOLERANCE_US (3000)
+
+static uint32_t seed;
+
+static uint32_t nextRandom(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return seed >> 8;
+}
+
+/* True time (relative to the start) to what the device clock reads then. */
+static uint32_t deviceRaw(uint64_t trueUs, uint32_t rawStart, double drift)
+{
+  return rawStart + (uint32_t) ((double) trueUs * (1.0 + drift) / 1000.0);
+}
+
+static bool runCase(const char *what, double drift, uint32_t rawStart)
+{
+  uint64_t trueUs;
+  int64_t  worstUs   = 0;
+  int      backwards = 0;
+  int      n         = 0;
+
+  memset(&deviceClock, 0, sizeof(deviceClock));
+  seed      = 523;
+  timestamp = 0;
+
+  for (trueUs = 0; trueUs < TEST_DURATION_US; trueUs += TEST_INTERVAL_US)
+  {
+    bool     fast    = (n % 5) == 4;
+    uint64_t stampUs = fast ? trueUs - TEST_FAST_EARLY_US : trueUs;
+    uint64_t latency = TEST_MIN_LATENCY_US + nextRandom() % (TEST_MAX_LATENCY_US - TEST_MIN_LATENCY_US);
+    uint64_t whenUs;
+    int64_t  errorUs;
+
+    /* The logger writes a timestamp record before every few messages */
+    if (n % 3 == 0)
+    {
+      timestamp             = (TEST_START_US + trueUs + latency) / 1000;
+      deviceClock.eblSample = true;
+    }
+    whenUs  = deviceTimeUs(deviceRaw(stampUs, rawStart, drift));
+    errorUs = (int64_t) whenUs - (int64_t) (TEST_START_US + stampUs);
+    if (fast && n > 0)
+    {
+      backwards++;
+    }
+    if (trueUs >= TEST_SETTLE_US && llabs(errorUs) > llabs(worstUs))
+    {
+      worstUs = errorUs;
+    }
+    n++;
+  }
+
+  if (llabs(worstUs) > TEST_TOLERANCE_US)
+  {
+    printf("%s: FAIL, off by %" PRId64 " us\n", what, worstUs);
+    return false;
+  }
+  printf("%s: ok, %d messages, %d stamped before their predecessor\n", what, n, backwards);
+  return true;
+}
+
+/* A device that is reset mid-stream starts counting from zero again. */
+static bool runReset(void)
+{
+  uint64_t before;
+  uint64_t after;
+
+  memset(&deviceClock, 0, sizeof(deviceClock));
+  timestamp             = TEST_START_US / 1000;
+  deviceClock.eblSample = true;
+  before                = deviceTimeUs(3600000);
+  timestamp += 2000;
+  deviceClock.eblSample = true;
+  after                 = deviceTimeUs(150);
+
+  if (after != TEST_START_US + 2000000)
+  {
+    printf("reset: FAIL, %" PRIu64 " us after the reset, expected %" PRIu64 "\n", after - before, (uint64_t) 2000000);
+    return false;
+  }
+  printf("reset: ok\n");
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  bool ok = true;
+
+  (void) argc;
+  setProgName(argv[0]);
+
+  isEBL         = true;
+  isRegularFile = true;
+  useDeviceTime = true;
+
+  ok &= runCase("device 500 ppm fast", 500e-6, 100000);
+  ok &= runCase("device 500 ppm slow", -500e-6, 100000);
+  ok &= runCase("device clock wraps", 200e-6, UINT32_C(0xffffffff) - 30000);
+  ok &= runReset();
+  return ok ? 0 : 1;
+}
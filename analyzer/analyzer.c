@@ -122,8 +122,11 @@ bool       showVersion   = true;
 bool       fixedTime     = false; // -fixtime in effect (test mode)
 bool       showSI        = false; // Output everything in strict SI units
 bool       showCamel     = false;
+bool       useDecoders   = true; // Use the keel-generated decoders for fixed-layout PGNs
 GeoFormats showGeo       = GEO_DD;
 
+static bool inlineNumbers = false; // The generated decoders may print numeric fields inline
+
 char *sep = " ";
 char  closingBraces[16]; // } and ] chars to close sentence in JSON mode, otherwise empty string
 
@@ -156,13 +159,24 @@ static bool            printField(const Field   *field,
 static void            printCanRaw(const RawMessage *msg);
 static void            showBuffers(void);
 static unsigned int    getMessageByteCount(const char *const msg);
+static void            attachPgnDecoders(void);
+static void            printInlineKey(const Field *field);
+static void            printInlineEmpty(const Field *field, int64_t exceptionValue);
+
+/* Straight-line decoders for the fixed-layout PGNs, generated by keel. They
+ * call printField() at constant offsets, or print numeric fields themselves
+ * through printInlineKey() and printInlineEmpty(), so they are included here,
+ * after those prototypes, rather than in pgn.h with the rest of the generated
+ * tables.
+ */
+#include PGN_DECODER_GENERATED
 
 static void usage(char **argv, char **av)
 {
   printf("Unknown or invalid argument %s\n", av[0]);
   printf("Usage: %s [[-raw] [-json [-empty] [-nv] [-camel]] [-data] [-debug] [-d] [-q] [-si] [-geo {dd|dm|dms}] "
          "-format <fmt> "
-         "[-src <src> | -dst <dst> | <pgn>]] ["
+         "[-src <src> | -dst <dst> | <pgn>]] [-stats] [-statsinterval <secs>] ["
 #ifndef SKIP_SETSYSTEMCLOCK
          "-clocksrc <src> | "
 #endif
@@ -187,12 +201,15 @@ static void usage(char **argv, char **av)
     printf("%s, ", RAW_FORMAT_STR[i]);
   }
   printf("\n");
+  printf("     -stats            Print statistics as JSON on stderr at the end of the input and on a #STATS line\n");
+  printf("     -statsinterval s  Also print statistics every s seconds; implies -stats\n");
   printf("     -version          Print the version of the program and quit\n");
   printf("\nThe following options are used to debug the analyzer:\n");
   printf("     -raw              Print the PGN in a format suitable to be fed to analyzer again (in standard raw format)\n");
   printf("     -data             Print the PGN three times: in hex, ascii and analyzed\n");
   printf("     -debug            Print raw value per field\n");
   printf("     -debugdata        Print raw value per pgn\n");
+  printf("     -generic          Decode every PGN with the generic field interpreter, not the generated decoders\n");
   printf("     -fixtime str      Print str as timestamp in logging\n");
   printf("\n");
   exit(1);
@@ -202,9 +219,10 @@ int main(int argc, char **argv)
 {
   int    r;
   char   msg[MAX_MSG_LINE_LENGTH];
-  FILE  *file = stdin;
-  int    ac   = argc;
-  char **av   = argv;
+  FILE  *file          = stdin;
+  int    ac            = argc;
+  char **av            = argv;
+  int    statsInterval = -1;
 
   setProgName(argv[0]);
 
@@ -240,6 +258,10 @@ int main(int argc, char **argv)
       showJsonEmpty = true;
       showAllBytes  = true;
     }
+    else if (strcasecmp(av[1], "-generic") == 0)
+    {
+      useDecoders = false;
+    }
     else if (strcasecmp(av[1], "-d") == 0)
     {
       setLogLevel(LOGLEVEL_DEBUG);
@@ -295,6 +317,16 @@ int main(int argc, char **argv)
     {
       showData = true;
     }
+    else if (strcasecmp(av[1], "-stats") == 0)
+    {
+      statsInterval = CB_MAX(statsInterval, 0);
+    }
+    else if (ac > 2 && strcasecmp(av[1], "-statsinterval") == 0)
+    {
+      statsInterval = CB_MAX(strtol(av[2], 0, 10), 0);
+      ac--;
+      av++;
+    }
     else if (ac > 2 && strcasecmp(av[1], "-fixtime") == 0)
     {
       setFixedTimestamp(av[2]);
@@ -398,11 +430,20 @@ int main(int argc, char **argv)
   fillLookups();
   fillFieldType(true);
   checkPgnList();
+  attachPgnDecoders();
+  if (statsInterval >= 0)
+  {
+    statsInit(statsInterval);
+  }
 
   while (fgets(msg, sizeof(msg) - 1, file))
   {
     RawMessage m;
 
+    if (statsEnabled)
+    {
+      statsTick(RAW_FORMAT_STR, ARRAY_SIZE(RAW_FORMAT_STR));
+    }
     if (*msg == 0 || *msg == '\r' || *msg == '\n' || *msg == '#')
     {
       if (*msg == '#')
@@ -411,6 +452,17 @@ int main(int argc, char **argv)
         {
           showBuffers();
         }
+        else if (strncmp(msg + 1, "STATS", STRSIZE("STATS")) == 0)
+        {
+          if (statsEnabled)
+          {
+            statsDump(RAW_FORMAT_STR, ARRAY_SIZE(RAW_FORMAT_STR));
+          }
+          else
+          {
+            logInfo("No statistics without -stats\n");
+          }
+        }
         else if (format == RAWFORMAT_UNKNOWN && strncmp(msg, CANBOAT_FORMAT_HEADER_PREFIX, STRSIZE(CANBOAT_FORMAT_HEADER_PREFIX)) == 0)
         {
           const char *fmt = msg + STRSIZE(CANBOAT_FORMAT_HEADER_PREFIX);
@@ -515,6 +567,7 @@ int main(int argc, char **argv)
 
     if (r == 0)
     {
+      stats.parsed[format]++;
       if (isMsgAllowed(&m))
       {
         printCanFormat(&m);
@@ -523,10 +576,15 @@ int main(int argc, char **argv)
     }
     else
     {
+      stats.parseErrors[format]++;
       logError("Unknown message error %d: '%s'\n", r, msg);
     }
   }
 
+  if (statsEnabled)
+  {
+    statsDump(RAW_FORMAT_STR, ARRAY_SIZE(RAW_FORMAT_STR));
+  }
   return 0;
 }
 
@@ -867,8 +925,10 @@ static void printCanFormat(RawMessage *msg)
     if (buffer == REASSEMBLY_BUFFER_SIZE)
     {
       logError("Out of reassembly buffers; ignoring PGN %u\n", msg->pgn);
+      stats.fastPacketDropped++;
       return;
     }
+    statsSlotTaken(&stats.fastPacketSlotsInUse, &stats.fastPacketSlotsPeak);
     p->used   = true;
     p->src    = msg->src;
     p->pgn    = msg->pgn;
@@ -885,6 +945,7 @@ static void printCanFormat(RawMessage *msg)
     if ((p->frames & (UINT32_C(1) << frame)) != 0)
     {
       logError("Received incomplete fast packet PGN %u from source %u\n", msg->pgn, msg->src);
+      stats.fastPacketIncomplete++;
       p->frames = 0;
     }
 
@@ -915,6 +976,7 @@ static void printCanFormat(RawMessage *msg)
       if (p->frames != 0 && allFrames != 1 && ((p->frames | UINT32_C(1)) & allFrames) == allFrames)
       {
         logError("Received incomplete fast packet PGN %u from source %u\n", msg->pgn, msg->src);
+        stats.fastPacketIncomplete++;
         p->frames = 0;
       }
       p->size      = size;
@@ -955,6 +1017,8 @@ static void printCanFormat(RawMessage *msg)
       printPgn(msg, p->data, p->size, showData, showJson);
       p->used   = false;
       p->frames = 0;
+      stats.fastPacketCompleted++;
+      stats.fastPacketSlotsInUse--;
     }
   }
 }
@@ -975,6 +1039,7 @@ static void handleIsoTpCm(const RawMessage *msg)
   if (msg->len == 0)
   {
     logError("ISO TP CM frame from source %u is empty; ignoring\n", msg->src);
+    stats.isoTpRejected++;
     return;
   }
 
@@ -988,6 +1053,8 @@ static void handleIsoTpCm(const RawMessage *msg)
       if (tpSlotBuffer[buffer].used && tpSlotBuffer[buffer].src == msg->src)
       {
         tpSlotBuffer[buffer].used = false;
+        stats.isoTpAborted++;
+        stats.isoTpSlotsInUse--;
       }
     }
     return;
@@ -1001,6 +1068,7 @@ static void handleIsoTpCm(const RawMessage *msg)
   if (msg->len < 8)
   {
     logError("ISO TP CM frame from source %u has %u bytes (need 8); ignoring\n", msg->src, msg->len);
+    stats.isoTpRejected++;
     return;
   }
 
@@ -1011,6 +1079,7 @@ static void handleIsoTpCm(const RawMessage *msg)
   if (packets == 0 || totalSize == 0 || totalSize > ISOTP_MAX_SIZE)
   {
     logError("ISO TP CM frame from source %u declares implausible size=%u packets=%u; ignoring\n", msg->src, totalSize, packets);
+    stats.isoTpRejected++;
     return;
   }
 
@@ -1036,8 +1105,14 @@ static void handleIsoTpCm(const RawMessage *msg)
     if (buffer == ISO_TP_SLOTS)
     {
       logError("Out of ISO TP reassembly slots; ignoring transfer from source %u\n", msg->src);
+      stats.isoTpDropped++;
       return;
     }
+    statsSlotTaken(&stats.isoTpSlotsInUse, &stats.isoTpSlotsPeak);
+  }
+  else
+  {
+    stats.isoTpRestarted++;
   }
 
   p            = &tpSlotBuffer[buffer];
@@ -1082,6 +1157,7 @@ static void handleIsoTpDt(const RawMessage *msg)
   if (msg->len == 0)
   {
     logError("ISO TP DT frame from source %u is empty; ignoring\n", msg->src);
+    stats.isoTpRejected++;
     return;
   }
 
@@ -1104,6 +1180,7 @@ static void handleIsoTpDt(const RawMessage *msg)
   if (sequence == 0 || sequence > p->packets)
   {
     logError("ISO TP DT frame from source %u has sequence %u out of range 1..%u; ignoring\n", msg->src, sequence, p->packets);
+    stats.isoTpRejected++;
     return;
   }
 
@@ -1153,6 +1230,8 @@ static void handleIsoTpDt(const RawMessage *msg)
   }
 
   p->used = false;
+  stats.isoTpCompleted++;
+  stats.isoTpSlotsInUse--;
 
   if (isTargetPgnAllowed(p->targetPgn))
   {
@@ -1281,6 +1360,68 @@ static void fillGlobalsBasedOnField(const Field *field, const uint8_t *data, siz
   }
 }
 
+/*
+ * Print a pre-rendered field key. The key starts with the separator that is
+ * by far the most common in its mode, so it normally goes out in one piece;
+ * any other separator replaces that first character.
+ */
+static void printFieldKey(const FieldKey *key)
+{
+  const char *s = getSep();
+
+  if (s[0] == key->str[0] && s[1] == '\0')
+  {
+    mappend(key->str, key->len);
+  }
+  else
+  {
+    mappend(s, strlen(s));
+    mappend(key->str + 1, key->len - 1);
+  }
+}
+
+/*
+ * The key of a numeric field that a generated decoder prints inline, as
+ * printField() would print it.
+ */
+static void printInlineKey(const Field *field)
+{
+  const FieldKey *key = &field->key[showCamel][showJson];
+
+  if (key->str != NULL)
+  {
+    printFieldKey(key);
+  }
+  else
+  {
+    const char *fieldName = (showCamel && field->camelName) ? field->camelName : field->name;
+
+    if (showJson)
+    {
+      mprintf("%s\"%s\":", getSep(), fieldName);
+    }
+    else
+    {
+      mprintf("%s %s = ", getSep(), fieldName);
+    }
+  }
+  sep = showJson ? "," : ";";
+}
+
+/*
+ * A numeric field that holds one of its sentinel values. In JSON mode
+ * without -empty printField() drops the field, key and all.
+ */
+static void printInlineEmpty(const Field *field, int64_t exceptionValue)
+{
+  if (showJson && !showJsonEmpty)
+  {
+    return;
+  }
+  printInlineKey(field);
+  printEmpty(field->name, exceptionValue);
+}
+
 static bool printField(const Field   *field,
                        const char    *fieldName,
                        const uint8_t *data,
@@ -1289,15 +1430,22 @@ static bool printField(const Field   *field,
                        size_t        *bits,
                        bool           allowKey)
 {
-  size_t bytes;
-  double resolution;
-  bool   r;
+  size_t          bytes;
+  double          resolution;
+  bool            r;
+  const FieldKey *key = NULL;
 
   if (fieldName == NULL)
   {
-    // Defensive only: both callers pass a name. Key on the mode, not on
-    // camelName presence - the generated tables set camelName everywhere.
+    // The field's own name, which fillFieldType() pre-rendered as a key.
+    // Key on the mode, not on camelName presence - the generated tables set
+    // camelName everywhere.
     fieldName = (showCamel && field->camelName) ? field->camelName : (char *) field->name;
+    key       = &field->key[showCamel][showJson];
+    if (key->str == NULL)
+    {
+      key = NULL;
+    }
   }
 
   resolution = field->resolution;
@@ -1362,19 +1510,22 @@ static bool printField(const Field   *field,
 
     if (field->ft->pf != fieldPrintVariable)
     {
-      if (showJson)
+      if (key != NULL)
+      {
+        printFieldKey(key);
+      }
+      else if (showJson)
       {
         mprintf("%s\"%s\":", getSep(), fieldName);
-        sep = ",";
-        if (showBytes || showJsonValue)
-        {
-          location2 = mlocation();
-        }
       }
       else
       {
         mprintf("%s %s = ", getSep(), fieldName);
-        sep = ";";
+      }
+      sep = showJson ? "," : ";";
+      if (showJson && (showBytes || showJsonValue))
+      {
+        location2 = mlocation();
       }
     }
     location3 = mlocation();
@@ -1444,15 +1595,20 @@ bool printPgn(const RawMessage *msg, const uint8_t *data, int length, bool showD
 {
   const Pgn *pgn;
 
-  size_t i;
-  bool   r;
-  size_t variableFields = 0; // How many variable fields remain (product of repetition count * # of fields)
-  char   ts[DATE_LENGTH];
+  size_t   i;
+  bool     r;
+  size_t   variableFields = 0; // How many variable fields remain (product of repetition count * # of fields)
+  char     ts[DATE_LENGTH];
+  uint64_t decodeStart = 0;
 
   if (msg == NULL)
   {
     return false;
   }
+  if (statsEnabled)
+  {
+    decodeStart = statsNow();
+  }
   normalizeTimestamp(msg->timestamp, ts, sizeof(ts));
   pgn = getMatchingPgn(msg->pgn, data, length);
   if (!pgn)
@@ -1535,6 +1691,10 @@ bool printPgn(const RawMessage *msg, const uint8_t *data, int length, bool showD
   }
   mprintf("\n");
 
+  if (statsEnabled)
+  {
+    statsDecoded(pgn, length, decodeStart, (r || !showJson) ? mlocation() : 0);
+  }
   if (r)
   {
     mwrite(stdout);
@@ -1550,6 +1710,7 @@ bool printPgn(const RawMessage *msg, const uint8_t *data, int length, bool showD
       mwrite(stdout);
     }
     mreset();
+    stats.analysisErrors++;
     logError("PGN %u analysis error\n", msg->pgn);
   }
 
@@ -1560,6 +1721,35 @@ bool printPgn(const RawMessage *msg, const uint8_t *data, int length, bool showD
   return r;
 }
 
+/*
+ * Wire the generated decoders into pgnList[]. Each entry names its PGN by
+ * index; the PGN number and id are checked too, so a decoder header that is
+ * out of step with pgn-generated-data.h aborts instead of printing some other
+ * PGN's fields.
+ */
+static void attachPgnDecoders(void)
+{
+  if (!useDecoders)
+  {
+    return;
+  }
+  for (size_t i = 0; i < ARRAY_SIZE(pgnDecoderList); i++)
+  {
+    const PgnDecoderEntry *e = &pgnDecoderList[i];
+
+    if (e->index >= pgnListSize || pgnList[e->index].pgn != e->pgn
+        || strcmp(pgnList[e->index].camelDescription, e->camelDescription) != 0)
+    {
+      logAbort("Generated decoder for PGN %u '%s' does not match the PGN list; regenerate\n", e->pgn, e->camelDescription);
+    }
+    pgnList[e->index].decoder = e->decoder;
+  }
+  // The inline numbers carry the display units of the default mode, and
+  // -bytes appends the raw bits to every field.
+  inlineNumbers = !showSI && !showBytes;
+  logDebug("Attached %zu generated PGN decoders\n", ARRAY_SIZE(pgnDecoderList));
+}
+
 extern bool printFields(const Pgn *pgn, const uint8_t *data, int length, bool showData, bool showJson, size_t *variableFields)
 {
   size_t  i;
@@ -1567,6 +1757,7 @@ extern bool printFields(const Pgn *pgn, const uint8_t *data, int length, bool sh
   size_t  startBit;
   int     repetition;
   char    fieldName[60];
+  char   *name;
   uint8_t variableFieldStart;
   uint8_t variableFieldCount;
 
@@ -1592,6 +1783,13 @@ extern bool printFields(const Pgn *pgn, const uint8_t *data, int length, bool sh
   g_length      = 0;
   g_lengthValid = false;
 
+  // Fixed-layout PGNs have every field at a known offset: the generated
+  // decoder prints the same output without the interpreter's bookkeeping.
+  if (pgn->decoder != NULL)
+  {
+    return (pgn->decoder)(pgn, data, length);
+  }
+
   for (i = 0, startBit = 0; (startBit >> 3) < length; i++)
   {
     const Field *field = &pgn->fieldList[i];
@@ -1658,26 +1856,26 @@ extern bool printFields(const Pgn *pgn, const uint8_t *data, int length, bool sh
       break;
     }
 
-    if (showCamel)
-    {
-      strcpy(fieldName, field->camelName ? field->camelName : field->name);
-    }
-    else
-    {
-      strcpy(fieldName, field->name);
-    }
-
     if (repetition >= 1 && !showJson)
     {
       // The separator follows the naming style in use ("windSpeed_2" vs
       // "Wind Speed 2"). This used to key on camelName presence as a cheap
       // proxy for the -camel mode, which broke down once every field
       // carries an explicit camelName (id) from the generated tables.
-      strcat(fieldName, showCamel ? "_" : " ");
-      sprintf(fieldName + strlen(fieldName), "%u", repetition);
+      snprintf(fieldName,
+               sizeof(fieldName),
+               "%s%s%u",
+               (showCamel && field->camelName) ? field->camelName : field->name,
+               showCamel ? "_" : " ",
+               repetition);
+      name = fieldName;
+    }
+    else
+    {
+      name = NULL; // printField() uses the field's pre-rendered key
     }
 
-    if (!printField(field, fieldName, data, length, startBit, &bits, true))
+    if (!printField(field, name, data, length, startBit, &bits, true))
     {
       r = false;
       break;
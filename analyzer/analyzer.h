@@ -63,14 +63,19 @@ limitations under the License.
 /* The two binaries carry different lookup tables: the marine one has no use
  * for the ISO 11783/J1939 manufacturer registry, and vice versa. keel emits
  * one file per tree; lookup.c and fieldtype.c are shared, so they include
- * whichever this build selected.
+ * whichever this build selected. The same goes for the lookup tables that
+ * lookup.c includes and the generated decoders that analyzer.c includes.
  */
 #ifdef J1939
 #define LOOKUP_GENERATED_DATA "lookup-j1939-generated-data.h"
+#define LOOKUP_TABLE_GENERATED_DATA "lookup-j1939-table-generated-data.h"
+#define PGN_DECODER_GENERATED "pgn-j1939-decoder-generated.h"
 #define lookupManufacturerCode lookupJ1939_MANUFACTURER_CODE
 #include "pgn-j1939.h"
 #else
 #define LOOKUP_GENERATED_DATA "lookup-generated-data.h"
+#define LOOKUP_TABLE_GENERATED_DATA "lookup-table-generated-data.h"
+#define PGN_DECODER_GENERATED "pgn-decoder-generated.h"
 #define lookupManufacturerCode lookupMANUFACTURER_CODE
 #include "pgn.h"
 #endif
@@ -102,6 +107,7 @@ extern bool         showJsonEmpty;
 extern bool         showJsonValue;
 extern bool         showBytes;
 extern bool         showSI;
+extern bool         fixedTime; // -fixtime in effect (test mode)
 extern GeoFormats   showGeo;
 extern char        *sep;
 extern char         closingBraces[16]; // } and ] chars to close sentence in JSON mode, otherwise empty string
@@ -124,5 +130,56 @@ extern size_t mlocation(void);
 extern void   mset(size_t location);
 extern char   mchr(size_t location);
 extern void   minsert(size_t location, const char *str);
+extern void   mappend(const char *str, size_t len);
 extern void   printEmpty(const char *name, int64_t exceptionValue);
 extern bool   adjustDataLenStart(const uint8_t **data, size_t *dataLen, size_t *startBit);
+
+/* stats.c */
+
+#define STATS_FORMATS (16)
+#define STATS_HISTOGRAM_BUCKETS (16) /* Decode time buckets: < 2^(7 + n) ns, the last one open ended */
+
+typedef struct
+{
+  uint64_t messages;
+  uint64_t bytes;
+  uint64_t decodeNs;
+  uint64_t decodeHistogram[STATS_HISTOGRAM_BUCKETS];
+} PgnStats;
+
+/* Runtime statistics, reported by -stats. The analyzer is single threaded, so
+ * these are plain counters without any locking. The counters are single
+ * increments and are always kept; the per-PGN counts and the decode timing,
+ * which cost a clock read per message, only when statsEnabled.
+ */
+typedef struct
+{
+  uint64_t  parsed[STATS_FORMATS]; // Indexed by input format
+  uint64_t  parseErrors[STATS_FORMATS];
+  uint64_t  decoded;
+  uint64_t  analysisErrors;
+  uint64_t  outputBytes;
+  uint64_t  fastPacketCompleted;
+  uint64_t  fastPacketIncomplete; // Partial messages discarded because a frame was repeated or a new message started
+  uint64_t  fastPacketDropped;    // Frames ignored because all reassembly slots were in use
+  size_t    fastPacketSlotsInUse;
+  size_t    fastPacketSlotsPeak;
+  uint64_t  isoTpCompleted;
+  uint64_t  isoTpAborted;
+  uint64_t  isoTpRestarted; // Open sessions replaced by a new TP.CM from the same source
+  uint64_t  isoTpDropped;   // Sessions ignored because all ISO TP slots were in use
+  uint64_t  isoTpRejected;  // Invalid TP.CM or TP.DT frames
+  size_t    isoTpSlotsInUse;
+  size_t    isoTpSlotsPeak;
+  PgnStats *pgn; // Indexed like pgnList[]
+} Stats;
+
+extern bool  statsEnabled;
+extern Stats stats;
+
+extern void     statsInit(int intervalSeconds);
+extern uint64_t statsNow(void);
+extern void     statsDecoded(const Pgn *pgn, size_t bytes, uint64_t startNs, size_t outputBytes);
+extern void     statsSlotTaken(size_t *inUse, size_t *peak);
+extern void     statsTick(const char *const *formatNames, size_t formatCount);
+extern void     statsDump(const char *const *formatNames, size_t formatCount);
@@ -197,6 +197,31 @@ static LookupInfo fieldtypeEnums[] = {
 #include LOOKUP_GENERATED_DATA
 };
 
+static const char *renderFieldKey(const char *format, const char *name, size_t *len)
+{
+  int   n   = snprintf(NULL, 0, format, name);
+  char *str = malloc(n + 1);
+
+  if (str == NULL)
+  {
+    die("Out of memory");
+  }
+  snprintf(str, n + 1, format, name);
+  *len = n;
+  return str;
+}
+
+static void fillFieldKeys(Field *f)
+{
+  for (int camel = 0; camel < 2; camel++)
+  {
+    const char *name = (camel && f->camelName != NULL) ? f->camelName : f->name;
+
+    f->key[camel][false].str = renderFieldKey("; %s = ", name, &f->key[camel][false].len);
+    f->key[camel][true].str  = renderFieldKey(",\"%s\":", name, &f->key[camel][true].len);
+  }
+}
+
 extern void fillFieldType(bool doUnitFixup)
 {
   // Percolate fields from physical quantity to fieldtype
@@ -438,6 +463,7 @@ extern void fillFieldType(bool doUnitFixup)
 
       f->pgn   = &pgnList[i];
       f->order = j + 1;
+      fillFieldKeys(f);
     }
     if (pgnList[i].type == PACKET_FAST && !ALLOW_PGN_FAST_PACKET(pgn))
     {
@@ -0,0 +1,279 @@
+/*
+
+Compares the keel-generated lookup tables (lookup-table-generated-data.h)
+against the switch statements that lookup.c used to expand the enumerations
+into, both for resolving a key and for rendering it as a JSON string.
+
+(C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+
+This file is part of CANboat.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include <time.h>
+
+#include "common.h"
+#include "lookup-table.h"
+
+#include "lookup-table-generated-data.h"
+
+#define BENCH_WARMUP (2)
+#define BENCH_REPEAT (5)
+#define BENCH_MIN_LOOKUPS (200000)  /* Per measurement, so short enumerations are still timed over milliseconds */
+#define BENCH_MAX_KEYS (4096)       /* Key space probed per enumeration: every key up to 2^bits, capped */
+
+/* The switch statements, as lookup.c generated them before the tables */
+
+#define BITS(x) (x)
+
+#define LOOKUP_TYPE(type, length)          \
+  static const char *switch##type(size_t val) \
+  {                                        \
+    switch (val)                           \
+    {
+#define LOOKUP(type, n, str) \
+  case n:                    \
+    return str;
+#define LOOKUP_TYPE_BITFIELD(type, length) LOOKUP_TYPE(type, length)
+#define LOOKUP_BITFIELD(type, n, str) LOOKUP(type, n, str)
+#define LOOKUP_TYPE_TRIPLET(type, length)                      \
+  static const char *switch##type(size_t val1, size_t val2) \
+  {                                                          \
+    switch (val1 * 256 + val2)                               \
+    {
+#define LOOKUP_TRIPLET(type, n1, n2, str) \
+  case n1 * 256 + n2:                     \
+    return str;
+/* Fieldtype lookups are not table driven; expand them to nothing that matters */
+#define LOOKUP_TYPE_FIELDTYPE(type, length)                \
+  static inline const char *unusedFieldtype##type(size_t val) \
+  {                                                        \
+    switch (val)                                           \
+    {
+#define LOOKUP_END \
+  }                \
+  return NULL;     \
+  }
+
+#include "lookup-generated-data.h"
+
+typedef struct BenchLookup
+{
+  const char        *name;
+  size_t             keys;
+  const char        *(*pair)(size_t val);
+  const char        *(*triplet)(size_t val1, size_t val2);
+  const LookupTable *table;
+} BenchLookup;
+
+#define LOOKUP_TYPE(type, length) {xstr(type), (size_t) 1 << (length), switch##type, NULL, &lookupTable##type},
+#define LOOKUP_TYPE_BITFIELD(type, length) {xstr(type), (length), switch##type, NULL, &lookupTable##type},
+#define LOOKUP_TYPE_TRIPLET(type, length) {xstr(type), (size_t) 1 << (length), NULL, switch##type, &lookupTable##type},
+
+static const BenchLookup benchLookupList[] = {
+#include "lookup-generated-data.h"
+};
+
+static const char *hotLookups[] = {"MANUFACTURER_CODE", "INDUSTRY_CODE", "DEVICE_CLASS", "DEVICE_FUNCTION", "YES_NO"};
+
+static volatile uintptr_t sink;
+
+static uint64_t nowNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+static size_t keyCount(const BenchLookup *l)
+{
+  size_t keys = CB_MIN(l->keys, BENCH_MAX_KEYS);
+
+  return l->triplet != NULL ? keys * 256 : keys;
+}
+
+static const char *switchLookup(const BenchLookup *l, size_t key)
+{
+  if (l->triplet == NULL)
+  {
+    return l->pair(key);
+  }
+  return l->triplet(key / 256, key % 256);
+}
+
+static const LookupEntry *tableLookup(const BenchLookup *l, size_t key)
+{
+  if (l->triplet == NULL)
+  {
+    return lookupTableFind(l->table, key);
+  }
+  return lookupTableFindTriplet(l->table, key / 256, key % 256);
+}
+
+/* Both implementations must name exactly the same keys, with the same strings. */
+static bool verify(const BenchLookup *l)
+{
+  for (size_t key = 0; key < keyCount(l); key++)
+  {
+    const char        *s = switchLookup(l, key);
+    const LookupEntry *e = tableLookup(l, key);
+
+    if ((s == NULL) != (e == NULL) || (s != NULL && (strcmp(s, e->name) != 0 || strlen(s) != e->nameLen)))
+    {
+      logError("%s: key %zu: switch '%s' != table '%s'\n", l->name, key, STRNULL(s), e != NULL ? e->name : "(null)");
+      return false;
+    }
+  }
+  return true;
+}
+
+typedef enum BenchMode
+{
+  BENCH_SWITCH,
+  BENCH_TABLE,
+  BENCH_SWITCH_JSON,
+  BENCH_TABLE_JSON
+} BenchMode;
+
+static void runOnce(const BenchLookup *l, BenchMode mode, size_t rounds, StringBuffer *sb)
+{
+  size_t    keys = keyCount(l);
+  uintptr_t acc  = 0;
+
+  for (size_t r = 0; r < rounds; r++)
+  {
+    sbEmpty(sb);
+    for (size_t key = 0; key < keys; key++)
+    {
+      switch (mode)
+      {
+        case BENCH_SWITCH:
+          acc += (uintptr_t) switchLookup(l, key);
+          break;
+        case BENCH_TABLE:
+          acc += (uintptr_t) tableLookup(l, key);
+          break;
+        case BENCH_SWITCH_JSON: {
+          const char *s = switchLookup(l, key);
+          if (s != NULL)
+          {
+            sbAppendFormat(sb, "\"%s\"", s);
+          }
+          break;
+        }
+        case BENCH_TABLE_JSON: {
+          const LookupEntry *e = tableLookup(l, key);
+          if (e != NULL)
+          {
+            sbAppendData(sb, e->json, e->jsonLen);
+          }
+          break;
+        }
+      }
+    }
+    acc += sbGetLength(sb);
+  }
+  sink = acc;
+}
+
+/* Best of BENCH_REPEAT runs, in ns per key, after BENCH_WARMUP untimed runs. */
+static double measure(const BenchLookup *l, BenchMode mode)
+{
+  StringBuffer sb     = sbNew;
+  size_t       keys   = keyCount(l);
+  size_t       rounds = CB_MAX(1, BENCH_MIN_LOOKUPS / keys);
+  double       best   = 0.0;
+
+  for (int i = 0; i < BENCH_WARMUP; i++)
+  {
+    runOnce(l, mode, rounds, &sb);
+  }
+  for (int i = 0; i < BENCH_REPEAT; i++)
+  {
+    uint64_t start = nowNs();
+    double   ns;
+
+    runOnce(l, mode, rounds, &sb);
+    ns = (double) (nowNs() - start) / (double) (rounds * keys);
+    if (i == 0 || ns < best)
+    {
+      best = ns;
+    }
+  }
+  sbClean(&sb);
+  return best;
+}
+
+static void report(const char *name, size_t keys, const double ns[4])
+{
+  printf("%-32s %6zu %9.2f %9.2f %7.2fx %9.2f %9.2f %7.2fx\n",
+         name,
+         keys,
+         ns[BENCH_SWITCH],
+         ns[BENCH_TABLE],
+         ns[BENCH_SWITCH] / ns[BENCH_TABLE],
+         ns[BENCH_SWITCH_JSON],
+         ns[BENCH_TABLE_JSON],
+         ns[BENCH_SWITCH_JSON] / ns[BENCH_TABLE_JSON]);
+}
+
+int main(int argc, char **argv)
+{
+  double total[4]  = {0};
+  size_t totalKeys = 0;
+  bool   all       = argc > 1 && strcmp(argv[1], "-all") == 0;
+
+  setProgName(argv[0]);
+
+  for (size_t i = 0; i < ARRAY_SIZE(benchLookupList); i++)
+  {
+    if (!verify(&benchLookupList[i]))
+    {
+      exit(1);
+    }
+  }
+  printf("%zu enumerations verified: tables and switch statements agree on every key\n\n", ARRAY_SIZE(benchLookupList));
+  printf("%-32s %6s %9s %9s %8s %9s %9s %8s\n", "", "", "resolve", "", "", "as JSON", "", "");
+  printf("%-32s %6s %9s %9s %8s %9s %9s %8s\n", "lookup (ns/key)", "keys", "switch", "table", "", "switch", "table", "");
+
+  for (size_t i = 0; i < ARRAY_SIZE(benchLookupList); i++)
+  {
+    const BenchLookup *l   = &benchLookupList[i];
+    bool               hot = all;
+    double             ns[4];
+
+    for (size_t h = 0; h < ARRAY_SIZE(hotLookups); h++)
+    {
+      hot |= strcmp(l->name, hotLookups[h]) == 0;
+    }
+    for (int mode = 0; mode < 4; mode++)
+    {
+      ns[mode] = measure(l, (BenchMode) mode);
+      total[mode] += ns[mode] * keyCount(l);
+    }
+    totalKeys += keyCount(l);
+    if (hot)
+    {
+      report(l->name, keyCount(l), ns);
+    }
+  }
+  for (int mode = 0; mode < 4; mode++)
+  {
+    total[mode] /= totalKeys;
+  }
+  report("all enumerations", totalKeys, total);
+  return 0;
+}
@@ -0,0 +1,2553 @@
+/* ==========================================================================
+*
+*   GENERATED FILE - DO NOT EDIT.
+*
+*   Every line below is written by `keel` from the YAML database in
+*   database/. Editing this file achieves nothing: the next `make generated`
+*   overwrites it, and CI fails the build on the resulting diff.
+*
+*   To change a PGN, a lookup or a field type, edit the YAML:
+*
+*       database/pgns/<pgn>-<id>.yaml     one file per PGN variant
+*       database/lookups/<NAME>.yaml      one file per enumeration
+*       database/fieldtypes.yaml          the field-type hierarchy
+*
+*   then regenerate and check it in:
+*
+*       make generated
+*
+*   See keel/DESIGN.md, or run `keel edit` for the browser editor.
+*
+* ==========================================================================
+*
+* (C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+* Part of CANboat; licensed under the Apache License, Version 2.0.
+*/
+
+static const LookupEntry lookupEntriesDEVICE_CLASS[] = {
+    {0, 21, 23, "Reserved for 2000 Use", "\"Reserved for 2000 Use\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {10, 12, 14, "System tools", "\"System tools\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {20, 14, 16, "Safety systems", "\"Safety systems\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {25, 19, 21, "Internetwork device", "\"Internetwork device\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {30, 23, 25, "Electrical Distribution", "\"Electrical Distribution\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {35, 21, 23, "Electrical Generation", "\"Electrical Generation\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {40, 29, 31, "Steering and Control surfaces", "\"Steering and Control surfaces\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {50, 10, 12, "Propulsion", "\"Propulsion\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {60, 10, 12, "Navigation", "\"Navigation\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {70, 13, 15, "Communication", "\"Communication\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {75, 30, 32, "Sensor Communication Interface", "\"Sensor Communication Interface\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {80, 31, 33, "Instrumentation/general systems", "\"Instrumentation/general systems\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {85, 20, 22, "External Environment", "\"External Environment\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {90, 20, 22, "Internal Environment", "\"Internal Environment\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {100, 40, 42, "Deck + cargo + fishing equipment systems", "\"Deck + cargo + fishing equipment systems\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {110, 15, 17, "Human Interface", "\"Human Interface\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {120, 7, 9, "Display", "\"Display\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {125, 13, 15, "Entertainment", "\"Entertainment\""}
+};
+const LookupTable lookupTableDEVICE_CLASS = {.kind = LOOKUP_TABLE_DENSE, .count = 126, .entries = lookupEntriesDEVICE_CLASS};
+
+static const LookupEntry lookupEntriesINDUSTRY_CODE[] = {
+    {0, 6, 8, "Global", "\"Global\""},
+    {1, 7, 9, "Highway", "\"Highway\""},
+    {2, 11, 13, "Agriculture", "\"Agriculture\""},
+    {3, 12, 14, "Construction", "\"Construction\""},
+    {4, 15, 17, "Marine Industry", "\"Marine Industry\""},
+    {5, 10, 12, "Industrial", "\"Industrial\""}
+};
+const LookupTable lookupTableINDUSTRY_CODE = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesINDUSTRY_CODE};
+
+static const LookupEntry lookupEntriesISO_COMMAND[] = {
+    {0, 3, 5, "ACK", "\"ACK\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {16, 3, 5, "RTS", "\"RTS\""},
+    {17, 3, 5, "CTS", "\"CTS\""},
+    {0},
+    {19, 3, 5, "EOM", "\"EOM\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {32, 3, 5, "BAM", "\"BAM\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {255, 5, 7, "Abort", "\"Abort\""}
+};
+const LookupTable lookupTableISO_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 256, .entries = lookupEntriesISO_COMMAND};
+
+static const LookupEntry lookupEntriesISO_CONTROL[] = {
+    {0, 3, 5, "ACK", "\"ACK\""},
+    {1, 3, 5, "NAK", "\"NAK\""},
+    {2, 13, 15, "Access Denied", "\"Access Denied\""},
+    {3, 12, 14, "Address Busy", "\"Address Busy\""}
+};
+const LookupTable lookupTableISO_CONTROL = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesISO_CONTROL};
+
+static const LookupEntry lookupEntriesJ1939_MANUFACTURER_CODE[] = {
+    {0, 43, 45, "For experimental or developmental use only.", "\"For experimental or developmental use only.\""},
+    {1, 67, 69, "Bendix Commercial Vehicle Systems LLC (formerly Allied Signal Inc.)", "\"Bendix Commercial Vehicle Systems LLC (formerly Allied Signal Inc.)\""},
+    {2, 26, 28, "Allison Transmission, Inc.", "\"Allison Transmission, Inc.\""},
+    {3, 25, 27, "Ametek, US Gauge Division", "\"Ametek, US Gauge Division\""},
+    {4, 13, 15, "Ametek-Dixson", "\"Ametek-Dixson\""},
+    {5, 8, 10, "AMP Inc.", "\"AMP Inc.\""},
+    {6, 23, 25, "Berifors Electronics AB", "\"Berifors Electronics AB\""},
+    {7, 10, 12, "Case Corp.", "\"Case Corp.\""},
+    {8, 16, 18, "Caterpillar Inc.", "\"Caterpillar Inc.\""},
+    {9, 14, 16, "Chrysler Corp.", "\"Chrysler Corp.\""},
+    {10, 40, 42, "Cummins Inc (formerly Cummins Engine Co)", "\"Cummins Inc (formerly Cummins Engine Co)\""},
+    {11, 19, 21, "Dearborn Group Inc.", "\"Dearborn Group Inc.\""},
+    {12, 34, 36, "Deere & Company, Precision Farming", "\"Deere & Company, Precision Farming\""},
+    {13, 17, 19, "Delco Electronics", "\"Delco Electronics\""},
+    {14, 26, 28, "Detroit Diesel Corporation", "\"Detroit Diesel Corporation\""},
+    {15, 23, 25, "DICKEY-john Corporation", "\"DICKEY-john Corporation\""},
+    {16, 10, 12, "Eaton Corp", "\"Eaton Corp\""},
+    {17, 26, 28, "Eaton Corp, Corp Res & Dev", "\"Eaton Corp, Corp Res & Dev\""},
+    {18, 29, 31, "Eaton Corp, Transmission Div.", "\"Eaton Corp, Transmission Div.\""},
+    {19, 34, 36, "Eaton Corp. Trucking Info Services", "\"Eaton Corp. Trucking Info Services\""},
+    {20, 9, 11, "Eaton Ltd", "\"Eaton Ltd\""},
+    {21, 31, 33, "Echlin Inc., Midland Brake Inc.", "\"Echlin Inc., Midland Brake Inc.\""},
+    {22, 45, 47, "Ford Motor Co., Electronic Concepts & Systems", "\"Ford Motor Co., Electronic Concepts & Systems\""},
+    {23, 27, 29, "Ford Motor Co., Heavy Truck", "\"Ford Motor Co., Heavy Truck\""},
+    {24, 32, 34, "Ford Motor Co., Vehicle Controls", "\"Ford Motor Co., Vehicle Controls\""},
+    {25, 60, 62, "Daimler Trucks North America LLC (formerly Freightliner LLC)", "\"Daimler Trucks North America LLC (formerly Freightliner LLC)\""},
+    {26, 43, 45, "General Motors Corp, Service Technology Grp", "\"General Motors Corp, Service Technology Grp\""},
+    {27, 3, 5, "GMC", "\"GMC\""},
+    {28, 15, 17, "Grote Ind. Inc.", "\"Grote Ind. Inc.\""},
+    {29, 16, 18, "Hino Motors Ltd.", "\"Hino Motors Ltd.\""},
+    {30, 16, 18, "Isuzu Motors Ltd", "\"Isuzu Motors Ltd\""},
+    {31, 13, 15, "J Pollak Corp", "\"J Pollak Corp\""},
+    {32, 22, 24, "Jacobs Vehicle Systems", "\"Jacobs Vehicle Systems\""},
+    {33, 10, 12, "John Deere", "\"John Deere\""},
+    {34, 16, 18, "Kelsey Hayes Co.", "\"Kelsey Hayes Co.\""},
+    {35, 18, 20, "Kenworth Truck Co.", "\"Kenworth Truck Co.\""},
+    {36, 10, 12, "Lucas Ind.", "\"Lucas Ind.\""},
+    {37, 16, 18, "Mack Trucks Inc.", "\"Mack Trucks Inc.\""},
+    {38, 28, 30, "Micro Processor Systems Inc.", "\"Micro Processor Systems Inc.\""},
+    {39, 14, 16, "Microfirm Inc.", "\"Microfirm Inc.\""},
+    {40, 18, 20, "Motorola AIEG Inc.", "\"Motorola AIEG Inc.\""},
+    {41, 13, 15, "Motorola Inc.", "\"Motorola Inc.\""},
+    {42, 118, 120, "International Truck and Engine Corporation - Engine Electronics (formerly Navistar Intl Trans Co., Engine Electronics)", "\"International Truck and Engine Corporation - Engine Electronics (formerly Navistar Intl Trans Co., Engine Electronics)\""},
+    {43, 101, 103, "International Truck and Engine Corporation - Vehicle Electronics (formerly Navistar Intl Trans Corp.)", "\"International Truck and Engine Corporation - Vehicle Electronics (formerly Navistar Intl Trans Corp.)\""},
+    {44, 20, 22, "Nippondenso Co. Ltd.", "\"Nippondenso Co. Ltd.\""},
+    {45, 6, 8, "PACCAR", "\"PACCAR\""},
+    {46, 52, 54, "Noregon Systems, LLC (formerly Noregon Systems, Inc)", "\"Noregon Systems, LLC (formerly Noregon Systems, Inc)\""},
+    {47, 22, 24, "Phillips Semiconductor", "\"Phillips Semiconductor\""},
+    {48, 15, 17, "Pollak Alphabet", "\"Pollak Alphabet\""},
+    {49, 15, 17, "RE America Inc.", "\"RE America Inc.\""},
+    {50, 17, 19, "Robert Bosch Corp", "\"Robert Bosch Corp\""},
+    {51, 17, 19, "Robert Bosch GmbH", "\"Robert Bosch GmbH\""},
+    {52, 55, 57, "Meritor Automotive, Inc. (formerly Rockwell Automotive)", "\"Meritor Automotive, Inc. (formerly Rockwell Automotive)\""},
+    {53, 79, 81, "Continental Automotive Systems US, Inc. (formerly Rockwell Land Transportation)", "\"Continental Automotive Systems US, Inc. (formerly Rockwell Land Transportation)\""},
+    {54, 13, 15, "Meritor Wabco", "\"Meritor Wabco\""},
+    {55, 17, 19, "Ryder System Inc.", "\"Ryder System Inc.\""},
+    {56, 4, 6, "SAIC", "\"SAIC\""},
+    {57, 61, 63, "Danfoss (formerly Sauer Sundstrand Co, then Sauer-Danfoss Co)", "\"Danfoss (formerly Sauer Sundstrand Co, then Sauer-Danfoss Co)\""},
+    {58, 24, 26, "SPX Corporation, OTC Div", "\"SPX Corporation, OTC Div\""},
+    {59, 8, 10, "VES Inc.", "\"VES Inc.\""},
+    {60, 31, 33, "Volvo Trucks North America Inc.", "\"Volvo Trucks North America Inc.\""},
+    {61, 17, 19, "Volvo Truck Corp.", "\"Volvo Truck Corp.\""},
+    {62, 5, 7, "Wabco", "\"Wabco\""},
+    {63, 18, 20, "ZF Industries Inc.", "\"ZF Industries Inc.\""},
+    {64, 66, 68, "Unused (formerly SpectraPrecision Laserplane, then SpectraPhysics)", "\"Unused (formerly SpectraPrecision Laserplane, then SpectraPhysics)\""},
+    {65, 20, 22, "MAN Nutzfahrzeuge AG", "\"MAN Nutzfahrzeuge AG\""},
+    {66, 42, 44, "John Deere Construction Equipment Division", "\"John Deere Construction Equipment Division\""},
+    {67, 66, 68, "John Deere Coffeyville Works (formerly Funk Manufacturing Company)", "\"John Deere Coffeyville Works (formerly Funk Manufacturing Company)\""},
+    {68, 6, 8, "Scania", "\"Scania\""},
+    {69, 18, 20, "Trimble Navigation", "\"Trimble Navigation\""},
+    {70, 17, 19, "Flex-coil Limited", "\"Flex-coil Limited\""},
+    {71, 23, 25, "Vansco Electronics Ltd.", "\"Vansco Electronics Ltd.\""},
+    {72, 16, 18, "Sisu Corporation", "\"Sisu Corporation\""},
+    {73, 16, 18, "LeTourneau, Inc.", "\"LeTourneau, Inc.\""},
+    {74, 25, 27, "Eaton Axle-Brake Division", "\"Eaton Axle-Brake Division\""},
+    {75, 33, 35, "Deere & Co, Agricultural Division", "\"Deere & Co, Agricultural Division\""},
+    {76, 51, 53, "unused (formerly Deere & Co, Construction Division)", "\"unused (formerly Deere & Co, Construction Division)\""},
+    {77, 25, 27, "Deere Power Systems Group", "\"Deere Power Systems Group\""},
+    {78, 34, 36, "Frank W. Murphy Manufacturing, Inc", "\"Frank W. Murphy Manufacturing, Inc\""},
+    {79, 39, 41, "Daimler Benz AG - Engine Division (PBM)", "\"Daimler Benz AG - Engine Division (PBM)\""},
+    {80, 15, 17, "Twin Disc, Inc.", "\"Twin Disc, Inc.\""},
+    {81, 19, 21, "Fire Research Corp.", "\"Fire Research Corp.\""},
+    {82, 54, 56, "Bobcat/Ingersoll-Rand (formerly Melroe/Ingersoll-Rand)", "\"Bobcat/Ingersoll-Rand (formerly Melroe/Ingersoll-Rand)\""},
+    {83, 61, 63, "Bendix VORAD Technologies (formerly Eaton VORAD Technologies)", "\"Bendix VORAD Technologies (formerly Eaton VORAD Technologies)\""},
+    {84, 22, 24, "New Holland UK Limited", "\"New Holland UK Limited\""},
+    {85, 9, 11, "Kohler Co", "\"Kohler Co\""},
+    {86, 23, 25, "C. E. Niehoff & Company", "\"C. E. Niehoff & Company\""},
+    {87, 33, 35, "J.C. Bamford Excavators Ltd (JCB)", "\"J.C. Bamford Excavators Ltd (JCB)\""},
+    {88, 50, 52, "Hemisphere GPS Inc (formerly Satloc Precision GPS)", "\"Hemisphere GPS Inc (formerly Satloc Precision GPS)\""},
+    {89, 38, 40, "Kverneland Group, Electronics Division", "\"Kverneland Group, Electronics Division\""},
+    {90, 21, 23, "Knorr-Bremse SfN GmbH", "\"Knorr-Bremse SfN GmbH\""},
+    {91, 31, 33, "BSG Bodensee Steuergeraete GmbH", "\"BSG Bodensee Steuergeraete GmbH\""},
+    {92, 27, 29, "Ag-Chem Equipment Co., Inc.", "\"Ag-Chem Equipment Co., Inc.\""},
+    {93, 28, 30, "Perkins Engines Company Ltd.", "\"Perkins Engines Company Ltd.\""},
+    {94, 46, 48, "CNH Industrial N.V. (formerly CNH Global N.V.)", "\"CNH Industrial N.V. (formerly CNH Global N.V.)\""},
+    {95, 33, 35, "Pacific Insight Electronics Corp.", "\"Pacific Insight Electronics Corp.\""},
+    {96, 19, 21, "Mech@tronic IT GmbH", "\"Mech@tronic IT GmbH\""},
+    {97, 26, 28, "Ag Leader Technology, Inc.", "\"Ag Leader Technology, Inc.\""},
+    {98, 51, 53, "PTx Trimble (formerly Mueller-Elektronik GmbH & Co)", "\"PTx Trimble (formerly Mueller-Elektronik GmbH & Co)\""},
+    {99, 37, 39, "International Transmissions Ltd (ITL)", "\"International Transmissions Ltd (ITL)\""},
+    {100, 14, 16, "VDO Technik AG", "\"VDO Technik AG\""},
+    {101, 8, 10, "Sensoria", "\"Sensoria\""},
+    {102, 31, 33, "AGCO (formerly AGCO GmbH & Co.)", "\"AGCO (formerly AGCO GmbH & Co.)\""},
+    {103, 65, 67, "CLAAS E-Systems GmbH (formerly CLAAS E-Systems KGaA mbH & Co. KG)", "\"CLAAS E-Systems GmbH (formerly CLAAS E-Systems KGaA mbH & Co. KG)\""},
+    {104, 66, 68, "CLAAS KGaA mbH (formerly CLAAS Selbstfahrende Erntemaschinen GmbH)", "\"CLAAS KGaA mbH (formerly CLAAS Selbstfahrende Erntemaschinen GmbH)\""},
+    {105, 28, 30, "Kiepe Elektrik GmbH & Co. KG", "\"Kiepe Elektrik GmbH & Co. KG\""},
+    {106, 26, 28, "BAE Systems Controls, Inc.", "\"BAE Systems Controls, Inc.\""},
+    {107, 34, 36, "Grimme Landmaschinen GmbH & Co. KG", "\"Grimme Landmaschinen GmbH & Co. KG\""},
+    {108, 81, 83, "PTx Trimble (formerly WTK-Elecktronik GmbH, now a duplicate entry; use MFR ID 98)", "\"PTx Trimble (formerly WTK-Elecktronik GmbH, now a duplicate entry; use MFR ID 98)\""},
+    {109, 58, 60, "TeeJet Technologies Denmark (formerly LH Technologies ApS)", "\"TeeJet Technologies Denmark (formerly LH Technologies ApS)\""},
+    {110, 16, 18, "EPIQ Sensor-Nite", "\"EPIQ Sensor-Nite\""},
+    {111, 79, 81, "Bernard Krone Holding SE & Co. KG (formerly Maschinenfabrik Bernard Krone GmbH)", "\"Bernard Krone Holding SE & Co. KG (formerly Maschinenfabrik Bernard Krone GmbH)\""},
+    {112, 7, 9, "MECALAC", "\"MECALAC\""},
+    {113, 16, 18, "Stress-Tek, Inc.", "\"Stress-Tek, Inc.\""},
+    {114, 15, 17, "EControls, Inc.", "\"EControls, Inc.\""},
+    {115, 36, 38, "NACCO Materials Handling Group, Inc.", "\"NACCO Materials Handling Group, Inc.\""},
+    {116, 20, 22, "BEELINE Technologies", "\"BEELINE Technologies\""},
+    {117, 19, 21, "HUSCO International", "\"HUSCO International\""},
+    {118, 11, 13, "Intron GmbH", "\"Intron GmbH\""},
+    {119, 14, 16, "IntegriNautics", "\"IntegriNautics\""},
+    {120, 18, 20, "RDS Technology Ltd", "\"RDS Technology Ltd\""},
+    {121, 36, 38, "HED (Hydro Electronic Devices, Inc.)", "\"HED (Hydro Electronic Devices, Inc.)\""},
+    {122, 31, 33, "FG Wilson (Engineering) Limited", "\"FG Wilson (Engineering) Limited\""},
+    {123, 15, 17, "Basler Electric", "\"Basler Electric\""},
+    {124, 16, 18, "Hydac Electronic", "\"Hydac Electronic\""},
+    {125, 29, 31, "Nevada Automotive Test Center", "\"Nevada Automotive Test Center\""},
+    {126, 11, 13, "Driver Tech", "\"Driver Tech\""},
+    {127, 11, 13, "Holland USA", "\"Holland USA\""},
+    {128, 29, 31, "Gerhard Duecker GmbH & Co. KG", "\"Gerhard Duecker GmbH & Co. KG\""},
+    {129, 26, 28, "OMNEX Control Systems Inc.", "\"OMNEX Control Systems Inc.\""},
+    {130, 30, 32, "Nido - Universal Machines B.V.", "\"Nido - Universal Machines B.V.\""},
+    {131, 14, 16, "ITT Industries", "\"ITT Industries\""},
+    {132, 18, 20, "Mulag-Fahrzeugwerk", "\"Mulag-Fahrzeugwerk\""},
+    {133, 22, 24, "Bucher Schoerling GmbH", "\"Bucher Schoerling GmbH\""},
+    {134, 19, 21, "Iris Technology Ltd", "\"Iris Technology Ltd\""},
+    {135, 29, 31, "Airmar Technology Corporation", "\"Airmar Technology Corporation\""},
+    {136, 11, 13, "Komatsu Ltd", "\"Komatsu Ltd\""},
+    {137, 8, 10, "Maretron", "\"Maretron\""},
+    {138, 30, 32, "Georg Fritzmeier GmbH & Co. KG", "\"Georg Fritzmeier GmbH & Co. KG\""},
+    {139, 52, 54, "Caterpillar Trimble Control Technologies (CTCT), LLC", "\"Caterpillar Trimble Control Technologies (CTCT), LLC\""},
+    {140, 26, 28, "Lowrance Electronics, Inc.", "\"Lowrance Electronics, Inc.\""},
+    {141, 22, 24, "Thales Navigation Ltd.", "\"Thales Navigation Ltd.\""},
+    {142, 44, 46, "TRW Automotive (Commercial Steering Systems)", "\"TRW Automotive (Commercial Steering Systems)\""},
+    {143, 21, 23, "W. Gmeiner GmbH & Co.", "\"W. Gmeiner GmbH & Co.\""},
+    {144, 14, 16, "Mercury Marine", "\"Mercury Marine\""},
+    {145, 15, 17, "MurCal Controls", "\"MurCal Controls\""},
+    {146, 19, 21, "Maxima Technologies", "\"Maxima Technologies\""},
+    {147, 24, 26, "Nautibus electronic GmbH", "\"Nautibus electronic GmbH\""},
+    {148, 21, 23, "Blue Water Data, Inc.", "\"Blue Water Data, Inc.\""},
+    {149, 6, 8, "Holset", "\"Holset\""},
+    {150, 10, 12, "Fleetguard", "\"Fleetguard\""},
+    {151, 22, 24, "Raven Industries, Inc.", "\"Raven Industries, Inc.\""},
+    {152, 20, 22, "elobau GmbH & Co. KG", "\"elobau GmbH & Co. KG\""},
+    {153, 38, 40, "Woodward, Industrial Controls Division", "\"Woodward, Industrial Controls Division\""},
+    {154, 22, 24, "Westerbeke Corporation", "\"Westerbeke Corporation\""},
+    {155, 20, 22, "Vetronix Corporation", "\"Vetronix Corporation\""},
+    {156, 23, 25, "ITT Industries - Cannon", "\"ITT Industries - Cannon\""},
+    {157, 11, 13, "ISSPRO Inc.", "\"ISSPRO Inc.\""},
+    {158, 37, 39, "Firestone Industrial Products Company", "\"Firestone Industrial Products Company\""},
+    {159, 20, 22, "NTech Industries Inc", "\"NTech Industries Inc\""},
+    {160, 4, 6, "Nido", "\"Nido\""},
+    {161, 25, 27, "Offshore Systems (UK) Ltd", "\"Offshore Systems (UK) Ltd\""},
+    {162, 22, 24, "Axiomatic Technologies", "\"Axiomatic Technologies\""},
+    {163, 8, 10, "BRP Inc.", "\"BRP Inc.\""},
+    {164, 63, 65, "MTU Friedrichshafen GmbH (formerly DaimlerChrysler Off-Highway)", "\"MTU Friedrichshafen GmbH (formerly DaimlerChrysler Off-Highway)\""},
+    {165, 15, 17, "CPAC Systems AB", "\"CPAC Systems AB\""},
+    {166, 64, 66, "John Deere Electronic Solutions (formerly Phoenix International)", "\"John Deere Electronic Solutions (formerly Phoenix International)\""},
+    {167, 18, 20, "JLG Industries Inc", "\"JLG Industries Inc\""},
+    {168, 7, 9, "Xantrex", "\"Xantrex\""},
+    {169, 24, 26, "Marlin Technologies Inc.", "\"Marlin Technologies Inc.\""},
+    {170, 29, 31, "Computronics Corporation Ltd.", "\"Computronics Corporation Ltd.\""},
+    {171, 80, 82, "Topcon Electronics GmbH & Co. KG (formerly Wachendorff Elektronik GmbH & Co. KG)", "\"Topcon Electronics GmbH & Co. KG (formerly Wachendorff Elektronik GmbH & Co. KG)\""},
+    {172, 45, 47, "Yanmar Co., Ltd. (formerly Yanmar Marine USA)", "\"Yanmar Co., Ltd. (formerly Yanmar Marine USA)\""},
+    {173, 11, 13, "Ryeso, Inc.", "\"Ryeso, Inc.\""},
+    {174, 14, 16, "AB Volvo Penta", "\"AB Volvo Penta\""},
+    {175, 24, 26, "Veris Technologies, Inc.", "\"Veris Technologies, Inc.\""},
+    {176, 16, 18, "Moritz Aerospace", "\"Moritz Aerospace\""},
+    {177, 29, 31, "Diagnostic Systems Associates", "\"Diagnostic Systems Associates\""},
+    {178, 64, 66, "Continental Automotive GmbH (formerly Siemens VDO Automotive AG)", "\"Continental Automotive GmbH (formerly Siemens VDO Automotive AG)\""},
+    {179, 77, 79, "TeeJet Technologies Springfield (formerly Midwest Technologies Illinois, LLC)", "\"TeeJet Technologies Springfield (formerly Midwest Technologies Illinois, LLC)\""},
+    {180, 19, 21, "Smart Power Systems", "\"Smart Power Systems\""},
+    {181, 17, 19, "Coretronics, Inc.", "\"Coretronics, Inc.\""},
+    {182, 32, 34, "Vehicle Systems Engineering B.V.", "\"Vehicle Systems Engineering B.V.\""},
+    {183, 17, 19, "KDS Controls, Inc", "\"KDS Controls, Inc\""},
+    {184, 15, 17, "EIA Electronics", "\"EIA Electronics\""},
+    {185, 35, 37, "Beede Electrical Instrument Company", "\"Beede Electrical Instrument Company\""},
+    {186, 13, 15, "Altronic, Inc", "\"Altronic, Inc\""},
+    {187, 9, 11, "Air-Weigh", "\"Air-Weigh\""},
+    {188, 8, 10, "EMP Corp", "\"EMP Corp\""},
+    {189, 8, 10, "QUALCOMM", "\"QUALCOMM\""},
+    {190, 21, 23, "Hella KGaA Hueck & Co", "\"Hella KGaA Hueck & Co\""},
+    {191, 43, 45, "XRS Corporation (formerly XATA Corporation)", "\"XRS Corporation (formerly XATA Corporation)\""},
+    {192, 7, 9, "Floscan", "\"Floscan\""},
+    {193, 15, 17, "Jeppesen Marine", "\"Jeppesen Marine\""},
+    {194, 19, 21, "TriMark Corporation", "\"TriMark Corporation\""},
+    {195, 23, 25, "General Engine Products", "\"General Engine Products\""},
+    {196, 19, 21, "LEMKEN GmbH & Co KG", "\"LEMKEN GmbH & Co KG\""},
+    {197, 21, 23, "Mechron Power Systems", "\"Mechron Power Systems\""},
+    {198, 28, 30, "Mystic Valley Communications", "\"Mystic Valley Communications\""},
+    {199, 33, 35, "ACTIA Group (formerly Actia Corp)", "\"ACTIA Group (formerly Actia Corp)\""},
+    {200, 10, 12, "MGM Brakes", "\"MGM Brakes\""},
+    {201, 25, 27, "Disenos y Tecnologia S.A.", "\"Disenos y Tecnologia S.A.\""},
+    {202, 23, 25, "Curtis Instruments, Inc", "\"Curtis Instruments, Inc\""},
+    {203, 14, 16, "MILtronik GmbH", "\"MILtronik GmbH\""},
+    {204, 21, 23, "The Morey Corporation", "\"The Morey Corporation\""},
+    {205, 20, 22, "SmarTire Systems Inc", "\"SmarTire Systems Inc\""},
+    {206, 9, 11, "port GmbH", "\"port GmbH\""},
+    {207, 16, 18, "Otto Engineering", "\"Otto Engineering\""},
+    {208, 22, 24, "Drew Technologies, Inc", "\"Drew Technologies, Inc\""},
+    {209, 28, 30, "Bell Equip. Co. SA (PTY) LTD", "\"Bell Equip. Co. SA (PTY) LTD\""},
+    {210, 12, 14, "Iteris, Inc.", "\"Iteris, Inc.\""},
+    {211, 9, 11, "DNA Group", "\"DNA Group\""},
+    {212, 26, 28, "Sure Power Industries, Inc", "\"Sure Power Industries, Inc\""},
+    {213, 16, 18, "CNH Belgium N.V.", "\"CNH Belgium N.V.\""},
+    {214, 18, 20, "MC elettronica Srl", "\"MC elettronica Srl\""},
+    {215, 32, 34, "Aetna Engineering/Fireboy-Xintex", "\"Aetna Engineering/Fireboy-Xintex\""},
+    {216, 17, 19, "Paneltronics Inc.", "\"Paneltronics Inc.\""},
+    {217, 41, 43, "RM Michaelides Software & Elektronik GmbH", "\"RM Michaelides Software & Elektronik GmbH\""},
+    {218, 26, 28, "Gits Manufacturing Company", "\"Gits Manufacturing Company\""},
+    {219, 17, 19, "Cat OEM Solutions", "\"Cat OEM Solutions\""},
+    {220, 40, 42, "Beede Electrical Instrument Company, Inc", "\"Beede Electrical Instrument Company, Inc\""},
+    {221, 3, 5, "SiE", "\"SiE\""},
+    {222, 27, 29, "Generac Power Systems, Inc.", "\"Generac Power Systems, Inc.\""},
+    {223, 24, 26, "Vaueo Retarder Co., Ltd.", "\"Vaueo Retarder Co., Ltd.\""},
+    {224, 18, 20, "EMMI Network, S.L.", "\"EMMI Network, S.L.\""},
+    {225, 3, 5, "SKF", "\"SKF\""},
+    {226, 24, 26, "Monaco Coach Corporation", "\"Monaco Coach Corporation\""},
+    {227, 15, 17, "Lykketronic A/S", "\"Lykketronic A/S\""},
+    {228, 39, 41, "Unused (formerly ZF Marine Electronics)", "\"Unused (formerly ZF Marine Electronics)\""},
+    {229, 25, 27, "Garmin International Inc.", "\"Garmin International Inc.\""},
+    {230, 19, 21, "Saucon Technologies", "\"Saucon Technologies\""},
+    {231, 32, 34, "Topcon Positioning Systems, Inc.", "\"Topcon Positioning Systems, Inc.\""},
+    {232, 23, 25, "TSD Integrated Controls", "\"TSD Integrated Controls\""},
+    {233, 31, 33, "Yacht Monitoring Solutions Inc.", "\"Yacht Monitoring Solutions Inc.\""},
+    {234, 23, 25, "Mondial electronic GmbH", "\"Mondial electronic GmbH\""},
+    {235, 51, 53, "SailorMade Marine Telemetry - Tetra Technology Ltd.", "\"SailorMade Marine Telemetry - Tetra Technology Ltd.\""},
+    {236, 31, 33, "NORAC Systems International Inc", "\"NORAC Systems International Inc\""},
+    {237, 22, 24, "Agtron Enterprises Inc", "\"Agtron Enterprises Inc\""},
+    {238, 21, 23, "ZF Friedrichshafen AG", "\"ZF Friedrichshafen AG\""},
+    {239, 18, 20, "May & Scofield Ltd", "\"May & Scofield Ltd\""},
+    {240, 10, 12, "Vanair Mfg", "\"Vanair Mfg\""},
+    {241, 24, 26, "Schneider Automation SAS", "\"Schneider Automation SAS\""},
+    {242, 20, 22, "Kokusandenki Co. Ltd", "\"Kokusandenki Co. Ltd\""},
+    {243, 11, 13, "eRide, Inc.", "\"eRide, Inc.\""},
+    {244, 12, 14, "Techno-Matic", "\"Techno-Matic\""},
+    {245, 24, 26, "Capstan Ag Systems, Inc.", "\"Capstan Ag Systems, Inc.\""},
+    {246, 12, 14, "Class 1, Inc", "\"Class 1, Inc\""},
+    {247, 6, 8, "ePULSE", "\"ePULSE\""},
+    {248, 47, 49, "Cooper Standard Automotive Active Systems Group", "\"Cooper Standard Automotive Active Systems Group\""},
+    {249, 14, 16, "Schaltbau GmbH", "\"Schaltbau GmbH\""},
+    {250, 10, 12, "Kuhn Group", "\"Kuhn Group\""},
+    {251, 46, 48, "German Agricultural Society, Test Center (DLG)", "\"German Agricultural Society, Test Center (DLG)\""},
+    {252, 29, 31, "Sensor-Technik Wiedemann GmbH", "\"Sensor-Technik Wiedemann GmbH\""},
+    {253, 22, 24, "Mobile Control Systems", "\"Mobile Control Systems\""},
+    {254, 10, 12, "GE Sensing", "\"GE Sensing\""},
+    {255, 11, 13, "MEAS France", "\"MEAS France\""},
+    {256, 20, 22, "Tyco Electronics AMP", "\"Tyco Electronics AMP\""},
+    {257, 20, 22, "Honda Motor Co., Ltd", "\"Honda Motor Co., Ltd\""},
+    {258, 4, 6, "ARAG", "\"ARAG\""},
+    {259, 41, 43, "Bucher Automation AG (formerly Jetter AG)", "\"Bucher Automation AG (formerly Jetter AG)\""},
+    {260, 33, 35, "Reichhardt GmbH Steuerungstechnik", "\"Reichhardt GmbH Steuerungstechnik\""},
+    {261, 19, 21, "Red Dot Corporation", "\"Red Dot Corporation\""},
+    {262, 15, 17, "HydraForce, Inc", "\"HydraForce, Inc\""},
+    {263, 4, 6, "IMMI", "\"IMMI\""},
+    {264, 8, 10, "Autolync", "\"Autolync\""},
+    {265, 27, 29, "MTS Sensor Technologie GmbH", "\"MTS Sensor Technologie GmbH\""},
+    {266, 34, 36, "International Thermal Research Ltd", "\"International Thermal Research Ltd\""},
+    {267, 22, 24, "Red Lion Controls, Inc", "\"Red Lion Controls, Inc\""},
+    {268, 21, 23, "Accurate Technologies", "\"Accurate Technologies\""},
+    {269, 43, 45, "Saft America Inc., Space & Defense Division", "\"Saft America Inc., Space & Defense Division\""},
+    {270, 7, 9, "Tennant", "\"Tennant\""},
+    {271, 11, 13, "Cole Hersee", "\"Cole Hersee\""},
+    {272, 34, 36, "Gross Mechanical Laboratories, Inc", "\"Gross Mechanical Laboratories, Inc\""},
+    {273, 23, 25, "Active Research Limited", "\"Active Research Limited\""},
+    {274, 23, 25, "LTW Technology Co., LTD", "\"LTW Technology Co., LTD\""},
+    {275, 18, 20, "Navico Egersund AS", "\"Navico Egersund AS\""},
+    {276, 24, 26, "Aqua-Hot Heating Systems", "\"Aqua-Hot Heating Systems\""},
+    {277, 14, 16, "LHP Telematics", "\"LHP Telematics\""},
+    {278, 18, 20, "Takata Electronics", "\"Takata Electronics\""},
+    {279, 12, 14, "Geometris LP", "\"Geometris LP\""},
+    {280, 24, 26, "Leica Geosystems Pty Ltd", "\"Leica Geosystems Pty Ltd\""},
+    {281, 23, 25, "Precision Governors LLC", "\"Precision Governors LLC\""},
+    {282, 33, 35, "Medallion Instrumentation Systems", "\"Medallion Instrumentation Systems\""},
+    {283, 21, 23, "CWF Hamilton & Co Ltd", "\"CWF Hamilton & Co Ltd\""},
+    {284, 17, 19, "Mobile Tech Chile", "\"Mobile Tech Chile\""},
+    {285, 17, 19, "Sea Recovery Corp", "\"Sea Recovery Corp\""},
+    {286, 10, 12, "Coelmo srl", "\"Coelmo srl\""},
+    {287, 21, 23, "NTech Industries, Inc", "\"NTech Industries, Inc\""},
+    {288, 33, 35, "Mitsubishi FUSO Truck & Bus Corp.", "\"Mitsubishi FUSO Truck & Bus Corp.\""},
+    {289, 6, 8, "Watlow", "\"Watlow\""},
+    {290, 12, 14, "Kuebler GmbH", "\"Kuebler GmbH\""},
+    {291, 34, 36, "Groeneveld Transport Efficiency BV", "\"Groeneveld Transport Efficiency BV\""},
+    {292, 27, 29, "IKUSI - Angel Iglesias S.A.", "\"IKUSI - Angel Iglesias S.A.\""},
+    {293, 21, 23, "Spyder Controls Corp.", "\"Spyder Controls Corp.\""},
+    {294, 13, 15, "Grayhill Inc.", "\"Grayhill Inc.\""},
+    {295, 10, 12, "BEP Marine", "\"BEP Marine\""},
+    {296, 19, 21, "micro dynamics GmbH", "\"micro dynamics GmbH\""},
+    {297, 17, 19, "Zonar Systems Inc", "\"Zonar Systems Inc\""},
+    {298, 18, 20, "Holley Performance", "\"Holley Performance\""},
+    {299, 5, 7, "Rauch", "\"Rauch\""},
+    {300, 25, 27, "Systron Donner Automotive", "\"Systron Donner Automotive\""},
+    {301, 34, 36, "Parker Hannifin (UK) Ltd FDE group", "\"Parker Hannifin (UK) Ltd FDE group\""},
+    {302, 21, 23, "Nissin Kogyo Co., LTD", "\"Nissin Kogyo Co., LTD\""},
+    {303, 15, 17, "CTS Corporation", "\"CTS Corporation\""},
+    {304, 11, 13, "EmpirBus AB", "\"EmpirBus AB\""},
+    {305, 11, 13, "NovAtel Inc", "\"NovAtel Inc\""},
+    {306, 17, 19, "Sleipner Motor AB", "\"Sleipner Motor AB\""},
+    {307, 16, 18, "MAS Technologies", "\"MAS Technologies\""},
+    {308, 6, 8, "Cyntrx", "\"Cyntrx\""},
+    {309, 35, 37, "Krauss-Maffei Wegmann GmbH & Co. KG", "\"Krauss-Maffei Wegmann GmbH & Co. KG\""},
+    {310, 11, 13, "TECNORD srl", "\"TECNORD srl\""},
+    {311, 22, 24, "Patrick Power Products", "\"Patrick Power Products\""},
+    {312, 15, 17, "Lectronix, Inc.", "\"Lectronix, Inc.\""},
+    {313, 23, 25, "Ilmor Engineering, Inc.", "\"Ilmor Engineering, Inc.\""},
+    {314, 8, 10, "CSM GmbH", "\"CSM GmbH\""},
+    {315, 17, 19, "Icom Incorporated", "\"Icom Incorporated\""},
+    {316, 16, 18, "ITT Flow Control", "\"ITT Flow Control\""},
+    {317, 15, 17, "Navtronics Bvba", "\"Navtronics Bvba\""},
+    {318, 8, 10, "SAT Plan", "\"SAT Plan\""},
+    {319, 12, 14, "Cadec Global", "\"Cadec Global\""},
+    {320, 38, 40, "Miedema Landbouwwerktuigenfabriek B.V.", "\"Miedema Landbouwwerktuigenfabriek B.V.\""},
+    {321, 28, 30, "Ultra Electronics, Electrics", "\"Ultra Electronics, Electrics\""},
+    {322, 15, 17, "MICHENKA s.r.o.", "\"MICHENKA s.r.o.\""},
+    {323, 33, 35, "Mobileye Vision Technologies Ltd.", "\"Mobileye Vision Technologies Ltd.\""},
+    {324, 19, 21, "Snap-on Diagnostics", "\"Snap-on Diagnostics\""},
+    {325, 40, 42, "ASM Automation Sensorik Messtechnik GmbH", "\"ASM Automation Sensorik Messtechnik GmbH\""},
+    {326, 19, 21, "Akron Brass Company", "\"Akron Brass Company\""},
+    {327, 11, 13, "Sonceboz SA", "\"Sonceboz SA\""},
+    {328, 20, 22, "Qwerty Electronik AB", "\"Qwerty Electronik AB\""},
+    {329, 8, 10, "Deif A/S", "\"Deif A/S\""},
+    {330, 27, 29, "Kidde Aerospace and Defense", "\"Kidde Aerospace and Defense\""},
+    {331, 12, 14, "Horton, Inc.", "\"Horton, Inc.\""},
+    {332, 15, 17, "HWH Corporation", "\"HWH Corporation\""},
+    {333, 63, 65, "Link Manufacturing, Ltd. (formerly Hadley Products Corporation)", "\"Link Manufacturing, Ltd. (formerly Hadley Products Corporation)\""},
+    {334, 15, 17, "Takata-Petri AG", "\"Takata-Petri AG\""},
+    {335, 16, 18, "Evo Electric Ltd", "\"Evo Electric Ltd\""},
+    {336, 10, 12, "APE s.r.o.", "\"APE s.r.o.\""},
+    {337, 14, 16, "Carraro S.p.A.", "\"Carraro S.p.A.\""},
+    {338, 11, 13, "GRAF-SYTECO", "\"GRAF-SYTECO\""},
+    {339, 29, 31, "Competence Center ISOBUS e.V.", "\"Competence Center ISOBUS e.V.\""},
+    {340, 14, 16, "Continental AG", "\"Continental AG\""},
+    {341, 16, 18, "Boning GmbH & Co", "\"Boning GmbH & Co\""},
+    {342, 19, 21, "THOMAS MAGNETE GmbH", "\"THOMAS MAGNETE GmbH\""},
+    {343, 12, 14, "Baumer Group", "\"Baumer Group\""},
+    {344, 18, 20, "Parvus Corporation", "\"Parvus Corporation\""},
+    {345, 26, 28, "Korean Maritime University", "\"Korean Maritime University\""},
+    {346, 17, 19, "Control Solutions", "\"Control Solutions\""},
+    {347, 9, 11, "Honeywell", "\"Honeywell\""},
+    {348, 24, 26, "Amazonen Werke H. Dreyer", "\"Amazonen Werke H. Dreyer\""},
+    {349, 11, 13, "Suonentieto", "\"Suonentieto\""},
+    {350, 33, 35, "Noris Marine Systems GmbH & Co KG", "\"Noris Marine Systems GmbH & Co KG\""},
+    {351, 15, 17, "Thrane & Thrane", "\"Thrane & Thrane\""},
+    {352, 28, 30, "SAME DEUTZ-FAHR GROUP S.p.A.", "\"SAME DEUTZ-FAHR GROUP S.p.A.\""},
+    {353, 25, 27, "Hegemon Electronics, Inc.", "\"Hegemon Electronics, Inc.\""},
+    {354, 11, 13, "Junkkari OY", "\"Junkkari OY\""},
+    {355, 29, 31, "Mastervolt International B.V.", "\"Mastervolt International B.V.\""},
+    {356, 29, 31, "Fischer Panda Generators, Inc", "\"Fischer Panda Generators, Inc\""},
+    {357, 23, 25, "Hardi International A/S", "\"Hardi International A/S\""},
+    {358, 19, 21, "Victron Energy B.V.", "\"Victron Energy B.V.\""},
+    {359, 20, 22, "Ludwig Bergmann GmbH", "\"Ludwig Bergmann GmbH\""},
+    {360, 80, 82, "HJS Emission Technology GmbH & Co KG (formerly HJS Fahrzeugtechnik GmbH & Co KG)", "\"HJS Emission Technology GmbH & Co KG (formerly HJS Fahrzeugtechnik GmbH & Co KG)\""},
+    {361, 6, 8, "InMach", "\"InMach\""},
+    {362, 76, 78, "Poettinger Landtechnik GmbH (formerly Alois Poettinger Maschinenfabrik GmbH)", "\"Poettinger Landtechnik GmbH (formerly Alois Poettinger Maschinenfabrik GmbH)\""},
+    {363, 10, 12, "BEI Duncan", "\"BEI Duncan\""},
+    {364, 17, 19, "OEM Controls Inc.", "\"OEM Controls Inc.\""},
+    {365, 14, 16, "Digi-Star, LLC", "\"Digi-Star, LLC\""},
+    {366, 13, 15, "Viewnyx Corp.", "\"Viewnyx Corp.\""},
+    {367, 19, 21, "Fliegl Agrartechnik", "\"Fliegl Agrartechnik\""},
+    {368, 20, 22, "HANSENHOF_electronic", "\"HANSENHOF_electronic\""},
+    {369, 28, 30, "Power Torque Engineering Ltd", "\"Power Torque Engineering Ltd\""},
+    {370, 21, 23, "Rolls-Royce Marine AS", "\"Rolls-Royce Marine AS\""},
+    {371, 23, 25, "Heinzmann GmbH & Co. KG", "\"Heinzmann GmbH & Co. KG\""},
+    {372, 6, 8, "Delphi", "\"Delphi\""},
+    {373, 22, 24, "Electronic Design Inc.", "\"Electronic Design Inc.\""},
+    {374, 21, 23, "Northern Lights, Inc.", "\"Northern Lights, Inc.\""},
+    {375, 22, 24, "Williams Controls Inc.", "\"Williams Controls Inc.\""},
+    {376, 12, 14, "Quake Global", "\"Quake Global\""},
+    {377, 19, 21, "ifm electronic gmbh", "\"ifm electronic gmbh\""},
+    {378, 27, 29, "Glendinning Marine Products", "\"Glendinning Marine Products\""},
+    {379, 20, 22, "Yamabiko Corporation", "\"Yamabiko Corporation\""},
+    {380, 26, 28, "Suntech International Ltd.", "\"Suntech International Ltd.\""},
+    {381, 5, 7, "B & G", "\"B & G\""},
+    {382, 51, 53, "National Agriculture and Food Research Organization", "\"National Agriculture and Food Research Organization\""},
+    {383, 14, 16, "MCL Industries", "\"MCL Industries\""},
+    {384, 12, 14, "Camano Light", "\"Camano Light\""},
+    {385, 34, 36, "Johnson Outdoor Marine Electronics", "\"Johnson Outdoor Marine Electronics\""},
+    {386, 19, 21, "JLG Automation BVBA", "\"JLG Automation BVBA\""},
+    {387, 22, 24, "Orscheln Products, LLC", "\"Orscheln Products, LLC\""},
+    {388, 14, 16, "Innomatix, LLC", "\"Innomatix, LLC\""},
+    {389, 41, 43, "Benchmark Electronics, Minnesota Division", "\"Benchmark Electronics, Minnesota Division\""},
+    {390, 12, 14, "Partech Inc.", "\"Partech Inc.\""},
+    {391, 35, 37, "Electronic Design for Industry, Inc", "\"Electronic Design for Industry, Inc\""},
+    {392, 27, 29, "Tianyuan Technology Co Ltd.", "\"Tianyuan Technology Co Ltd.\""},
+    {393, 16, 18, "Harvest Tec, Inc", "\"Harvest Tec, Inc\""},
+    {394, 21, 23, "Capi 2 Nederland B.V.", "\"Capi 2 Nederland B.V.\""},
+    {395, 13, 15, "GENTEC S.R.L.", "\"GENTEC S.R.L.\""},
+    {396, 14, 16, "Beyond Measure", "\"Beyond Measure\""},
+    {397, 18, 20, "Sanyo-kiki Co Ltd.", "\"Sanyo-kiki Co Ltd.\""},
+    {398, 20, 22, "Hilite International", "\"Hilite International\""},
+    {399, 17, 19, "ISEKI & Co., Ltd.", "\"ISEKI & Co., Ltd.\""},
+    {400, 14, 16, "Livorsi Marine", "\"Livorsi Marine\""},
+    {401, 13, 15, "Torqeedo GmbH", "\"Torqeedo GmbH\""},
+    {402, 20, 22, "Simma Software, Inc.", "\"Simma Software, Inc.\""},
+    {403, 19, 21, "Trackwell ADS, Inc.", "\"Trackwell ADS, Inc.\""},
+    {404, 18, 20, "Com Nav Marine Ltd", "\"Com Nav Marine Ltd\""},
+    {405, 14, 16, "Wema System AS", "\"Wema System AS\""},
+    {406, 20, 22, "Vecima Networks Inc.", "\"Vecima Networks Inc.\""},
+    {407, 22, 24, "Comtech Mobile Datacom", "\"Comtech Mobile Datacom\""},
+    {408, 18, 20, "Corvus Energy Ltd.", "\"Corvus Energy Ltd.\""},
+    {409, 17, 19, "Transfluid S.r.L.", "\"Transfluid S.r.L.\""},
+    {410, 25, 27, "COBO S.p.A. Divisione 3B6", "\"COBO S.p.A. Divisione 3B6\""},
+    {411, 26, 28, "Hy-Drive Technologies Ltd.", "\"Hy-Drive Technologies Ltd.\""},
+    {412, 21, 23, "WebTech Wireless Inc.", "\"WebTech Wireless Inc.\""},
+    {413, 21, 23, "Datapross Nijbroek bv", "\"Datapross Nijbroek bv\""},
+    {414, 27, 29, "Cattron Group International", "\"Cattron Group International\""},
+    {415, 24, 26, "Valid Manufacturing Ltd.", "\"Valid Manufacturing Ltd.\""},
+    {416, 18, 20, "Kubota Corporation", "\"Kubota Corporation\""},
+    {417, 7, 9, "KZValve", "\"KZValve\""},
+    {418, 16, 18, "Intellistick Inc", "\"Intellistick Inc\""},
+    {419, 22, 24, "Fusion Electronics Ltd", "\"Fusion Electronics Ltd\""},
+    {420, 30, 32, "Vermeer Corporation, ACS Group", "\"Vermeer Corporation, ACS Group\""},
+    {421, 23, 25, "Vertex Standard Co, Ltd", "\"Vertex Standard Co, Ltd\""},
+    {422, 15, 17, "True Heading AB", "\"True Heading AB\""},
+    {423, 18, 20, "BSM Wireless, Inc.", "\"BSM Wireless, Inc.\""},
+    {424, 9, 11, "Odyne LLC", "\"Odyne LLC\""},
+    {425, 28, 30, "Methode Electronics Inc, MDI", "\"Methode Electronics Inc, MDI\""},
+    {0},
+    {0},
+    {0},
+    {429, 21, 23, "Rota Engineering Ltd.", "\"Rota Engineering Ltd.\""},
+    {430, 21, 23, "Auteq Telematica S.A.", "\"Auteq Telematica S.A.\""},
+    {431, 19, 21, "Tohatsu Corporation", "\"Tohatsu Corporation\""},
+    {432, 17, 19, "S&A Systems, Inc.", "\"S&A Systems, Inc.\""},
+    {433, 16, 18, "Rowe Electronics", "\"Rowe Electronics\""},
+    {434, 21, 23, "Stored Energy Systems", "\"Stored Energy Systems\""},
+    {435, 14, 16, "Zunhammer GmbH", "\"Zunhammer GmbH\""},
+    {436, 19, 21, "Kinze Manufacturing", "\"Kinze Manufacturing\""},
+    {437, 21, 23, "Digital Yacht Limited", "\"Digital Yacht Limited\""},
+    {438, 17, 19, "Comar Systems Ltd", "\"Comar Systems Ltd\""},
+    {439, 46, 48, "HD Hyundai (formerly Hyundai Heavy Industries)", "\"HD Hyundai (formerly Hyundai Heavy Industries)\""},
+    {440, 24, 26, "Cummins Power Generation", "\"Cummins Power Generation\""},
+    {441, 32, 34, "PTG Reifendruckregelsysteme GmbH", "\"PTG Reifendruckregelsysteme GmbH\""},
+    {442, 61, 63, "HORSCH Maschinen SE & Co. KG (formerly HORSCH Maschinen GmbH)", "\"HORSCH Maschinen SE & Co. KG (formerly HORSCH Maschinen GmbH)\""},
+    {443, 17, 19, "SignalQuest, Inc.", "\"SignalQuest, Inc.\""},
+    {444, 19, 21, "ITT Power Solutions", "\"ITT Power Solutions\""},
+    {445, 44, 46, "KAT MECHATRONIC, Electronic Product Division", "\"KAT MECHATRONIC, Electronic Product Division\""},
+    {446, 16, 18, "CertTech, L.L.C.", "\"CertTech, L.L.C.\""},
+    {447, 17, 19, "Great Plains Mfg.", "\"Great Plains Mfg.\""},
+    {448, 42, 44, "Stanadyne Corporation, Electronics Systems", "\"Stanadyne Corporation, Electronics Systems\""},
+    {449, 22, 24, "Polaris Industries Inc", "\"Polaris Industries Inc\""},
+    {450, 23, 25, "Dycor Technologies Ltd.", "\"Dycor Technologies Ltd.\""},
+    {451, 20, 22, "Parker Hannifin Corp", "\"Parker Hannifin Corp\""},
+    {452, 34, 36, "WIKA Alexander Wiegand SE & Co. KG", "\"WIKA Alexander Wiegand SE & Co. KG\""},
+    {453, 15, 17, "Cooper Bussmann", "\"Cooper Bussmann\""},
+    {454, 22, 24, "NGK Spark Plug Co. Ltd", "\"NGK Spark Plug Co. Ltd\""},
+    {455, 15, 17, "ADZ NAGANO GmbH", "\"ADZ NAGANO GmbH\""},
+    {456, 16, 18, "General Kinetics", "\"General Kinetics\""},
+    {457, 27, 29, "RUSELPROM-ElectricDrive Ltd", "\"RUSELPROM-ElectricDrive Ltd\""},
+    {458, 23, 25, "Control Solutions, Inc.", "\"Control Solutions, Inc.\""},
+    {459, 30, 32, "Alltek Marine Electronics Corp", "\"Alltek Marine Electronics Corp\""},
+    {460, 20, 22, "San Giorgio S.E.I.N.", "\"San Giorgio S.E.I.N.\""},
+    {461, 17, 19, "HAWE Hydraulik SE", "\"HAWE Hydraulik SE\""},
+    {462, 34, 36, "IHI Shibaura Machinery Corporation", "\"IHI Shibaura Machinery Corporation\""},
+    {463, 8, 10, "PROBOTIQ", "\"PROBOTIQ\""},
+    {464, 31, 33, "Leach International Corporation", "\"Leach International Corporation\""},
+    {465, 12, 14, "Ashcroft Inc", "\"Ashcroft Inc\""},
+    {466, 35, 37, "Veethree Electronics and Marine LLC", "\"Veethree Electronics and Marine LLC\""},
+    {467, 20, 22, "Lely Industries N.V.", "\"Lely Industries N.V.\""},
+    {468, 29, 31, "Tyco Fire Protection Products", "\"Tyco Fire Protection Products\""},
+    {469, 18, 20, "RA Consulting GmbH", "\"RA Consulting GmbH\""},
+    {470, 25, 27, "SI-TEX Marine Electronics", "\"SI-TEX Marine Electronics\""},
+    {471, 19, 21, "Sea Cross Marine AB", "\"Sea Cross Marine AB\""},
+    {472, 12, 14, "Tenneco Inc.", "\"Tenneco Inc.\""},
+    {473, 21, 23, "Boss Industries, Inc.", "\"Boss Industries, Inc.\""},
+    {474, 24, 26, "Persen Technologies Inc.", "\"Persen Technologies Inc.\""},
+    {475, 3, 5, "GME", "\"GME\""},
+    {476, 30, 32, "Hummingbird Marine Electronics", "\"Hummingbird Marine Electronics\""},
+    {477, 11, 13, "OilQuick AB", "\"OilQuick AB\""},
+    {478, 13, 15, "OceanSat B.V.", "\"OceanSat B.V.\""},
+    {479, 23, 25, "Vapor Bus International", "\"Vapor Bus International\""},
+    {480, 13, 15, "EnerDel, Inc.", "\"EnerDel, Inc.\""},
+    {481, 26, 28, "Chetco Digital Instruments", "\"Chetco Digital Instruments\""},
+    {482, 18, 20, "Tricon Electronics", "\"Tricon Electronics\""},
+    {483, 5, 7, "Valeo", "\"Valeo\""},
+    {484, 14, 16, "Headsight Inc.", "\"Headsight Inc.\""},
+    {485, 15, 17, "MATT automotive", "\"MATT automotive\""},
+    {486, 25, 27, "Westport Innovations Inc.", "\"Westport Innovations Inc.\""},
+    {487, 22, 24, "DSE Test Solutions A/S", "\"DSE Test Solutions A/S\""},
+    {488, 31, 33, "The Charles Machine Works, Inc.", "\"The Charles Machine Works, Inc.\""},
+    {489, 20, 22, "Appareo Systems, LLC", "\"Appareo Systems, LLC\""},
+    {490, 5, 7, "QuikQ", "\"QuikQ\""},
+    {491, 19, 21, "Penny and Giles Ltd", "\"Penny and Giles Ltd\""},
+    {492, 25, 27, "Inergy Automotive Systems", "\"Inergy Automotive Systems\""},
+    {493, 8, 10, "Watcheye", "\"Watcheye\""},
+    {494, 9, 11, "Synerject", "\"Synerject\""},
+    {495, 24, 26, "HOLMER Maschinenbau GmbH", "\"HOLMER Maschinenbau GmbH\""},
+    {496, 16, 18, "W. Gessmann GmbH", "\"W. Gessmann GmbH\""},
+    {497, 27, 29, "SENTRON Sistemas Embarcados", "\"SENTRON Sistemas Embarcados\""},
+    {498, 33, 35, "Innovative Design Solutions, Inc.", "\"Innovative Design Solutions, Inc.\""},
+    {499, 12, 14, "LCJ Capteurs", "\"LCJ Capteurs\""},
+    {500, 30, 32, "Oxbo International Corporation", "\"Oxbo International Corporation\""},
+    {501, 15, 17, "Agrotronix S.A.", "\"Agrotronix S.A.\""},
+    {502, 19, 21, "Attwood Corporation", "\"Attwood Corporation\""},
+    {503, 13, 15, "Naviop S.R.L.", "\"Naviop S.R.L.\""},
+    {504, 13, 15, "Vesper Marine", "\"Vesper Marine\""},
+    {505, 21, 23, "Yetter Farm Equipment", "\"Yetter Farm Equipment\""},
+    {506, 30, 32, "IHI STAR Machinery Corporation", "\"IHI STAR Machinery Corporation\""},
+    {507, 18, 20, "ISOBUS Test Center", "\"ISOBUS Test Center\""},
+    {508, 21, 23, "Transtech Innovations", "\"Transtech Innovations\""},
+    {509, 14, 16, "MOTORTECH GmbH", "\"MOTORTECH GmbH\""},
+    {510, 18, 20, "Marinesoft Co. Ltd", "\"Marinesoft Co. Ltd\""},
+    {511, 5, 7, "Sulky", "\"Sulky\""},
+    {512, 11, 13, "Inpower LLC", "\"Inpower LLC\""},
+    {513, 20, 22, "Precision Technology", "\"Precision Technology\""},
+    {514, 24, 26, "DISTek Integration, Inc.", "\"DISTek Integration, Inc.\""},
+    {515, 27, 29, "GINAF Trucks Nederland B.V.", "\"GINAF Trucks Nederland B.V.\""},
+    {516, 20, 22, "AVAT Automation GmbH", "\"AVAT Automation GmbH\""},
+    {517, 18, 20, "Noland Engineering", "\"Noland Engineering\""},
+    {518, 16, 18, "Transas USA Inc.", "\"Transas USA Inc.\""},
+    {519, 29, 31, "Peeters Landbouwmachines b.v.", "\"Peeters Landbouwmachines b.v.\""},
+    {520, 7, 9, "Trapeze", "\"Trapeze\""},
+    {521, 19, 21, "Clever Devices Ltd.", "\"Clever Devices Ltd.\""},
+    {522, 32, 34, "Nebraska Tractor Test Laboratory", "\"Nebraska Tractor Test Laboratory\""},
+    {523, 25, 27, "Reggio Emilia Innovazione", "\"Reggio Emilia Innovazione\""},
+    {524, 31, 33, "Vomax Instrumentation Pty. Ltd.", "\"Vomax Instrumentation Pty. Ltd.\""},
+    {525, 14, 16, "Rust Sales INC", "\"Rust Sales INC\""},
+    {526, 20, 22, "LOFA Industries, Inc", "\"LOFA Industries, Inc\""},
+    {527, 21, 23, "GKN Walterscheid GmbH", "\"GKN Walterscheid GmbH\""},
+    {528, 34, 36, "Hoganas AB, Electric Drive Systems", "\"Hoganas AB, Electric Drive Systems\""},
+    {529, 26, 28, "National Instruments Korea", "\"National Instruments Korea\""},
+    {530, 4, 6, "NMEA", "\"NMEA\""},
+    {531, 16, 18, "Genge & Thoma AG", "\"Genge & Thoma AG\""},
+    {532, 31, 33, "Onwa Marine Electronics Co Ltd.", "\"Onwa Marine Electronics Co Ltd.\""},
+    {533, 24, 26, "Doran Manufacturing, LLC", "\"Doran Manufacturing, LLC\""},
+    {534, 27, 29, "Webasto Thermo & Comfort SE", "\"Webasto Thermo & Comfort SE\""},
+    {535, 14, 16, "MOTORPAL, a.s.", "\"MOTORPAL, a.s.\""},
+    {536, 16, 18, "SSI Technologies", "\"SSI Technologies\""},
+    {537, 25, 27, "Schrader Electronics Ltd.", "\"Schrader Electronics Ltd.\""},
+    {538, 19, 21, "Crop Ventures, Inc.", "\"Crop Ventures, Inc.\""},
+    {539, 10, 12, "Mobileview", "\"Mobileview\""},
+    {540, 9, 11, "Dinex A/S", "\"Dinex A/S\""},
+    {541, 24, 26, "Total Fire Systems, Inc.", "\"Total Fire Systems, Inc.\""},
+    {542, 24, 26, "Dinamica Generale s.p.a.", "\"Dinamica Generale s.p.a.\""},
+    {543, 20, 22, "BAUER Maschinen GmbH", "\"BAUER Maschinen GmbH\""},
+    {544, 20, 22, "Au Group Electronics", "\"Au Group Electronics\""},
+    {545, 44, 46, "GS Global Resources (formerly GS Hydraulics)", "\"GS Global Resources (formerly GS Hydraulics)\""},
+    {546, 21, 23, "Maruyama Mfg Co, Inc.", "\"Maruyama Mfg Co, Inc.\""},
+    {547, 18, 20, "Thomson Linear LLC", "\"Thomson Linear LLC\""},
+    {548, 8, 10, "TM4 Inc.", "\"TM4 Inc.\""},
+    {549, 21, 23, "ROAD Deutschland GmbH", "\"ROAD Deutschland GmbH\""},
+    {550, 17, 19, "SUN-A Corporation", "\"SUN-A Corporation\""},
+    {551, 15, 17, "Wexler CSD Ltd.", "\"Wexler CSD Ltd.\""},
+    {552, 26, 28, "Matsuyama Plow Mfg Co, Ltd", "\"Matsuyama Plow Mfg Co, Ltd\""},
+    {553, 15, 17, "KIB Electronics", "\"KIB Electronics\""},
+    {554, 40, 42, "iris-GmbH infrared & intelligent sensors", "\"iris-GmbH infrared & intelligent sensors\""},
+    {555, 18, 20, "Sasaki Corporation", "\"Sasaki Corporation\""},
+    {556, 62, 64, "HD Hyundai Infracore Norway (formerly Doosan Infracore Norway)", "\"HD Hyundai Infracore Norway (formerly Doosan Infracore Norway)\""},
+    {557, 23, 25, "Rockson Automation GmbH", "\"Rockson Automation GmbH\""},
+    {558, 23, 25, "Davis Instruments Corp.", "\"Davis Instruments Corp.\""},
+    {559, 21, 23, "Four Peaks Navigation", "\"Four Peaks Navigation\""},
+    {560, 62, 64, "Iowa State University, Agricultural and Biosystems Engineering", "\"Iowa State University, Agricultural and Biosystems Engineering\""},
+    {561, 11, 13, "b-plus GmbH", "\"b-plus GmbH\""},
+    {562, 30, 32, "Bombardier Transportation GmbH", "\"Bombardier Transportation GmbH\""},
+    {563, 30, 32, "LOHR Sistemas Eletronicos LTDA", "\"LOHR Sistemas Eletronicos LTDA\""},
+    {564, 21, 23, "Auto Power Electronic", "\"Auto Power Electronic\""},
+    {565, 24, 26, "Micro-Trak Systems, Inc.", "\"Micro-Trak Systems, Inc.\""},
+    {566, 22, 24, "Geode Technology, Inc.", "\"Geode Technology, Inc.\""},
+    {567, 16, 18, "Lithiumstart LLC", "\"Lithiumstart LLC\""},
+    {568, 17, 19, "Makersan Ltd. Co.", "\"Makersan Ltd. Co.\""},
+    {569, 32, 34, "LORD MicroStrain Sensing Systems", "\"LORD MicroStrain Sensing Systems\""},
+    {570, 39, 41, "frenzel + berg electronic GmbH & Co. KG", "\"frenzel + berg electronic GmbH & Co. KG\""},
+    {571, 21, 23, "Marinecraft Co., Ltd.", "\"Marinecraft Co., Ltd.\""},
+    {572, 12, 14, "Fasse Valves", "\"Fasse Valves\""},
+    {573, 10, 12, "Orolia Ltd", "\"Orolia Ltd\""},
+    {574, 22, 24, "Vishay Precision Group", "\"Vishay Precision Group\""},
+    {575, 4, 6, "Lytx", "\"Lytx\""},
+    {576, 6, 8, "Vectia", "\"Vectia\""},
+    {577, 56, 58, "Denchi Power Ltd (formerly ABSL Power Solutions Limited)", "\"Denchi Power Ltd (formerly ABSL Power Solutions Limited)\""},
+    {578, 8, 10, "advanSea", "\"advanSea\""},
+    {579, 20, 22, "KVH Industries, Inc.", "\"KVH Industries, Inc.\""},
+    {580, 25, 27, "San Jose Technology, Inc.", "\"San Jose Technology, Inc.\""},
+    {581, 13, 15, "Väderstad AB", "\"Väderstad AB\""},
+    {582, 31, 33, "Innovative Software Engineering", "\"Innovative Software Engineering\""},
+    {583, 12, 14, "Yachtcontrol", "\"Yachtcontrol\""},
+    {584, 16, 18, "CarMedialab GmbH", "\"CarMedialab GmbH\""},
+    {585, 30, 32, "Industrial Electronic Controls", "\"Industrial Electronic Controls\""},
+    {586, 17, 19, "Suzuki Motor Corp", "\"Suzuki Motor Corp\""},
+    {587, 15, 17, "JCA Electronics", "\"JCA Electronics\""},
+    {588, 14, 16, "Vignal Systems", "\"Vignal Systems\""},
+    {589, 10, 12, "MICO, Inc.", "\"MICO, Inc.\""},
+    {590, 15, 17, "ARGO-HYTOS GMBH", "\"ARGO-HYTOS GMBH\""},
+    {591, 25, 27, "United States Coast Guard", "\"United States Coast Guard\""},
+    {592, 11, 13, "tecsis GmbH", "\"tecsis GmbH\""},
+    {593, 20, 22, "Sensata Technologies", "\"Sensata Technologies\""},
+    {594, 20, 22, "Kongsberg Automotive", "\"Kongsberg Automotive\""},
+    {595, 10, 12, "CustomWare", "\"CustomWare\""},
+    {596, 35, 37, "Brunelco Electronic Innovators B.V.", "\"Brunelco Electronic Innovators B.V.\""},
+    {597, 25, 27, "Hydac Filter Systems GmbH", "\"Hydac Filter Systems GmbH\""},
+    {598, 21, 23, "ABB Turbo Systems Ltd", "\"ABB Turbo Systems Ltd\""},
+    {599, 25, 27, "Spudnik Equipment Co, LLC", "\"Spudnik Equipment Co, LLC\""},
+    {600, 10, 12, "Aquatic AV", "\"Aquatic AV\""},
+    {601, 15, 17, "Navitas Systems", "\"Navitas Systems\""},
+    {602, 18, 20, "Nomad Digital Ltd.", "\"Nomad Digital Ltd.\""},
+    {603, 7, 9, "Kereval", "\"Kereval\""},
+    {604, 58, 60, "Rototilt Group AB (formerly Indexator Rototilt Systems AB)", "\"Rototilt Group AB (formerly Indexator Rototilt Systems AB)\""},
+    {605, 13, 15, "Aventics GmbH", "\"Aventics GmbH\""},
+    {606, 22, 24, "Intellian Technologies", "\"Intellian Technologies\""},
+    {607, 15, 17, "Knappco/Civacon", "\"Knappco/Civacon\""},
+    {608, 22, 24, "Gale Banks Engineering", "\"Gale Banks Engineering\""},
+    {609, 14, 16, "Walvoil S.p.A.", "\"Walvoil S.p.A.\""},
+    {610, 10, 12, "Trail Tech", "\"Trail Tech\""},
+    {611, 9, 11, "Esterline", "\"Esterline\""},
+    {612, 9, 11, "Samwon IT", "\"Samwon IT\""},
+    {613, 13, 15, "HKS Co., Ltd.", "\"HKS Co., Ltd.\""},
+    {614, 22, 24, "ARLT Technologies GmbH", "\"ARLT Technologies GmbH\""},
+    {615, 32, 34, "Networkfleet, Verizon Telematics", "\"Networkfleet, Verizon Telematics\""},
+    {616, 16, 18, "SMART-TEC s.r.o.", "\"SMART-TEC s.r.o.\""},
+    {617, 22, 24, "Zero Emission Vehicles", "\"Zero Emission Vehicles\""},
+    {618, 9, 11, "Evrard SA", "\"Evrard SA\""},
+    {619, 23, 25, "Right Weigh Load Scales", "\"Right Weigh Load Scales\""},
+    {620, 38, 40, "BorgWarner Inc. (formerly Sevcon Ltd.)", "\"BorgWarner Inc. (formerly Sevcon Ltd.)\""},
+    {621, 27, 29, "Hagie Manufacturing Company", "\"Hagie Manufacturing Company\""},
+    {622, 14, 16, "Floyd Bell Inc", "\"Floyd Bell Inc\""},
+    {623, 18, 20, "Xirgo Technologies", "\"Xirgo Technologies\""},
+    {624, 32, 34, "Blackbox Machine Control Pty Ltd", "\"Blackbox Machine Control Pty Ltd\""},
+    {625, 15, 17, "Global MRV Inc.", "\"Global MRV Inc.\""},
+    {626, 15, 17, "AVL DiTEST GmbH", "\"AVL DiTEST GmbH\""},
+    {627, 11, 13, "Radio Ocean", "\"Radio Ocean\""},
+    {628, 29, 31, "Falck Schmidt Defence Systems", "\"Falck Schmidt Defence Systems\""},
+    {629, 22, 24, "Agri Info Design, Ltd.", "\"Agri Info Design, Ltd.\""},
+    {630, 23, 25, "SmartDrive Systems Inc.", "\"SmartDrive Systems Inc.\""},
+    {631, 7, 9, "Reltima", "\"Reltima\""},
+    {632, 18, 20, "Pepperl+Fuchs GmbH", "\"Pepperl+Fuchs GmbH\""},
+    {633, 13, 15, "TORC Robotics", "\"TORC Robotics\""},
+    {634, 14, 16, "Rocky Research", "\"Rocky Research\""},
+    {635, 20, 22, "Argo Tractors S.p.A.", "\"Argo Tractors S.p.A.\""},
+    {636, 21, 23, "Divelbiss Corporation", "\"Divelbiss Corporation\""},
+    {637, 21, 23, "Bavaria Yachtbau GmbH", "\"Bavaria Yachtbau GmbH\""},
+    {638, 20, 22, "KVH Industries, Inc.", "\"KVH Industries, Inc.\""},
+    {639, 14, 16, "Startec s.r.l.", "\"Startec s.r.l.\""},
+    {640, 29, 31, "Power Solutions International", "\"Power Solutions International\""},
+    {641, 22, 24, "Diverse Yacht Services", "\"Diverse Yacht Services\""},
+    {642, 32, 34, "Moog / Aspen Motion Technologies", "\"Moog / Aspen Motion Technologies\""},
+    {643, 12, 14, "Bogballe A/S", "\"Bogballe A/S\""},
+    {644, 7, 9, "KUS USA", "\"KUS USA\""},
+    {645, 33, 35, "esd electronic system design gmbh", "\"esd electronic system design gmbh\""},
+    {646, 22, 24, "Veenhuis Machines B.V.", "\"Veenhuis Machines B.V.\""},
+    {647, 8, 10, "Siloking", "\"Siloking\""},
+    {648, 10, 12, "OJSC Ekran", "\"OJSC Ekran\""},
+    {649, 14, 16, "Control-Q B.V.", "\"Control-Q B.V.\""},
+    {650, 17, 19, "Seiko Epson Corp.", "\"Seiko Epson Corp.\""},
+    {651, 17, 19, "Takakita Co, Ltd.", "\"Takakita Co, Ltd.\""},
+    {652, 26, 28, "MicroControl GmbH & Co. KG", "\"MicroControl GmbH & Co. KG\""},
+    {653, 18, 20, "AEV, spol. s r. o.", "\"AEV, spol. s r. o.\""},
+    {654, 62, 64, "Kohler Power Systems, Detroit Engine Development Center (DEDC)", "\"Kohler Power Systems, Detroit Engine Development Center (DEDC)\""},
+    {655, 16, 18, "Genge & Thoma AG", "\"Genge & Thoma AG\""},
+    {656, 19, 21, "PRO SOLUS do Brasil", "\"PRO SOLUS do Brasil\""},
+    {657, 19, 21, "Terzo Power Systems", "\"Terzo Power Systems\""},
+    {658, 49, 51, "Shenzhen Jiuzhou Himunication Technology Co., Ltd", "\"Shenzhen Jiuzhou Himunication Technology Co., Ltd\""},
+    {659, 16, 18, "Data Panel Corp.", "\"Data Panel Corp.\""},
+    {660, 16, 18, "Auto-Gaz Centrum", "\"Auto-Gaz Centrum\""},
+    {661, 22, 24, "SPAL Automotive S.r.l.", "\"SPAL Automotive S.r.l.\""},
+    {662, 28, 30, "Kissling Elektrotechnik GmbH", "\"Kissling Elektrotechnik GmbH\""},
+    {663, 18, 20, "Delta Systems, Inc", "\"Delta Systems, Inc\""},
+    {664, 22, 24, "Level Developments Ltd", "\"Level Developments Ltd\""},
+    {665, 24, 26, "Gebr. Bode GmbH & Co. KG", "\"Gebr. Bode GmbH & Co. KG\""},
+    {666, 36, 38, "Schaeffler Technologies AG & Co., KG", "\"Schaeffler Technologies AG & Co., KG\""},
+    {667, 6, 8, "Bartec", "\"Bartec\""},
+    {668, 22, 24, "MacDon Industries Ltd.", "\"MacDon Industries Ltd.\""},
+    {669, 48, 50, "Quantum Fuel Systems Technologies Worldwide, Inc", "\"Quantum Fuel Systems Technologies Worldwide, Inc\""},
+    {670, 9, 11, "STEMCO LP", "\"STEMCO LP\""},
+    {671, 24, 26, "Innovative Controls Inc.", "\"Innovative Controls Inc.\""},
+    {672, 14, 16, "OPTIMA Concept", "\"OPTIMA Concept\""},
+    {673, 16, 18, "Caruelle Nicolas", "\"Caruelle Nicolas\""},
+    {674, 22, 24, "Yara International ASA", "\"Yara International ASA\""},
+    {675, 59, 61, "Kawasaki Motors, Ltd. (formerly Kawasaki Motors Corp., USA)", "\"Kawasaki Motors, Ltd. (formerly Kawasaki Motors Corp., USA)\""},
+    {676, 15, 17, "Danfoss IXA A/S", "\"Danfoss IXA A/S\""},
+    {677, 33, 35, "DSA Daten- und Systemtechnik GmbH", "\"DSA Daten- und Systemtechnik GmbH\""},
+    {678, 17, 19, "KeepTruckin, Inc.", "\"KeepTruckin, Inc.\""},
+    {679, 40, 42, "OXE Marine AB (formerly Cimco Marine AB)", "\"OXE Marine AB (formerly Cimco Marine AB)\""},
+    {680, 26, 28, "AMVAC Chemical Corporation", "\"AMVAC Chemical Corporation\""},
+    {681, 34, 36, "BEDIA Motorentechnik GmbH & Co. KG", "\"BEDIA Motorentechnik GmbH & Co. KG\""},
+    {682, 12, 14, "Eckelmann AG", "\"Eckelmann AG\""},
+    {683, 13, 15, "Fosen Elektro", "\"Fosen Elektro\""},
+    {684, 3, 5, "KEB", "\"KEB\""},
+    {685, 27, 29, "ANEDO (formerly ANEDO Ltd.)", "\"ANEDO (formerly ANEDO Ltd.)\""},
+    {686, 32, 34, "Taigene Electric Machinery Corp.", "\"Taigene Electric Machinery Corp.\""},
+    {687, 20, 22, "Flight Systems, Inc.", "\"Flight Systems, Inc.\""},
+    {688, 13, 15, "Rockford Corp", "\"Rockford Corp\""},
+    {689, 19, 21, "Aarcomm Systems Inc", "\"Aarcomm Systems Inc\""},
+    {690, 9, 11, "LINAK A/S", "\"LINAK A/S\""},
+    {691, 34, 36, "Digitroll Agricultural Electronics", "\"Digitroll Agricultural Electronics\""},
+    {692, 18, 20, "Tanhay Corporation", "\"Tanhay Corporation\""},
+    {693, 54, 56, "Agility Fuel Solutions (formerly Agility Fuel Systems)", "\"Agility Fuel Solutions (formerly Agility Fuel Systems)\""},
+    {694, 12, 14, "GasTOPS Ltd.", "\"GasTOPS Ltd.\""},
+    {695, 19, 21, "Weldon Technologies", "\"Weldon Technologies\""},
+    {696, 53, 55, "DRS Network & Imaging Systems, LLC (DRS Technologies)", "\"DRS Network & Imaging Systems, LLC (DRS Technologies)\""},
+    {697, 33, 35, "JOST Umeå AB (formerly Ålö AB)", "\"JOST Umeå AB (formerly Ålö AB)\""},
+    {698, 26, 28, "Scorpion Technologies Ltd.", "\"Scorpion Technologies Ltd.\""},
+    {699, 63, 65, "Harman International (formerly Harman International Industries)", "\"Harman International (formerly Harman International Industries)\""},
+    {700, 22, 24, "K-Tec Earthmovers Inc.", "\"K-Tec Earthmovers Inc.\""},
+    {701, 12, 14, "BigRoad Inc.", "\"BigRoad Inc.\""},
+    {702, 23, 25, "Weichai Power Co., Ltd.", "\"Weichai Power Co., Ltd.\""},
+    {703, 28, 30, "Hydro Tab Marine Engineering", "\"Hydro Tab Marine Engineering\""},
+    {704, 14, 16, "JL Audio, Inc.", "\"JL Audio, Inc.\""},
+    {705, 17, 19, "SVAB Hydraulik AB", "\"SVAB Hydraulik AB\""},
+    {706, 42, 44, "Shanghai Diesel Engine Corporation Limited", "\"Shanghai Diesel Engine Corporation Limited\""},
+    {707, 20, 22, "Rochester Gauges Inc", "\"Rochester Gauges Inc\""},
+    {708, 15, 17, "Lars Thrane A/S", "\"Lars Thrane A/S\""},
+    {709, 14, 16, "Marquardt GmbH", "\"Marquardt GmbH\""},
+    {710, 17, 19, "Greentronics Ltd.", "\"Greentronics Ltd.\""},
+    {711, 12, 14, "DAS Co., LTD", "\"DAS Co., LTD\""},
+    {712, 30, 32, "LOR Manufacturing Company Inc.", "\"LOR Manufacturing Company Inc.\""},
+    {713, 21, 23, "US Hybrid Corporation", "\"US Hybrid Corporation\""},
+    {714, 23, 25, "Kobashi Kogyo Co., Ltd.", "\"Kobashi Kogyo Co., Ltd.\""},
+    {715, 21, 23, "Autonnic Research Ltd", "\"Autonnic Research Ltd\""},
+    {716, 48, 50, "Eaton Control & Power Conversion Division (CPCD)", "\"Eaton Control & Power Conversion Division (CPCD)\""},
+    {717, 17, 19, "Yacht Devices Ltd", "\"Yacht Devices Ltd\""},
+    {718, 12, 14, "Micronet Inc", "\"Micronet Inc\""},
+    {719, 12, 14, "Cojali S. L.", "\"Cojali S. L.\""},
+    {720, 16, 18, "WITZ Corporation", "\"WITZ Corporation\""},
+    {721, 5, 7, "Hypro", "\"Hypro\""},
+    {722, 11, 13, "Contelec AG", "\"Contelec AG\""},
+    {723, 10, 12, "Jabil Inc.", "\"Jabil Inc.\""},
+    {724, 29, 31, "Electronic Applications, Inc.", "\"Electronic Applications, Inc.\""},
+    {725, 40, 42, "Hitachi Construction Machinery Co., Ltd.", "\"Hitachi Construction Machinery Co., Ltd.\""},
+    {726, 17, 19, "MIDORI PRECISIONS", "\"MIDORI PRECISIONS\""},
+    {727, 27, 29, "Dhoot Transmission Pvt Ltd.", "\"Dhoot Transmission Pvt Ltd.\""},
+    {728, 43, 45, "Streumaster (formerly Streumaster / Panien)", "\"Streumaster (formerly Streumaster / Panien)\""},
+    {729, 8, 10, "Liebherr", "\"Liebherr\""},
+    {730, 17, 19, "BERTHOUD AGRICOLE", "\"BERTHOUD AGRICOLE\""},
+    {731, 28, 30, "Modine Manufacturing Company", "\"Modine Manufacturing Company\""},
+    {732, 13, 15, "Gefran S.p.A.", "\"Gefran S.p.A.\""},
+    {733, 13, 15, "Intendia S.L.", "\"Intendia S.L.\""},
+    {734, 11, 13, "REAPsystems", "\"REAPsystems\""},
+    {735, 27, 29, "AEM Performance Electronics", "\"AEM Performance Electronics\""},
+    {736, 35, 37, "Terex Aerial Work Platforms - Genie", "\"Terex Aerial Work Platforms - Genie\""},
+    {737, 12, 14, "Balluff GmbH", "\"Balluff GmbH\""},
+    {738, 21, 23, "Blue Ink Technologies", "\"Blue Ink Technologies\""},
+    {739, 12, 14, "LXNAV d.o.o.", "\"LXNAV d.o.o.\""},
+    {740, 10, 12, "e-Traction", "\"e-Traction\""},
+    {741, 20, 22, "Carling Technologies", "\"Carling Technologies\""},
+    {742, 5, 7, "EROAD", "\"EROAD\""},
+    {743, 27, 29, "Daemyung Elevator Co., Ltd.", "\"Daemyung Elevator Co., Ltd.\""},
+    {744, 29, 31, "Woosung Engineering Co., Ltd.", "\"Woosung Engineering Co., Ltd.\""},
+    {745, 29, 31, "Cidra Corporate Services Inc.", "\"Cidra Corporate Services Inc.\""},
+    {746, 57, 59, "SurePoint Ag Systems (formerly SureFire Ag Systems, Inc.)", "\"SurePoint Ag Systems (formerly SureFire Ag Systems, Inc.)\""},
+    {747, 10, 12, "Agratronix", "\"Agratronix\""},
+    {748, 6, 8, "ISOTTA", "\"ISOTTA\""},
+    {749, 10, 12, "Chart Inc.", "\"Chart Inc.\""},
+    {750, 9, 11, "Joskin SA", "\"Joskin SA\""},
+    {751, 13, 15, "Pacific Track", "\"Pacific Track\""},
+    {752, 24, 26, "Deep Sea Electronics Plc", "\"Deep Sea Electronics Plc\""},
+    {753, 18, 20, "AIROD Technologies", "\"AIROD Technologies\""},
+    {754, 39, 41, "Parker Hannifin Corp., Automation Group", "\"Parker Hannifin Corp., Automation Group\""},
+    {755, 20, 22, "Firefly Integrations", "\"Firefly Integrations\""},
+    {756, 23, 25, "Maschio Gaspardo S.P.A.", "\"Maschio Gaspardo S.P.A.\""},
+    {757, 18, 20, "IMPCO Technologies", "\"IMPCO Technologies\""},
+    {758, 24, 26, "Banner Engineering Corp.", "\"Banner Engineering Corp.\""},
+    {759, 10, 12, "Hydro-Gear", "\"Hydro-Gear\""},
+    {760, 44, 46, "Bernecker + Rainer Industrie Elektronik GmbH", "\"Bernecker + Rainer Industrie Elektronik GmbH\""},
+    {761, 24, 26, "MITA OLEODINAMICA S.p.A.", "\"MITA OLEODINAMICA S.p.A.\""},
+    {762, 10, 12, "ROJ s.r.l.", "\"ROJ s.r.l.\""},
+    {763, 15, 17, "AT-Systems BVBA", "\"AT-Systems BVBA\""},
+    {764, 17, 19, "Bednar FMT s.r.o.", "\"Bednar FMT s.r.o.\""},
+    {765, 7, 9, "GIGAVAC", "\"GIGAVAC\""},
+    {766, 7, 9, "Epec Oy", "\"Epec Oy\""},
+    {767, 35, 37, "Alliance Wireless Technologies Inc.", "\"Alliance Wireless Technologies Inc.\""},
+    {768, 22, 24, "Flores Automation, LLC", "\"Flores Automation, LLC\""},
+    {769, 9, 11, "Trombetta", "\"Trombetta\""},
+    {770, 7, 9, "MONOSEM", "\"MONOSEM\""},
+    {771, 21, 23, "Shaw Development, LLC", "\"Shaw Development, LLC\""},
+    {772, 12, 14, "Blink Marine", "\"Blink Marine\""},
+    {773, 30, 32, "Clarion Corporation of America", "\"Clarion Corporation of America\""},
+    {774, 18, 20, "Taisho Corporation", "\"Taisho Corporation\""},
+    {775, 27, 29, "ZIEHL-ABEGG Automotive GmbH", "\"ZIEHL-ABEGG Automotive GmbH\""},
+    {776, 15, 17, "HMI Systems LLC", "\"HMI Systems LLC\""},
+    {777, 16, 18, "Ocean Signal Ltd", "\"Ocean Signal Ltd\""},
+    {778, 14, 16, "Seakeeper Inc.", "\"Seakeeper Inc.\""},
+    {779, 22, 24, "RLC Electronic Systems", "\"RLC Electronic Systems\""},
+    {780, 57, 59, "Turntide Transport Limited (formerly AVID Technology Ltd)", "\"Turntide Transport Limited (formerly AVID Technology Ltd)\""},
+    {781, 15, 17, "Poly-Planar LLC", "\"Poly-Planar LLC\""},
+    {782, 6, 8, "AVR nv", "\"AVR nv\""},
+    {783, 21, 23, "Loup Electronics Inc.", "\"Loup Electronics Inc.\""},
+    {784, 27, 29, "CM Automotive Systems, Inc.", "\"CM Automotive Systems, Inc.\""},
+    {785, 18, 20, "Fischer Panda GmbH", "\"Fischer Panda GmbH\""},
+    {786, 31, 33, "Johnson Matthey Battery Systems", "\"Johnson Matthey Battery Systems\""},
+    {787, 28, 30, "Abertax Technologies Limited", "\"Abertax Technologies Limited\""},
+    {788, 13, 15, "MoTeC Pty Ltd", "\"MoTeC Pty Ltd\""},
+    {789, 7, 9, "GRADALL", "\"GRADALL\""},
+    {790, 6, 8, "VACALL", "\"VACALL\""},
+    {791, 5, 7, "AUTEC", "\"AUTEC\""},
+    {792, 15, 17, "Kostal Mexicana", "\"Kostal Mexicana\""},
+    {793, 19, 21, "James Fisher Prolec", "\"James Fisher Prolec\""},
+    {794, 42, 44, "Shihlin Electric & Engineering Corporation", "\"Shihlin Electric & Engineering Corporation\""},
+    {795, 26, 28, "Broyda Enterprises Pty Ltd", "\"Broyda Enterprises Pty Ltd\""},
+    {796, 34, 36, "Canadian Automotive Industries Ltd", "\"Canadian Automotive Industries Ltd\""},
+    {797, 12, 14, "Tides Marine", "\"Tides Marine\""},
+    {798, 13, 15, "Lumishore Ltd", "\"Lumishore Ltd\""},
+    {799, 43, 45, "Stillwater Designs and Audio, Inc. - KICKER", "\"Stillwater Designs and Audio, Inc. - KICKER\""},
+    {800, 20, 22, "Delta-Q Technologies", "\"Delta-Q Technologies\""},
+    {801, 30, 32, "LOR Manufacturing Company Inc.", "\"LOR Manufacturing Company Inc.\""},
+    {802, 21, 23, "SPBI (Bj Technologie)", "\"SPBI (Bj Technologie)\""},
+    {803, 31, 33, "Gill Sensors & Controls Limited", "\"Gill Sensors & Controls Limited\""},
+    {804, 15, 17, "ASA Electronics", "\"ASA Electronics\""},
+    {805, 21, 23, "Gundersen & Løken AS", "\"Gundersen & Løken AS\""},
+    {806, 21, 23, "Charge Automotive Ltd", "\"Charge Automotive Ltd\""},
+    {807, 18, 20, "Schneider-Electric", "\"Schneider-Electric\""},
+    {808, 17, 19, "RIMEX Supply Ltd.", "\"RIMEX Supply Ltd.\""},
+    {809, 26, 28, "HMS Industrial Networks AB", "\"HMS Industrial Networks AB\""},
+    {810, 19, 21, "Dutch Power Company", "\"Dutch Power Company\""},
+    {811, 23, 25, "Blue Water Desalination", "\"Blue Water Desalination\""},
+    {812, 18, 20, "Torch Technologies", "\"Torch Technologies\""},
+    {813, 16, 18, "Thales Suisse SA", "\"Thales Suisse SA\""},
+    {814, 58, 60, "Kronotech Srl (formerly Soltec Soluzioni Tecnologiche Srl)", "\"Kronotech Srl (formerly Soltec Soluzioni Tecnologiche Srl)\""},
+    {815, 18, 20, "FLIR Systems, Inc.", "\"FLIR Systems, Inc.\""},
+    {816, 9, 11, "UniStrong", "\"UniStrong\""},
+    {817, 32, 34, "TE Connectivity Sensor Solutions", "\"TE Connectivity Sensor Solutions\""},
+    {818, 5, 7, "HGNSS", "\"HGNSS\""},
+    {819, 17, 19, "Preco Electronics", "\"Preco Electronics\""},
+    {820, 53, 55, "DIaLOGIKa Gesellschaft fuer angewandte Informatik mbH", "\"DIaLOGIKa Gesellschaft fuer angewandte Informatik mbH\""},
+    {821, 18, 20, "Thorsen Teknik A/S", "\"Thorsen Teknik A/S\""},
+    {822, 18, 20, "Bren-Tronics, Inc.", "\"Bren-Tronics, Inc.\""},
+    {823, 35, 37, "ACEINNA, Inc (formerly MEMSIC, Inc)", "\"ACEINNA, Inc (formerly MEMSIC, Inc)\""},
+    {824, 18, 20, "Undheim Systems AS", "\"Undheim Systems AS\""},
+    {825, 13, 15, "BPW Hungária", "\"BPW Hungária\""},
+    {826, 17, 19, "Lewmar Marine Inc", "\"Lewmar Marine Inc\""},
+    {827, 28, 30, "INmatix Technology Group Ltd", "\"INmatix Technology Group Ltd\""},
+    {828, 14, 16, "AgriBrink Inc.", "\"AgriBrink Inc.\""},
+    {829, 23, 25, "Drov Technologies, Inc.", "\"Drov Technologies, Inc.\""},
+    {830, 16, 18, "Ultra Motion LLC", "\"Ultra Motion LLC\""},
+    {831, 12, 14, "DOK-ING Ltd.", "\"DOK-ING Ltd.\""},
+    {832, 39, 41, "Heizomat Gerätebau-Energiesysteme GmbH", "\"Heizomat Gerätebau-Energiesysteme GmbH\""},
+    {833, 22, 24, "Electrum Automation AB", "\"Electrum Automation AB\""},
+    {834, 26, 28, "Pioneer Microsystems, Inc.", "\"Pioneer Microsystems, Inc.\""},
+    {835, 13, 15, "PetTrack Ltd.", "\"PetTrack Ltd.\""},
+    {836, 10, 12, "Signature4", "\"Signature4\""},
+    {837, 23, 25, "Famic Technologies Inc.", "\"Famic Technologies Inc.\""},
+    {838, 12, 14, "Teamsurv Ltd", "\"Teamsurv Ltd\""},
+    {839, 28, 30, "Indexator Rotator Systems AB", "\"Indexator Rotator Systems AB\""},
+    {840, 12, 14, "E.S.T.E. srl", "\"E.S.T.E. srl\""},
+    {841, 8, 10, "Agra-GPS", "\"Agra-GPS\""},
+    {842, 14, 16, "DigiDevice Srl", "\"DigiDevice Srl\""},
+    {843, 44, 46, "Hendrickson Truck Commercial Vehicle Systems", "\"Hendrickson Truck Commercial Vehicle Systems\""},
+    {844, 7, 9, "FELL AS", "\"FELL AS\""},
+    {845, 32, 34, "GMB Güstrower Maschinenbau GmbH", "\"GMB Güstrower Maschinenbau GmbH\""},
+    {846, 15, 17, "L3 Magnet-Motor", "\"L3 Magnet-Motor\""},
+    {847, 9, 11, "Oceanvolt", "\"Oceanvolt\""},
+    {848, 8, 10, "ningupex", "\"ningupex\""},
+    {849, 31, 33, "MTS Maschinentechnik Schrode AG", "\"MTS Maschinentechnik Schrode AG\""},
+    {850, 19, 21, "Geoprospectors GmbH", "\"Geoprospectors GmbH\""},
+    {851, 33, 35, "Novotechnik Messwertaufnehmer OHG", "\"Novotechnik Messwertaufnehmer OHG\""},
+    {852, 10, 12, "Velvac Inc", "\"Velvac Inc\""},
+    {853, 19, 21, "Teledyne RESON B.V.", "\"Teledyne RESON B.V.\""},
+    {854, 19, 21, "GEMAC Chemnitz GmbH", "\"GEMAC Chemnitz GmbH\""},
+    {855, 54, 56, "Toshiba Infrastructure Systems & Solutions Corporation", "\"Toshiba Infrastructure Systems & Solutions Corporation\""},
+    {856, 14, 16, "FarmFacts GmbH", "\"FarmFacts GmbH\""},
+    {857, 31, 33, "Zoomlion Heavy Industry NA, Inc", "\"Zoomlion Heavy Industry NA, Inc\""},
+    {858, 10, 12, "Littelfuse", "\"Littelfuse\""},
+    {859, 5, 7, "Valor", "\"Valor\""},
+    {860, 8, 10, "Michelin", "\"Michelin\""},
+    {861, 18, 20, "Adel System S.r.l.", "\"Adel System S.r.l.\""},
+    {862, 19, 21, "Prospec Electronics", "\"Prospec Electronics\""},
+    {863, 4, 6, "SMAG", "\"SMAG\""},
+    {864, 43, 45, "Streamline Transportation Technologies Inc.", "\"Streamline Transportation Technologies Inc.\""},
+    {865, 10, 12, "MyEasyFarm", "\"MyEasyFarm\""},
+    {866, 15, 17, "Netradyne, Inc.", "\"Netradyne, Inc.\""},
+    {867, 21, 23, "Skeleton Technologies", "\"Skeleton Technologies\""},
+    {868, 15, 17, "Data Panel Corp", "\"Data Panel Corp\""},
+    {869, 9, 11, "Intercomp", "\"Intercomp\""},
+    {870, 24, 26, "Textron Fleet Management", "\"Textron Fleet Management\""},
+    {871, 37, 39, "Agri-Fab (formerly Superior Tech Inc)", "\"Agri-Fab (formerly Superior Tech Inc)\""},
+    {872, 28, 30, "Kählig Antriebstechnik GmbH", "\"Kählig Antriebstechnik GmbH\""},
+    {873, 23, 25, "Garnet Instruments Ltd.", "\"Garnet Instruments Ltd.\""},
+    {874, 10, 12, "MTA S.p.A.", "\"MTA S.p.A.\""},
+    {875, 16, 18, "Salvarani S.r.l.", "\"Salvarani S.r.l.\""},
+    {876, 36, 38, "SUCO Robert Scheuffele GmbH & Co. KG", "\"SUCO Robert Scheuffele GmbH & Co. KG\""},
+    {877, 15, 17, "SICK ATech GmbH", "\"SICK ATech GmbH\""},
+    {878, 5, 7, "FOTON", "\"FOTON\""},
+    {879, 16, 18, "PG Trionic, Inc.", "\"PG Trionic, Inc.\""},
+    {880, 17, 19, "Revision Military", "\"Revision Military\""},
+    {881, 6, 8, "Sovema", "\"Sovema\""},
+    {882, 22, 24, "BHTronik GmbH & Co. KG", "\"BHTronik GmbH & Co. KG\""},
+    {883, 22, 24, "Swift Navigation, Inc.", "\"Swift Navigation, Inc.\""},
+    {884, 23, 25, "Sure Grip Controls Inc.", "\"Sure Grip Controls Inc.\""},
+    {885, 37, 39, "SICK AG (formerly SICK Stegmann GmbH)", "\"SICK AG (formerly SICK Stegmann GmbH)\""},
+    {886, 25, 27, "Hitachi Zosen Corporation", "\"Hitachi Zosen Corporation\""},
+    {887, 67, 69, "Turntide Transport Limited (formerly Hyperdrive Innovation Limited)", "\"Turntide Transport Limited (formerly Hyperdrive Innovation Limited)\""},
+    {888, 17, 19, "Carma Systems Inc", "\"Carma Systems Inc\""},
+    {889, 16, 18, "SANY America Inc", "\"SANY America Inc\""},
+    {890, 21, 23, "L3 Technologies, Inc.", "\"L3 Technologies, Inc.\""},
+    {891, 10, 12, "CarrierWeb", "\"CarrierWeb\""},
+    {892, 13, 15, "Mectronx Corp", "\"Mectronx Corp\""},
+    {893, 18, 20, "KlinkTechnics Ltd.", "\"KlinkTechnics Ltd.\""},
+    {894, 71, 73, "Rhodan Marine Systems of Florida LLC (Duplicate entry; use MFR ID 1012)", "\"Rhodan Marine Systems of Florida LLC (Duplicate entry; use MFR ID 1012)\""},
+    {895, 18, 20, "Peloton Technology", "\"Peloton Technology\""},
+    {896, 22, 24, "NextFour Solutions Ltd", "\"NextFour Solutions Ltd\""},
+    {897, 20, 22, "Dot Technology Corp.", "\"Dot Technology Corp.\""},
+    {898, 37, 39, "Josef Kotte Landtechnik GmbH & Co. KG", "\"Josef Kotte Landtechnik GmbH & Co. KG\""},
+    {899, 23, 25, "Lippert Components, Inc", "\"Lippert Components, Inc\""},
+    {900, 37, 39, "OSB connagtive GmbH (formerly OSB AG)", "\"OSB connagtive GmbH (formerly OSB AG)\""},
+    {901, 9, 11, "Zivan Srl", "\"Zivan Srl\""},
+    {902, 17, 19, "Bucher Hydraulics", "\"Bucher Hydraulics\""},
+    {903, 8, 10, "InMotion", "\"InMotion\""},
+    {904, 41, 43, "Equipment Safety Systems Pty. Ltd. (EQSS)", "\"Equipment Safety Systems Pty. Ltd. (EQSS)\""},
+    {905, 15, 17, "ASA Electronics", "\"ASA Electronics\""},
+    {906, 7, 9, "MOBA AG", "\"MOBA AG\""},
+    {907, 10, 12, "strautmann", "\"strautmann\""},
+    {908, 53, 55, "Chonbuk National University Department of Electronics", "\"Chonbuk National University Department of Electronics\""},
+    {909, 17, 19, "Marines Co., Ltd.", "\"Marines Co., Ltd.\""},
+    {910, 33, 35, "Hermann Paus Maschinenfabrik GmbH", "\"Hermann Paus Maschinenfabrik GmbH\""},
+    {911, 9, 11, "Nautic-On", "\"Nautic-On\""},
+    {912, 17, 19, "Steyr Motors GmbH", "\"Steyr Motors GmbH\""},
+    {913, 24, 26, "Toyota Motor Corporation", "\"Toyota Motor Corporation\""},
+    {914, 19, 21, "ZETOR TRACTORS a.s.", "\"ZETOR TRACTORS a.s.\""},
+    {915, 47, 49, "Dosificacion y sistemas electronicos S.L. (DSE)", "\"Dosificacion y sistemas electronicos S.L. (DSE)\""},
+    {916, 46, 48, "Hans Turck GmbH & Co. KG (formerly Turck Inc.)", "\"Hans Turck GmbH & Co. KG (formerly Turck Inc.)\""},
+    {917, 15, 17, "Sentinel d.o.o.", "\"Sentinel d.o.o.\""},
+    {918, 24, 26, "AMW Machine Control, Inc", "\"AMW Machine Control, Inc\""},
+    {919, 11, 13, "Furrion LLC", "\"Furrion LLC\""},
+    {920, 23, 25, "MTD Consumer Group Inc.", "\"MTD Consumer Group Inc.\""},
+    {921, 36, 38, "ROPA Fahrzeug- und Maschinenbau GmbH", "\"ROPA Fahrzeug- und Maschinenbau GmbH\""},
+    {922, 21, 23, "Terberg Benschop B.V.", "\"Terberg Benschop B.V.\""},
+    {923, 12, 14, "ELTEK S.p.A.", "\"ELTEK S.p.A.\""},
+    {924, 33, 35, "PAS Peschak Autonome Systeme GmbH", "\"PAS Peschak Autonome Systeme GmbH\""},
+    {925, 15, 17, "GW Lisk Company", "\"GW Lisk Company\""},
+    {926, 22, 24, "Buhler Industries Inc.", "\"Buhler Industries Inc.\""},
+    {927, 6, 8, "Saicon", "\"Saicon\""},
+    {928, 28, 30, "EAO Automotive GmbH & Co. KG", "\"EAO Automotive GmbH & Co. KG\""},
+    {929, 23, 25, "Jl Marine Systems, Inc.", "\"Jl Marine Systems, Inc.\""},
+    {930, 15, 17, "Ecotronix Corp.", "\"Ecotronix Corp.\""},
+    {931, 18, 20, "Enertec Marine Ltd", "\"Enertec Marine Ltd\""},
+    {932, 16, 18, "Discover Battery", "\"Discover Battery\""},
+    {933, 26, 28, "Delta Mobile Systems, Inc.", "\"Delta Mobile Systems, Inc.\""},
+    {934, 15, 17, "Farmobile, Inc.", "\"Farmobile, Inc.\""},
+    {935, 19, 21, "Meels GmbH & Co. KG", "\"Meels GmbH & Co. KG\""},
+    {936, 18, 20, "Hi-tech Millennium", "\"Hi-tech Millennium\""},
+    {937, 22, 24, "Precision Circuits Inc", "\"Precision Circuits Inc\""},
+    {938, 13, 15, "LEVEL Systems", "\"LEVEL Systems\""},
+    {939, 21, 23, "Warn Industries, Inc.", "\"Warn Industries, Inc.\""},
+    {940, 10, 12, "Dometal Oy", "\"Dometal Oy\""},
+    {941, 5, 7, "Navya", "\"Navya\""},
+    {942, 23, 25, "Vogelsang GmbH & Co. KG", "\"Vogelsang GmbH & Co. KG\""},
+    {943, 29, 31, "FISCHER AG Präzisionspindeln", "\"FISCHER AG Präzisionspindeln\""},
+    {944, 17, 19, "ZONTISA Marine SL", "\"ZONTISA Marine SL\""},
+    {945, 12, 14, "Equalizer AG", "\"Equalizer AG\""},
+    {946, 21, 23, "Hydac Tecnologia Ltda", "\"Hydac Tecnologia Ltda\""},
+    {947, 14, 16, "Gerd Bär GmbH", "\"Gerd Bär GmbH\""},
+    {948, 5, 7, "Donix", "\"Donix\""},
+    {949, 20, 22, "Škoda Electric a.s.", "\"Škoda Electric a.s.\""},
+    {950, 13, 15, "RE:Lab s.r.l.", "\"RE:Lab s.r.l.\""},
+    {951, 25, 27, "Exor International S.p.A.", "\"Exor International S.p.A.\""},
+    {952, 21, 23, "Tan Delta Systems Ltd", "\"Tan Delta Systems Ltd\""},
+    {953, 14, 16, "Curtiss-Wright", "\"Curtiss-Wright\""},
+    {954, 13, 15, "Setec Pty Ltd", "\"Setec Pty Ltd\""},
+    {955, 70, 72, "Hottinger Baldwin (Suzhou) Electronic Measurement Technology Co., Ltd.", "\"Hottinger Baldwin (Suzhou) Electronic Measurement Technology Co., Ltd.\""},
+    {956, 29, 31, "Piher Sensors & Controls S.A.", "\"Piher Sensors & Controls S.A.\""},
+    {957, 19, 21, "Sierra Wireless Inc", "\"Sierra Wireless Inc\""},
+    {958, 19, 21, "NHK MEC Corporation", "\"NHK MEC Corporation\""},
+    {959, 19, 21, "Cascade Corporation", "\"Cascade Corporation\""},
+    {960, 11, 13, "Vemcon GmbH", "\"Vemcon GmbH\""},
+    {961, 7, 9, "POK SAS", "\"POK SAS\""},
+    {962, 26, 28, "Timbolier Industries, Inc.", "\"Timbolier Industries, Inc.\""},
+    {963, 27, 29, "Thomason Jones Company, LLC", "\"Thomason Jones Company, LLC\""},
+    {964, 11, 13, "AgroVIR Kft", "\"AgroVIR Kft\""},
+    {965, 15, 17, "Ro-Sys Software", "\"Ro-Sys Software\""},
+    {966, 11, 13, "VisibleFarm", "\"VisibleFarm\""},
+    {967, 21, 23, "Moteck Electric Corp.", "\"Moteck Electric Corp.\""},
+    {968, 22, 24, "Cox Powertrain Limited", "\"Cox Powertrain Limited\""},
+    {969, 16, 18, "Blue Sea Systems", "\"Blue Sea Systems\""},
+    {970, 26, 28, "Jaboni Power Products, LLC", "\"Jaboni Power Products, LLC\""},
+    {971, 13, 15, "B+B Smartworx", "\"B+B Smartworx\""},
+    {972, 8, 10, "Axion AG", "\"Axion AG\""},
+    {973, 10, 12, "Zasso GmbH", "\"Zasso GmbH\""},
+    {974, 23, 25, "Pico Technology Limited", "\"Pico Technology Limited\""},
+    {975, 10, 12, "Siemens AG", "\"Siemens AG\""},
+    {976, 20, 22, "Derive Systems, Inc.", "\"Derive Systems, Inc.\""},
+    {977, 43, 45, "Copeland LP (formerly Emerson Electric Co.)", "\"Copeland LP (formerly Emerson Electric Co.)\""},
+    {978, 18, 20, "Canfield Connector", "\"Canfield Connector\""},
+    {979, 6, 8, "McHale", "\"McHale\""},
+    {980, 19, 21, "Gussi Italia S.R.L.", "\"Gussi Italia S.R.L.\""},
+    {981, 28, 30, "Kobelt Manufacturing Co. Ltd", "\"Kobelt Manufacturing Co. Ltd\""},
+    {982, 29, 31, "Briggs & Stratton Corporation", "\"Briggs & Stratton Corporation\""},
+    {983, 10, 12, "Dezwaef NV", "\"Dezwaef NV\""},
+    {984, 37, 39, "E-T-A Elektrotechnische Apparate GmbH", "\"E-T-A Elektrotechnische Apparate GmbH\""},
+    {985, 8, 10, "NLR, LLC", "\"NLR, LLC\""},
+    {986, 11, 13, "AAMP Global", "\"AAMP Global\""},
+    {987, 20, 22, "Baltic Car Equipment", "\"Baltic Car Equipment\""},
+    {988, 11, 13, "Voith Turbo", "\"Voith Turbo\""},
+    {989, 17, 19, "Flux-Geräte GmbH", "\"Flux-Geräte GmbH\""},
+    {990, 21, 23, "SAMSUNG SDI Co., Ltd.", "\"SAMSUNG SDI Co., Ltd.\""},
+    {991, 25, 27, "Deutronic Elektronik GmbH", "\"Deutronic Elektronik GmbH\""},
+    {992, 13, 15, "MarineIOT LLC", "\"MarineIOT LLC\""},
+    {993, 25, 27, "Alelion Energy Systems AB", "\"Alelion Energy Systems AB\""},
+    {994, 22, 24, "Morris Industries Ltd.", "\"Morris Industries Ltd.\""},
+    {995, 20, 22, "Circuitlink Pty Ltd.", "\"Circuitlink Pty Ltd.\""},
+    {996, 16, 18, "Eniquest Pty Ltd", "\"Eniquest Pty Ltd\""},
+    {997, 17, 19, "Xenta Systems Srl", "\"Xenta Systems Srl\""},
+    {998, 24, 26, "Transcell Technology Inc", "\"Transcell Technology Inc\""},
+    {999, 16, 18, "TerraTroniq B.V.", "\"TerraTroniq B.V.\""},
+    {1000, 27, 29, "Landmaschinen Wienhoff GmbH", "\"Landmaschinen Wienhoff GmbH\""},
+    {1001, 11, 13, "Cleral Inc.", "\"Cleral Inc.\""},
+    {1002, 24, 26, "Kussmaul Electronics Co.", "\"Kussmaul Electronics Co.\""},
+    {1003, 14, 16, "technotrans SE", "\"technotrans SE\""},
+    {1004, 13, 15, "Ultraflex SpA", "\"Ultraflex SpA\""},
+    {1005, 16, 18, "TSE Brakes, Inc.", "\"TSE Brakes, Inc.\""},
+    {1006, 8, 10, "Proterra", "\"Proterra\""},
+    {1007, 32, 34, "Maschinenfabrik Meyer-Lohne GmbH", "\"Maschinenfabrik Meyer-Lohne GmbH\""},
+    {1008, 19, 21, "Lintest Systems LLC", "\"Lintest Systems LLC\""},
+    {1009, 18, 20, "TouchTronics, Inc.", "\"TouchTronics, Inc.\""},
+    {1010, 49, 51, "Agricultural Industry Electronics Foundation e.V.", "\"Agricultural Industry Electronics Foundation e.V.\""},
+    {1011, 24, 26, "Soundmax Electronics Ltd", "\"Soundmax Electronics Ltd\""},
+    {1012, 36, 38, "Rhodan Marine Systems of Florida LLC", "\"Rhodan Marine Systems of Florida LLC\""},
+    {1013, 14, 16, "Allochis E-Tec", "\"Allochis E-Tec\""},
+    {1014, 23, 25, "Briri Maschinenbau GmbH", "\"Briri Maschinenbau GmbH\""},
+    {1015, 13, 15, "SECURITAG SAS", "\"SECURITAG SAS\""},
+    {1016, 34, 36, "Röhren- und Pumpenwerk BAUER GmbH", "\"Röhren- und Pumpenwerk BAUER GmbH\""},
+    {1017, 10, 12, "Caldaro AB", "\"Caldaro AB\""},
+    {1018, 8, 10, "Flex TTS", "\"Flex TTS\""},
+    {1019, 15, 17, "Codek Foundries", "\"Codek Foundries\""},
+    {1020, 29, 31, "Onyx Marine Automation s.r.l.", "\"Onyx Marine Automation s.r.l.\""},
+    {1021, 21, 23, "Entratech Systems LLC", "\"Entratech Systems LLC\""},
+    {1022, 7, 9, "ITC Inc", "\"ITC Inc\""},
+    {1023, 24, 26, "PEAK-System Technik GmbH", "\"PEAK-System Technik GmbH\""},
+    {1024, 14, 16, "Inventus Power", "\"Inventus Power\""},
+    {1025, 16, 18, "eze System, Inc.", "\"eze System, Inc.\""},
+    {1026, 24, 26, "ZTR Control Systems, LLC", "\"ZTR Control Systems, LLC\""},
+    {1027, 17, 19, "Goldacres PTY LTD", "\"Goldacres PTY LTD\""},
+    {1028, 39, 41, "Autel Intelligent Technology Corp., Ltd", "\"Autel Intelligent Technology Corp., Ltd\""},
+    {1029, 23, 25, "The Marine Guardian LLC", "\"The Marine Guardian LLC\""},
+    {1030, 12, 14, "Tume-Agri Oy", "\"Tume-Agri Oy\""},
+    {1031, 15, 17, "Flintec UK Ltd.", "\"Flintec UK Ltd.\""},
+    {1032, 12, 14, "SIMOL S.p.A.", "\"SIMOL S.p.A.\""},
+    {1033, 17, 19, "ECCO Safety Group", "\"ECCO Safety Group\""},
+    {1034, 12, 14, "Siren Marine", "\"Siren Marine\""},
+    {1035, 5, 7, "Agres", "\"Agres\""},
+    {1036, 20, 22, "Bender GmbH & Co. KG", "\"Bender GmbH & Co. KG\""},
+    {1037, 22, 24, "Dragonfly Energy Corp.", "\"Dragonfly Energy Corp.\""},
+    {1038, 23, 25, "EMIT Technologies, Inc.", "\"EMIT Technologies, Inc.\""},
+    {1039, 25, 27, "Liugong Dressta Machinery", "\"Liugong Dressta Machinery\""},
+    {1040, 19, 21, "BPE Electronics Srl", "\"BPE Electronics Srl\""},
+    {1041, 7, 9, "EZ Lynk", "\"EZ Lynk\""},
+    {1042, 12, 14, "engcon group", "\"engcon group\""},
+    {1043, 4, 6, "Hyva", "\"Hyva\""},
+    {1044, 3, 5, "Xee", "\"Xee\""},
+    {1045, 9, 11, "CMR Group", "\"CMR Group\""},
+    {1046, 8, 10, "Praxidyn", "\"Praxidyn\""},
+    {1047, 17, 19, "Sonic Corporation", "\"Sonic Corporation\""},
+    {1048, 13, 15, "Agrivation UG", "\"Agrivation UG\""},
+    {1049, 9, 11, "S&S Cycle", "\"S&S Cycle\""},
+    {1050, 13, 15, "Spacenus GmbH", "\"Spacenus GmbH\""},
+    {1051, 9, 11, "ProNav AS", "\"ProNav AS\""},
+    {1052, 8, 10, "Pfreundt", "\"Pfreundt\""},
+    {1053, 19, 21, "Vetus Maxwell, Inc.", "\"Vetus Maxwell, Inc.\""},
+    {1054, 35, 37, "Schmotzer Hacktechnik GmbH & Co. KG", "\"Schmotzer Hacktechnik GmbH & Co. KG\""},
+    {1055, 18, 20, "EXA Computing GmbH", "\"EXA Computing GmbH\""},
+    {1056, 12, 14, "Lithium Pros", "\"Lithium Pros\""},
+    {1057, 14, 16, "EquipmentShare", "\"EquipmentShare\""},
+    {1058, 21, 23, "Bondioli & Pavesi SpA", "\"Bondioli & Pavesi SpA\""},
+    {1059, 7, 9, "Boatrax", "\"Boatrax\""},
+    {1060, 9, 11, "Scale-Tec", "\"Scale-Tec\""},
+    {1061, 28, 30, "Volvo Construction Equipment", "\"Volvo Construction Equipment\""},
+    {1062, 12, 14, "Marol Co Ltd", "\"Marol Co Ltd\""},
+    {1063, 8, 10, "SolSteer", "\"SolSteer\""},
+    {1064, 22, 24, "Omnitech Robotics Inc.", "\"Omnitech Robotics Inc.\""},
+    {1065, 19, 21, "CALYPSO Instruments", "\"CALYPSO Instruments\""},
+    {1066, 15, 17, "Spot Zero Water", "\"Spot Zero Water\""},
+    {1067, 14, 16, "Tecomec S.r.l.", "\"Tecomec S.r.l.\""},
+    {1068, 11, 13, "Zapi S.p.A.", "\"Zapi S.p.A.\""},
+    {1069, 22, 24, "Lithionics Battery LLC", "\"Lithionics Battery LLC\""},
+    {1070, 26, 28, "Quick-teck Electronics Ltd", "\"Quick-teck Electronics Ltd\""},
+    {1071, 19, 21, "MACH SYSTEMS s.r.o.", "\"MACH SYSTEMS s.r.o.\""},
+    {1072, 31, 33, "La Marche Manufacturing Company", "\"La Marche Manufacturing Company\""},
+    {1073, 29, 31, "Manitou Equipment America LLC", "\"Manitou Equipment America LLC\""},
+    {1074, 20, 22, "Kindhelm / Navigs Oy", "\"Kindhelm / Navigs Oy\""},
+    {1075, 26, 28, "Uniden America Corporation", "\"Uniden America Corporation\""},
+    {1076, 9, 11, "DOGA S.A.", "\"DOGA S.A.\""},
+    {1077, 15, 17, "Ymer Technology", "\"Ymer Technology\""},
+    {1078, 13, 15, "GE Appliances", "\"GE Appliances\""},
+    {1079, 28, 30, "Carl Zeiss Spectroscopy GmbH", "\"Carl Zeiss Spectroscopy GmbH\""},
+    {1080, 26, 28, "Epsilor-Electric Fuel Ltd.", "\"Epsilor-Electric Fuel Ltd.\""},
+    {1081, 25, 27, "Imcon Electronics, s.r.o.", "\"Imcon Electronics, s.r.o.\""},
+    {1082, 31, 33, "TÜMOSAN Engine and Tractor Co.", "\"TÜMOSAN Engine and Tractor Co.\""},
+    {1083, 12, 14, "Nauticoncept", "\"Nauticoncept\""},
+    {1084, 30, 32, "Shadow-Caster LED lighting LLC", "\"Shadow-Caster LED lighting LLC\""},
+    {1085, 15, 17, "Wet Sounds, LLC", "\"Wet Sounds, LLC\""},
+    {1086, 15, 17, "Life Racing Ltd", "\"Life Racing Ltd\""},
+    {1087, 18, 20, "ITPhotonics S.r.l.", "\"ITPhotonics S.r.l.\""},
+    {1088, 22, 24, "E-T-A Circuit Breakers", "\"E-T-A Circuit Breakers\""},
+    {1089, 19, 21, "Carrosserie HESS AG", "\"Carrosserie HESS AG\""},
+    {1090, 26, 28, "E-T-A Circuit Breakers Ltd", "\"E-T-A Circuit Breakers Ltd\""},
+    {1091, 18, 20, "Wheel Monitor Inc.", "\"Wheel Monitor Inc.\""},
+    {1092, 8, 10, "Scheiber", "\"Scheiber\""},
+    {1093, 11, 13, "innolectric", "\"innolectric\""},
+    {1094, 13, 15, "Tokushu Denki", "\"Tokushu Denki\""},
+    {1095, 42, 44, "WEG Drives and Controls - Automação Ltda", "\"WEG Drives and Controls - Automação Ltda\""},
+    {1096, 15, 17, "Texense Sensors", "\"Texense Sensors\""},
+    {1097, 18, 20, "M2M Craft Co., Ltd", "\"M2M Craft Co., Ltd\""},
+    {1098, 9, 11, "Preh GmbH", "\"Preh GmbH\""},
+    {1099, 14, 16, "MadgeTech, Inc", "\"MadgeTech, Inc\""},
+    {1100, 70, 72, "LINK Marine Technologies (formerly Smart Yachts International Limited)", "\"LINK Marine Technologies (formerly Smart Yachts International Limited)\""},
+    {1101, 16, 18, "DIS Sensors B.V.", "\"DIS Sensors B.V.\""},
+    {1102, 29, 31, "Carl Geringhoff GmbH & Co. KG", "\"Carl Geringhoff GmbH & Co. KG\""},
+    {1103, 14, 16, "Diesel Laptops", "\"Diesel Laptops\""},
+    {1104, 16, 18, "The Toro Company", "\"The Toro Company\""},
+    {1105, 21, 23, "Redekop Manufacturing", "\"Redekop Manufacturing\""},
+    {1106, 14, 16, "Great Dane LLC", "\"Great Dane LLC\""},
+    {1107, 14, 16, "Dräger Safety", "\"Dräger Safety\""},
+    {1108, 7, 9, "ORBCOMM", "\"ORBCOMM\""},
+    {1109, 8, 10, "Dockmate", "\"Dockmate\""},
+    {1110, 33, 35, "Analytic Systems Ware (1993) Ltd.", "\"Analytic Systems Ware (1993) Ltd.\""},
+    {1111, 8, 10, "SEPPI M.", "\"SEPPI M.\""},
+    {1112, 16, 18, "Bollinger Motors", "\"Bollinger Motors\""},
+    {1113, 14, 16, "iVolve Pty Ltd", "\"iVolve Pty Ltd\""},
+    {1114, 13, 15, "Bob's Machine", "\"Bob's Machine\""},
+    {1115, 23, 25, "Gems Sensors & Controls", "\"Gems Sensors & Controls\""},
+    {1116, 20, 22, "HR Agrartechnik GmbH", "\"HR Agrartechnik GmbH\""},
+    {1117, 12, 14, "LG Chem, Ltd", "\"LG Chem, Ltd\""},
+    {1118, 12, 14, "L3Harris ASV", "\"L3Harris ASV\""},
+    {1119, 10, 12, "Balmar LLC", "\"Balmar LLC\""},
+    {1120, 19, 21, "Elettromedia s.r.l.", "\"Elettromedia s.r.l.\""},
+    {1121, 16, 18, "Platform Science", "\"Platform Science\""},
+    {1122, 7, 9, "GT Inc.", "\"GT Inc.\""},
+    {1123, 13, 15, "QP Hydraulics", "\"QP Hydraulics\""},
+    {1124, 19, 21, "Fortron Agriculture", "\"Fortron Agriculture\""},
+    {1125, 25, 27, "Griffith-Elder & Co. Ltd.", "\"Griffith-Elder & Co. Ltd.\""},
+    {1126, 7, 9, "Auralix", "\"Auralix\""},
+    {1127, 11, 13, "ElectroMaax", "\"ElectroMaax\""},
+    {1128, 48, 50, "Citoon Electronic Technology (Tianjin) Co., Ltd.", "\"Citoon Electronic Technology (Tianjin) Co., Ltd.\""},
+    {1129, 17, 19, "Spectrolytic GmbH", "\"Spectrolytic GmbH\""},
+    {1130, 20, 22, "Vitesco Technologies", "\"Vitesco Technologies\""},
+    {1131, 26, 28, "Guliwer electronics s.r.o.", "\"Guliwer electronics s.r.o.\""},
+    {1132, 14, 16, "Tokachi Zaidan", "\"Tokachi Zaidan\""},
+    {1133, 33, 35, "MEGATRON Elektronik GmbH & Co. KG", "\"MEGATRON Elektronik GmbH & Co. KG\""},
+    {1134, 28, 30, "Master Schools at Ostbahnhof", "\"Master Schools at Ostbahnhof\""},
+    {1135, 44, 46, "Japan Aviation Electronics Industry, Limited", "\"Japan Aviation Electronics Industry, Limited\""},
+    {1136, 16, 18, "Primosensor GmbH", "\"Primosensor GmbH\""},
+    {1137, 9, 11, "SIKO GmbH", "\"SIKO GmbH\""},
+    {1138, 17, 19, "Micro-Sensor GmbH", "\"Micro-Sensor GmbH\""},
+    {1139, 14, 16, "ASP Technology", "\"ASP Technology\""},
+    {1140, 26, 28, "Across Oceans Systems Ltd.", "\"Across Oceans Systems Ltd.\""},
+    {1141, 28, 30, "MRS Electronic GmbH & Co. KG", "\"MRS Electronic GmbH & Co. KG\""},
+    {1142, 5, 7, "Truma", "\"Truma\""},
+    {1143, 18, 20, "Elektro-Szoft 2000", "\"Elektro-Szoft 2000\""},
+    {1144, 16, 18, "Troo Corporation", "\"Troo Corporation\""},
+    {1145, 13, 15, "Kiwi Yachting", "\"Kiwi Yachting\""},
+    {1146, 8, 10, "Rometron", "\"Rometron\""},
+    {1147, 9, 11, "Dana Inc.", "\"Dana Inc.\""},
+    {1148, 28, 30, "Stercom Power Solutions GmbH", "\"Stercom Power Solutions GmbH\""},
+    {1149, 35, 37, "Wuxi Shengbang Electronics Co., Ltd", "\"Wuxi Shengbang Electronics Co., Ltd\""},
+    {1150, 32, 34, "BSB Artificial Intelligence GmbH", "\"BSB Artificial Intelligence GmbH\""},
+    {1151, 20, 22, "Orca Technologies AS", "\"Orca Technologies AS\""},
+    {1152, 20, 22, "Vredo Dodewaard B.V.", "\"Vredo Dodewaard B.V.\""},
+    {1153, 31, 33, "Kawasaki Heavy Industries, Ltd.", "\"Kawasaki Heavy Industries, Ltd.\""},
+    {1154, 18, 20, "TBS Electronics BV", "\"TBS Electronics BV\""},
+    {1155, 48, 50, "LACOS GmbH (formerly LACOS Computerservice GmbH)", "\"LACOS GmbH (formerly LACOS Computerservice GmbH)\""},
+    {1156, 12, 14, "Nokian Tyres", "\"Nokian Tyres\""},
+    {1157, 14, 16, "Carriergistics", "\"Carriergistics\""},
+    {1158, 21, 23, "Technoton Electronics", "\"Technoton Electronics\""},
+    {1159, 19, 21, "Bel Power Solutions", "\"Bel Power Solutions\""},
+    {1160, 22, 24, "MG Energy Systems B.V.", "\"MG Energy Systems B.V.\""},
+    {1161, 15, 17, "Griessbach GmbH", "\"Griessbach GmbH\""},
+    {1162, 12, 14, "PEL-tuote Oy", "\"PEL-tuote Oy\""},
+    {1163, 20, 22, "DFX Technologies LLC", "\"DFX Technologies LLC\""},
+    {1164, 14, 16, "SEG Automotive", "\"SEG Automotive\""},
+    {1165, 12, 14, "InnoTotal AB", "\"InnoTotal AB\""},
+    {1166, 36, 38, "Wachendorff Automation GmbH & Co. KG", "\"Wachendorff Automation GmbH & Co. KG\""},
+    {1167, 12, 14, "Tevva Motors", "\"Tevva Motors\""},
+    {1168, 11, 13, "Masats S.A.", "\"Masats S.A.\""},
+    {1169, 25, 27, "Sea Machine Robotics Inc.", "\"Sea Machine Robotics Inc.\""},
+    {1170, 27, 29, "Poseidon Ocean Systems Ltd.", "\"Poseidon Ocean Systems Ltd.\""},
+    {1171, 19, 21, "Vista Manufacturing", "\"Vista Manufacturing\""},
+    {1172, 12, 14, "Hyzon Motors", "\"Hyzon Motors\""},
+    {1173, 33, 35, "philippi elektrische systeme gmbh", "\"philippi elektrische systeme gmbh\""},
+    {1174, 12, 14, "Agricon GmbH", "\"Agricon GmbH\""},
+    {1175, 21, 23, "MAGTEC Products, Inc.", "\"MAGTEC Products, Inc.\""},
+    {1176, 11, 13, "Asuns Corp.", "\"Asuns Corp.\""},
+    {1177, 22, 24, "RNG International Inc.", "\"RNG International Inc.\""},
+    {1178, 8, 10, "ERO GmbH", "\"ERO GmbH\""},
+    {1179, 14, 16, "QS Control srl", "\"QS Control srl\""},
+    {1180, 27, 29, "Murata Power Solutions Inc.", "\"Murata Power Solutions Inc.\""},
+    {1181, 17, 19, "Banjo Corporation", "\"Banjo Corporation\""},
+    {1182, 19, 21, "Rottmann Automation", "\"Rottmann Automation\""},
+    {1183, 10, 12, "Zipwake AB", "\"Zipwake AB\""},
+    {1184, 10, 12, "AMA S.p.A.", "\"AMA S.p.A.\""},
+    {1185, 16, 18, "WFCO Electronics", "\"WFCO Electronics\""},
+    {1186, 10, 12, "Sailmon BV", "\"Sailmon BV\""},
+    {1187, 17, 19, "TiTAN-Project LLC", "\"TiTAN-Project LLC\""},
+    {1188, 5, 7, "G-SNS", "\"G-SNS\""},
+    {1189, 25, 27, "Autotrasporti Cavallo G&V", "\"Autotrasporti Cavallo G&V\""},
+    {1190, 10, 12, "Sirros IoT", "\"Sirros IoT\""},
+    {1191, 16, 18, "Pacoma USA, Inc.", "\"Pacoma USA, Inc.\""},
+    {1192, 17, 19, "Airmoniq Pro Kft.", "\"Airmoniq Pro Kft.\""},
+    {1193, 34, 36, "emotas embedded communication GmbH", "\"emotas embedded communication GmbH\""},
+    {1194, 13, 15, "Sierra Marine", "\"Sierra Marine\""},
+    {1195, 11, 13, "düvelsdorf", "\"düvelsdorf\""},
+    {1196, 15, 17, "Terra Care GmbH", "\"Terra Care GmbH\""},
+    {1197, 17, 19, "SOLGE Corporation", "\"SOLGE Corporation\""},
+    {1198, 38, 40, "ComLink Equipamentos Eletrônicos Ltda", "\"ComLink Equipamentos Eletrônicos Ltda\""},
+    {1199, 22, 24, "ELEO Technologies B.V.", "\"ELEO Technologies B.V.\""},
+    {1200, 57, 59, "Xinuo Information Technology (Xiamen) Corporation Limited", "\"Xinuo Information Technology (Xiamen) Corporation Limited\""},
+    {1201, 26, 28, "Emisense Technologies, LLC", "\"Emisense Technologies, LLC\""},
+    {1202, 50, 52, "OSCAR ELECTRONICS SRL (formerly OSCAR Elettronica)", "\"OSCAR ELECTRONICS SRL (formerly OSCAR Elettronica)\""},
+    {1203, 28, 30, "Equipment Technologies, Inc.", "\"Equipment Technologies, Inc.\""},
+    {1204, 30, 32, "Miller Technology Incorporated", "\"Miller Technology Incorporated\""},
+    {1205, 33, 35, "Carbon Autonomous Robotic Systems", "\"Carbon Autonomous Robotic Systems\""},
+    {1206, 18, 20, "STE Solutions B.V.", "\"STE Solutions B.V.\""},
+    {1207, 15, 17, "UEC Electronics", "\"UEC Electronics\""},
+    {1208, 30, 32, "Afflield Kft. (MachineryGuide)", "\"Afflield Kft. (MachineryGuide)\""},
+    {1209, 20, 22, "Bauser GmbH & Co. KG", "\"Bauser GmbH & Co. KG\""},
+    {1210, 15, 17, "Ambra Solutions", "\"Ambra Solutions\""},
+    {1211, 27, 29, "Kiwon Electronics Co., Ltd.", "\"Kiwon Electronics Co., Ltd.\""},
+    {1212, 23, 25, "TAO Performance Limited", "\"TAO Performance Limited\""},
+    {1213, 16, 18, "Apollo Tyres Ltd", "\"Apollo Tyres Ltd\""},
+    {1214, 9, 11, "Element 1", "\"Element 1\""},
+    {1215, 21, 23, "Power Control Systems", "\"Power Control Systems\""},
+    {1216, 21, 23, "SMP Poland sp. z o.o.", "\"SMP Poland sp. z o.o.\""},
+    {1217, 38, 40, "FSG Fernsteuergeräte Kurt Oelsch GmbH", "\"FSG Fernsteuergeräte Kurt Oelsch GmbH\""},
+    {1218, 10, 12, "Septentrio", "\"Septentrio\""},
+    {1219, 35, 37, "Weidmueller Interface GmbH & Co. KG", "\"Weidmueller Interface GmbH & Co. KG\""},
+    {1220, 25, 27, "Catamaran Electronics LLC", "\"Catamaran Electronics LLC\""},
+    {1221, 12, 14, "Norcold Inc.", "\"Norcold Inc.\""},
+    {1222, 15, 17, "Tough Tech Ltd.", "\"Tough Tech Ltd.\""},
+    {1223, 51, 53, "Toyo Agricultural Machinery Manufacturing Co., Ltd.", "\"Toyo Agricultural Machinery Manufacturing Co., Ltd.\""},
+    {1224, 26, 28, "Neuser Elektrotechnik GmbH", "\"Neuser Elektrotechnik GmbH\""},
+    {1225, 29, 31, "SeedMaster Manufacturing Ltd.", "\"SeedMaster Manufacturing Ltd.\""},
+    {1226, 16, 18, "Piippo Hydraulic", "\"Piippo Hydraulic\""},
+    {1227, 16, 18, "YAHATA Co., Ltd.", "\"YAHATA Co., Ltd.\""},
+    {1228, 13, 15, "INTILION GmbH", "\"INTILION GmbH\""},
+    {1229, 18, 20, "Arcon Designs, LLC", "\"Arcon Designs, LLC\""},
+    {1230, 34, 36, "Nick Abbey Digital Agriculture Ltd", "\"Nick Abbey Digital Agriculture Ltd\""},
+    {1231, 10, 12, "Excidor AB", "\"Excidor AB\""},
+    {1232, 35, 37, "Treffler Maschinenbau GmbH & Co. KG", "\"Treffler Maschinenbau GmbH & Co. KG\""},
+    {1233, 22, 24, "nke Marine Electronics", "\"nke Marine Electronics\""},
+    {1234, 26, 28, "American Battery Solutions", "\"American Battery Solutions\""},
+    {1235, 21, 23, "NESAN Automotive Inc.", "\"NESAN Automotive Inc.\""},
+    {1236, 10, 12, "Agrosystem", "\"Agrosystem\""},
+    {1237, 36, 38, "Changzhou Lambda Electronic Co., Ltd", "\"Changzhou Lambda Electronic Co., Ltd\""},
+    {1238, 26, 28, "Honda Electronics Co., Ltd", "\"Honda Electronics Co., Ltd\""},
+    {1239, 14, 16, "SuperTrack Aps", "\"SuperTrack Aps\""},
+    {1240, 8, 10, "TiMOTION", "\"TiMOTION\""},
+    {1241, 13, 15, "Ineo Systrans", "\"Ineo Systrans\""},
+    {1242, 21, 23, "Super Start Batteries", "\"Super Start Batteries\""},
+    {1243, 12, 14, "AvMap S.r.l.", "\"AvMap S.r.l.\""},
+    {1244, 13, 15, "Planti Center", "\"Planti Center\""},
+    {1245, 32, 34, "Raritan Engineering Company, Inc", "\"Raritan Engineering Company, Inc\""},
+    {1246, 30, 32, "Rother Industries & Technology", "\"Rother Industries & Technology\""},
+    {1247, 5, 7, "GRIFA", "\"GRIFA\""},
+    {1248, 36, 38, "O.M.F.B. S.p.A. Hydraulic Components", "\"O.M.F.B. S.p.A. Hydraulic Components\""},
+    {1249, 29, 31, "Integrated Power Solutions AG", "\"Integrated Power Solutions AG\""},
+    {1250, 4, 6, "ELHO", "\"ELHO\""},
+    {1251, 30, 32, "Valmet Automotive EV Power Ltd", "\"Valmet Automotive EV Power Ltd\""},
+    {1252, 30, 32, "APV - Technische Produkte GmbH", "\"APV - Technische Produkte GmbH\""},
+    {1253, 9, 11, "Trafag AG", "\"Trafag AG\""},
+    {1254, 9, 11, "ARADEX AG", "\"ARADEX AG\""},
+    {1255, 22, 24, "Altec Industries, Inc.", "\"Altec Industries, Inc.\""},
+    {1256, 31, 33, "Dimensions Agri Technologies AS", "\"Dimensions Agri Technologies AS\""},
+    {1257, 6, 8, "KOSTAL", "\"KOSTAL\""},
+    {1258, 16, 18, "AGC Technologies", "\"AGC Technologies\""},
+    {1259, 35, 37, "Grayson Automotive Services Limited", "\"Grayson Automotive Services Limited\""},
+    {1260, 30, 32, "Interactive Technologies, Inc.", "\"Interactive Technologies, Inc.\""},
+    {1261, 6, 8, "AgXeed", "\"AgXeed\""},
+    {1262, 13, 15, "Fort Robotics", "\"Fort Robotics\""},
+    {1263, 33, 35, "BOS Balance of Storage Systems AG", "\"BOS Balance of Storage Systems AG\""},
+    {1264, 10, 12, "Microelect", "\"Microelect\""},
+    {1265, 22, 24, "IPETRONIK GmbH & Co KG", "\"IPETRONIK GmbH & Co KG\""},
+    {1266, 24, 26, "Hyundai Doosan Infracore", "\"Hyundai Doosan Infracore\""},
+    {1267, 16, 18, "Wacker Neuson SE", "\"Wacker Neuson SE\""},
+    {1268, 22, 24, "Back 40 Precision Inc.", "\"Back 40 Precision Inc.\""},
+    {1269, 21, 23, "VIS Hydraulics s.r.l.", "\"VIS Hydraulics s.r.l.\""},
+    {1270, 21, 23, "Versalift Denmark A/S", "\"Versalift Denmark A/S\""},
+    {1271, 15, 17, "Raven Connected", "\"Raven Connected\""},
+    {1272, 12, 14, "Samsara Inc.", "\"Samsara Inc.\""},
+    {1273, 22, 24, "Clearflame Engines Inc", "\"Clearflame Engines Inc\""},
+    {1274, 14, 16, "LDL Technology", "\"LDL Technology\""},
+    {1275, 39, 41, "O.M.P. Officine Mazzocco Pagnoni S.r.l.", "\"O.M.P. Officine Mazzocco Pagnoni S.r.l.\""},
+    {1276, 23, 25, "Aspin Kemp & Associates", "\"Aspin Kemp & Associates\""},
+    {1277, 16, 18, "BMZ Germany GmbH", "\"BMZ Germany GmbH\""},
+    {1278, 26, 28, "Comrod Communication Group", "\"Comrod Communication Group\""},
+    {1279, 21, 23, "Ognibene Power S.p.A.", "\"Ognibene Power S.p.A.\""},
+    {1280, 17, 19, "SANTEST CO., LTD.", "\"SANTEST CO., LTD.\""},
+    {1281, 5, 7, "iQuus", "\"iQuus\""},
+    {1282, 30, 32, "COTEK ELECTRONIC IND. CO., LTD", "\"COTEK ELECTRONIC IND. CO., LTD\""},
+    {1283, 8, 10, "LTG Tech", "\"LTG Tech\""},
+    {1284, 17, 19, "Robot Makers GmbH", "\"Robot Makers GmbH\""},
+    {1285, 10, 12, "Graco Inc.", "\"Graco Inc.\""},
+    {1286, 10, 12, "NEXAT GmbH", "\"NEXAT GmbH\""},
+    {1287, 13, 15, "Spartan Radar", "\"Spartan Radar\""},
+    {1288, 16, 18, "ANELLO Photonics", "\"ANELLO Photonics\""},
+    {1289, 24, 26, "Loadrite (Auckland) Ltd.", "\"Loadrite (Auckland) Ltd.\""},
+    {1290, 22, 24, "WaveTamer Partners LLC", "\"WaveTamer Partners LLC\""},
+    {1291, 28, 30, "Forward Thinking Systems LLC", "\"Forward Thinking Systems LLC\""},
+    {1292, 41, 43, "SUMITOMO CONSTRUCTION MACHINERY Co., Ltd.", "\"SUMITOMO CONSTRUCTION MACHINERY Co., Ltd.\""},
+    {1293, 7, 9, "POSITAL", "\"POSITAL\""},
+    {1294, 18, 20, "TR-Electronic GmbH", "\"TR-Electronic GmbH\""},
+    {1295, 8, 10, "SIP d.d.", "\"SIP d.d.\""},
+    {1296, 7, 9, "Hexagon", "\"Hexagon\""},
+    {1297, 39, 41, "Micro-Epsilon Messtechnik GmbH & Co. KG", "\"Micro-Epsilon Messtechnik GmbH & Co. KG\""},
+    {1298, 35, 37, "SFOGGIA Agriculture Division S.r.l.", "\"SFOGGIA Agriculture Division S.r.l.\""},
+    {1299, 16, 18, "Energy Solutions", "\"Energy Solutions\""},
+    {1300, 26, 28, "Watt Fuel Cell Corporation", "\"Watt Fuel Cell Corporation\""},
+    {1301, 23, 25, "Tecumseh do Brasil Ltda", "\"Tecumseh do Brasil Ltda\""},
+    {1302, 10, 12, "ProMariner", "\"ProMariner\""},
+    {1303, 17, 19, "Carbon Bee AgTech", "\"Carbon Bee AgTech\""},
+    {1304, 21, 23, "Palfinger Europe GmbH", "\"Palfinger Europe GmbH\""},
+    {1305, 16, 18, "dragonfly Energy", "\"dragonfly Energy\""},
+    {1306, 27, 29, "Koden Electronics Co., Ltd.", "\"Koden Electronics Co., Ltd.\""},
+    {1307, 16, 18, "Smart AG Systems", "\"Smart AG Systems\""},
+    {1308, 8, 10, "Agtecnic", "\"Agtecnic\""},
+    {1309, 43, 45, "Shanghai Zhichuan Electronic Tech Co., Ltd.", "\"Shanghai Zhichuan Electronic Tech Co., Ltd.\""},
+    {1310, 48, 50, "LPL Systems (formerly Loughborough Projects Ltd)", "\"LPL Systems (formerly Loughborough Projects Ltd)\""},
+    {1311, 11, 13, "Humphree AB", "\"Humphree AB\""},
+    {1312, 23, 25, "Control Devices Pty Ltd", "\"Control Devices Pty Ltd\""},
+    {1313, 50, 52, "United States Army - Ground Vehicle Systems Center", "\"United States Army - Ground Vehicle Systems Center\""},
+    {1314, 26, 28, "Newton Crouch Company, LLC", "\"Newton Crouch Company, LLC\""},
+    {1315, 22, 24, "SMPC Technologies Ltd.", "\"SMPC Technologies Ltd.\""},
+    {1316, 14, 16, "Hinkley Yachts", "\"Hinkley Yachts\""},
+    {1317, 37, 39, "GMM - Global Maritime Management GmbH", "\"GMM - Global Maritime Management GmbH\""},
+    {1318, 20, 22, "Atlis Motor Vehicles", "\"Atlis Motor Vehicles\""},
+    {1319, 24, 26, "I/O Controls Corporation", "\"I/O Controls Corporation\""},
+    {1320, 18, 20, "Triskel Marine Ltd", "\"Triskel Marine Ltd\""},
+    {1321, 19, 21, "PATLITE Corporation", "\"PATLITE Corporation\""},
+    {1322, 10, 12, "Movimatica", "\"Movimatica\""},
+    {1323, 21, 23, "Briter Products, Inc.", "\"Briter Products, Inc.\""},
+    {1324, 20, 22, "Bourgault Industries", "\"Bourgault Industries\""},
+    {1325, 36, 38, "OPW (formerly BASE Engineering Inc.)", "\"OPW (formerly BASE Engineering Inc.)\""},
+    {1326, 19, 21, "HBC-radiomatic GmbH", "\"HBC-radiomatic GmbH\""},
+    {1327, 18, 20, "Frans Vervaet B.V.", "\"Frans Vervaet B.V.\""},
+    {1328, 12, 14, "PerPlant ApS", "\"PerPlant ApS\""},
+    {1329, 10, 12, "IDM S.r.l.", "\"IDM S.r.l.\""},
+    {1330, 28, 30, "Warwick Control Technologies", "\"Warwick Control Technologies\""},
+    {1331, 15, 17, "Dolphin Charger", "\"Dolphin Charger\""},
+    {1332, 22, 24, "Fairbanks Scales, Inc.", "\"Fairbanks Scales, Inc.\""},
+    {1333, 21, 23, "xFarm Technologies SA", "\"xFarm Technologies SA\""},
+    {1334, 13, 15, "Greer Company", "\"Greer Company\""},
+    {1335, 8, 10, "CPDEVICE", "\"CPDEVICE\""},
+    {1336, 25, 27, "Aegis Power Systems, Inc.", "\"Aegis Power Systems, Inc.\""},
+    {1337, 21, 23, "Barnacle Systems Inc.", "\"Barnacle Systems Inc.\""},
+    {1338, 15, 17, "Volta Trucks AB", "\"Volta Trucks AB\""},
+    {1339, 36, 38, "Tillett and Hague Technology Limited", "\"Tillett and Hague Technology Limited\""},
+    {1340, 45, 47, "ORELTEK Elektronik ve Yazılım Teknolojileri", "\"ORELTEK Elektronik ve Yazılım Teknolojileri\""},
+    {1341, 22, 24, "Ag Express Electronics", "\"Ag Express Electronics\""},
+    {1342, 22, 24, "DKE-Data GmbH & Co. KG", "\"DKE-Data GmbH & Co. KG\""},
+    {1343, 15, 17, "Heavy Data GmbH", "\"Heavy Data GmbH\""},
+    {1344, 14, 16, "Haulotte Group", "\"Haulotte Group\""},
+    {1345, 32, 34, "PRIGNITZ Mikrosystemtechnik GmbH", "\"PRIGNITZ Mikrosystemtechnik GmbH\""},
+    {1346, 13, 15, "Einboeck GmbH", "\"Einboeck GmbH\""},
+    {1347, 30, 32, "Munckhof Fruit Tech Innovators", "\"Munckhof Fruit Tech Innovators\""},
+    {1348, 16, 18, "Radian IoT, Inc.", "\"Radian IoT, Inc.\""},
+    {1349, 28, 30, "ANNABURGER Nutzfahrzeug GmbH", "\"ANNABURGER Nutzfahrzeug GmbH\""},
+    {1350, 9, 11, "AGRONETIC", "\"AGRONETIC\""},
+    {1351, 32, 34, "Motorenfabrik Hatz GmbH & Co. KG", "\"Motorenfabrik Hatz GmbH & Co. KG\""},
+    {1352, 21, 23, "NISHIYAMA Corporation", "\"NISHIYAMA Corporation\""},
+    {1353, 20, 22, "Ocean LED Marine Ltd", "\"Ocean LED Marine Ltd\""},
+    {1354, 46, 48, "Técnicas de Electrónica y Automatismos, S.A.", "\"Técnicas de Electrónica y Automatismos, S.A.\""},
+    {1355, 21, 23, "DROP Agricultura Ltda", "\"DROP Agricultura Ltda\""},
+    {1356, 17, 19, "Nordic Lights Ltd", "\"Nordic Lights Ltd\""},
+    {1357, 9, 11, "TireCheck", "\"TireCheck\""},
+    {1358, 20, 22, "Fontaine Fifth Wheel", "\"Fontaine Fifth Wheel\""},
+    {1359, 7, 9, "BlueNav", "\"BlueNav\""},
+    {1360, 12, 14, "Lemca Vision", "\"Lemca Vision\""},
+    {1361, 37, 39, "Nantong Saiyang Electronics Co., Ltd.", "\"Nantong Saiyang Electronics Co., Ltd.\""},
+    {1362, 8, 10, "Zparq AB", "\"Zparq AB\""},
+    {1363, 8, 10, "Calix AB", "\"Calix AB\""},
+    {1364, 13, 15, "Yashu Systems", "\"Yashu Systems\""},
+    {1365, 22, 24, "JVCKENWOOD Corporation", "\"JVCKENWOOD Corporation\""},
+    {1366, 32, 34, "Telemecanique Sensors & Switches", "\"Telemecanique Sensors & Switches\""},
+    {1367, 9, 11, "Dewulf NV", "\"Dewulf NV\""},
+    {1368, 18, 20, "RAD Propulsion Ltd", "\"RAD Propulsion Ltd\""},
+    {1369, 14, 16, "Electric Yacht", "\"Electric Yacht\""},
+    {1370, 11, 13, "Emtech S.A.", "\"Emtech S.A.\""},
+    {1371, 10, 12, "First Mode", "\"First Mode\""},
+    {1372, 17, 19, "Elco Motor Yachts", "\"Elco Motor Yachts\""},
+    {1373, 17, 19, "Centek Industries", "\"Centek Industries\""},
+    {1374, 14, 16, "CASAPPA S.p.A.", "\"CASAPPA S.p.A.\""},
+    {1375, 20, 22, "ŠKODA ELECTRIC a.s.", "\"ŠKODA ELECTRIC a.s.\""},
+    {1376, 23, 25, "SUNS International, LLC", "\"SUNS International, LLC\""},
+    {1377, 13, 15, "ABD Solutions", "\"ABD Solutions\""},
+    {1378, 10, 12, "Bertini SA", "\"Bertini SA\""},
+    {1379, 9, 11, "Novag SAS", "\"Novag SAS\""},
+    {1380, 19, 21, "ADVES GmbH & Co. KG", "\"ADVES GmbH & Co. KG\""},
+    {1381, 23, 25, "Dr. Diesel Technologies", "\"Dr. Diesel Technologies\""},
+    {1382, 19, 21, "Thornwave Labs Inc.", "\"Thornwave Labs Inc.\""},
+    {1383, 13, 15, "Alpego S.p.A.", "\"Alpego S.p.A.\""},
+    {1384, 24, 26, "Tecnoseal Foundry S.r.l.", "\"Tecnoseal Foundry S.r.l.\""},
+    {1385, 25, 27, "Pro Charging Systems, LLC", "\"Pro Charging Systems, LLC\""},
+    {1386, 12, 14, "Smart Eye AB", "\"Smart Eye AB\""},
+    {1387, 15, 17, "Radel (Pty) Ltd", "\"Radel (Pty) Ltd\""},
+    {1388, 15, 17, "Nira Technology", "\"Nira Technology\""},
+    {1389, 13, 15, "EVEX Co., LTD", "\"EVEX Co., LTD\""},
+    {1390, 33, 35, "FJ Dynamics International Limited", "\"FJ Dynamics International Limited\""},
+    {1391, 8, 10, "AriensCo", "\"AriensCo\""},
+    {1392, 19, 21, "Phoenix America LLC", "\"Phoenix America LLC\""},
+    {1393, 24, 26, "Powerland Technology Inc", "\"Powerland Technology Inc\""},
+    {1394, 55, 57, "Zhejiang Ruixing Electromechanical Technology Co., Ltd.", "\"Zhejiang Ruixing Electromechanical Technology Co., Ltd.\""},
+    {1395, 14, 16, "MLB Industrial", "\"MLB Industrial\""},
+    {1396, 22, 24, "Fast Ag Solutions, LLC", "\"Fast Ag Solutions, LLC\""},
+    {1397, 17, 19, "SaMASZ Sp. Z o.o.", "\"SaMASZ Sp. Z o.o.\""},
+    {1398, 27, 29, "Gobius Sensor Technology AB", "\"Gobius Sensor Technology AB\""},
+    {1399, 48, 50, "Hans Brantner & Sohn Fahrzeugbaugesellschaft mbH", "\"Hans Brantner & Sohn Fahrzeugbaugesellschaft mbH\""},
+    {1400, 17, 19, "IWN GmbH & Co. KG", "\"IWN GmbH & Co. KG\""},
+    {1401, 23, 25, "ROM Communications Inc.", "\"ROM Communications Inc.\""},
+    {1402, 22, 24, "ComNav Technology Ltd.", "\"ComNav Technology Ltd.\""},
+    {1403, 11, 13, "Arco Marine", "\"Arco Marine\""},
+    {1404, 16, 18, "BRUSA HyPower AG", "\"BRUSA HyPower AG\""},
+    {1405, 17, 19, "TELIG Electronics", "\"TELIG Electronics\""},
+    {1406, 15, 17, "Lumilex ALT SRL", "\"Lumilex ALT SRL\""},
+    {1407, 16, 18, "Open-Agriculture", "\"Open-Agriculture\""},
+    {1408, 17, 19, "Lenco Marine Inc.", "\"Lenco Marine Inc.\""},
+    {1409, 18, 20, "Z Elektronika Kft.", "\"Z Elektronika Kft.\""},
+    {1410, 34, 36, "Allan Equipment Manufacturing Ltd.", "\"Allan Equipment Manufacturing Ltd.\""},
+    {1411, 41, 43, "Shanghai Huace Navigation Technology Ltd.", "\"Shanghai Huace Navigation Technology Ltd.\""},
+    {1412, 15, 17, "Naocontrol S.L.", "\"Naocontrol S.L.\""},
+    {1413, 11, 13, "OHNOH2O LLC", "\"OHNOH2O LLC\""},
+    {1414, 21, 23, "INTRACOM DEFENSE S.A.", "\"INTRACOM DEFENSE S.A.\""},
+    {1415, 31, 33, "Máquinas Agrícolas Jacto S.A.", "\"Máquinas Agrícolas Jacto S.A.\""},
+    {1416, 14, 16, "Wavetronix LLC", "\"Wavetronix LLC\""},
+    {1417, 11, 13, "Revatek LLC", "\"Revatek LLC\""},
+    {1418, 19, 21, "Karluna Engineering", "\"Karluna Engineering\""},
+    {1419, 13, 15, "iPatch Marine", "\"iPatch Marine\""},
+    {1420, 42, 44, "TALOS - Precision Measurement Technologies", "\"TALOS - Precision Measurement Technologies\""},
+    {1421, 12, 14, "Clarios, LLC", "\"Clarios, LLC\""},
+    {1422, 7, 9, "xTCU AG", "\"xTCU AG\""},
+    {1423, 7, 9, "AC S.A.", "\"AC S.A.\""},
+    {1424, 5, 7, "Bewis", "\"Bewis\""},
+    {1425, 71, 73, "Electronics in Agriculture, School of Engineering, University of Galway", "\"Electronics in Agriculture, School of Engineering, University of Galway\""},
+    {1426, 12, 14, "Samson Group", "\"Samson Group\""},
+    {1427, 14, 16, "REITER RESPIRO", "\"REITER RESPIRO\""},
+    {1428, 22, 24, "Samo Maschinenbau GmbH", "\"Samo Maschinenbau GmbH\""},
+    {1429, 18, 20, "Nikola Corporation", "\"Nikola Corporation\""},
+    {1430, 27, 29, "Mantracourt Electronics Ltd", "\"Mantracourt Electronics Ltd\""},
+    {1431, 10, 12, "Nauto Inc.", "\"Nauto Inc.\""},
+    {1432, 16, 18, "MDH Defence Ltd.", "\"MDH Defence Ltd.\""},
+    {1433, 14, 16, "Unicontrol ApS", "\"Unicontrol ApS\""},
+    {1434, 17, 19, "eSurvey GNSS Ltd.", "\"eSurvey GNSS Ltd.\""},
+    {1435, 38, 40, "Heilongjiang Huida Technology Co., Ltd", "\"Heilongjiang Huida Technology Co., Ltd\""},
+    {1436, 8, 10, "M-extend", "\"M-extend\""},
+    {1437, 25, 27, "DOKEN Technology Co. Ltd.", "\"DOKEN Technology Co. Ltd.\""},
+    {1438, 10, 12, "Aeolionics", "\"Aeolionics\""},
+    {1439, 15, 17, "PredictWind Ltd", "\"PredictWind Ltd\""},
+    {1440, 20, 22, "Egis Mobile Electric", "\"Egis Mobile Electric\""},
+    {1441, 36, 38, "Shanghai Allynav Technology Co.,Ltd.", "\"Shanghai Allynav Technology Co.,Ltd.\""},
+    {1442, 11, 13, "EVYTRA GmbH", "\"EVYTRA GmbH\""},
+    {1443, 22, 24, "SoilEssentials Limited", "\"SoilEssentials Limited\""},
+    {1444, 16, 18, "Micropower Group", "\"Micropower Group\""},
+    {1445, 21, 23, "Starboard Yacht Group", "\"Starboard Yacht Group\""},
+    {1446, 14, 16, "Roswell Marine", "\"Roswell Marine\""},
+    {1447, 26, 28, "Innotag Distributions Inc.", "\"Innotag Distributions Inc.\""},
+    {1448, 21, 23, "Elmer's Manufacturing", "\"Elmer's Manufacturing\""},
+    {1449, 13, 15, "Bontaz Centre", "\"Bontaz Centre\""},
+    {1450, 8, 10, "Agrivaux", "\"Agrivaux\""},
+    {1451, 37, 39, "Guangdong ePropulsion Technology Ltd.", "\"Guangdong ePropulsion Technology Ltd.\""},
+    {1452, 13, 15, "Micro-Air LLC", "\"Micro-Air LLC\""},
+    {1453, 13, 15, "Vital Battery", "\"Vital Battery\""},
+    {1454, 9, 11, "QTIS B.V.", "\"QTIS B.V.\""},
+    {1455, 55, 57, "Eberspächer Climate Control Systems International GmbH", "\"Eberspächer Climate Control Systems International GmbH\""},
+    {1456, 23, 25, "Krampe Fahrzeugbau GmbH", "\"Krampe Fahrzeugbau GmbH\""},
+    {1457, 22, 24, "Albach Maschinenbau AG", "\"Albach Maschinenbau AG\""},
+    {1458, 18, 20, "RideController LLC", "\"RideController LLC\""},
+    {1459, 22, 24, "Advanced Input Systems", "\"Advanced Input Systems\""},
+    {1460, 11, 13, "Tocaro Blue", "\"Tocaro Blue\""},
+    {1461, 15, 17, "Vanquish Yachts", "\"Vanquish Yachts\""},
+    {1462, 13, 15, "Trackunit ApS", "\"Trackunit ApS\""},
+    {1463, 13, 15, "STOK Electric", "\"STOK Electric\""},
+    {1464, 40, 42, "Hi-Target Surveying Instrument Co., Ltd.", "\"Hi-Target Surveying Instrument Co., Ltd.\""},
+    {1465, 7, 9, "Watteco", "\"Watteco\""},
+    {1466, 23, 25, "Sveaverken Svea Agri AB", "\"Sveaverken Svea Agri AB\""},
+    {1467, 15, 17, "S.A.E.T. s.r.l.", "\"S.A.E.T. s.r.l.\""},
+    {1468, 7, 9, "Senquip", "\"Senquip\""},
+    {1469, 8, 10, "LS Mtron", "\"LS Mtron\""},
+    {1470, 9, 11, "GemOne NV", "\"GemOne NV\""},
+    {1471, 15, 17, "FT Technologies", "\"FT Technologies\""},
+    {1472, 14, 16, "Acculon Energy", "\"Acculon Energy\""},
+    {1473, 24, 26, "Cranesmart Systems, Inc.", "\"Cranesmart Systems, Inc.\""},
+    {1474, 25, 27, "Calex Electronics Limited", "\"Calex Electronics Limited\""},
+    {1475, 19, 21, "DSP Solutions, Inc.", "\"DSP Solutions, Inc.\""},
+    {1476, 34, 36, "Wilhelm Stoll Maschinenfabrik GmbH", "\"Wilhelm Stoll Maschinenfabrik GmbH\""},
+    {1477, 13, 15, "TOBROCO-GIANT", "\"TOBROCO-GIANT\""},
+    {1478, 21, 23, "Alps Alpine Co., Ltd.", "\"Alps Alpine Co., Ltd.\""},
+    {1479, 12, 14, "A-Electronix", "\"A-Electronix\""},
+    {1480, 11, 13, "Thermo King", "\"Thermo King\""},
+    {1481, 14, 16, "E-Force Marine", "\"E-Force Marine\""},
+    {1482, 10, 12, "CMC Marine", "\"CMC Marine\""},
+    {1483, 52, 54, "Nanjing Sandemarine Information Technology Co., Ltd.", "\"Nanjing Sandemarine Information Technology Co., Ltd.\""},
+    {1484, 7, 9, "AgroOSA", "\"AgroOSA\""},
+    {1485, 17, 19, "Lester Electrical", "\"Lester Electrical\""},
+    {1486, 7, 9, "Xpanner", "\"Xpanner\""},
+    {1487, 7, 9, "Geosoft", "\"Geosoft\""},
+    {1488, 27, 29, "Boetkin Technology Co., LTD", "\"Boetkin Technology Co., LTD\""},
+    {1489, 14, 16, "Lite-Check LLC", "\"Lite-Check LLC\""},
+    {1490, 24, 26, "Clean Republic SODO, LLC", "\"Clean Republic SODO, LLC\""},
+    {1491, 12, 14, "Power Pollen", "\"Power Pollen\""},
+    {1492, 9, 11, "Softivert", "\"Softivert\""},
+    {1493, 9, 11, "Jantop Oy", "\"Jantop Oy\""},
+    {1494, 11, 13, "RAPITRONICS", "\"RAPITRONICS\""},
+    {1495, 9, 11, "FlyAgData", "\"FlyAgData\""},
+    {1496, 9, 11, "AgriRobot", "\"AgriRobot\""},
+    {1497, 8, 10, "ERMO Spa", "\"ERMO Spa\""},
+    {1498, 29, 31, "PM Pfanzelt Maschinenbau GmbH", "\"PM Pfanzelt Maschinenbau GmbH\""},
+    {1499, 22, 24, "Hydrasystem SP. Z O.O.", "\"Hydrasystem SP. Z O.O.\""},
+    {1500, 14, 16, "Scanstrut Inc.", "\"Scanstrut Inc.\""},
+    {1501, 17, 19, "Reverso Pumps LLC", "\"Reverso Pumps LLC\""},
+    {1502, 9, 11, "Barantech", "\"Barantech\""},
+    {1503, 28, 30, "Rosemount Specialty Products", "\"Rosemount Specialty Products\""},
+    {1504, 26, 28, "Nimbus Power Systems, Inc.", "\"Nimbus Power Systems, Inc.\""},
+    {1505, 9, 11, "BC Motion", "\"BC Motion\""},
+    {1506, 9, 11, "Expion360", "\"Expion360\""},
+    {1507, 13, 15, "Apex.AI, Inc.", "\"Apex.AI, Inc.\""},
+    {1508, 44, 46, "Xwatch Safety Solutions Ltd. part of Hexagon", "\"Xwatch Safety Solutions Ltd. part of Hexagon\""},
+    {1509, 17, 19, "Bondioli & Pavesi", "\"Bondioli & Pavesi\""},
+    {1510, 18, 20, "Austin Motor Works", "\"Austin Motor Works\""},
+    {1511, 19, 21, "APATOR METRA s.r.o.", "\"APATOR METRA s.r.o.\""},
+    {1512, 11, 13, "Lumitec LLC", "\"Lumitec LLC\""},
+    {1513, 22, 24, "Sy-Klone International", "\"Sy-Klone International\""},
+    {1514, 7, 9, "SYMX.ai", "\"SYMX.ai\""},
+    {1515, 28, 30, "Ingeniería y Sistemas Cerea", "\"Ingeniería y Sistemas Cerea\""},
+    {1516, 20, 22, "THERMIS spol. s r.o.", "\"THERMIS spol. s r.o.\""},
+    {1517, 19, 21, "Daedong Corporation", "\"Daedong Corporation\""},
+    {1518, 27, 29, "Nova Kool Manufacturing ULC", "\"Nova Kool Manufacturing ULC\""},
+    {1519, 49, 51, "Volboff Electron Science and Technology Co., Ltd.", "\"Volboff Electron Science and Technology Co., Ltd.\""},
+    {1520, 22, 24, "SRT Marine Systems PLC", "\"SRT Marine Systems PLC\""},
+    {1521, 16, 18, "Agricolmeccanica", "\"Agricolmeccanica\""},
+    {1522, 28, 30, "American Thermal Instruments", "\"American Thermal Instruments\""},
+    {1523, 16, 18, "Carlson Software", "\"Carlson Software\""},
+    {1524, 32, 34, "Ocean Infinity Solutions Limited", "\"Ocean Infinity Solutions Limited\""},
+    {1525, 14, 16, "Emsiso-emDrive", "\"Emsiso-emDrive\""},
+    {1526, 51, 53, "MITSUBISHI MAHINDRA AGRICULTURAL MACHINERY CO.,LTD.", "\"MITSUBISHI MAHINDRA AGRICULTURAL MACHINERY CO.,LTD.\""},
+    {1527, 38, 40, "Richardt Steuer- und Regelgeraete GmbH", "\"Richardt Steuer- und Regelgeraete GmbH\""},
+    {1528, 17, 19, "Savant Technology", "\"Savant Technology\""},
+    {1529, 32, 34, "Industrie Elektronik Brilon GmbH", "\"Industrie Elektronik Brilon GmbH\""},
+    {1530, 12, 14, "Roelama B.V.", "\"Roelama B.V.\""},
+    {1531, 39, 41, "Kobelco Construction Machinery Co.,Ltd.", "\"Kobelco Construction Machinery Co.,Ltd.\""},
+    {1532, 14, 16, "E-Switch, Inc.", "\"E-Switch, Inc.\""},
+    {1533, 11, 13, "Rieker Inc.", "\"Rieker Inc.\""},
+    {1534, 7, 9, "BluVein", "\"BluVein\""},
+    {1535, 27, 29, "LOX Container Technology AB", "\"LOX Container Technology AB\""},
+    {1536, 17, 19, "Tatra Trucks a.s.", "\"Tatra Trucks a.s.\""},
+    {1537, 28, 30, "Anyload Weigh & Measure Inc.", "\"Anyload Weigh & Measure Inc.\""},
+    {1538, 12, 14, "Quick S.p.A.", "\"Quick S.p.A.\""},
+    {1539, 30, 32, "Ceday Information Technologies", "\"Ceday Information Technologies\""},
+    {1540, 14, 16, "Ideas & Motion", "\"Ideas & Motion\""},
+    {1541, 18, 20, "Solid State Marine", "\"Solid State Marine\""},
+    {1542, 26, 28, "Global Digital Instruments", "\"Global Digital Instruments\""},
+    {1543, 15, 17, "GT Joysticks AG", "\"GT Joysticks AG\""},
+    {1544, 32, 34, "Geophysical Survey Systems, Inc.", "\"Geophysical Survey Systems, Inc.\""},
+    {1545, 8, 10, "RoadEazy", "\"RoadEazy\""},
+    {1546, 6, 8, "ESMART", "\"ESMART\""},
+    {1547, 59, 61, "Weichai Lovol Intelligent Agricultural Technology Co., Ltd.", "\"Weichai Lovol Intelligent Agricultural Technology Co., Ltd.\""},
+    {0},
+    {1549, 12, 14, "AM Co., Ltd.", "\"AM Co., Ltd.\""},
+    {1550, 16, 18, "Mario Tanzi S.A.", "\"Mario Tanzi S.A.\""},
+    {1551, 10, 12, "LMCE Group", "\"LMCE Group\""},
+    {1552, 40, 42, "Antoniosi Tecnologia Agroindustrial Ltda", "\"Antoniosi Tecnologia Agroindustrial Ltda\""},
+    {1553, 24, 26, "Boughton Engineering LTD", "\"Boughton Engineering LTD\""},
+    {1554, 9, 11, "Frigus AB", "\"Frigus AB\""},
+    {1555, 7, 9, "Safiery", "\"Safiery\""},
+    {1556, 28, 30, "B. Kaufmann AG Landmaschinen", "\"B. Kaufmann AG Landmaschinen\""},
+    {1557, 17, 19, "Interfacom S.A.U.", "\"Interfacom S.A.U.\""},
+    {1558, 29, 31, "Intangles Lab Private Limited", "\"Intangles Lab Private Limited\""},
+    {1559, 14, 16, "Kar-Tech, Inc.", "\"Kar-Tech, Inc.\""},
+    {1560, 18, 20, "MACOME CORPORATION", "\"MACOME CORPORATION\""},
+    {1561, 10, 12, "Fox Marine", "\"Fox Marine\""},
+    {1562, 31, 33, "Kingsat Communications Co., Ltd", "\"Kingsat Communications Co., Ltd\""},
+    {1563, 19, 21, "Wabtec Graham White", "\"Wabtec Graham White\""},
+    {1564, 19, 21, "Pro-Guide Batteries", "\"Pro-Guide Batteries\""},
+    {1565, 17, 19, "Livemac Co., Ltd.", "\"Livemac Co., Ltd.\""},
+    {1566, 6, 8, "OUTSET", "\"OUTSET\""},
+    {1567, 34, 36, "Hagedorn Software Engineering GmbH", "\"Hagedorn Software Engineering GmbH\""},
+    {1568, 5, 7, "Aigro", "\"Aigro\""},
+    {1569, 21, 23, "621 Technologies Inc.", "\"621 Technologies Inc.\""},
+    {1570, 37, 39, "Unverferth Manufacturing Company Inc.", "\"Unverferth Manufacturing Company Inc.\""},
+    {1571, 7, 9, "Super B", "\"Super B\""},
+    {1572, 19, 21, "SMARTLINE Co., Ltd.", "\"SMARTLINE Co., Ltd.\""},
+    {1573, 13, 15, "R.H. Sheppard", "\"R.H. Sheppard\""},
+    {1574, 10, 12, "SIGMA4 SRL", "\"SIGMA4 SRL\""},
+    {1575, 10, 12, "DieselHeat", "\"DieselHeat\""},
+    {1576, 23, 25, "RB International S.r.l.", "\"RB International S.r.l.\""},
+    {1577, 12, 14, "Ironstone AG", "\"Ironstone AG\""},
+    {1578, 18, 20, "MidNite Solar Inc.", "\"MidNite Solar Inc.\""},
+    {1579, 17, 19, "Hydro Engineering", "\"Hydro Engineering\""},
+    {1580, 20, 22, "Nabtesco Corporation", "\"Nabtesco Corporation\""},
+    {1581, 16, 18, "Metro Marine LLC", "\"Metro Marine LLC\""},
+    {1582, 34, 36, "Samsung Heavy Industries Co., Ltd.", "\"Samsung Heavy Industries Co., Ltd.\""},
+    {1583, 20, 22, "MULTI-WING GROUP A/S", "\"MULTI-WING GROUP A/S\""},
+    {1584, 19, 21, "TWK-ELEKTRONIK GmbH", "\"TWK-ELEKTRONIK GmbH\""},
+    {1585, 44, 46, "Qianxun Spatial Intelligence (Zhejiang) Inc.", "\"Qianxun Spatial Intelligence (Zhejiang) Inc.\""},
+    {1586, 13, 15, "XAG CO., LTD.", "\"XAG CO., LTD.\""},
+    {1587, 12, 14, "BURGER GROUP", "\"BURGER GROUP\""},
+    {1588, 7, 9, "MORESIL", "\"MORESIL\""},
+    {1589, 21, 23, "HÜBNER GmbH & Co. KG", "\"HÜBNER GmbH & Co. KG\""},
+    {1590, 10, 12, "Monpaineis", "\"Monpaineis\""},
+    {1591, 22, 24, "WaterWorld Electronics", "\"WaterWorld Electronics\""},
+    {1592, 35, 37, "Incomagri Máquinas Agrícolas Ltda", "\"Incomagri Máquinas Agrícolas Ltda\""},
+    {1593, 19, 21, "Cordon Technologies", "\"Cordon Technologies\""},
+    {1594, 18, 20, "Elwell Corporation", "\"Elwell Corporation\""},
+    {1595, 34, 36, "Pruefrex engineering e motion gmbh", "\"Pruefrex engineering e motion gmbh\""},
+    {1596, 7, 9, "Neosens", "\"Neosens\""},
+    {1597, 21, 23, "S.A.S. Desvoys & Fils", "\"S.A.S. Desvoys & Fils\""},
+    {1598, 7, 9, "Di Goro", "\"Di Goro\""},
+    {1599, 6, 8, "Kamtec", "\"Kamtec\""},
+    {1600, 24, 26, "Consolidated Metco, Inc.", "\"Consolidated Metco, Inc.\""},
+    {1601, 24, 26, "T/CCI Manufacturing, LLC", "\"T/CCI Manufacturing, LLC\""},
+    {1602, 24, 26, "Norcross Marine Products", "\"Norcross Marine Products\""},
+    {1603, 15, 17, "Rockville Audio", "\"Rockville Audio\""},
+    {1604, 23, 25, "RoverSense Technologies", "\"RoverSense Technologies\""},
+    {1605, 9, 11, "Blue Wolf", "\"Blue Wolf\""},
+    {1606, 18, 20, "SENSAR MARINE INC.", "\"SENSAR MARINE INC.\""},
+    {1607, 9, 11, "Micro-Key", "\"Micro-Key\""},
+    {1608, 7, 9, "Quectel", "\"Quectel\""},
+    {1609, 12, 14, "NanoNord A/S", "\"NanoNord A/S\""},
+    {1610, 15, 17, "Simarine d.o.o.", "\"Simarine d.o.o.\""},
+    {1611, 28, 30, "Ningbo Haibo Group Co., Ltd.", "\"Ningbo Haibo Group Co., Ltd.\""},
+    {1612, 7, 9, "BLUETTI", "\"BLUETTI\""},
+    {1613, 12, 14, "Whisperpower", "\"Whisperpower\""},
+    {1614, 17, 19, "Risseeuw Techniek", "\"Risseeuw Techniek\""},
+    {1615, 6, 8, "J.Assy", "\"J.Assy\""},
+    {1616, 8, 10, "Satel Oy", "\"Satel Oy\""},
+    {1617, 14, 16, "DRUDLES s.r.o.", "\"DRUDLES s.r.o.\""},
+    {1618, 26, 28, "The Carlisle and Finch Co.", "\"The Carlisle and Finch Co.\""},
+    {1619, 21, 23, "Clemens GmbH & Co. KG", "\"Clemens GmbH & Co. KG\""},
+    {1620, 7, 9, "BlueNav", "\"BlueNav\""},
+    {1621, 9, 11, "Mach Inc.", "\"Mach Inc.\""},
+    {1622, 23, 25, "Brettmeister Elektronik", "\"Brettmeister Elektronik\""},
+    {1623, 25, 27, "PRO Charging Systems, LLC", "\"PRO Charging Systems, LLC\""},
+    {1624, 12, 14, "CrossControl", "\"CrossControl\""},
+    {1625, 13, 15, "DMX Power LLC", "\"DMX Power LLC\""},
+    {1626, 15, 17, "SMP STABIL GmbH", "\"SMP STABIL GmbH\""},
+    {1627, 12, 14, "Roter Italia", "\"Roter Italia\""},
+    {1628, 13, 15, "Vanemar, Inc.", "\"Vanemar, Inc.\""},
+    {1629, 18, 20, "dSPACE SE & Co. KG", "\"dSPACE SE & Co. KG\""},
+    {1630, 31, 33, "Rainer Meyer Landmaschinen GmbH", "\"Rainer Meyer Landmaschinen GmbH\""},
+    {1631, 6, 8, "Leidos", "\"Leidos\""},
+    {1632, 5, 7, "Zocon", "\"Zocon\""},
+    {1633, 31, 33, "Zydro Marine Technologies, Inc.", "\"Zydro Marine Technologies, Inc.\""},
+    {1634, 23, 25, "IBISUL ELETRÔNICA LTDA", "\"IBISUL ELETRÔNICA LTDA\""},
+    {1635, 19, 21, "Saframax Industrial", "\"Saframax Industrial\""},
+    {1636, 28, 30, "TBB POWER (XIAMEN) Co., Ltd.", "\"TBB POWER (XIAMEN) Co., Ltd.\""},
+    {1637, 32, 34, "Scherzinger Pumpen GmbH & Co. KG", "\"Scherzinger Pumpen GmbH & Co. KG\""},
+    {1638, 12, 14, "TEMPA TEKNIK", "\"TEMPA TEKNIK\""},
+    {1639, 33, 35, "GEA Farm Technologies Canada Inc.", "\"GEA Farm Technologies Canada Inc.\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1650, 37, 39, "Shanghai Infipax Technology Co., Ltd.", "\"Shanghai Infipax Technology Co., Ltd.\""},
+    {0},
+    {0},
+    {1653, 29, 31, "Schaffer Farming Technologies", "\"Schaffer Farming Technologies\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1850, 37, 39, "Seastar Solutions (formerly Teleflex)", "\"Seastar Solutions (formerly Teleflex)\""},
+    {1851, 9, 11, "RayMarine", "\"RayMarine\""},
+    {1852, 9, 11, "Navionics", "\"Navionics\""},
+    {1853, 14, 16, "Japan Radio Co", "\"Japan Radio Co\""},
+    {1854, 22, 24, "Northstar Technologies", "\"Northstar Technologies\""},
+    {1855, 10, 12, "Furuno USA", "\"Furuno USA\""},
+    {1856, 7, 9, "Trimble", "\"Trimble\""},
+    {1857, 6, 8, "Simrad", "\"Simrad\""},
+    {1858, 6, 8, "Litton", "\"Litton\""},
+    {1859, 9, 11, "Kvasar AB", "\"Kvasar AB\""},
+    {1860, 3, 5, "MMP", "\"MMP\""},
+    {1861, 46, 48, "Vector North America (formerly Vector Cantech)", "\"Vector North America (formerly Vector Cantech)\""},
+    {1862, 7, 9, "Sanshin", "\"Sanshin\""},
+    {1863, 19, 21, "Thomas G. Faria Co.", "\"Thomas G. Faria Co.\""}
+};
+const LookupTable lookupTableJ1939_MANUFACTURER_CODE = {.kind = LOOKUP_TABLE_DENSE, .count = 1864, .entries = lookupEntriesJ1939_MANUFACTURER_CODE};
+
+static const LookupEntry lookupEntriesPOWER_FACTOR[] = {
+    {0, 7, 9, "Leading", "\"Leading\""},
+    {1, 7, 9, "Lagging", "\"Lagging\""},
+    {2, 5, 7, "Error", "\"Error\""}
+};
+const LookupTable lookupTablePOWER_FACTOR = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesPOWER_FACTOR};
+
+static const LookupEntry lookupEntriesYES_NO[] = {
+    {0, 2, 4, "No", "\"No\""},
+    {1, 3, 5, "Yes", "\"Yes\""}
+};
+const LookupTable lookupTableYES_NO = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesYES_NO};
+
+static const LookupEntry lookupEntriesDEVICE_FUNCTION[] = {
+    {130, 10, 12, "Diagnostic", "\"Diagnostic\""},
+    {140, 18, 20, "Bus Traffic Logger", "\"Bus Traffic Logger\""},
+    {110, 16, 18, "Alarm Enunciator", "\"Alarm Enunciator\""},
+    {130, 50, 52, "Emergency Position Indicating Radio Beacon (EPIRB)", "\"Emergency Position Indicating Radio Beacon (EPIRB)\""},
+    {135, 13, 15, "Man Overboard", "\"Man Overboard\""},
+    {140, 20, 22, "Voyage Data Recorder", "\"Voyage Data Recorder\""},
+    {150, 6, 8, "Camera", "\"Camera\""},
+    {130, 10, 12, "PC Gateway", "\"PC Gateway\""},
+    {131, 27, 29, "NMEA 2000 to Analog Gateway", "\"NMEA 2000 to Analog Gateway\""},
+    {132, 27, 29, "Analog to NMEA 2000 Gateway", "\"Analog to NMEA 2000 Gateway\""},
+    {133, 27, 29, "NMEA 2000 to Serial Gateway", "\"NMEA 2000 to Serial Gateway\""},
+    {135, 17, 19, "NMEA 0183 Gateway", "\"NMEA 0183 Gateway\""},
+    {136, 20, 22, "NMEA Network Gateway", "\"NMEA Network Gateway\""},
+    {137, 26, 28, "NMEA 2000 Wireless Gateway", "\"NMEA 2000 Wireless Gateway\""},
+    {140, 6, 8, "Router", "\"Router\""},
+    {150, 6, 8, "Bridge", "\"Bridge\""},
+    {160, 8, 10, "Repeater", "\"Repeater\""},
+    {130, 20, 22, "Binary Event Monitor", "\"Binary Event Monitor\""},
+    {140, 15, 17, "Load Controller", "\"Load Controller\""},
+    {141, 11, 13, "AC/DC Input", "\"AC/DC Input\""},
+    {150, 19, 21, "Function Controller", "\"Function Controller\""},
+    {140, 6, 8, "Engine", "\"Engine\""},
+    {141, 23, 25, "DC Generator/Alternator", "\"DC Generator/Alternator\""},
+    {142, 25, 27, "Solar Panel (Solar Array)", "\"Solar Panel (Solar Array)\""},
+    {143, 19, 21, "Wind Generator (DC)", "\"Wind Generator (DC)\""},
+    {144, 9, 11, "Fuel Cell", "\"Fuel Cell\""},
+    {145, 20, 22, "Network Power Supply", "\"Network Power Supply\""},
+    {151, 12, 14, "AC Generator", "\"AC Generator\""},
+    {152, 6, 8, "AC Bus", "\"AC Bus\""},
+    {153, 24, 26, "AC Mains (Utility/Shore)", "\"AC Mains (Utility/Shore)\""},
+    {154, 9, 11, "AC Output", "\"AC Output\""},
+    {160, 33, 35, "Power Converter - Battery Charger", "\"Power Converter - Battery Charger\""},
+    {161, 42, 44, "Power Converter - Battery Charger+Inverter", "\"Power Converter - Battery Charger+Inverter\""},
+    {162, 26, 28, "Power Converter - Inverter", "\"Power Converter - Inverter\""},
+    {163, 20, 22, "Power Converter - DC", "\"Power Converter - DC\""},
+    {170, 7, 9, "Battery", "\"Battery\""},
+    {180, 14, 16, "Engine Gateway", "\"Engine Gateway\""},
+    {130, 20, 22, "Follow-up Controller", "\"Follow-up Controller\""},
+    {140, 15, 17, "Mode Controller", "\"Mode Controller\""},
+    {150, 9, 11, "Autopilot", "\"Autopilot\""},
+    {155, 6, 8, "Rudder", "\"Rudder\""},
+    {160, 15, 17, "Heading Sensors", "\"Heading Sensors\""},
+    {170, 24, 26, "Trim (Tabs)/Interceptors", "\"Trim (Tabs)/Interceptors\""},
+    {180, 35, 37, "Attitude (Pitch, Roll, Yaw) Control", "\"Attitude (Pitch, Roll, Yaw) Control\""},
+    {130, 21, 23, "Engineroom Monitoring", "\"Engineroom Monitoring\""},
+    {140, 6, 8, "Engine", "\"Engine\""},
+    {141, 23, 25, "DC Generator/Alternator", "\"DC Generator/Alternator\""},
+    {150, 17, 19, "Engine Controller", "\"Engine Controller\""},
+    {151, 12, 14, "AC Generator", "\"AC Generator\""},
+    {155, 5, 7, "Motor", "\"Motor\""},
+    {160, 14, 16, "Engine Gateway", "\"Engine Gateway\""},
+    {165, 12, 14, "Transmission", "\"Transmission\""},
+    {170, 22, 24, "Throttle/Shift Control", "\"Throttle/Shift Control\""},
+    {180, 8, 10, "Actuator", "\"Actuator\""},
+    {190, 15, 17, "Gauge Interface", "\"Gauge Interface\""},
+    {200, 11, 13, "Gauge Large", "\"Gauge Large\""},
+    {210, 11, 13, "Gauge Small", "\"Gauge Small\""},
+    {130, 12, 14, "Bottom Depth", "\"Bottom Depth\""},
+    {135, 18, 20, "Bottom Depth/Speed", "\"Bottom Depth/Speed\""},
+    {136, 30, 32, "Bottom Depth/Speed/Temperature", "\"Bottom Depth/Speed/Temperature\""},
+    {140, 16, 18, "Ownship Attitude", "\"Ownship Attitude\""},
+    {145, 23, 25, "Ownship Position (GNSS)", "\"Ownship Position (GNSS)\""},
+    {150, 26, 28, "Ownship Position (Loran C)", "\"Ownship Position (Loran C)\""},
+    {155, 5, 7, "Speed", "\"Speed\""},
+    {160, 19, 21, "Turn Rate Indicator", "\"Turn Rate Indicator\""},
+    {170, 21, 23, "Integrated Navigation", "\"Integrated Navigation\""},
+    {175, 28, 30, "Integrated Navigation System", "\"Integrated Navigation System\""},
+    {190, 21, 23, "Navigation Management", "\"Navigation Management\""},
+    {195, 37, 39, "Automatic Identification System (AIS)", "\"Automatic Identification System (AIS)\""},
+    {200, 5, 7, "Radar", "\"Radar\""},
+    {201, 16, 18, "Infrared Imaging", "\"Infrared Imaging\""},
+    {205, 5, 7, "ECDIS", "\"ECDIS\""},
+    {210, 3, 5, "ECS", "\"ECS\""},
+    {220, 16, 18, "Direction Finder", "\"Direction Finder\""},
+    {230, 13, 15, "Voyage Status", "\"Voyage Status\""},
+    {130, 5, 7, "EPIRB", "\"EPIRB\""},
+    {140, 3, 5, "AIS", "\"AIS\""},
+    {150, 3, 5, "DSC", "\"DSC\""},
+    {160, 25, 27, "Data Receiver/Transceiver", "\"Data Receiver/Transceiver\""},
+    {170, 9, 11, "Satellite", "\"Satellite\""},
+    {180, 23, 25, "Radio-telephone (MF/HF)", "\"Radio-telephone (MF/HF)\""},
+    {190, 14, 16, "Radiotelephone", "\"Radiotelephone\""},
+    {130, 11, 13, "Temperature", "\"Temperature\""},
+    {140, 8, 10, "Pressure", "\"Pressure\""},
+    {150, 11, 13, "Fluid Level", "\"Fluid Level\""},
+    {160, 4, 6, "Flow", "\"Flow\""},
+    {170, 8, 10, "Humidity", "\"Humidity\""},
+    {130, 17, 19, "Time/Date Systems", "\"Time/Date Systems\""},
+    {140, 3, 5, "VDR", "\"VDR\""},
+    {150, 26, 28, "Integrated Instrumentation", "\"Integrated Instrumentation\""},
+    {160, 24, 26, "General Purpose Displays", "\"General Purpose Displays\""},
+    {170, 18, 20, "General Sensor Box", "\"General Sensor Box\""},
+    {180, 19, 21, "Weather Instruments", "\"Weather Instruments\""},
+    {190, 18, 20, "Transducer/General", "\"Transducer/General\""},
+    {200, 19, 21, "NMEA 0183 Converter", "\"NMEA 0183 Converter\""},
+    {130, 11, 13, "Atmospheric", "\"Atmospheric\""},
+    {160, 7, 9, "Aquatic", "\"Aquatic\""},
+    {130, 4, 6, "HVAC", "\"HVAC\""},
+    {130, 13, 15, "Scale (Catch)", "\"Scale (Catch)\""},
+    {130, 16, 18, "Button Interface", "\"Button Interface\""},
+    {135, 16, 18, "Switch Interface", "\"Switch Interface\""},
+    {140, 16, 18, "Analog Interface", "\"Analog Interface\""},
+    {130, 7, 9, "Display", "\"Display\""},
+    {140, 16, 18, "Alarm Enunciator", "\"Alarm Enunciator\""},
+    {130, 17, 19, "Multimedia Player", "\"Multimedia Player\""},
+    {140, 21, 23, "Multimedia Controller", "\"Multimedia Controller\""}
+};
+static const LookupRange lookupRangesDEVICE_FUNCTION[] = {
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 2},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {2, 5},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {7, 10},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {17, 4},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {21, 16},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {37, 7},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {44, 13},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {57, 18},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {75, 7},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {82, 5},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {87, 8},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {95, 2},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {97, 1},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {98, 1},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {99, 3},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {102, 2},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {104, 2}
+};
+const LookupTable lookupTableDEVICE_FUNCTION = {.kind = LOOKUP_TABLE_TRIPLET, .count = 106, .entries = lookupEntriesDEVICE_FUNCTION, .rangeCount = 126, .ranges = lookupRangesDEVICE_FUNCTION};
+
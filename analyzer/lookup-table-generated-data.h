@@ -0,0 +1,10246 @@
+/* ==========================================================================
+*
+*   GENERATED FILE - DO NOT EDIT.
+*
+*   Every line below is written by `keel` from the YAML database in
+*   database/. Editing this file achieves nothing: the next `make generated`
+*   overwrites it, and CI fails the build on the resulting diff.
+*
+*   To change a PGN, a lookup or a field type, edit the YAML:
+*
+*       database/pgns/<pgn>-<id>.yaml     one file per PGN variant
+*       database/lookups/<NAME>.yaml      one file per enumeration
+*       database/fieldtypes.yaml          the field-type hierarchy
+*
+*   then regenerate and check it in:
+*
+*       make generated
+*
+*   See keel/DESIGN.md, or run `keel edit` for the browser editor.
+*
+* ==========================================================================
+*
+* (C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+* Part of CANboat; licensed under the Apache License, Version 2.0.
+*/
+
+static const LookupEntry lookupEntriesACCEPTABILITY[] = {
+    {0, 9, 11, "Bad level", "\"Bad level\""},
+    {1, 13, 15, "Bad frequency", "\"Bad frequency\""},
+    {2, 15, 17, "Being qualified", "\"Being qualified\""},
+    {3, 4, 6, "Good", "\"Good\""}
+};
+const LookupTable lookupTableACCEPTABILITY = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesACCEPTABILITY};
+
+static const LookupEntry lookupEntriesACCESS_LEVEL[] = {
+    {0, 6, 8, "Locked", "\"Locked\""},
+    {1, 16, 18, "unlocked level 1", "\"unlocked level 1\""},
+    {2, 16, 18, "unlocked level 2", "\"unlocked level 2\""}
+};
+const LookupTable lookupTableACCESS_LEVEL = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesACCESS_LEVEL};
+
+static const LookupEntry lookupEntriesAC_LINE[] = {
+    {0, 6, 8, "Line 1", "\"Line 1\""},
+    {1, 6, 8, "Line 2", "\"Line 2\""},
+    {2, 6, 8, "Line 3", "\"Line 3\""}
+};
+const LookupTable lookupTableAC_LINE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesAC_LINE};
+
+static const LookupEntry lookupEntriesAGS_GENERATING_STATE[] = {
+    {0, 10, 12, "Preheating", "\"Preheating\""},
+    {1, 11, 13, "Start delay", "\"Start delay\""},
+    {2, 8, 10, "Cranking", "\"Cranking\""},
+    {3, 15, 17, "Starter cooling", "\"Starter cooling\""},
+    {4, 10, 12, "Warming up", "\"Warming up\""},
+    {5, 12, 14, "Cooling down", "\"Cooling down\""},
+    {6, 11, 13, "Spinning up", "\"Spinning up\""},
+    {7, 15, 17, "Shutdown bypass", "\"Shutdown bypass\""},
+    {8, 8, 10, "Stopping", "\"Stopping\""},
+    {9, 7, 9, "Running", "\"Running\""},
+    {10, 7, 9, "Stopped", "\"Stopped\""},
+    {11, 12, 14, "Crank delaty", "\"Crank delaty\""}
+};
+const LookupTable lookupTableAGS_GENERATING_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 12, .entries = lookupEntriesAGS_GENERATING_STATE};
+
+static const LookupEntry lookupEntriesAGS_MODE[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 2, 4, "On", "\"On\""},
+    {2, 9, 11, "Automatic", "\"Automatic\""}
+};
+const LookupTable lookupTableAGS_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesAGS_MODE};
+
+static const LookupEntry lookupEntriesAGS_OFF_REASON[] = {
+    {0, 7, 9, "Not off", "\"Not off\""},
+    {1, 15, 17, "DC voltage high", "\"DC voltage high\""},
+    {2, 28, 30, "Battery state of charge high", "\"Battery state of charge high\""},
+    {3, 14, 16, "AC current low", "\"AC current low\""},
+    {4, 14, 16, "Contact opened", "\"Contact opened\""},
+    {5, 18, 20, "Reached absorption", "\"Reached absorption\""},
+    {6, 13, 15, "Reached float", "\"Reached float\""},
+    {7, 10, 12, "Manual off", "\"Manual off\""},
+    {8, 12, 14, "Max run time", "\"Max run time\""},
+    {9, 14, 16, "Max auto cycle", "\"Max auto cycle\""},
+    {10, 13, 15, "Exercise done", "\"Exercise done\""},
+    {11, 10, 12, "Quiet time", "\"Quiet time\""},
+    {12, 20, 22, "External off via AGS", "\"External off via AGS\""},
+    {13, 9, 11, "Safe mode", "\"Safe mode\""},
+    {14, 26, 28, "External off via generator", "\"External off via generator\""},
+    {15, 17, 19, "External shutdown", "\"External shutdown\""},
+    {16, 8, 10, "Auto off", "\"Auto off\""},
+    {17, 5, 7, "Fault", "\"Fault\""},
+    {18, 15, 17, "Unable to start", "\"Unable to start\""}
+};
+const LookupTable lookupTableAGS_OFF_REASON = {.kind = LOOKUP_TABLE_DENSE, .count = 19, .entries = lookupEntriesAGS_OFF_REASON};
+
+static const LookupEntry lookupEntriesAGS_ON_REASON[] = {
+    {0, 6, 8, "Not on", "\"Not on\""},
+    {1, 14, 16, "DC voltage low", "\"DC voltage low\""},
+    {2, 27, 29, "Battery state of charge low", "\"Battery state of charge low\""},
+    {3, 15, 17, "AC current high", "\"AC current high\""},
+    {4, 14, 16, "Contact closed", "\"Contact closed\""},
+    {5, 9, 11, "Manual on", "\"Manual on\""},
+    {6, 8, 10, "Exercise", "\"Exercise\""},
+    {7, 14, 16, "Non Quiet time", "\"Non Quiet time\""},
+    {8, 19, 21, "External on via AGS", "\"External on via AGS\""},
+    {9, 25, 27, "External on via generator", "\"External on via generator\""},
+    {10, 14, 16, "Unable to stop", "\"Unable to stop\""}
+};
+const LookupTable lookupTableAGS_ON_REASON = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesAGS_ON_REASON};
+
+static const LookupEntry lookupEntriesAGS_OPERATING_STATE[] = {
+    {0, 10, 12, "Quiet time", "\"Quiet time\""},
+    {1, 7, 9, "Auto on", "\"Auto on\""},
+    {2, 8, 10, "Auto off", "\"Auto off\""},
+    {3, 9, 11, "Manual On", "\"Manual On\""},
+    {4, 10, 12, "Manual Off", "\"Manual Off\""},
+    {5, 18, 20, "Generator shutdown", "\"Generator shutdown\""},
+    {6, 17, 19, "External shutdown", "\"External shutdown\""},
+    {7, 5, 7, "Fault", "\"Fault\""},
+    {8, 7, 9, "Suspend", "\"Suspend\""},
+    {9, 13, 15, "Not operating", "\"Not operating\""}
+};
+const LookupTable lookupTableAGS_OPERATING_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 10, .entries = lookupEntriesAGS_OPERATING_STATE};
+
+static const LookupEntry lookupEntriesAIRMAR_CALIBRATE_FUNCTION[] = {
+    {0, 25, 27, "Normal/cancel calibration", "\"Normal/cancel calibration\""},
+    {1, 22, 24, "Enter calibration mode", "\"Enter calibration mode\""},
+    {2, 22, 24, "Reset calibration to 0", "\"Reset calibration to 0\""},
+    {3, 6, 8, "Verify", "\"Verify\""},
+    {4, 25, 27, "Reset compass to defaults", "\"Reset compass to defaults\""},
+    {5, 25, 27, "Reset damping to defaults", "\"Reset damping to defaults\""}
+};
+const LookupTable lookupTableAIRMAR_CALIBRATE_FUNCTION = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesAIRMAR_CALIBRATE_FUNCTION};
+
+static const LookupEntry lookupEntriesAIRMAR_CALIBRATE_STATUS[] = {
+    {0, 7, 9, "Queried", "\"Queried\""},
+    {1, 6, 8, "Passed", "\"Passed\""},
+    {2, 16, 18, "Failed - timeout", "\"Failed - timeout\""},
+    {3, 19, 21, "Failed - tilt error", "\"Failed - tilt error\""},
+    {4, 14, 16, "Failed - other", "\"Failed - other\""},
+    {5, 11, 13, "In progress", "\"In progress\""}
+};
+const LookupTable lookupTableAIRMAR_CALIBRATE_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesAIRMAR_CALIBRATE_STATUS};
+
+static const LookupEntry lookupEntriesAIRMAR_COMMAND[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {32, 16, 18, "Attitude Offsets", "\"Attitude Offsets\""},
+    {33, 17, 19, "Calibrate Compass", "\"Calibrate Compass\""},
+    {34, 17, 19, "True Wind Options", "\"True Wind Options\""},
+    {35, 13, 15, "Simulate Mode", "\"Simulate Mode\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {40, 15, 17, "Calibrate Depth", "\"Calibrate Depth\""},
+    {41, 15, 17, "Calibrate Speed", "\"Calibrate Speed\""},
+    {42, 21, 23, "Calibrate Temperature", "\"Calibrate Temperature\""},
+    {43, 12, 14, "Speed Filter", "\"Speed Filter\""},
+    {44, 18, 20, "Temperature Filter", "\"Temperature Filter\""},
+    {0},
+    {46, 17, 19, "NMEA 2000 options", "\"NMEA 2000 options\""}
+};
+const LookupTable lookupTableAIRMAR_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 47, .entries = lookupEntriesAIRMAR_COMMAND};
+
+static const LookupEntry lookupEntriesAIRMAR_DEPTH_QUALITY_FACTOR[] = {
+    {0, 14, 16, "Depth unlocked", "\"Depth unlocked\""},
+    {1, 11, 13, "Quality 10%", "\"Quality 10%\""},
+    {2, 11, 13, "Quality 20%", "\"Quality 20%\""},
+    {3, 11, 13, "Quality 30%", "\"Quality 30%\""},
+    {4, 11, 13, "Quality 40%", "\"Quality 40%\""},
+    {5, 11, 13, "Quality 50%", "\"Quality 50%\""},
+    {6, 11, 13, "Quality 60%", "\"Quality 60%\""},
+    {7, 11, 13, "Quality 70%", "\"Quality 70%\""},
+    {8, 11, 13, "Quality 80%", "\"Quality 80%\""},
+    {9, 11, 13, "Quality 90%", "\"Quality 90%\""},
+    {10, 12, 14, "Quality 100%", "\"Quality 100%\""}
+};
+const LookupTable lookupTableAIRMAR_DEPTH_QUALITY_FACTOR = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesAIRMAR_DEPTH_QUALITY_FACTOR};
+
+static const LookupEntry lookupEntriesAIRMAR_POST_CONTROL[] = {
+    {0, 22, 24, "Report previous values", "\"Report previous values\""},
+    {1, 19, 21, "Generate new values", "\"Generate new values\""}
+};
+const LookupTable lookupTableAIRMAR_POST_CONTROL = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesAIRMAR_POST_CONTROL};
+
+static const LookupEntry lookupEntriesAIRMAR_POST_ID[] = {
+    {0},
+    {1, 11, 13, "Format Code", "\"Format Code\""},
+    {2, 14, 16, "Factory EEPROM", "\"Factory EEPROM\""},
+    {3, 11, 13, "User EEPROM", "\"User EEPROM\""},
+    {4, 24, 26, "Water Temperature Sensor", "\"Water Temperature Sensor\""},
+    {5, 17, 19, "Sonar Transceiver", "\"Sonar Transceiver\""},
+    {6, 12, 14, "Speed sensor", "\"Speed sensor\""},
+    {7, 27, 29, "Internal temperature sensor", "\"Internal temperature sensor\""},
+    {8, 22, 24, "Battery voltage sensor", "\"Battery voltage sensor\""}
+};
+const LookupTable lookupTableAIRMAR_POST_ID = {.kind = LOOKUP_TABLE_DENSE, .count = 9, .entries = lookupEntriesAIRMAR_POST_ID};
+
+static const LookupEntry lookupEntriesAIRMAR_TEMPERATURE_INSTANCE[] = {
+    {0, 13, 15, "Device Sensor", "\"Device Sensor\""},
+    {1, 20, 22, "Onboard Water Sensor", "\"Onboard Water Sensor\""},
+    {2, 21, 23, "Optional Water Sensor", "\"Optional Water Sensor\""}
+};
+const LookupTable lookupTableAIRMAR_TEMPERATURE_INSTANCE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesAIRMAR_TEMPERATURE_INSTANCE};
+
+static const LookupEntry lookupEntriesAIRMAR_TRANSMISSION_INTERVAL[] = {
+    {0, 16, 18, "Measure interval", "\"Measure interval\""},
+    {1, 17, 19, "Requested by user", "\"Requested by user\""}
+};
+const LookupTable lookupTableAIRMAR_TRANSMISSION_INTERVAL = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesAIRMAR_TRANSMISSION_INTERVAL};
+
+static const LookupEntry lookupEntriesAIS_ASSIGNED_MODE[] = {
+    {0, 25, 27, "Autonomous and continuous", "\"Autonomous and continuous\""},
+    {1, 13, 15, "Assigned mode", "\"Assigned mode\""}
+};
+const LookupTable lookupTableAIS_ASSIGNED_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesAIS_ASSIGNED_MODE};
+
+static const LookupEntry lookupEntriesAIS_BAND[] = {
+    {0, 26, 28, "Top 525 kHz of marine band", "\"Top 525 kHz of marine band\""},
+    {1, 18, 20, "Entire marine band", "\"Entire marine band\""}
+};
+const LookupTable lookupTableAIS_BAND = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesAIS_BAND};
+
+static const LookupEntry lookupEntriesAIS_COMMUNICATION_STATE[] = {
+    {0, 6, 8, "SOTDMA", "\"SOTDMA\""},
+    {1, 5, 7, "ITDMA", "\"ITDMA\""}
+};
+const LookupTable lookupTableAIS_COMMUNICATION_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesAIS_COMMUNICATION_STATE};
+
+static const LookupEntry lookupEntriesAIS_MESSAGE_ID[] = {
+    {0},
+    {1, 33, 35, "Scheduled Class A position report", "\"Scheduled Class A position report\""},
+    {2, 42, 44, "Assigned scheduled Class A position report", "\"Assigned scheduled Class A position report\""},
+    {3, 36, 38, "Interrogated Class A position report", "\"Interrogated Class A position report\""},
+    {4, 19, 21, "Base station report", "\"Base station report\""},
+    {5, 30, 32, "Static and voyage related data", "\"Static and voyage related data\""},
+    {6, 24, 26, "Binary addressed message", "\"Binary addressed message\""},
+    {7, 22, 24, "Binary acknowledgement", "\"Binary acknowledgement\""},
+    {8, 24, 26, "Binary broadcast message", "\"Binary broadcast message\""},
+    {9, 37, 39, "Standard SAR aircraft position report", "\"Standard SAR aircraft position report\""},
+    {10, 16, 18, "UTC/date inquiry", "\"UTC/date inquiry\""},
+    {11, 17, 19, "UTC/date response", "\"UTC/date response\""},
+    {12, 32, 34, "Safety related addressed message", "\"Safety related addressed message\""},
+    {13, 30, 32, "Safety related acknowledgement", "\"Safety related acknowledgement\""},
+    {14, 32, 34, "Satety related broadcast message", "\"Satety related broadcast message\""},
+    {15, 13, 15, "Interrogation", "\"Interrogation\""},
+    {16, 23, 25, "Assignment mode command", "\"Assignment mode command\""},
+    {17, 30, 32, "DGNSS broadcast binary message", "\"DGNSS broadcast binary message\""},
+    {18, 32, 34, "Standard Class B position report", "\"Standard Class B position report\""},
+    {19, 32, 34, "Extended Class B position report", "\"Extended Class B position report\""},
+    {20, 28, 30, "Data link management message", "\"Data link management message\""},
+    {21, 11, 13, "ATON report", "\"ATON report\""},
+    {22, 18, 20, "Channel management", "\"Channel management\""},
+    {23, 24, 26, "Group assignment command", "\"Group assignment command\""},
+    {24, 18, 20, "Static data report", "\"Static data report\""},
+    {25, 26, 28, "Single slot binary message", "\"Single slot binary message\""},
+    {26, 28, 30, "Multiple slot binary message", "\"Multiple slot binary message\""},
+    {27, 43, 45, "Position report for long range applications", "\"Position report for long range applications\""}
+};
+const LookupTable lookupTableAIS_MESSAGE_ID = {.kind = LOOKUP_TABLE_DENSE, .count = 28, .entries = lookupEntriesAIS_MESSAGE_ID};
+
+static const LookupEntry lookupEntriesAIS_MODE[] = {
+    {0, 10, 12, "Autonomous", "\"Autonomous\""},
+    {1, 8, 10, "Assigned", "\"Assigned\""}
+};
+const LookupTable lookupTableAIS_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesAIS_MODE};
+
+static const LookupEntry lookupEntriesAIS_SPECIAL_MANEUVER[] = {
+    {0, 13, 15, "Not available", "\"Not available\""},
+    {1, 31, 33, "Not engaged in special maneuver", "\"Not engaged in special maneuver\""},
+    {2, 27, 29, "Engaged in special maneuver", "\"Engaged in special maneuver\""},
+    {3, 8, 10, "Reserved", "\"Reserved\""}
+};
+const LookupTable lookupTableAIS_SPECIAL_MANEUVER = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesAIS_SPECIAL_MANEUVER};
+
+static const LookupEntry lookupEntriesAIS_TRANSCEIVER[] = {
+    {0, 23, 25, "Channel A VDL reception", "\"Channel A VDL reception\""},
+    {1, 23, 25, "Channel B VDL reception", "\"Channel B VDL reception\""},
+    {2, 26, 28, "Channel A VDL transmission", "\"Channel A VDL transmission\""},
+    {3, 26, 28, "Channel B VDL transmission", "\"Channel B VDL transmission\""},
+    {4, 29, 31, "Own information not broadcast", "\"Own information not broadcast\""},
+    {5, 8, 10, "Reserved", "\"Reserved\""}
+};
+const LookupTable lookupTableAIS_TRANSCEIVER = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesAIS_TRANSCEIVER};
+
+static const LookupEntry lookupEntriesAIS_TYPE[] = {
+    {0, 6, 8, "SOTDMA", "\"SOTDMA\""},
+    {1, 2, 4, "CS", "\"CS\""}
+};
+const LookupTable lookupTableAIS_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesAIS_TYPE};
+
+static const LookupEntry lookupEntriesAIS_VERSION[] = {
+    {0, 14, 16, "ITU-R M.1371-1", "\"ITU-R M.1371-1\""},
+    {1, 14, 16, "ITU-R M.1371-3", "\"ITU-R M.1371-3\""},
+    {2, 14, 16, "ITU-R M.1371-5", "\"ITU-R M.1371-5\""},
+    {3, 27, 29, "ITU-R M.1371 future edition", "\"ITU-R M.1371 future edition\""}
+};
+const LookupTable lookupTableAIS_VERSION = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesAIS_VERSION};
+
+static const LookupEntry lookupEntriesALERT_CATEGORY[] = {
+    {0, 12, 14, "Navigational", "\"Navigational\""},
+    {1, 9, 11, "Technical", "\"Technical\""}
+};
+const LookupTable lookupTableALERT_CATEGORY = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesALERT_CATEGORY};
+
+static const LookupEntry lookupEntriesALERT_LANGUAGE_ID[] = {
+    {0, 12, 14, "English (US)", "\"English (US)\""},
+    {1, 12, 14, "English (UK)", "\"English (UK)\""},
+    {2, 6, 8, "Arabic", "\"Arabic\""},
+    {3, 20, 22, "Chinese (simplified)", "\"Chinese (simplified)\""},
+    {4, 8, 10, "Croatian", "\"Croatian\""},
+    {5, 6, 8, "Danish", "\"Danish\""},
+    {6, 5, 7, "Dutch", "\"Dutch\""},
+    {7, 7, 9, "Finnish", "\"Finnish\""},
+    {8, 6, 8, "French", "\"French\""},
+    {9, 6, 8, "German", "\"German\""},
+    {10, 5, 7, "Greek", "\"Greek\""},
+    {11, 7, 9, "Italian", "\"Italian\""},
+    {12, 8, 10, "Japanese", "\"Japanese\""},
+    {13, 6, 8, "Korean", "\"Korean\""},
+    {14, 9, 11, "Norwegian", "\"Norwegian\""},
+    {15, 6, 8, "Polish", "\"Polish\""},
+    {16, 10, 12, "Portuguese", "\"Portuguese\""},
+    {17, 7, 9, "Russian", "\"Russian\""},
+    {18, 7, 9, "Spanish", "\"Spanish\""},
+    {19, 7, 9, "Swedish", "\"Swedish\""}
+};
+const LookupTable lookupTableALERT_LANGUAGE_ID = {.kind = LOOKUP_TABLE_DENSE, .count = 20, .entries = lookupEntriesALERT_LANGUAGE_ID};
+
+static const LookupEntry lookupEntriesALERT_RESPONSE_COMMAND[] = {
+    {0, 11, 13, "Acknowledge", "\"Acknowledge\""},
+    {1, 17, 19, "Temporary Silence", "\"Temporary Silence\""},
+    {2, 16, 18, "Test Command off", "\"Test Command off\""},
+    {3, 15, 17, "Test Command on", "\"Test Command on\""}
+};
+const LookupTable lookupTableALERT_RESPONSE_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesALERT_RESPONSE_COMMAND};
+
+static const LookupEntry lookupEntriesALERT_STATE[] = {
+    {0, 8, 10, "Disabled", "\"Disabled\""},
+    {1, 6, 8, "Normal", "\"Normal\""},
+    {2, 6, 8, "Active", "\"Active\""},
+    {3, 8, 10, "Silenced", "\"Silenced\""},
+    {4, 12, 14, "Acknowledged", "\"Acknowledged\""},
+    {5, 20, 22, "Awaiting Acknowledge", "\"Awaiting Acknowledge\""}
+};
+const LookupTable lookupTableALERT_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesALERT_STATE};
+
+static const LookupEntry lookupEntriesALERT_THRESHOLD_STATUS[] = {
+    {0, 6, 8, "Normal", "\"Normal\""},
+    {1, 18, 20, "Threshold Exceeded", "\"Threshold Exceeded\""},
+    {2, 26, 28, "Extreme Threshold Exceeded", "\"Extreme Threshold Exceeded\""},
+    {3, 22, 24, "Low Threshold Exceeded", "\"Low Threshold Exceeded\""},
+    {4, 12, 14, "Acknowledged", "\"Acknowledged\""},
+    {5, 20, 22, "Awaiting Acknowledge", "\"Awaiting Acknowledge\""}
+};
+const LookupTable lookupTableALERT_THRESHOLD_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesALERT_THRESHOLD_STATUS};
+
+static const LookupEntry lookupEntriesALERT_TRIGGER_CONDITION[] = {
+    {0, 6, 8, "Manual", "\"Manual\""},
+    {1, 4, 6, "Auto", "\"Auto\""},
+    {2, 4, 6, "Test", "\"Test\""},
+    {3, 8, 10, "Disabled", "\"Disabled\""}
+};
+const LookupTable lookupTableALERT_TRIGGER_CONDITION = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesALERT_TRIGGER_CONDITION};
+
+static const LookupEntry lookupEntriesALERT_TYPE[] = {
+    {0},
+    {1, 15, 17, "Emergency Alarm", "\"Emergency Alarm\""},
+    {2, 5, 7, "Alarm", "\"Alarm\""},
+    {0},
+    {0},
+    {5, 7, 9, "Warning", "\"Warning\""},
+    {0},
+    {0},
+    {8, 7, 9, "Caution", "\"Caution\""}
+};
+const LookupTable lookupTableALERT_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 9, .entries = lookupEntriesALERT_TYPE};
+
+static const LookupEntry lookupEntriesATON_TYPE[] = {
+    {0, 35, 37, "Default: Type of AtoN not specified", "\"Default: Type of AtoN not specified\""},
+    {1, 15, 17, "Reference point", "\"Reference point\""},
+    {2, 5, 7, "RACON", "\"RACON\""},
+    {3, 25, 27, "Fixed structure off-shore", "\"Fixed structure off-shore\""},
+    {4, 23, 25, "Reserved for future use", "\"Reserved for future use\""},
+    {5, 28, 30, "Fixed light: without sectors", "\"Fixed light: without sectors\""},
+    {6, 25, 27, "Fixed light: with sectors", "\"Fixed light: with sectors\""},
+    {7, 25, 27, "Fixed leading light front", "\"Fixed leading light front\""},
+    {8, 24, 26, "Fixed leading light rear", "\"Fixed leading light rear\""},
+    {9, 24, 26, "Fixed beacon: cardinal N", "\"Fixed beacon: cardinal N\""},
+    {10, 24, 26, "Fixed beacon: cardinal E", "\"Fixed beacon: cardinal E\""},
+    {11, 24, 26, "Fixed beacon: cardinal S", "\"Fixed beacon: cardinal S\""},
+    {12, 24, 26, "Fixed beacon: cardinal W", "\"Fixed beacon: cardinal W\""},
+    {13, 23, 25, "Fixed beacon: port hand", "\"Fixed beacon: port hand\""},
+    {14, 28, 30, "Fixed beacon: starboard hand", "\"Fixed beacon: starboard hand\""},
+    {15, 41, 43, "Fixed beacon: preferred channel port hand", "\"Fixed beacon: preferred channel port hand\""},
+    {16, 46, 48, "Fixed beacon: preferred channel starboard hand", "\"Fixed beacon: preferred channel starboard hand\""},
+    {17, 29, 31, "Fixed beacon: isolated danger", "\"Fixed beacon: isolated danger\""},
+    {18, 24, 26, "Fixed beacon: safe water", "\"Fixed beacon: safe water\""},
+    {19, 26, 28, "Fixed beacon: special mark", "\"Fixed beacon: special mark\""},
+    {20, 25, 27, "Floating AtoN: cardinal N", "\"Floating AtoN: cardinal N\""},
+    {21, 25, 27, "Floating AtoN: cardinal E", "\"Floating AtoN: cardinal E\""},
+    {22, 25, 27, "Floating AtoN: cardinal S", "\"Floating AtoN: cardinal S\""},
+    {23, 25, 27, "Floating AtoN: cardinal W", "\"Floating AtoN: cardinal W\""},
+    {24, 29, 31, "Floating AtoN: port hand mark", "\"Floating AtoN: port hand mark\""},
+    {25, 34, 36, "Floating AtoN: starboard hand mark", "\"Floating AtoN: starboard hand mark\""},
+    {26, 42, 44, "Floating AtoN: preferred channel port hand", "\"Floating AtoN: preferred channel port hand\""},
+    {27, 47, 49, "Floating AtoN: preferred channel starboard hand", "\"Floating AtoN: preferred channel starboard hand\""},
+    {28, 30, 32, "Floating AtoN: isolated danger", "\"Floating AtoN: isolated danger\""},
+    {29, 25, 27, "Floating AtoN: safe water", "\"Floating AtoN: safe water\""},
+    {30, 27, 29, "Floating AtoN: special mark", "\"Floating AtoN: special mark\""},
+    {31, 38, 40, "Floating AtoN: light vessel/LANBY/rigs", "\"Floating AtoN: light vessel/LANBY/rigs\""}
+};
+const LookupTable lookupTableATON_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 32, .entries = lookupEntriesATON_TYPE};
+
+static const LookupEntry lookupEntriesAUTOMATIC_MANUAL[] = {
+    {0, 9, 11, "Automatic", "\"Automatic\""},
+    {1, 6, 8, "Manual", "\"Manual\""}
+};
+const LookupTable lookupTableAUTOMATIC_MANUAL = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesAUTOMATIC_MANUAL};
+
+static const LookupEntry lookupEntriesAVAILABLE[] = {
+    {0, 9, 11, "Available", "\"Available\""},
+    {1, 13, 15, "Not available", "\"Not available\""}
+};
+const LookupTable lookupTableAVAILABLE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesAVAILABLE};
+
+static const LookupEntry lookupEntriesBANDG_DECIMALS[] = {
+    {0, 1, 3, "0", "\"0\""},
+    {1, 1, 3, "1", "\"1\""},
+    {2, 1, 3, "2", "\"2\""},
+    {3, 1, 3, "3", "\"3\""},
+    {4, 1, 3, "4", "\"4\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {254, 4, 6, "Auto", "\"Auto\""}
+};
+const LookupTable lookupTableBANDG_DECIMALS = {.kind = LOOKUP_TABLE_DENSE, .count = 255, .entries = lookupEntriesBANDG_DECIMALS};
+
+static const LookupEntry lookupEntriesBANDWIDTH[] = {
+    {0, 7, 9, "Default", "\"Default\""},
+    {1, 8, 10, "12.5 kHz", "\"12.5 kHz\""}
+};
+const LookupTable lookupTableBANDWIDTH = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesBANDWIDTH};
+
+static const LookupEntry lookupEntriesBATTERY_CHEMISTRY[] = {
+    {0, 9, 11, "Pb (Lead)", "\"Pb (Lead)\""},
+    {1, 2, 4, "Li", "\"Li\""},
+    {2, 4, 6, "NiCd", "\"NiCd\""},
+    {3, 3, 5, "ZnO", "\"ZnO\""},
+    {4, 4, 6, "NiMH", "\"NiMH\""}
+};
+const LookupTable lookupTableBATTERY_CHEMISTRY = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesBATTERY_CHEMISTRY};
+
+static const LookupEntry lookupEntriesBATTERY_TYPE[] = {
+    {0, 7, 9, "Flooded", "\"Flooded\""},
+    {1, 3, 5, "Gel", "\"Gel\""},
+    {2, 3, 5, "AGM", "\"AGM\""}
+};
+const LookupTable lookupTableBATTERY_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesBATTERY_TYPE};
+
+static const LookupEntry lookupEntriesBATTERY_VOLTAGE[] = {
+    {0, 2, 4, "6V", "\"6V\""},
+    {1, 3, 5, "12V", "\"12V\""},
+    {2, 3, 5, "24V", "\"24V\""},
+    {3, 3, 5, "32V", "\"32V\""},
+    {4, 3, 5, "36V", "\"36V\""},
+    {5, 3, 5, "42V", "\"42V\""},
+    {6, 3, 5, "48V", "\"48V\""}
+};
+const LookupTable lookupTableBATTERY_VOLTAGE = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesBATTERY_VOLTAGE};
+
+static const LookupEntry lookupEntriesBEARING_MODE[] = {
+    {0, 12, 14, "Great Circle", "\"Great Circle\""},
+    {1, 9, 11, "Rhumbline", "\"Rhumbline\""}
+};
+const LookupTable lookupTableBEARING_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesBEARING_MODE};
+
+static const LookupEntry lookupEntriesBLUETOOTH_SOURCE_STATUS[] = {
+    {0, 8, 10, "Reserved", "\"Reserved\""},
+    {1, 9, 11, "Connected", "\"Connected\""},
+    {2, 10, 12, "Connecting", "\"Connecting\""},
+    {3, 13, 15, "Not connected", "\"Not connected\""}
+};
+const LookupTable lookupTableBLUETOOTH_SOURCE_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesBLUETOOTH_SOURCE_STATUS};
+
+static const LookupEntry lookupEntriesBLUETOOTH_STATUS[] = {
+    {0, 9, 11, "Connected", "\"Connected\""},
+    {1, 13, 15, "Not connected", "\"Not connected\""},
+    {2, 10, 12, "Not paired", "\"Not paired\""}
+};
+const LookupTable lookupTableBLUETOOTH_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesBLUETOOTH_STATUS};
+
+static const LookupEntry lookupEntriesBOOT_STATE[] = {
+    {0, 18, 20, "in Startup Monitor", "\"in Startup Monitor\""},
+    {1, 18, 20, "running Bootloader", "\"running Bootloader\""},
+    {2, 19, 21, "running Application", "\"running Application\""}
+};
+const LookupTable lookupTableBOOT_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesBOOT_STATE};
+
+static const LookupEntry lookupEntriesBROADCAST_INDICATOR[] = {
+    {0, 26, 28, "Broadcast geo area message", "\"Broadcast geo area message\""},
+    {1, 17, 19, "Addressed message", "\"Addressed message\""}
+};
+const LookupTable lookupTableBROADCAST_INDICATOR = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesBROADCAST_INDICATOR};
+
+static const LookupEntry lookupEntriesCERTIFICATION_LEVEL[] = {
+    {0, 7, 9, "Level A", "\"Level A\""},
+    {1, 7, 9, "Level B", "\"Level B\""}
+};
+const LookupTable lookupTableCERTIFICATION_LEVEL = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesCERTIFICATION_LEVEL};
+
+static const LookupEntry lookupEntriesCHARGER_MODE[] = {
+    {0, 10, 12, "Standalone", "\"Standalone\""},
+    {1, 7, 9, "Primary", "\"Primary\""},
+    {2, 9, 11, "Secondary", "\"Secondary\""},
+    {3, 4, 6, "Echo", "\"Echo\""}
+};
+const LookupTable lookupTableCHARGER_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesCHARGER_MODE};
+
+static const LookupEntry lookupEntriesCHARGER_STATE[] = {
+    {0, 12, 14, "Not charging", "\"Not charging\""},
+    {1, 4, 6, "Bulk", "\"Bulk\""},
+    {2, 10, 12, "Absorption", "\"Absorption\""},
+    {3, 10, 12, "Overcharge", "\"Overcharge\""},
+    {4, 8, 10, "Equalise", "\"Equalise\""},
+    {5, 5, 7, "Float", "\"Float\""},
+    {6, 8, 10, "No float", "\"No float\""},
+    {7, 11, 13, "Constant VI", "\"Constant VI\""},
+    {8, 8, 10, "Disabled", "\"Disabled\""},
+    {9, 5, 7, "Fault", "\"Fault\""}
+};
+const LookupTable lookupTableCHARGER_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 10, .entries = lookupEntriesCHARGER_STATE};
+
+static const LookupEntry lookupEntriesCHARGING_ALGORITHM[] = {
+    {0, 7, 9, "Trickle", "\"Trickle\""},
+    {1, 35, 37, "Constant voltage / Constant current", "\"Constant voltage / Constant current\""},
+    {2, 18, 20, "2 stage (no float)", "\"2 stage (no float)\""},
+    {3, 7, 9, "3 stage", "\"3 stage\""}
+};
+const LookupTable lookupTableCHARGING_ALGORITHM = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesCHARGING_ALGORITHM};
+
+static const LookupEntry lookupEntriesCONTROLLER_STATE[] = {
+    {0, 12, 14, "Error Active", "\"Error Active\""},
+    {1, 13, 15, "Error Passive", "\"Error Passive\""},
+    {2, 7, 9, "Bus Off", "\"Bus Off\""}
+};
+const LookupTable lookupTableCONTROLLER_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesCONTROLLER_STATE};
+
+static const LookupEntry lookupEntriesCONVERTER_STATE[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 14, 16, "Low Power Mode", "\"Low Power Mode\""},
+    {2, 5, 7, "Fault", "\"Fault\""},
+    {3, 4, 6, "Bulk", "\"Bulk\""},
+    {4, 10, 12, "Absorption", "\"Absorption\""},
+    {5, 5, 7, "Float", "\"Float\""},
+    {6, 7, 9, "Storage", "\"Storage\""},
+    {7, 8, 10, "Equalize", "\"Equalize\""},
+    {8, 9, 11, "Pass thru", "\"Pass thru\""},
+    {9, 9, 11, "Inverting", "\"Inverting\""},
+    {10, 9, 11, "Assisting", "\"Assisting\""}
+};
+const LookupTable lookupTableCONVERTER_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesCONVERTER_STATE};
+
+static const LookupEntry lookupEntriesCZONE_ALARM_TYPE[] = {
+    {0},
+    {1, 16, 18, "AC Voltage Error", "\"AC Voltage Error\""},
+    {2, 18, 20, "AC Frequency Error", "\"AC Frequency Error\""},
+    {3, 13, 15, "AC High Power", "\"AC High Power\""},
+    {4, 14, 16, "DC Low Voltage", "\"DC Low Voltage\""},
+    {5, 19, 21, "DC Very Low Voltage", "\"DC Very Low Voltage\""},
+    {6, 15, 17, "DC High Voltage", "\"DC High Voltage\""},
+    {7, 23, 25, "DC Low Battery Capacity", "\"DC Low Battery Capacity\""},
+    {0},
+    {0},
+    {10, 12, 14, "Out of Range", "\"Out of Range\""},
+    {11, 15, 17, "Low Run Current", "\"Low Run Current\""},
+    {12, 12, 14, "Over Current", "\"Over Current\""},
+    {13, 13, 15, "Short Circuit", "\"Short Circuit\""},
+    {14, 17, 19, "Missing Commander", "\"Missing Commander\""},
+    {15, 15, 17, "Reverse Current", "\"Reverse Current\""},
+    {16, 17, 19, "Calibration Error", "\"Calibration Error\""},
+    {17, 14, 16, "Missing Output", "\"Missing Output\""},
+    {18, 10, 12, "Systems On", "\"Systems On\""},
+    {19, 18, 20, "AC Very High Power", "\"AC Very High Power\""},
+    {20, 12, 14, "AC Low Power", "\"AC Low Power\""},
+    {21, 28, 30, "DC Very Low Battery Capacity", "\"DC Very Low Battery Capacity\""},
+    {22, 12, 14, "Battery Full", "\"Battery Full\""},
+    {23, 16, 18, "DC Load Shed Low", "\"DC Load Shed Low\""},
+    {24, 21, 23, "DC Load Shed Very Low", "\"DC Load Shed Very Low\""},
+    {25, 16, 18, "AC Load Shed Low", "\"AC Load Shed Low\""},
+    {26, 21, 23, "AC Load Shed Very Low", "\"AC Load Shed Very Low\""},
+    {27, 16, 18, "Reverse Polarity", "\"Reverse Polarity\""},
+    {28, 15, 17, "Manual Override", "\"Manual Override\""},
+    {29, 10, 12, "Mastervolt", "\"Mastervolt\""},
+    {30, 14, 16, "Hardware Fault", "\"Hardware Fault\""},
+    {31, 12, 14, "No AC Supply", "\"No AC Supply\""},
+    {0},
+    {0},
+    {34, 16, 18, "PGN Switching On", "\"PGN Switching On\""},
+    {35, 18, 20, "Low Canbus Voltage", "\"Low Canbus Voltage\""},
+    {36, 10, 12, "Blown Fuse", "\"Blown Fuse\""},
+    {37, 13, 15, "Manual Bypass", "\"Manual Bypass\""},
+    {38, 13, 15, "Generic Alarm", "\"Generic Alarm\""},
+    {39, 25, 27, "Battery Temperature Alarm", "\"Battery Temperature Alarm\""},
+    {40, 24, 26, "Temperature Sensor Error", "\"Temperature Sensor Error\""},
+    {41, 18, 20, "AC IN Out Of Range", "\"AC IN Out Of Range\""},
+    {42, 18, 20, "Device In Overload", "\"Device In Overload\""},
+    {43, 16, 18, "High Temperature", "\"High Temperature\""},
+    {44, 35, 37, "Inverter/Charger Installation Error", "\"Inverter/Charger Installation Error\""},
+    {45, 27, 29, "Inverter Installation Error", "\"Inverter Installation Error\""},
+    {46, 26, 28, "Charger Installation Error", "\"Charger Installation Error\""},
+    {47, 27, 29, "Cable Voltage Drop Too High", "\"Cable Voltage Drop Too High\""},
+    {48, 15, 17, "Shunt mistmatch", "\"Shunt mistmatch\""},
+    {49, 17, 19, "Cooling Fan Error", "\"Cooling Fan Error\""},
+    {50, 22, 24, "Mastershunt Fuse Blown", "\"Mastershunt Fuse Blown\""},
+    {51, 16, 18, "High Temperature", "\"High Temperature\""},
+    {52, 13, 15, "Over Pressure", "\"Over Pressure\""},
+    {53, 12, 14, "Low Pressure", "\"Low Pressure\""},
+    {54, 15, 17, "Rapid Deflation", "\"Rapid Deflation\""},
+    {55, 33, 35, "Inverter/Charger Over Temperature", "\"Inverter/Charger Over Temperature\""},
+    {56, 10, 12, "Confirm On", "\"Confirm On\""},
+    {57, 14, 16, "Battery Safety", "\"Battery Safety\""},
+    {58, 13, 15, "Stop Charging", "\"Stop Charging\""},
+    {59, 19, 21, "Check Battery Relay", "\"Check Battery Relay\""},
+    {60, 24, 26, "Battery Hardware Failure", "\"Battery Hardware Failure\""},
+    {61, 20, 22, "Battery Over Current", "\"Battery Over Current\""},
+    {62, 23, 25, "Battery Temperature Low", "\"Battery Temperature Low\""},
+    {63, 24, 26, "Battery Temperature High", "\"Battery Temperature High\""},
+    {64, 16, 18, "Battery Last 100", "\"Battery Last 100\""}
+};
+const LookupTable lookupTableCZONE_ALARM_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 65, .entries = lookupEntriesCZONE_ALARM_TYPE};
+
+static const LookupEntry lookupEntriesDC_SOURCE[] = {
+    {0, 7, 9, "Battery", "\"Battery\""},
+    {1, 10, 12, "Alternator", "\"Alternator\""},
+    {2, 9, 11, "Convertor", "\"Convertor\""},
+    {3, 10, 12, "Solar cell", "\"Solar cell\""},
+    {4, 14, 16, "Wind generator", "\"Wind generator\""}
+};
+const LookupTable lookupTableDC_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesDC_SOURCE};
+
+static const LookupEntry lookupEntriesDEVICE_CLASS[] = {
+    {0, 21, 23, "Reserved for 2000 Use", "\"Reserved for 2000 Use\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {10, 12, 14, "System tools", "\"System tools\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {20, 14, 16, "Safety systems", "\"Safety systems\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {25, 19, 21, "Internetwork device", "\"Internetwork device\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {30, 23, 25, "Electrical Distribution", "\"Electrical Distribution\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {35, 21, 23, "Electrical Generation", "\"Electrical Generation\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {40, 29, 31, "Steering and Control surfaces", "\"Steering and Control surfaces\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {50, 10, 12, "Propulsion", "\"Propulsion\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {60, 10, 12, "Navigation", "\"Navigation\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {70, 13, 15, "Communication", "\"Communication\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {75, 30, 32, "Sensor Communication Interface", "\"Sensor Communication Interface\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {80, 31, 33, "Instrumentation/general systems", "\"Instrumentation/general systems\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {85, 20, 22, "External Environment", "\"External Environment\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {90, 20, 22, "Internal Environment", "\"Internal Environment\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {100, 40, 42, "Deck + cargo + fishing equipment systems", "\"Deck + cargo + fishing equipment systems\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {110, 15, 17, "Human Interface", "\"Human Interface\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {120, 7, 9, "Display", "\"Display\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {125, 13, 15, "Entertainment", "\"Entertainment\""}
+};
+const LookupTable lookupTableDEVICE_CLASS = {.kind = LOOKUP_TABLE_DENSE, .count = 126, .entries = lookupEntriesDEVICE_CLASS};
+
+static const LookupEntry lookupEntriesDEVICE_TEMP_STATE[] = {
+    {0, 4, 6, "Cold", "\"Cold\""},
+    {1, 4, 6, "Warm", "\"Warm\""},
+    {2, 3, 5, "Hot", "\"Hot\""}
+};
+const LookupTable lookupTableDEVICE_TEMP_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesDEVICE_TEMP_STATE};
+
+static const LookupEntry lookupEntriesDGNSS_MODE[] = {
+    {0, 4, 6, "None", "\"None\""},
+    {1, 17, 19, "SBAS if available", "\"SBAS if available\""},
+    {0},
+    {3, 4, 6, "SBAS", "\"SBAS\""}
+};
+const LookupTable lookupTableDGNSS_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesDGNSS_MODE};
+
+static const LookupEntry lookupEntriesDIFFERENTIAL_MODE[] = {
+    {0, 6, 8, "Manual", "\"Manual\""},
+    {1, 10, 12, "Auto Power", "\"Auto Power\""},
+    {2, 10, 12, "Auto Range", "\"Auto Range\""}
+};
+const LookupTable lookupTableDIFFERENTIAL_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesDIFFERENTIAL_MODE};
+
+static const LookupEntry lookupEntriesDIFFERENTIAL_SOURCE[] = {
+    {0, 4, 6, "Auto", "\"Auto\""},
+    {1, 5, 7, "Loran", "\"Loran\""},
+    {2, 10, 12, "MSK Beacon", "\"MSK Beacon\""},
+    {3, 13, 15, "FM Subcarrier", "\"FM Subcarrier\""},
+    {4, 3, 5, "AIS", "\"AIS\""},
+    {5, 18, 20, "Ground based radio", "\"Ground based radio\""},
+    {6, 4, 6, "SBAS", "\"SBAS\""},
+    {7, 9, 11, "Satellite", "\"Satellite\""}
+};
+const LookupTable lookupTableDIFFERENTIAL_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 8, .entries = lookupEntriesDIFFERENTIAL_SOURCE};
+
+static const LookupEntry lookupEntriesDIRECTION[] = {
+    {0, 7, 9, "Forward", "\"Forward\""},
+    {1, 7, 9, "Reverse", "\"Reverse\""}
+};
+const LookupTable lookupTableDIRECTION = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesDIRECTION};
+
+static const LookupEntry lookupEntriesDIRECTION_REFERENCE[] = {
+    {0, 4, 6, "True", "\"True\""},
+    {1, 8, 10, "Magnetic", "\"Magnetic\""},
+    {2, 5, 7, "Error", "\"Error\""}
+};
+const LookupTable lookupTableDIRECTION_REFERENCE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesDIRECTION_REFERENCE};
+
+static const LookupEntry lookupEntriesDIRECTION_RUDDER[] = {
+    {0, 8, 10, "No Order", "\"No Order\""},
+    {1, 17, 19, "Move to starboard", "\"Move to starboard\""},
+    {2, 12, 14, "Move to port", "\"Move to port\""}
+};
+const LookupTable lookupTableDIRECTION_RUDDER = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesDIRECTION_RUDDER};
+
+static const LookupEntry lookupEntriesDOCKING_STATUS[] = {
+    {0, 10, 12, "Not docked", "\"Not docked\""},
+    {1, 12, 14, "Fully docked", "\"Fully docked\""}
+};
+const LookupTable lookupTableDOCKING_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesDOCKING_STATUS};
+
+static const LookupEntry lookupEntriesDSC_CATEGORY[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {100, 7, 9, "Routine", "\"Routine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {108, 6, 8, "Safety", "\"Safety\""},
+    {0},
+    {110, 7, 9, "Urgency", "\"Urgency\""},
+    {0},
+    {112, 8, 10, "Distress", "\"Distress\""}
+};
+const LookupTable lookupTableDSC_CATEGORY = {.kind = LOOKUP_TABLE_DENSE, .count = 113, .entries = lookupEntriesDSC_CATEGORY};
+
+static const LookupEntry lookupEntriesDSC_EXPANSION_DATA[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {100, 17, 19, "Enhanced position", "\"Enhanced position\""},
+    {101, 28, 30, "Source and datum of position", "\"Source and datum of position\""},
+    {102, 3, 5, "SOG", "\"SOG\""},
+    {103, 3, 5, "COG", "\"COG\""},
+    {104, 33, 35, "Additional station identification", "\"Additional station identification\""},
+    {105, 24, 26, "Enhanced geographic area", "\"Enhanced geographic area\""},
+    {106, 26, 28, "Number of persons on board", "\"Number of persons on board\""}
+};
+const LookupTable lookupTableDSC_EXPANSION_DATA = {.kind = LOOKUP_TABLE_DENSE, .count = 107, .entries = lookupEntriesDSC_EXPANSION_DATA};
+
+static const LookupEntry lookupEntriesDSC_FIRST_TELECOMMAND[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {100, 20, 22, "F3E/G3E All modes TP", "\"F3E/G3E All modes TP\""},
+    {101, 17, 19, "F3E/G3E duplex TP", "\"F3E/G3E duplex TP\""},
+    {0},
+    {103, 7, 9, "Polling", "\"Polling\""},
+    {104, 16, 18, "Unable to comply", "\"Unable to comply\""},
+    {105, 11, 13, "End of call", "\"End of call\""},
+    {106, 4, 6, "Data", "\"Data\""},
+    {0},
+    {0},
+    {109, 6, 8, "J3E TP", "\"J3E TP\""},
+    {110, 24, 26, "Distress acknowledgement", "\"Distress acknowledgement\""},
+    {0},
+    {112, 14, 16, "Distress relay", "\"Distress relay\""},
+    {113, 15, 17, "F1B/J2B TTY-FEC", "\"F1B/J2B TTY-FEC\""},
+    {0},
+    {115, 15, 17, "F1B/J2B TTY-ARQ", "\"F1B/J2B TTY-ARQ\""},
+    {0},
+    {0},
+    {118, 4, 6, "Test", "\"Test\""},
+    {0},
+    {0},
+    {121, 47, 49, "Ship position or location registration updating", "\"Ship position or location registration updating\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {126, 14, 16, "No information", "\"No information\""}
+};
+const LookupTable lookupTableDSC_FIRST_TELECOMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 127, .entries = lookupEntriesDSC_FIRST_TELECOMMAND};
+
+static const LookupEntry lookupEntriesDSC_FORMAT[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {102, 17, 19, "Geographical area", "\"Geographical area\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {112, 8, 10, "Distress", "\"Distress\""},
+    {0},
+    {114, 15, 17, "Common interest", "\"Common interest\""},
+    {0},
+    {116, 9, 11, "All ships", "\"All ships\""},
+    {0},
+    {0},
+    {0},
+    {120, 19, 21, "Individual stations", "\"Individual stations\""},
+    {121, 19, 21, "Non-calling purpose", "\"Non-calling purpose\""},
+    {0},
+    {123, 28, 30, "Individual station automatic", "\"Individual station automatic\""}
+};
+const LookupTable lookupTableDSC_FORMAT = {.kind = LOOKUP_TABLE_DENSE, .count = 124, .entries = lookupEntriesDSC_FORMAT};
+
+static const LookupEntry lookupEntriesDSC_NATURE[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {100, 4, 6, "Fire", "\"Fire\""},
+    {101, 8, 10, "Flooding", "\"Flooding\""},
+    {102, 9, 11, "Collision", "\"Collision\""},
+    {103, 9, 11, "Grounding", "\"Grounding\""},
+    {104, 7, 9, "Listing", "\"Listing\""},
+    {105, 7, 9, "Sinking", "\"Sinking\""},
+    {106, 19, 21, "Disabled and adrift", "\"Disabled and adrift\""},
+    {107, 12, 14, "Undesignated", "\"Undesignated\""},
+    {108, 15, 17, "Abandoning ship", "\"Abandoning ship\""},
+    {109, 6, 8, "Piracy", "\"Piracy\""},
+    {110, 13, 15, "Man overboard", "\"Man overboard\""},
+    {0},
+    {112, 14, 16, "EPIRB emission", "\"EPIRB emission\""}
+};
+const LookupTable lookupTableDSC_NATURE = {.kind = LOOKUP_TABLE_DENSE, .count = 113, .entries = lookupEntriesDSC_NATURE};
+
+static const LookupEntry lookupEntriesDSC_SECOND_TELECOMMAND[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {100, 15, 17, "No reason given", "\"No reason given\""},
+    {101, 17, 19, "Congestion at MSC", "\"Congestion at MSC\""},
+    {102, 4, 6, "Busy", "\"Busy\""},
+    {103, 16, 18, "Queue indication", "\"Queue indication\""},
+    {104, 14, 16, "Station barred", "\"Station barred\""},
+    {105, 21, 23, "No operator available", "\"No operator available\""},
+    {106, 32, 34, "Operator temporarily unavailable", "\"Operator temporarily unavailable\""},
+    {107, 18, 20, "Equipment disabled", "\"Equipment disabled\""},
+    {108, 30, 32, "Unable to use proposed channel", "\"Unable to use proposed channel\""},
+    {109, 27, 29, "Unable to use proposed mode", "\"Unable to use proposed mode\""},
+    {110, 61, 63, "Ships and aircraft of States not parties to an armed conflict", "\"Ships and aircraft of States not parties to an armed conflict\""},
+    {111, 18, 20, "Medical transports", "\"Medical transports\""},
+    {112, 28, 30, "Pay phone/public call office", "\"Pay phone/public call office\""},
+    {113, 8, 10, "Fax/data", "\"Fax/data\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {126, 14, 16, "No information", "\"No information\""}
+};
+const LookupTable lookupTableDSC_SECOND_TELECOMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 127, .entries = lookupEntriesDSC_SECOND_TELECOMMAND};
+
+static const LookupEntry lookupEntriesENGINE_INSTANCE[] = {
+    {0, 33, 35, "Single Engine or Dual Engine Port", "\"Single Engine or Dual Engine Port\""},
+    {1, 21, 23, "Dual Engine Starboard", "\"Dual Engine Starboard\""}
+};
+const LookupTable lookupTableENGINE_INSTANCE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesENGINE_INSTANCE};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_CHANNEL[] = {
+    {0, 12, 14, "All channels", "\"All channels\""},
+    {1, 17, 19, "Stereo full range", "\"Stereo full range\""},
+    {2, 12, 14, "Stereo front", "\"Stereo front\""},
+    {3, 11, 13, "Stereo back", "\"Stereo back\""},
+    {4, 15, 17, "Stereo surround", "\"Stereo surround\""},
+    {5, 6, 8, "Center", "\"Center\""},
+    {6, 9, 11, "Subwoofer", "\"Subwoofer\""},
+    {7, 10, 12, "Front left", "\"Front left\""},
+    {8, 11, 13, "Front right", "\"Front right\""},
+    {9, 9, 11, "Back left", "\"Back left\""},
+    {10, 10, 12, "Back right", "\"Back right\""},
+    {11, 13, 15, "Surround left", "\"Surround left\""},
+    {12, 14, 16, "Surround right", "\"Surround right\""}
+};
+const LookupTable lookupTableENTERTAINMENT_CHANNEL = {.kind = LOOKUP_TABLE_DENSE, .count = 13, .entries = lookupEntriesENTERTAINMENT_CHANNEL};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_DEFAULT_SETTINGS[] = {
+    {0, 37, 39, "Save current settings as user default", "\"Save current settings as user default\""},
+    {1, 17, 19, "Load user default", "\"Load user default\""},
+    {2, 25, 27, "Load manufacturer default", "\"Load manufacturer default\""}
+};
+const LookupTable lookupTableENTERTAINMENT_DEFAULT_SETTINGS = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesENTERTAINMENT_DEFAULT_SETTINGS};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_EQ[] = {
+    {0, 4, 6, "Flat", "\"Flat\""},
+    {1, 4, 6, "Rock", "\"Rock\""},
+    {2, 4, 6, "Hall", "\"Hall\""},
+    {3, 4, 6, "Jazz", "\"Jazz\""},
+    {4, 3, 5, "Pop", "\"Pop\""},
+    {5, 4, 6, "Live", "\"Live\""},
+    {6, 7, 9, "Classic", "\"Classic\""},
+    {7, 5, 7, "Vocal", "\"Vocal\""},
+    {8, 5, 7, "Arena", "\"Arena\""},
+    {9, 6, 8, "Cinema", "\"Cinema\""},
+    {10, 6, 8, "Custom", "\"Custom\""}
+};
+const LookupTable lookupTableENTERTAINMENT_EQ = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesENTERTAINMENT_EQ};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_FILTER[] = {
+    {0, 10, 12, "Full range", "\"Full range\""},
+    {1, 9, 11, "High pass", "\"High pass\""},
+    {2, 8, 10, "Low pass", "\"Low pass\""},
+    {3, 9, 11, "Band pass", "\"Band pass\""},
+    {4, 12, 14, "Notch filter", "\"Notch filter\""}
+};
+const LookupTable lookupTableENTERTAINMENT_FILTER = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesENTERTAINMENT_FILTER};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_GROUP[] = {
+    {0, 4, 6, "File", "\"File\""},
+    {1, 13, 15, "Playlist Name", "\"Playlist Name\""},
+    {2, 10, 12, "Genre Name", "\"Genre Name\""},
+    {3, 10, 12, "Album Name", "\"Album Name\""},
+    {4, 11, 13, "Artist Name", "\"Artist Name\""},
+    {5, 10, 12, "Track Name", "\"Track Name\""},
+    {6, 12, 14, "Station Name", "\"Station Name\""},
+    {7, 14, 16, "Station Number", "\"Station Number\""},
+    {8, 16, 18, "Favourite Number", "\"Favourite Number\""},
+    {9, 10, 12, "Play Queue", "\"Play Queue\""},
+    {10, 12, 14, "Content Info", "\"Content Info\""}
+};
+const LookupTable lookupTableENTERTAINMENT_GROUP = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesENTERTAINMENT_GROUP};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_ID_TYPE[] = {
+    {0, 5, 7, "Group", "\"Group\""},
+    {1, 4, 6, "File", "\"File\""},
+    {2, 15, 17, "Encrypted group", "\"Encrypted group\""},
+    {3, 14, 16, "Encrypted file", "\"Encrypted file\""}
+};
+const LookupTable lookupTableENTERTAINMENT_ID_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesENTERTAINMENT_ID_TYPE};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_LIKE_STATUS[] = {
+    {0, 4, 6, "None", "\"None\""},
+    {1, 9, 11, "Thumbs up", "\"Thumbs up\""},
+    {2, 11, 13, "Thumbs down", "\"Thumbs down\""}
+};
+const LookupTable lookupTableENTERTAINMENT_LIKE_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesENTERTAINMENT_LIKE_STATUS};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_PLAY_STATUS[] = {
+    {0, 4, 6, "Play", "\"Play\""},
+    {1, 5, 7, "Pause", "\"Pause\""},
+    {2, 4, 6, "Stop", "\"Stop\""},
+    {3, 5, 7, "FF 1x", "\"FF 1x\""},
+    {4, 5, 7, "FF 2x", "\"FF 2x\""},
+    {5, 5, 7, "FF 3x", "\"FF 3x\""},
+    {6, 5, 7, "FF 4x", "\"FF 4x\""},
+    {7, 5, 7, "RW 1x", "\"RW 1x\""},
+    {8, 5, 7, "RW 2x", "\"RW 2x\""},
+    {9, 5, 7, "RW 3x", "\"RW 3x\""},
+    {10, 5, 7, "RW 4x", "\"RW 4x\""},
+    {11, 10, 12, "Skip ahead", "\"Skip ahead\""},
+    {12, 9, 11, "Skip back", "\"Skip back\""},
+    {13, 9, 11, "Jog ahead", "\"Jog ahead\""},
+    {14, 8, 10, "Jog back", "\"Jog back\""},
+    {15, 7, 9, "Seek up", "\"Seek up\""},
+    {16, 9, 11, "Seek down", "\"Seek down\""},
+    {17, 7, 9, "Scan up", "\"Scan up\""},
+    {18, 9, 11, "Scan down", "\"Scan down\""},
+    {19, 7, 9, "Tune up", "\"Tune up\""},
+    {20, 9, 11, "Tune down", "\"Tune down\""},
+    {21, 16, 18, "Slow motion .75x", "\"Slow motion .75x\""},
+    {22, 15, 17, "Slow motion .5x", "\"Slow motion .5x\""},
+    {23, 16, 18, "Slow motion .25x", "\"Slow motion .25x\""},
+    {24, 17, 19, "Slow motion .125x", "\"Slow motion .125x\""}
+};
+const LookupTable lookupTableENTERTAINMENT_PLAY_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 25, .entries = lookupEntriesENTERTAINMENT_PLAY_STATUS};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_REGIONS[] = {
+    {0, 3, 5, "USA", "\"USA\""},
+    {1, 6, 8, "Europe", "\"Europe\""},
+    {2, 4, 6, "Asia", "\"Asia\""},
+    {3, 11, 13, "Middle East", "\"Middle East\""},
+    {4, 13, 15, "Latin America", "\"Latin America\""},
+    {5, 9, 11, "Australia", "\"Australia\""},
+    {6, 6, 8, "Russia", "\"Russia\""},
+    {7, 5, 7, "Japan", "\"Japan\""}
+};
+const LookupTable lookupTableENTERTAINMENT_REGIONS = {.kind = LOOKUP_TABLE_DENSE, .count = 8, .entries = lookupEntriesENTERTAINMENT_REGIONS};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_REPEAT_STATUS[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 3, 5, "One", "\"One\""},
+    {2, 3, 5, "All", "\"All\""}
+};
+const LookupTable lookupTableENTERTAINMENT_REPEAT_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesENTERTAINMENT_REPEAT_STATUS};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_SHUFFLE_STATUS[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 10, 12, "Play queue", "\"Play queue\""},
+    {2, 3, 5, "All", "\"All\""}
+};
+const LookupTable lookupTableENTERTAINMENT_SHUFFLE_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesENTERTAINMENT_SHUFFLE_STATUS};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_SOURCE[] = {
+    {0, 12, 14, "Vessel alarm", "\"Vessel alarm\""},
+    {1, 2, 4, "AM", "\"AM\""},
+    {2, 2, 4, "FM", "\"FM\""},
+    {3, 7, 9, "Weather", "\"Weather\""},
+    {4, 3, 5, "DAB", "\"DAB\""},
+    {5, 3, 5, "Aux", "\"Aux\""},
+    {6, 3, 5, "USB", "\"USB\""},
+    {7, 2, 4, "CD", "\"CD\""},
+    {8, 3, 5, "MP3", "\"MP3\""},
+    {9, 9, 11, "Apple iOS", "\"Apple iOS\""},
+    {10, 7, 9, "Android", "\"Android\""},
+    {11, 9, 11, "Bluetooth", "\"Bluetooth\""},
+    {12, 9, 11, "Sirius XM", "\"Sirius XM\""},
+    {13, 7, 9, "Pandora", "\"Pandora\""},
+    {14, 7, 9, "Spotify", "\"Spotify\""},
+    {15, 7, 9, "Slacker", "\"Slacker\""},
+    {16, 6, 8, "Songza", "\"Songza\""},
+    {17, 11, 13, "Apple Radio", "\"Apple Radio\""},
+    {18, 7, 9, "Last FM", "\"Last FM\""},
+    {19, 8, 10, "Ethernet", "\"Ethernet\""},
+    {20, 9, 11, "Video MP4", "\"Video MP4\""},
+    {21, 9, 11, "Video DVD", "\"Video DVD\""},
+    {22, 12, 14, "Video BluRay", "\"Video BluRay\""},
+    {23, 4, 6, "HDMI", "\"HDMI\""},
+    {24, 5, 7, "Video", "\"Video\""}
+};
+const LookupTable lookupTableENTERTAINMENT_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 25, .entries = lookupEntriesENTERTAINMENT_SOURCE};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_TYPE[] = {
+    {0, 4, 6, "File", "\"File\""},
+    {1, 13, 15, "Playlist Name", "\"Playlist Name\""},
+    {2, 10, 12, "Genre Name", "\"Genre Name\""},
+    {3, 10, 12, "Album Name", "\"Album Name\""},
+    {4, 11, 13, "Artist Name", "\"Artist Name\""},
+    {5, 10, 12, "Track Name", "\"Track Name\""},
+    {6, 12, 14, "Station Name", "\"Station Name\""},
+    {7, 14, 16, "Station Number", "\"Station Number\""},
+    {8, 16, 18, "Favourite Number", "\"Favourite Number\""},
+    {9, 10, 12, "Play Queue", "\"Play Queue\""},
+    {10, 12, 14, "Content Info", "\"Content Info\""}
+};
+const LookupTable lookupTableENTERTAINMENT_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesENTERTAINMENT_TYPE};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_VOLUME_CONTROL[] = {
+    {0, 2, 4, "Up", "\"Up\""},
+    {1, 4, 6, "Down", "\"Down\""}
+};
+const LookupTable lookupTableENTERTAINMENT_VOLUME_CONTROL = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesENTERTAINMENT_VOLUME_CONTROL};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_ZONE[] = {
+    {0, 9, 11, "All zones", "\"All zones\""},
+    {1, 6, 8, "Zone 1", "\"Zone 1\""},
+    {2, 6, 8, "Zone 2", "\"Zone 2\""},
+    {3, 6, 8, "Zone 3", "\"Zone 3\""},
+    {4, 6, 8, "Zone 4", "\"Zone 4\""}
+};
+const LookupTable lookupTableENTERTAINMENT_ZONE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesENTERTAINMENT_ZONE};
+
+static const LookupEntry lookupEntriesEQUIPMENT_STATUS[] = {
+    {0, 11, 13, "Operational", "\"Operational\""},
+    {1, 5, 7, "Fault", "\"Fault\""}
+};
+const LookupTable lookupTableEQUIPMENT_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesEQUIPMENT_STATUS};
+
+static const LookupEntry lookupEntriesFLOOD_STATE[] = {
+    {0, 5, 7, "Flood", "\"Flood\""},
+    {1, 5, 7, "Slack", "\"Slack\""},
+    {2, 3, 5, "Ebb", "\"Ebb\""}
+};
+const LookupTable lookupTableFLOOD_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesFLOOD_STATE};
+
+static const LookupEntry lookupEntriesFUSION_COMMAND[] = {
+    {0},
+    {1, 4, 6, "Play", "\"Play\""},
+    {2, 5, 7, "Pause", "\"Pause\""},
+    {0},
+    {4, 4, 6, "Next", "\"Next\""},
+    {0},
+    {6, 4, 6, "Prev", "\"Prev\""}
+};
+const LookupTable lookupTableFUSION_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesFUSION_COMMAND};
+
+static const LookupEntry lookupEntriesFUSION_MENU_ACTION[] = {
+    {0},
+    {1, 4, 6, "Open", "\"Open\""},
+    {2, 6, 8, "Select", "\"Select\""},
+    {0},
+    {4, 5, 7, "Close", "\"Close\""}
+};
+const LookupTable lookupTableFUSION_MENU_ACTION = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesFUSION_MENU_ACTION};
+
+static const LookupEntry lookupEntriesFUSION_MESSAGE_ID[] = {
+    {0},
+    {1, 14, 16, "Request Status", "\"Request Status\""},
+    {2, 10, 12, "Set Source", "\"Set Source\""},
+    {3, 13, 15, "Media Command", "\"Media Command\""},
+    {0},
+    {5, 13, 15, "Tuner Command", "\"Tuner Command\""},
+    {6, 20, 22, "Marine Tuner Command", "\"Marine Tuner Command\""},
+    {7, 24, 26, "Set Marine Tuner Squelch", "\"Set Marine Tuner Squelch\""},
+    {8, 26, 28, "Set Marine Tuner Scan Mode", "\"Set Marine Tuner Scan Mode\""},
+    {9, 11, 13, "Menu Action", "\"Menu Action\""},
+    {10, 18, 20, "Request Menu Count", "\"Request Menu Count\""},
+    {11, 17, 19, "Request Menu Item", "\"Request Menu Item\""},
+    {12, 20, 22, "Request Menu Lock ID", "\"Request Menu Lock ID\""},
+    {13, 12, 14, "Set Aux Gain", "\"Set Aux Gain\""},
+    {0},
+    {15, 12, 14, "Set Settings", "\"Set Settings\""},
+    {16, 19, 21, "DAB Updtate Command", "\"DAB Updtate Command\""},
+    {17, 8, 10, "Set Mute", "\"Set Mute\""},
+    {18, 11, 13, "Set Balance", "\"Set Balance\""},
+    {19, 18, 20, "Set Low Pass Filer", "\"Set Low Pass Filer\""},
+    {20, 12, 14, "Set Sublevel", "\"Set Sublevel\""},
+    {0},
+    {22, 13, 15, "Set Equalizer", "\"Set Equalizer\""},
+    {23, 16, 18, "Set Volume Limit", "\"Set Volume Limit\""},
+    {24, 15, 17, "Set Zone Volume", "\"Set Zone Volume\""},
+    {25, 15, 17, "Set All Volumes", "\"Set All Volumes\""},
+    {0},
+    {27, 22, 24, "Set Line Level Control", "\"Set Line Level Control\""},
+    {28, 5, 7, "Power", "\"Power\""},
+    {29, 15, 17, "Set Device Name", "\"Set Device Name\""},
+    {30, 19, 21, "Send Sirius Command", "\"Send Sirius Command\""},
+    {31, 19, 21, "Set Sirius Parental", "\"Set Sirius Parental\""},
+    {0},
+    {33, 26, 28, "Send Factory Reset Command", "\"Send Factory Reset Command\""},
+    {34, 13, 15, "Set Zone Name", "\"Set Zone Name\""},
+    {35, 16, 18, "Send Dvd Command", "\"Send Dvd Command\""},
+    {36, 16, 18, "Dvd Press Ir Key", "\"Dvd Press Ir Key\""},
+    {0},
+    {0},
+    {39, 23, 25, "Send Select Sirius Team", "\"Send Select Sirius Team\""},
+    {40, 25, 27, "Send Select Sirius Artist", "\"Send Select Sirius Artist\""},
+    {41, 35, 37, "Send Sirius Sport Alert User Action", "\"Send Sirius Sport Alert User Action\""},
+    {0},
+    {0},
+    {0},
+    {45, 35, 37, "Send Sirius Artist Song User Action", "\"Send Sirius Artist Song User Action\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {50, 22, 24, "Send Multiroom Command", "\"Send Multiroom Command\""},
+    {51, 27, 29, "Get Multiroom Device Record", "\"Get Multiroom Device Record\""},
+    {52, 23, 25, "Scan Multirooom Devices", "\"Scan Multirooom Devices\""},
+    {53, 18, 20, "Send File Transfer", "\"Send File Transfer\""},
+    {54, 8, 10, "Set Loud", "\"Set Loud\""},
+    {0},
+    {56, 33, 35, "Fapi Set Source Multiroom Enabled", "\"Fapi Set Source Multiroom Enabled\""},
+    {57, 30, 32, "Request Head Unit Dsp Settings", "\"Request Head Unit Dsp Settings\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {64, 20, 22, "Send Transfer Status", "\"Send Transfer Status\""},
+    {65, 20, 22, "Fapi Get Server Info", "\"Fapi Get Server Info\""},
+    {0},
+    {0},
+    {0},
+    {69, 23, 25, "Fapi Set Source Enabled", "\"Fapi Set Source Enabled\""},
+    {70, 20, 22, "Fapi Set Source Name", "\"Fapi Set Source Name\""},
+    {0},
+    {0},
+    {73, 22, 24, "Send External Amp Gain", "\"Send External Amp Gain\""},
+    {74, 22, 24, "Send Internal Amp Gain", "\"Send Internal Amp Gain\""},
+    {75, 9, 11, "Send Mono", "\"Send Mono\""}
+};
+const LookupTable lookupTableFUSION_MESSAGE_ID = {.kind = LOOKUP_TABLE_DENSE, .count = 76, .entries = lookupEntriesFUSION_MESSAGE_ID};
+
+static const LookupEntry lookupEntriesFUSION_MUTE_COMMAND[] = {
+    {0},
+    {1, 7, 9, "Mute On", "\"Mute On\""},
+    {2, 8, 10, "Mute Off", "\"Mute Off\""}
+};
+const LookupTable lookupTableFUSION_MUTE_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesFUSION_MUTE_COMMAND};
+
+static const LookupEntry lookupEntriesFUSION_PLAY_STATUS[] = {
+    {0, 7, 9, "Invalid", "\"Invalid\""},
+    {1, 7, 9, "Playing", "\"Playing\""},
+    {2, 6, 8, "Paused", "\"Paused\""},
+    {3, 7, 9, "Stopped", "\"Stopped\""},
+    {4, 12, 14, "Skip Forward", "\"Skip Forward\""},
+    {5, 11, 13, "Skip Rewind", "\"Skip Rewind\""}
+};
+const LookupTable lookupTableFUSION_PLAY_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesFUSION_PLAY_STATUS};
+
+static const LookupEntry lookupEntriesFUSION_POWER_STATE[] = {
+    {0},
+    {1, 2, 4, "On", "\"On\""},
+    {2, 3, 5, "Off", "\"Off\""}
+};
+const LookupTable lookupTableFUSION_POWER_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesFUSION_POWER_STATE};
+
+static const LookupEntry lookupEntriesFUSION_RADIO_SOURCE[] = {
+    {0, 2, 4, "AM", "\"AM\""},
+    {1, 2, 4, "FM", "\"FM\""}
+};
+const LookupTable lookupTableFUSION_RADIO_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesFUSION_RADIO_SOURCE};
+
+static const LookupEntry lookupEntriesFUSION_REPEAT_STATUS[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 9, 11, "One/track", "\"One/track\""},
+    {2, 9, 11, "All/album", "\"All/album\""}
+};
+const LookupTable lookupTableFUSION_REPEAT_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesFUSION_REPEAT_STATUS};
+
+static const LookupEntry lookupEntriesFUSION_SETTING[] = {
+    {0, 22, 24, "Alpha Search Threshold", "\"Alpha Search Threshold\""},
+    {1, 14, 16, "iPod Subtitles", "\"iPod Subtitles\""},
+    {2, 13, 15, "Zone 2 Linked", "\"Zone 2 Linked\""},
+    {3, 14, 16, "Zone 2 Enabled", "\"Zone 2 Enabled\""},
+    {4, 14, 16, "Zone 3 Enabled", "\"Zone 3 Enabled\""},
+    {5, 14, 16, "Zone 4 Enabled", "\"Zone 4 Enabled\""},
+    {6, 8, 10, "Telemute", "\"Telemute\""},
+    {7, 12, 14, "Tuner Region", "\"Tuner Region\""},
+    {8, 11, 13, "Marine Zone", "\"Marine Zone\""},
+    {9, 10, 12, "USB repeat", "\"USB repeat\""},
+    {10, 11, 13, "USB shuffle", "\"USB shuffle\""},
+    {11, 18, 20, "iPod Album Artwork", "\"iPod Album Artwork\""},
+    {12, 11, 13, "iPod repeat", "\"iPod repeat\""},
+    {13, 12, 14, "iPod shuffle", "\"iPod shuffle\""},
+    {14, 11, 13, "AM Preset 0", "\"AM Preset 0\""},
+    {15, 11, 13, "AM Preset 1", "\"AM Preset 1\""},
+    {16, 11, 13, "AM Preset 2", "\"AM Preset 2\""},
+    {17, 11, 13, "AM Preset 3", "\"AM Preset 3\""},
+    {18, 11, 13, "AM Preset 4", "\"AM Preset 4\""},
+    {19, 11, 13, "AM Preset 5", "\"AM Preset 5\""},
+    {20, 11, 13, "AM Preset 6", "\"AM Preset 6\""},
+    {21, 11, 13, "AM Preset 7", "\"AM Preset 7\""},
+    {22, 11, 13, "AM Preset 8", "\"AM Preset 8\""},
+    {23, 11, 13, "AM Preset 9", "\"AM Preset 9\""},
+    {24, 12, 14, "AM Preset 10", "\"AM Preset 10\""},
+    {25, 12, 14, "AM Preset 11", "\"AM Preset 11\""},
+    {26, 12, 14, "AM Preset 12", "\"AM Preset 12\""},
+    {27, 12, 14, "AM Preset 13", "\"AM Preset 13\""},
+    {28, 12, 14, "AM Preset 14", "\"AM Preset 14\""},
+    {29, 11, 13, "FM Preset 0", "\"FM Preset 0\""},
+    {30, 11, 13, "FM Preset 1", "\"FM Preset 1\""},
+    {31, 11, 13, "FM Preset 2", "\"FM Preset 2\""},
+    {32, 11, 13, "FM Preset 3", "\"FM Preset 3\""},
+    {33, 11, 13, "FM Preset 4", "\"FM Preset 4\""},
+    {34, 11, 13, "FM Preset 5", "\"FM Preset 5\""},
+    {35, 11, 13, "FM Preset 6", "\"FM Preset 6\""},
+    {36, 11, 13, "FM Preset 7", "\"FM Preset 7\""},
+    {37, 11, 13, "FM Preset 8", "\"FM Preset 8\""},
+    {38, 11, 13, "FM Preset 9", "\"FM Preset 9\""},
+    {39, 12, 14, "FM Preset 10", "\"FM Preset 10\""},
+    {40, 12, 14, "FM Preset 11", "\"FM Preset 11\""},
+    {41, 12, 14, "FM Preset 12", "\"FM Preset 12\""},
+    {42, 12, 14, "FM Preset 13", "\"FM Preset 13\""},
+    {43, 12, 14, "FM Preset 14", "\"FM Preset 14\""},
+    {44, 12, 14, "VHF Preset 0", "\"VHF Preset 0\""},
+    {45, 12, 14, "VHF Preset 1", "\"VHF Preset 1\""},
+    {46, 12, 14, "VHF Preset 2", "\"VHF Preset 2\""},
+    {47, 12, 14, "VHF Preset 3", "\"VHF Preset 3\""},
+    {48, 12, 14, "VHF Preset 4", "\"VHF Preset 4\""},
+    {49, 12, 14, "VHF Preset 5", "\"VHF Preset 5\""},
+    {50, 12, 14, "VHF Preset 6", "\"VHF Preset 6\""},
+    {51, 12, 14, "VHF Preset 7", "\"VHF Preset 7\""},
+    {52, 12, 14, "VHF Preset 8", "\"VHF Preset 8\""},
+    {53, 12, 14, "VHF Preset 9", "\"VHF Preset 9\""},
+    {54, 13, 15, "VHF Preset 10", "\"VHF Preset 10\""},
+    {55, 13, 15, "VHF Preset 11", "\"VHF Preset 11\""},
+    {56, 13, 15, "VHF Preset 12", "\"VHF Preset 12\""},
+    {57, 13, 15, "VHF Preset 13", "\"VHF Preset 13\""},
+    {58, 13, 15, "VHF Preset 14", "\"VHF Preset 14\""},
+    {59, 10, 12, "Clock Time", "\"Clock Time\""},
+    {60, 11, 13, "Clock Alarm", "\"Clock Alarm\""},
+    {61, 17, 19, "iPod Video Signal", "\"iPod Video Signal\""},
+    {62, 19, 21, "iPod Monitor Aspect", "\"iPod Monitor Aspect\""},
+    {63, 14, 16, "Aux Name Index", "\"Aux Name Index\""},
+    {64, 10, 12, "AM Enabled", "\"AM Enabled\""},
+    {65, 11, 13, "VHF Enabled", "\"VHF Enabled\""},
+    {66, 8, 10, "Language", "\"Language\""},
+    {67, 16, 18, "Internal Amps On", "\"Internal Amps On\""},
+    {68, 10, 12, "MTP Repeat", "\"MTP Repeat\""},
+    {69, 11, 13, "MTP Shuffle", "\"MTP Shuffle\""},
+    {70, 19, 21, "Id Accessory Source", "\"Id Accessory Source\""},
+    {71, 10, 12, "NMEA Power", "\"NMEA Power\""},
+    {72, 14, 16, "Low Power Mode", "\"Low Power Mode\""},
+    {73, 10, 12, "DVD region", "\"DVD region\""},
+    {74, 16, 18, "Volume Zone Sync", "\"Volume Zone Sync\""},
+    {75, 16, 18, "Max Volume Start", "\"Max Volume Start\""},
+    {76, 15, 17, "BT Auto Connect", "\"BT Auto Connect\""},
+    {77, 12, 14, "Null Setting", "\"Null Setting\""}
+};
+const LookupTable lookupTableFUSION_SETTING = {.kind = LOOKUP_TABLE_DENSE, .count = 78, .entries = lookupEntriesFUSION_SETTING};
+
+static const LookupEntry lookupEntriesFUSION_SIRIUS_COMMAND[] = {
+    {0},
+    {1, 4, 6, "Next", "\"Next\""},
+    {2, 4, 6, "Prev", "\"Prev\""}
+};
+const LookupTable lookupTableFUSION_SIRIUS_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesFUSION_SIRIUS_COMMAND};
+
+static const LookupEntry lookupEntriesFUSION_SIRIUS_COM_STATE[] = {
+    {0},
+    {1, 3, 5, "Off", "\"Off\""},
+    {2, 12, 14, "Initialising", "\"Initialising\""},
+    {3, 2, 4, "On", "\"On\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {255, 7, 9, "Unknown", "\"Unknown\""}
+};
+const LookupTable lookupTableFUSION_SIRIUS_COM_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 256, .entries = lookupEntriesFUSION_SIRIUS_COM_STATE};
+
+static const LookupEntry lookupEntriesFUSION_SIRIUS_TUNING_MODE[] = {
+    {0},
+    {1, 6, 8, "Normal", "\"Normal\""},
+    {2, 8, 10, "Category", "\"Category\""},
+    {3, 6, 8, "Preset", "\"Preset\""}
+};
+const LookupTable lookupTableFUSION_SIRIUS_TUNING_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesFUSION_SIRIUS_TUNING_MODE};
+
+static const LookupEntry lookupEntriesFUSION_SOURCE_TYPE[] = {
+    {0, 2, 4, "AM", "\"AM\""},
+    {1, 2, 4, "FM", "\"FM\""},
+    {2, 3, 5, "Aux", "\"Aux\""},
+    {3, 6, 8, "Sirius", "\"Sirius\""},
+    {4, 4, 6, "Ipod", "\"Ipod\""},
+    {5, 3, 5, "USB", "\"USB\""},
+    {6, 3, 5, "DVD", "\"DVD\""},
+    {7, 3, 5, "VHF", "\"VHF\""},
+    {8, 7, 9, "Invalid", "\"Invalid\""},
+    {9, 3, 5, "MTP", "\"MTP\""},
+    {10, 9, 11, "Bluetooth", "\"Bluetooth\""},
+    {11, 3, 5, "ARC", "\"ARC\""},
+    {12, 7, 9, "Android", "\"Android\""},
+    {13, 7, 9, "Pandora", "\"Pandora\""},
+    {14, 3, 5, "DAB", "\"DAB\""},
+    {15, 7, 9, "AirPlay", "\"AirPlay\""},
+    {16, 4, 6, "UPNP", "\"UPNP\""},
+    {17, 7, 9, "Unknown", "\"Unknown\""}
+};
+const LookupTable lookupTableFUSION_SOURCE_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 18, .entries = lookupEntriesFUSION_SOURCE_TYPE};
+
+static const LookupEntry lookupEntriesFUSION_STATUS_MESSAGE_ID[] = {
+    {0, 7, 9, "Unknown", "\"Unknown\""},
+    {32769, 11, 13, "API Version", "\"API Version\""},
+    {32770, 6, 8, "Source", "\"Source\""},
+    {32771, 12, 14, "Source Count", "\"Source Count\""},
+    {32772, 10, 12, "Track Info", "\"Track Info\""},
+    {32773, 11, 13, "Track Title", "\"Track Title\""},
+    {32774, 12, 14, "Track Artist", "\"Track Artist\""},
+    {32775, 11, 13, "Track Album", "\"Track Album\""},
+    {32776, 9, 11, "Cover Art", "\"Cover Art\""},
+    {32777, 14, 16, "Track Progress", "\"Track Progress\""},
+    {32778, 11, 13, "Tuner Align", "\"Tuner Align\""},
+    {32779, 5, 7, "Tuner", "\"Tuner\""},
+    {32780, 12, 14, "Marine Tuner", "\"Marine Tuner\""},
+    {32781, 14, 16, "Marine Squelch", "\"Marine Squelch\""},
+    {32782, 16, 18, "Marine Scan Mode", "\"Marine Scan Mode\""},
+    {32783, 11, 13, "Menu Action", "\"Menu Action\""},
+    {32784, 10, 12, "Menu Count", "\"Menu Count\""},
+    {32785, 9, 11, "Menu Item", "\"Menu Item\""},
+    {32786, 12, 14, "Menu Lock ID", "\"Menu Lock ID\""},
+    {32787, 8, 10, "Aux Gain", "\"Aux Gain\""},
+    {32788, 7, 9, "Setting", "\"Setting\""},
+    {32789, 8, 10, "Settings", "\"Settings\""},
+    {32790, 22, 24, "Update Firmware Result", "\"Update Firmware Result\""},
+    {32791, 4, 6, "Mute", "\"Mute\""},
+    {32792, 7, 9, "Balance", "\"Balance\""},
+    {32793, 15, 17, "Low Pass Filter", "\"Low Pass Filter\""},
+    {32794, 9, 11, "Sublevels", "\"Sublevels\""},
+    {32795, 4, 6, "Tone", "\"Tone\""},
+    {32796, 13, 15, "Volume Limits", "\"Volume Limits\""},
+    {32797, 6, 8, "Volume", "\"Volume\""},
+    {32798, 12, 14, "Capabilities", "\"Capabilities\""},
+    {32799, 18, 20, "Line Level Control", "\"Line Level Control\""},
+    {32800, 5, 7, "Power", "\"Power\""},
+    {32801, 9, 11, "Unit Name", "\"Unit Name\""},
+    {32802, 6, 8, "Sirius", "\"Sirius\""},
+    {32803, 21, 23, "SiriusXM Preset Event", "\"SiriusXM Preset Event\""},
+    {32804, 16, 18, "SiriusXM Channel", "\"SiriusXM Channel\""},
+    {32805, 14, 16, "SiriusXM Title", "\"SiriusXM Title\""},
+    {32806, 15, 17, "SiriusXM Artist", "\"SiriusXM Artist\""},
+    {32807, 14, 16, "SiriusXM Genre", "\"SiriusXM Genre\""},
+    {32808, 17, 19, "SiriusXM Category", "\"SiriusXM Category\""},
+    {32809, 15, 17, "SiriusXm Signal", "\"SiriusXm Signal\""},
+    {32810, 25, 27, "SiriusXM Parental Request", "\"SiriusXM Parental Request\""},
+    {32811, 20, 22, "SiriusXM Diagnostics", "\"SiriusXM Diagnostics\""},
+    {32812, 16, 18, "SiriusXM Presets", "\"SiriusXM Presets\""},
+    {32813, 9, 11, "Zone Name", "\"Zone Name\""},
+    {32819, 10, 12, "IP Setting", "\"IP Setting\""},
+    {32824, 9, 11, "Multiroom", "\"Multiroom\""},
+    {32825, 16, 18, "Multiroom Status", "\"Multiroom Status\""},
+    {32829, 19, 21, "System Capabilities", "\"System Capabilities\""},
+    {32830, 11, 13, "Part Number", "\"Part Number\""},
+    {32832, 17, 19, "Processing Bypass", "\"Processing Bypass\""},
+    {32846, 11, 13, "Server Info", "\"Server Info\""},
+    {32850, 8, 10, "RDS Data", "\"RDS Data\""},
+    {32859, 21, 23, "Ignition Switch State", "\"Ignition Switch State\""},
+    {32862, 4, 6, "Mono", "\"Mono\""},
+    {32863, 26, 28, "Speed Volume Current Speed", "\"Speed Volume Current Speed\""},
+    {32865, 26, 28, "Zone Capabilities Extended", "\"Zone Capabilities Extended\""}
+};
+const LookupTable lookupTableFUSION_STATUS_MESSAGE_ID = {.kind = LOOKUP_TABLE_SORTED, .count = 58, .entries = lookupEntriesFUSION_STATUS_MESSAGE_ID};
+
+static const LookupEntry lookupEntriesGARMIN_ATT_MESSAGE_ID[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {40, 26, 28, "Calibration Matrix Present", "\"Calibration Matrix Present\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {52, 15, 17, "Set North State", "\"Set North State\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {65, 12, 14, "Device Flags", "\"Device Flags\""},
+    {0},
+    {67, 21, 23, "COG Source Valid Flag", "\"COG Source Valid Flag\""}
+};
+const LookupTable lookupTableGARMIN_ATT_MESSAGE_ID = {.kind = LOOKUP_TABLE_DENSE, .count = 68, .entries = lookupEntriesGARMIN_ATT_MESSAGE_ID};
+
+static const LookupEntry lookupEntriesGARMIN_AUTOPILOT_FIELD[] = {
+    {0},
+    {0},
+    {0},
+    {3, 9, 11, "Heartbeat", "\"Heartbeat\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {10, 10, 12, "Mode State", "\"Mode State\""},
+    {11, 16, 18, "Heading to Steer", "\"Heading to Steer\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {62, 16, 18, "Response Setting", "\"Response Setting\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {114, 12, 14, "Rate of Turn", "\"Rate of Turn\""},
+    {115, 18, 20, "Rate of Turn Order", "\"Rate of Turn Order\""},
+    {116, 16, 18, "Turn Angle Order", "\"Turn Angle Order\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {158, 14, 16, "System Voltage", "\"System Voltage\""},
+    {0},
+    {0},
+    {161, 19, 21, "Turn Angle Measured", "\"Turn Angle Measured\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {239, 12, 14, "Engine RPM B", "\"Engine RPM B\""},
+    {240, 12, 14, "Engine RPM A", "\"Engine RPM A\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {246, 5, 7, "Speed", "\"Speed\""}
+};
+const LookupTable lookupTableGARMIN_AUTOPILOT_FIELD = {.kind = LOOKUP_TABLE_DENSE, .count = 247, .entries = lookupEntriesGARMIN_AUTOPILOT_FIELD};
+
+static const LookupEntry lookupEntriesGARMIN_AUTOPILOT_MANEUVER_CODE[] = {
+    {0, 25, 27, "Decrease Heading 1 Degree", "\"Decrease Heading 1 Degree\""},
+    {1, 27, 29, "Decrease Heading 10 Degrees", "\"Decrease Heading 10 Degrees\""},
+    {2, 25, 27, "Increase Heading 1 Degree", "\"Increase Heading 1 Degree\""},
+    {3, 27, 29, "Increase Heading 10 Degrees", "\"Increase Heading 10 Degrees\""}
+};
+const LookupTable lookupTableGARMIN_AUTOPILOT_MANEUVER_CODE = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesGARMIN_AUTOPILOT_MANEUVER_CODE};
+
+static const LookupEntry lookupEntriesGARMIN_AUTOPILOT_MODE_STATE[] = {
+    {0},
+    {0},
+    {2, 7, 9, "Standby", "\"Standby\""},
+    {3, 12, 14, "Shadow Drive", "\"Shadow Drive\""},
+    {0},
+    {5, 7, 9, "Engaged", "\"Engaged\""}
+};
+const LookupTable lookupTableGARMIN_AUTOPILOT_MODE_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesGARMIN_AUTOPILOT_MODE_STATE};
+
+static const LookupEntry lookupEntriesGARMIN_BACKLIGHT_LEVEL[] = {
+    {0, 2, 4, "0%", "\"0%\""},
+    {1, 2, 4, "5%", "\"5%\""},
+    {2, 3, 5, "10%", "\"10%\""},
+    {3, 3, 5, "15%", "\"15%\""},
+    {4, 3, 5, "20%", "\"20%\""},
+    {5, 3, 5, "25%", "\"25%\""},
+    {6, 3, 5, "30%", "\"30%\""},
+    {7, 3, 5, "35%", "\"35%\""},
+    {8, 3, 5, "40%", "\"40%\""},
+    {9, 3, 5, "45%", "\"45%\""},
+    {10, 3, 5, "50%", "\"50%\""},
+    {11, 3, 5, "55%", "\"55%\""},
+    {12, 3, 5, "60%", "\"60%\""},
+    {13, 3, 5, "65%", "\"65%\""},
+    {14, 3, 5, "70%", "\"70%\""},
+    {15, 3, 5, "75%", "\"75%\""},
+    {16, 3, 5, "80%", "\"80%\""},
+    {17, 3, 5, "85%", "\"85%\""},
+    {18, 3, 5, "90%", "\"90%\""},
+    {19, 3, 5, "95%", "\"95%\""},
+    {20, 4, 6, "100%", "\"100%\""}
+};
+const LookupTable lookupTableGARMIN_BACKLIGHT_LEVEL = {.kind = LOOKUP_TABLE_DENSE, .count = 21, .entries = lookupEntriesGARMIN_BACKLIGHT_LEVEL};
+
+static const LookupEntry lookupEntriesGARMIN_COLOR[] = {
+    {0, 14, 16, "Day full color", "\"Day full color\""},
+    {1, 17, 19, "Day high contrast", "\"Day high contrast\""},
+    {2, 16, 18, "Night full color", "\"Night full color\""},
+    {3, 15, 17, "Night red/black", "\"Night red/black\""},
+    {4, 17, 19, "Night green/black", "\"Night green/black\""}
+};
+const LookupTable lookupTableGARMIN_COLOR = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesGARMIN_COLOR};
+
+static const LookupEntry lookupEntriesGARMIN_COLOR_MODE[] = {
+    {0, 3, 5, "Day", "\"Day\""},
+    {1, 5, 7, "Night", "\"Night\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {13, 5, 7, "Color", "\"Color\""}
+};
+const LookupTable lookupTableGARMIN_COLOR_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 14, .entries = lookupEntriesGARMIN_COLOR_MODE};
+
+static const LookupEntry lookupEntriesGARMIN_MESSAGE_ID[] = {
+    {1900, 18, 20, "AHRS ATT transport", "\"AHRS ATT transport\""},
+    {5904, 19, 21, "Autopilot transport", "\"Autopilot transport\""}
+};
+const LookupTable lookupTableGARMIN_MESSAGE_ID = {.kind = LOOKUP_TABLE_SORTED, .count = 2, .entries = lookupEntriesGARMIN_MESSAGE_ID};
+
+static const LookupEntry lookupEntriesGEAR_STATUS[] = {
+    {0, 7, 9, "Forward", "\"Forward\""},
+    {1, 7, 9, "Neutral", "\"Neutral\""},
+    {2, 7, 9, "Reverse", "\"Reverse\""}
+};
+const LookupTable lookupTableGEAR_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesGEAR_STATUS};
+
+static const LookupEntry lookupEntriesGNS[] = {
+    {0, 3, 5, "GPS", "\"GPS\""},
+    {1, 7, 9, "GLONASS", "\"GLONASS\""},
+    {2, 11, 13, "GPS+GLONASS", "\"GPS+GLONASS\""},
+    {3, 13, 15, "GPS+SBAS/WAAS", "\"GPS+SBAS/WAAS\""},
+    {4, 21, 23, "GPS+SBAS/WAAS+GLONASS", "\"GPS+SBAS/WAAS+GLONASS\""},
+    {5, 6, 8, "Chayka", "\"Chayka\""},
+    {6, 10, 12, "integrated", "\"integrated\""},
+    {7, 8, 10, "surveyed", "\"surveyed\""},
+    {8, 7, 9, "Galileo", "\"Galileo\""}
+};
+const LookupTable lookupTableGNS = {.kind = LOOKUP_TABLE_DENSE, .count = 9, .entries = lookupEntriesGNS};
+
+static const LookupEntry lookupEntriesGNSS_MODE[] = {
+    {0, 2, 4, "1D", "\"1D\""},
+    {1, 2, 4, "2D", "\"2D\""},
+    {2, 2, 4, "3D", "\"3D\""},
+    {3, 4, 6, "Auto", "\"Auto\""}
+};
+const LookupTable lookupTableGNSS_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesGNSS_MODE};
+
+static const LookupEntry lookupEntriesGNSS_SYSTEM[] = {
+    {0, 3, 5, "GPS", "\"GPS\""},
+    {1, 7, 9, "GLONASS", "\"GLONASS\""},
+    {2, 7, 9, "Galileo", "\"Galileo\""},
+    {3, 6, 8, "BeiDou", "\"BeiDou\""},
+    {4, 4, 6, "QZSS", "\"QZSS\""}
+};
+const LookupTable lookupTableGNSS_SYSTEM = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesGNSS_SYSTEM};
+
+static const LookupEntry lookupEntriesGNS_INTEGRITY[] = {
+    {0, 21, 23, "No integrity checking", "\"No integrity checking\""},
+    {1, 4, 6, "Safe", "\"Safe\""},
+    {2, 7, 9, "Caution", "\"Caution\""},
+    {3, 6, 8, "Unsafe", "\"Unsafe\""}
+};
+const LookupTable lookupTableGNS_INTEGRITY = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesGNS_INTEGRITY};
+
+static const LookupEntry lookupEntriesGNS_METHOD[] = {
+    {0, 7, 9, "no GNSS", "\"no GNSS\""},
+    {1, 8, 10, "GNSS fix", "\"GNSS fix\""},
+    {2, 9, 11, "DGNSS fix", "\"DGNSS fix\""},
+    {3, 12, 14, "Precise GNSS", "\"Precise GNSS\""},
+    {4, 17, 19, "RTK Fixed Integer", "\"RTK Fixed Integer\""},
+    {5, 9, 11, "RTK float", "\"RTK float\""},
+    {6, 19, 21, "Estimated (DR) mode", "\"Estimated (DR) mode\""},
+    {7, 12, 14, "Manual Input", "\"Manual Input\""},
+    {8, 13, 15, "Simulate mode", "\"Simulate mode\""}
+};
+const LookupTable lookupTableGNS_METHOD = {.kind = LOOKUP_TABLE_DENSE, .count = 9, .entries = lookupEntriesGNS_METHOD};
+
+static const LookupEntry lookupEntriesGOOD_WARNING_ERROR[] = {
+    {0, 4, 6, "Good", "\"Good\""},
+    {1, 7, 9, "Warning", "\"Warning\""},
+    {2, 5, 7, "Error", "\"Error\""}
+};
+const LookupTable lookupTableGOOD_WARNING_ERROR = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesGOOD_WARNING_ERROR};
+
+static const LookupEntry lookupEntriesGROUP_FUNCTION[] = {
+    {0, 7, 9, "Request", "\"Request\""},
+    {1, 7, 9, "Command", "\"Command\""},
+    {2, 11, 13, "Acknowledge", "\"Acknowledge\""},
+    {3, 11, 13, "Read Fields", "\"Read Fields\""},
+    {4, 17, 19, "Read Fields Reply", "\"Read Fields Reply\""},
+    {5, 12, 14, "Write Fields", "\"Write Fields\""},
+    {6, 18, 20, "Write Fields Reply", "\"Write Fields Reply\""}
+};
+const LookupTable lookupTableGROUP_FUNCTION = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesGROUP_FUNCTION};
+
+static const LookupEntry lookupEntriesHUMIDITY_SOURCE[] = {
+    {0, 6, 8, "Inside", "\"Inside\""},
+    {1, 7, 9, "Outside", "\"Outside\""}
+};
+const LookupTable lookupTableHUMIDITY_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesHUMIDITY_SOURCE};
+
+static const LookupEntry lookupEntriesINDUSTRY_CODE[] = {
+    {0, 6, 8, "Global", "\"Global\""},
+    {1, 7, 9, "Highway", "\"Highway\""},
+    {2, 11, 13, "Agriculture", "\"Agriculture\""},
+    {3, 12, 14, "Construction", "\"Construction\""},
+    {4, 15, 17, "Marine Industry", "\"Marine Industry\""},
+    {5, 10, 12, "Industrial", "\"Industrial\""}
+};
+const LookupTable lookupTableINDUSTRY_CODE = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesINDUSTRY_CODE};
+
+static const LookupEntry lookupEntriesINVERTER_MODE[] = {
+    {0, 10, 12, "Standalone", "\"Standalone\""},
+    {1, 13, 15, "Series Master", "\"Series Master\""},
+    {2, 12, 14, "Series Slave", "\"Series Slave\""},
+    {3, 15, 17, "Parallel Master", "\"Parallel Master\""},
+    {4, 14, 16, "Parallel Slave", "\"Parallel Slave\""}
+};
+const LookupTable lookupTableINVERTER_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesINVERTER_MODE};
+
+static const LookupEntry lookupEntriesINVERTER_STATE[] = {
+    {0, 6, 8, "Invert", "\"Invert\""},
+    {1, 11, 13, "AC passthru", "\"AC passthru\""},
+    {2, 10, 12, "Load sense", "\"Load sense\""},
+    {3, 5, 7, "Fault", "\"Fault\""},
+    {4, 8, 10, "Disabled", "\"Disabled\""}
+};
+const LookupTable lookupTableINVERTER_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesINVERTER_STATE};
+
+static const LookupEntry lookupEntriesISO_COMMAND[] = {
+    {0, 3, 5, "ACK", "\"ACK\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {16, 3, 5, "RTS", "\"RTS\""},
+    {17, 3, 5, "CTS", "\"CTS\""},
+    {0},
+    {19, 3, 5, "EOM", "\"EOM\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {32, 3, 5, "BAM", "\"BAM\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {255, 5, 7, "Abort", "\"Abort\""}
+};
+const LookupTable lookupTableISO_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 256, .entries = lookupEntriesISO_COMMAND};
+
+static const LookupEntry lookupEntriesISO_CONTROL[] = {
+    {0, 3, 5, "ACK", "\"ACK\""},
+    {1, 3, 5, "NAK", "\"NAK\""},
+    {2, 13, 15, "Access Denied", "\"Access Denied\""},
+    {3, 12, 14, "Address Busy", "\"Address Busy\""}
+};
+const LookupTable lookupTableISO_CONTROL = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesISO_CONTROL};
+
+static const LookupEntry lookupEntriesLIGHTING_COMMAND[] = {
+    {0, 4, 6, "Idle", "\"Idle\""},
+    {1, 14, 16, "Detect Devices", "\"Detect Devices\""},
+    {2, 6, 8, "Reboot", "\"Reboot\""},
+    {3, 13, 15, "Factory Reset", "\"Factory Reset\""},
+    {4, 11, 13, "Powering Up", "\"Powering Up\""}
+};
+const LookupTable lookupTableLIGHTING_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesLIGHTING_COMMAND};
+
+static const LookupEntry lookupEntriesLINE[] = {
+    {0, 6, 8, "Line 1", "\"Line 1\""},
+    {1, 6, 8, "Line 2", "\"Line 2\""},
+    {2, 6, 8, "Line 3", "\"Line 3\""}
+};
+const LookupTable lookupTableLINE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesLINE};
+
+static const LookupEntry lookupEntriesLOW_BATTERY[] = {
+    {0, 4, 6, "Good", "\"Good\""},
+    {1, 3, 5, "Low", "\"Low\""}
+};
+const LookupTable lookupTableLOW_BATTERY = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesLOW_BATTERY};
+
+static const LookupEntry lookupEntriesMAGNETIC_VARIATION[] = {
+    {0, 6, 8, "Manual", "\"Manual\""},
+    {1, 15, 17, "Automatic Chart", "\"Automatic Chart\""},
+    {2, 15, 17, "Automatic Table", "\"Automatic Table\""},
+    {3, 21, 23, "Automatic Calculation", "\"Automatic Calculation\""},
+    {4, 8, 10, "WMM 2000", "\"WMM 2000\""},
+    {5, 8, 10, "WMM 2005", "\"WMM 2005\""},
+    {6, 8, 10, "WMM 2010", "\"WMM 2010\""},
+    {7, 8, 10, "WMM 2015", "\"WMM 2015\""},
+    {8, 8, 10, "WMM 2020", "\"WMM 2020\""},
+    {9, 8, 10, "WMM 2025", "\"WMM 2025\""}
+};
+const LookupTable lookupTableMAGNETIC_VARIATION = {.kind = LOOKUP_TABLE_DENSE, .count = 10, .entries = lookupEntriesMAGNETIC_VARIATION};
+
+static const LookupEntry lookupEntriesMANUFACTURER_CODE[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {69, 16, 18, "ARKS Enterprises", "\"ARKS Enterprises\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {78, 28, 30, "FW Murphy/Enovation Controls", "\"FW Murphy/Enovation Controls\""},
+    {0},
+    {80, 9, 11, "Twin Disc", "\"Twin Disc\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {85, 20, 22, "Kohler Power Systems", "\"Kohler Power Systems\""},
+    {0},
+    {0},
+    {88, 14, 16, "Hemisphere GPS", "\"Hemisphere GPS\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {135, 6, 8, "Airmar", "\"Airmar\""},
+    {0},
+    {137, 8, 10, "Maretron", "\"Maretron\""},
+    {0},
+    {0},
+    {140, 8, 10, "Lowrance", "\"Lowrance\""},
+    {0},
+    {0},
+    {0},
+    {144, 14, 16, "Mercury Marine", "\"Mercury Marine\""},
+    {0},
+    {0},
+    {147, 19, 21, "Nautibus Electronic", "\"Nautibus Electronic\""},
+    {148, 15, 17, "Blue Water Data", "\"Blue Water Data\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {154, 10, 12, "Westerbeke", "\"Westerbeke\""},
+    {0},
+    {0},
+    {157, 6, 8, "ISSPRO", "\"ISSPRO\""},
+    {0},
+    {0},
+    {0},
+    {161, 21, 23, "Offshore Systems (UK)", "\"Offshore Systems (UK)\""},
+    {0},
+    {163, 12, 14, "Evinrude/BRP", "\"Evinrude/BRP\""},
+    {0},
+    {165, 12, 14, "CPAC Systems", "\"CPAC Systems\""},
+    {0},
+    {0},
+    {168, 18, 20, "Xantrex Technology", "\"Xantrex Technology\""},
+    {169, 19, 21, "Marlin Technologies", "\"Marlin Technologies\""},
+    {0},
+    {0},
+    {172, 13, 15, "Yanmar Marine", "\"Yanmar Marine\""},
+    {0},
+    {174, 11, 13, "Volvo Penta", "\"Volvo Penta\""},
+    {0},
+    {176, 44, 46, "Carling Technologies Inc. (Moritz Aerospace)", "\"Carling Technologies Inc. (Moritz Aerospace)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {185, 17, 19, "Beede Instruments", "\"Beede Instruments\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {192, 18, 20, "Floscan Instrument", "\"Floscan Instrument\""},
+    {193, 8, 10, "Nobeltec", "\"Nobeltec\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {198, 28, 30, "Mystic Valley Communications", "\"Mystic Valley Communications\""},
+    {199, 5, 7, "Actia", "\"Actia\""},
+    {0},
+    {201, 21, 23, "Disenos Y Technologia", "\"Disenos Y Technologia\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {211, 25, 27, "Digital Switching Systems", "\"Digital Switching Systems\""},
+    {0},
+    {0},
+    {0},
+    {215, 12, 14, "Xintex/Atena", "\"Xintex/Atena\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {224, 12, 14, "EMMI NETWORK", "\"EMMI NETWORK\""},
+    {0},
+    {0},
+    {0},
+    {228, 2, 4, "ZF", "\"ZF\""},
+    {229, 6, 8, "Garmin", "\"Garmin\""},
+    {0},
+    {0},
+    {0},
+    {233, 26, 28, "Yacht Monitoring Solutions", "\"Yacht Monitoring Solutions\""},
+    {0},
+    {235, 44, 46, "Sailormade Marine Telemetry/Tetra Technology", "\"Sailormade Marine Telemetry/Tetra Technology\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {243, 5, 7, "Eride", "\"Eride\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {257, 11, 13, "Honda Motor", "\"Honda Motor\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {272, 5, 7, "Groco", "\"Groco\""},
+    {273, 9, 11, "Actisense", "\"Actisense\""},
+    {274, 23, 25, "Amphenol LTW Technology", "\"Amphenol LTW Technology\""},
+    {275, 6, 8, "Navico", "\"Navico\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {283, 12, 14, "Hamilton Jet", "\"Hamilton Jet\""},
+    {0},
+    {285, 12, 14, "Sea Recovery", "\"Sea Recovery\""},
+    {286, 16, 18, "Coelmo SRL Italy", "\"Coelmo SRL Italy\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {295, 10, 12, "BEP Marine", "\"BEP Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {304, 9, 11, "Empir Bus", "\"Empir Bus\""},
+    {305, 7, 9, "NovAtel", "\"NovAtel\""},
+    {306, 14, 16, "Sleipner Motor", "\"Sleipner Motor\""},
+    {307, 16, 18, "MBW Technologies", "\"MBW Technologies\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {315, 4, 6, "ICOM", "\"ICOM\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {328, 6, 8, "Qwerty", "\"Qwerty\""},
+    {329, 4, 6, "Dief", "\"Dief\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {341, 30, 32, "Boening Automationstechnologie", "\"Boening Automationstechnologie\""},
+    {0},
+    {0},
+    {0},
+    {345, 26, 28, "Korean Maritime University", "\"Korean Maritime University\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {351, 17, 19, "Thrane and Thrane", "\"Thrane and Thrane\""},
+    {0},
+    {0},
+    {0},
+    {355, 10, 12, "Mastervolt", "\"Mastervolt\""},
+    {356, 24, 26, "Fischer Panda Generators", "\"Fischer Panda Generators\""},
+    {0},
+    {358, 14, 16, "Victron Energy", "\"Victron Energy\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {370, 18, 20, "Rolls Royce Marine", "\"Rolls Royce Marine\""},
+    {0},
+    {0},
+    {373, 17, 19, "Electronic Design", "\"Electronic Design\""},
+    {374, 15, 17, "Northern Lights", "\"Northern Lights\""},
+    {0},
+    {0},
+    {0},
+    {378, 11, 13, "Glendinning", "\"Glendinning\""},
+    {0},
+    {0},
+    {381, 5, 7, "B & G", "\"B & G\""},
+    {0},
+    {0},
+    {384, 29, 31, "Rose Point Navigation Systems", "\"Rose Point Navigation Systems\""},
+    {385, 46, 48, "Johnson Outdoors Marine Electronics Inc Geonav", "\"Johnson Outdoors Marine Electronics Inc Geonav\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {394, 6, 8, "Capi 2", "\"Capi 2\""},
+    {0},
+    {396, 14, 16, "Beyond Measure", "\"Beyond Measure\""},
+    {0},
+    {0},
+    {0},
+    {400, 14, 16, "Livorsi Marine", "\"Livorsi Marine\""},
+    {0},
+    {0},
+    {0},
+    {404, 6, 8, "ComNav", "\"ComNav\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {409, 6, 8, "Chetco", "\"Chetco\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {419, 18, 20, "Fusion Electronics", "\"Fusion Electronics\""},
+    {0},
+    {421, 16, 18, "Standard Horizon", "\"Standard Horizon\""},
+    {422, 12, 14, "True Heading", "\"True Heading\""},
+    {0},
+    {0},
+    {0},
+    {426, 27, 29, "Egersund Marine Electronics", "\"Egersund Marine Electronics\""},
+    {427, 26, 28, "em-trak Marine Electronics", "\"em-trak Marine Electronics\""},
+    {0},
+    {0},
+    {0},
+    {431, 14, 16, "Tohatsu Co, JP", "\"Tohatsu Co, JP\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {437, 13, 15, "Digital Yacht", "\"Digital Yacht\""},
+    {438, 21, 23, "Comar Systems Limited", "\"Comar Systems Limited\""},
+    {0},
+    {440, 7, 9, "Cummins", "\"Cummins\""},
+    {0},
+    {0},
+    {443, 33, 35, "VDO (aka Continental-Corporation)", "\"VDO (aka Continental-Corporation)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {451, 39, 41, "Parker Hannifin aka Village Marine Tech", "\"Parker Hannifin aka Village Marine Tech\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {459, 25, 27, "Alltek Marine Electronics", "\"Alltek Marine Electronics\""},
+    {460, 19, 21, "SAN GIORGIO S.E.I.N", "\"SAN GIORGIO S.E.I.N\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {466, 29, 31, "Veethree Electronics & Marine", "\"Veethree Electronics & Marine\""},
+    {0},
+    {0},
+    {0},
+    {470, 25, 27, "SI-TEX Marine Electronics", "\"SI-TEX Marine Electronics\""},
+    {471, 16, 18, "Sea Cross Marine", "\"Sea Cross Marine\""},
+    {0},
+    {0},
+    {0},
+    {475, 31, 33, "GME aka Standard Communications", "\"GME aka Standard Communications\""},
+    {476, 29, 31, "Humminbird Marine Electronics", "\"Humminbird Marine Electronics\""},
+    {0},
+    {478, 9, 11, "Ocean Sat", "\"Ocean Sat\""},
+    {0},
+    {0},
+    {481, 26, 28, "Chetco Digital Instruments", "\"Chetco Digital Instruments\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {493, 8, 10, "Watcheye", "\"Watcheye\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {499, 12, 14, "Lcj Capteurs", "\"Lcj Capteurs\""},
+    {0},
+    {0},
+    {502, 14, 16, "Attwood Marine", "\"Attwood Marine\""},
+    {503, 13, 15, "Naviop S.R.L.", "\"Naviop S.R.L.\""},
+    {504, 13, 15, "Vesper Marine", "\"Vesper Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {510, 10, 12, "Marinesoft", "\"Marinesoft\""},
+    {0},
+    {0},
+    {513, 8, 10, "Simarine", "\"Simarine\""},
+    {0},
+    {0},
+    {0},
+    {517, 18, 20, "NoLand Engineering", "\"NoLand Engineering\""},
+    {518, 11, 13, "Transas USA", "\"Transas USA\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {529, 26, 28, "National Instruments Korea", "\"National Instruments Korea\""},
+    {530, 39, 41, "National Marine Electronics Association", "\"National Marine Electronics Association\""},
+    {0},
+    {532, 11, 13, "Onwa Marine", "\"Onwa Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {540, 7, 9, "Webasto", "\"Webasto\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {571, 25, 27, "Marinecraft (South Korea)", "\"Marinecraft (South Korea)\""},
+    {0},
+    {573, 24, 26, "McMurdo Group aka Orolia", "\"McMurdo Group aka Orolia\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {578, 8, 10, "Advansea", "\"Advansea\""},
+    {579, 3, 5, "KVH", "\"KVH\""},
+    {580, 19, 21, "San Jose Technology", "\"San Jose Technology\""},
+    {0},
+    {0},
+    {583, 13, 15, "Yacht Control", "\"Yacht Control\""},
+    {0},
+    {0},
+    {586, 12, 14, "Suzuki Motor", "\"Suzuki Motor\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {591, 14, 16, "US Coast Guard", "\"US Coast Guard\""},
+    {0},
+    {0},
+    {0},
+    {595, 26, 28, "Ship Module aka Customware", "\"Ship Module aka Customware\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {600, 10, 12, "Aquatic AV", "\"Aquatic AV\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {605, 8, 10, "Aventics", "\"Aventics\""},
+    {606, 9, 11, "Intellian", "\"Intellian\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {612, 8, 10, "SamwonIT", "\"SamwonIT\""},
+    {0},
+    {614, 16, 18, "Arlt Tecnologies", "\"Arlt Tecnologies\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {637, 14, 16, "Bavaria Yachts", "\"Bavaria Yachts\""},
+    {0},
+    {0},
+    {0},
+    {641, 22, 24, "Diverse Yacht Services", "\"Diverse Yacht Services\""},
+    {0},
+    {0},
+    {644, 18, 20, "Wema U.S.A dba KUS", "\"Wema U.S.A dba KUS\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {658, 29, 31, "Shenzhen Jiuzhou Himunication", "\"Shenzhen Jiuzhou Himunication\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {688, 8, 10, "Rockford", "\"Rockford\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {699, 20, 22, "Harman International", "\"Harman International\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {704, 8, 10, "JL Audio", "\"JL Audio\""},
+    {0},
+    {0},
+    {0},
+    {708, 11, 13, "Lars Thrane", "\"Lars Thrane\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {715, 8, 10, "Autonnic", "\"Autonnic\""},
+    {0},
+    {717, 13, 15, "Yacht Devices", "\"Yacht Devices\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {734, 12, 14, "REAP Systems", "\"REAP Systems\""},
+    {735, 27, 29, "AEM Performance Electronics", "\"AEM Performance Electronics\""},
+    {0},
+    {0},
+    {0},
+    {739, 5, 7, "LxNav", "\"LxNav\""},
+    {0},
+    {741, 47, 49, "Littelfuse, Inc (formerly Carling Technologies)", "\"Littelfuse, Inc (formerly Carling Technologies)\""},
+    {0},
+    {743, 8, 10, "DaeMyung", "\"DaeMyung\""},
+    {744, 7, 9, "Woosung", "\"Woosung\""},
+    {0},
+    {0},
+    {0},
+    {748, 15, 17, "ISOTTA IFRA srl", "\"ISOTTA IFRA srl\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {773, 10, 12, "Clarion US", "\"Clarion US\""},
+    {0},
+    {0},
+    {776, 11, 13, "HMI Systems", "\"HMI Systems\""},
+    {777, 12, 14, "Ocean Signal", "\"Ocean Signal\""},
+    {778, 9, 11, "Seakeeper", "\"Seakeeper\""},
+    {0},
+    {0},
+    {781, 11, 13, "Poly Planar", "\"Poly Planar\""},
+    {0},
+    {0},
+    {0},
+    {785, 16, 18, "Fischer Panda DE", "\"Fischer Panda DE\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {795, 17, 19, "Broyda Industries", "\"Broyda Industries\""},
+    {796, 19, 21, "Canadian Automotive", "\"Canadian Automotive\""},
+    {797, 12, 14, "Tides Marine", "\"Tides Marine\""},
+    {798, 9, 11, "Lumishore", "\"Lumishore\""},
+    {799, 29, 31, "Still Water Designs and Audio", "\"Still Water Designs and Audio\""},
+    {0},
+    {0},
+    {802, 26, 28, "BJ Technologies (Beneteau)", "\"BJ Technologies (Beneteau)\""},
+    {803, 12, 14, "Gill Sensors", "\"Gill Sensors\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {811, 23, 25, "Blue Water Desalination", "\"Blue Water Desalination\""},
+    {0},
+    {0},
+    {0},
+    {815, 4, 6, "FLIR", "\"FLIR\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {824, 15, 17, "Undheim Systems", "\"Undheim Systems\""},
+    {0},
+    {826, 6, 8, "Lewmar", "\"Lewmar\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {838, 8, 10, "TeamSurv", "\"TeamSurv\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {844, 11, 13, "Fell Marine", "\"Fell Marine\""},
+    {0},
+    {0},
+    {847, 9, 11, "Oceanvolt", "\"Oceanvolt\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {862, 7, 9, "Prospec", "\"Prospec\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {868, 10, 12, "Data Panel", "\"Data Panel\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {890, 15, 17, "L3 Technologies", "\"L3 Technologies\""},
+    {0},
+    {0},
+    {0},
+    {894, 21, 23, "Rhodan Marine Systems", "\"Rhodan Marine Systems\""},
+    {0},
+    {896, 17, 19, "Nexfour Solutions", "\"Nexfour Solutions\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {905, 15, 17, "ASA Electronics", "\"ASA Electronics\""},
+    {0},
+    {0},
+    {0},
+    {909, 24, 26, "Marines Co (South Korea)", "\"Marines Co (South Korea)\""},
+    {0},
+    {911, 9, 11, "Nautic-on", "\"Nautic-on\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {917, 8, 10, "Sentinel", "\"Sentinel\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {929, 17, 19, "JL Marine Systems", "\"JL Marine Systems\""},
+    {930, 9, 11, "Ecotronix", "\"Ecotronix\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {944, 14, 16, "Zontisa Marine", "\"Zontisa Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {951, 18, 20, "EXOR International", "\"EXOR International\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {962, 20, 22, "Timbolier Industries", "\"Timbolier Industries\""},
+    {963, 9, 11, "TJC Micro", "\"TJC Micro\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {968, 14, 16, "Cox Powertrain", "\"Cox Powertrain\""},
+    {969, 9, 11, "Blue Seas", "\"Blue Seas\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {981, 20, 22, "Kobelt Manufacturing", "\"Kobelt Manufacturing\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {992, 14, 16, "Blue Ocean IOT", "\"Blue Ocean IOT\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {997, 13, 15, "Xenta Systems", "\"Xenta Systems\""},
+    {0},
+    {999, 8, 10, "Signal K", "\"Signal K\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1004, 9, 11, "Ultraflex", "\"Ultraflex\""},
+    {0},
+    {0},
+    {0},
+    {1008, 17, 19, "Lintest SmartBoat", "\"Lintest SmartBoat\""},
+    {0},
+    {0},
+    {1011, 8, 10, "Soundmax", "\"Soundmax\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1020, 49, 51, "Team Italia Marine (Onyx Marine Automation s.r.l)", "\"Team Italia Marine (Onyx Marine Automation s.r.l)\""},
+    {1021, 9, 11, "Entratech", "\"Entratech\""},
+    {1022, 3, 5, "ITC", "\"ITC\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1029, 19, 21, "The Marine Guardian", "\"The Marine Guardian\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1047, 5, 7, "Sonic", "\"Sonic\""},
+    {0},
+    {0},
+    {0},
+    {1051, 6, 8, "ProNav", "\"ProNav\""},
+    {0},
+    {1053, 18, 20, "Vetus Maxwell INC.", "\"Vetus Maxwell INC.\""},
+    {0},
+    {0},
+    {1056, 12, 14, "Lithium Pros", "\"Lithium Pros\""},
+    {0},
+    {0},
+    {1059, 7, 9, "Boatrax", "\"Boatrax\""},
+    {0},
+    {0},
+    {1062, 12, 14, "Marol Co ltd", "\"Marol Co ltd\""},
+    {0},
+    {0},
+    {1065, 19, 21, "CALYPSO Instruments", "\"CALYPSO Instruments\""},
+    {1066, 15, 17, "Spot Zero Water", "\"Spot Zero Water\""},
+    {0},
+    {0},
+    {1069, 18, 20, "Lithionics Battery", "\"Lithionics Battery\""},
+    {1070, 22, 24, "Quick-teck Electronics", "\"Quick-teck Electronics\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1075, 14, 16, "Uniden America", "\"Uniden America\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1083, 12, 14, "Nauticoncept", "\"Nauticoncept\""},
+    {1084, 26, 28, "Shadow-Caster LED lighting", "\"Shadow-Caster LED lighting\""},
+    {1085, 10, 12, "Wet Sounds", "\"Wet Sounds\""},
+    {0},
+    {0},
+    {1088, 22, 24, "E-T-A Circuit Breakers", "\"E-T-A Circuit Breakers\""},
+    {0},
+    {0},
+    {0},
+    {1092, 8, 10, "Scheiber", "\"Scheiber\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1100, 34, 36, "Smart Yachts International Limited", "\"Smart Yachts International Limited\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1109, 8, 10, "Dockmate", "\"Dockmate\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1114, 12, 14, "Bobs Machine", "\"Bobs Machine\""},
+    {0},
+    {0},
+    {0},
+    {1118, 12, 14, "L3Harris ASV", "\"L3Harris ASV\""},
+    {1119, 6, 8, "Balmar", "\"Balmar\""},
+    {1120, 12, 14, "Elettromedia", "\"Elettromedia\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1127, 11, 13, "Electromaax", "\"Electromaax\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1140, 21, 23, "Across Oceans Systems", "\"Across Oceans Systems\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1145, 13, 15, "Kiwi Yachting", "\"Kiwi Yachting\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1150, 27, 29, "BSB Artificial Intelligence", "\"BSB Artificial Intelligence\""},
+    {1151, 17, 19, "Orca Technologies", "\"Orca Technologies\""},
+    {0},
+    {0},
+    {1154, 15, 17, "TBS Electronics", "\"TBS Electronics\""},
+    {0},
+    {0},
+    {0},
+    {1158, 20, 22, "Technoton Electroics", "\"Technoton Electroics\""},
+    {0},
+    {1160, 17, 19, "MG Energy Systems", "\"MG Energy Systems\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1169, 20, 22, "Sea Machine Robotics", "\"Sea Machine Robotics\""},
+    {0},
+    {1171, 19, 21, "Vista Manufacturing", "\"Vista Manufacturing\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1183, 7, 9, "Zipwake", "\"Zipwake\""},
+    {0},
+    {0},
+    {1186, 7, 9, "Sailmon", "\"Sailmon\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1192, 16, 18, "Airmoniq Pro Kft", "\"Airmoniq Pro Kft\""},
+    {0},
+    {1194, 13, 15, "Sierra Marine", "\"Sierra Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1200, 37, 39, "Xinuo Information Technology (Xiamen)", "\"Xinuo Information Technology (Xiamen)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1218, 10, 12, "Septentrio", "\"Septentrio\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1233, 22, 24, "NKE Marine Electronics", "\"NKE Marine Electronics\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1238, 14, 16, "SuperTrack Aps", "\"SuperTrack Aps\""},
+    {1239, 17, 19, "Honda Electronics", "\"Honda Electronics\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1245, 19, 21, "Raritan Engineering", "\"Raritan Engineering\""},
+    {0},
+    {0},
+    {0},
+    {1249, 29, 31, "Integrated Power Solutions AG", "\"Integrated Power Solutions AG\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1260, 24, 26, "Interactive Technologies", "\"Interactive Technologies\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1283, 8, 10, "LTG-Tech", "\"LTG-Tech\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1299, 21, 23, "Energy Solutions (UK)", "\"Energy Solutions (UK)\""},
+    {1300, 14, 16, "WATT Fuel Cell", "\"WATT Fuel Cell\""},
+    {0},
+    {1302, 10, 12, "Pro Mainer", "\"Pro Mainer\""},
+    {0},
+    {0},
+    {1305, 16, 18, "Dragonfly Energy", "\"Dragonfly Energy\""},
+    {1306, 17, 19, "Koden Electronics", "\"Koden Electronics\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1311, 8, 10, "Humphree", "\"Humphree\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1316, 14, 16, "Hinkley Yachts", "\"Hinkley Yachts\""},
+    {1317, 35, 37, "Global Marine Management GmbH (GMM)", "\"Global Marine Management GmbH (GMM)\""},
+    {0},
+    {0},
+    {1320, 14, 16, "Triskel Marine", "\"Triskel Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1330, 28, 30, "Warwick Control Technologies", "\"Warwick Control Technologies\""},
+    {1331, 15, 17, "Dolphin Charger", "\"Dolphin Charger\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1337, 16, 18, "Barnacle Systems", "\"Barnacle Systems\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1348, 10, 12, "Radian IoT", "\"Radian IoT\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1353, 16, 18, "Ocean LED Marine", "\"Ocean LED Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1359, 6, 8, "BluNav", "\"BluNav\""},
+    {0},
+    {1361, 42, 44, "OVA (Nantong Saiyang Electronics Co., Ltd)", "\"OVA (Nantong Saiyang Electronics Co., Ltd)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1368, 14, 16, "RAD Propulsion", "\"RAD Propulsion\""},
+    {1369, 14, 16, "Electric Yacht", "\"Electric Yacht\""},
+    {0},
+    {0},
+    {1372, 17, 19, "Elco Motor Yachts", "\"Elco Motor Yachts\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1384, 23, 25, "Tecnoseal Foundry S.r.l", "\"Tecnoseal Foundry S.r.l\""},
+    {1385, 20, 22, "Pro Charging Systems", "\"Pro Charging Systems\""},
+    {0},
+    {0},
+    {0},
+    {1389, 4, 6, "EVEX", "\"EVEX\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1398, 24, 26, "Gobius Sensor Technology", "\"Gobius Sensor Technology\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1403, 11, 13, "Arco Marine", "\"Arco Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1408, 12, 14, "Lenco Marine", "\"Lenco Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1413, 10, 12, "Naocontrol", "\"Naocontrol\""},
+    {0},
+    {0},
+    {0},
+    {1417, 7, 9, "Revatek", "\"Revatek\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1438, 10, 12, "Aeolionics", "\"Aeolionics\""},
+    {1439, 11, 13, "PredictWind", "\"PredictWind\""},
+    {1440, 20, 22, "Egis Mobile Electric", "\"Egis Mobile Electric\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1445, 21, 23, "Starboard Yacht Group", "\"Starboard Yacht Group\""},
+    {1446, 14, 16, "Roswell Marine", "\"Roswell Marine\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1451, 51, 53, "ePropulsion (Guangdong ePropulsion Technology Ltd.)", "\"ePropulsion (Guangdong ePropulsion Technology Ltd.)\""},
+    {1452, 9, 11, "Micro-Air", "\"Micro-Air\""},
+    {1453, 13, 15, "Vital Battery", "\"Vital Battery\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1458, 15, 17, "Ride Controller", "\"Ride Controller\""},
+    {0},
+    {1460, 11, 13, "Tocaro Blue", "\"Tocaro Blue\""},
+    {1461, 15, 17, "Vanquish Yachts", "\"Vanquish Yachts\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1471, 15, 17, "FT Technologies", "\"FT Technologies\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1478, 11, 13, "Alps Alpine", "\"Alps Alpine\""},
+    {0},
+    {0},
+    {1481, 14, 16, "E-Force Marine", "\"E-Force Marine\""},
+    {1482, 10, 12, "CMC Marine", "\"CMC Marine\""},
+    {1483, 42, 44, "Nanjing Sandemarine Information Technology", "\"Nanjing Sandemarine Information Technology\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {1850, 35, 37, "Teleflex Marine (SeaStar Solutions)", "\"Teleflex Marine (SeaStar Solutions)\""},
+    {1851, 9, 11, "Raymarine", "\"Raymarine\""},
+    {1852, 9, 11, "Navionics", "\"Navionics\""},
+    {1853, 11, 13, "Japan Radio", "\"Japan Radio\""},
+    {1854, 22, 24, "Northstar Technologies", "\"Northstar Technologies\""},
+    {1855, 6, 8, "Furuno", "\"Furuno\""},
+    {1856, 7, 9, "Trimble", "\"Trimble\""},
+    {1857, 6, 8, "Simrad", "\"Simrad\""},
+    {1858, 6, 8, "Litton", "\"Litton\""},
+    {1859, 6, 8, "Kvasar", "\"Kvasar\""},
+    {1860, 3, 5, "MMP", "\"MMP\""},
+    {1861, 14, 16, "Vector Cantech", "\"Vector Cantech\""},
+    {1862, 13, 15, "Yamaha Marine", "\"Yamaha Marine\""},
+    {1863, 17, 19, "Faria Instruments", "\"Faria Instruments\""}
+};
+const LookupTable lookupTableMANUFACTURER_CODE = {.kind = LOOKUP_TABLE_DENSE, .count = 1864, .entries = lookupEntriesMANUFACTURER_CODE};
+
+static const LookupEntry lookupEntriesMARETRON_COMMAND[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {80, 21, 23, "Deviation calibration", "\"Deviation calibration\""}
+};
+const LookupTable lookupTableMARETRON_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 81, .entries = lookupEntriesMARETRON_COMMAND};
+
+static const LookupEntry lookupEntriesMARETRON_OPCODE[] = {
+    {0, 8, 10, "Read All", "\"Read All\""},
+    {1, 14, 16, "Write Register", "\"Write Register\""},
+    {2, 11, 13, "Read Config", "\"Read Config\""},
+    {3, 12, 14, "Write Config", "\"Write Config\""},
+    {4, 9, 11, "Calibrate", "\"Calibrate\""},
+    {5, 17, 19, "Clear Calibration", "\"Clear Calibration\""},
+    {6, 6, 8, "Status", "\"Status\""},
+    {7, 12, 14, "Clear Status", "\"Clear Status\""},
+    {8, 21, 23, "Reset Factory Default", "\"Reset Factory Default\""},
+    {9, 5, 7, "Debug", "\"Debug\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {16, 14, 16, "Write Instance", "\"Write Instance\""},
+    {17, 13, 15, "Read Instance", "\"Read Instance\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {32, 11, 13, "Write Label", "\"Write Label\""},
+    {33, 10, 12, "Read Label", "\"Read Label\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {48, 19, 21, "Write Switch Config", "\"Write Switch Config\""},
+    {49, 18, 20, "Read Switch Config", "\"Read Switch Config\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {64, 18, 20, "Write Alert Config", "\"Write Alert Config\""},
+    {65, 17, 19, "Read Alert Config", "\"Read Alert Config\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {80, 20, 22, "Write Channel Config", "\"Write Channel Config\""},
+    {81, 19, 21, "Read Channel Config", "\"Read Channel Config\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {86, 28, 30, "Read Channel Config Extended", "\"Read Channel Config Extended\""},
+    {87, 29, 31, "Write Channel Config Extended", "\"Write Channel Config Extended\""}
+};
+const LookupTable lookupTableMARETRON_OPCODE = {.kind = LOOKUP_TABLE_DENSE, .count = 88, .entries = lookupEntriesMARETRON_OPCODE};
+
+static const LookupEntry lookupEntriesMARETRON_PRODUCT_CODE[] = {
+    {434, 6, 8, "SSC200", "\"SSC200\""},
+    {1047, 6, 8, "SMS100", "\"SMS100\""},
+    {1151, 7, 9, "MBB200C", "\"MBB200C\""},
+    {1534, 6, 8, "DST110", "\"DST110\""},
+    {1776, 6, 8, "GPS100", "\"GPS100\""},
+    {2606, 6, 8, "CLM100", "\"CLM100\""},
+    {2686, 6, 8, "SSC300", "\"SSC300\""},
+    {2781, 6, 8, "TLA100", "\"TLA100\""},
+    {3373, 6, 8, "GPS200", "\"GPS200\""},
+    {3563, 6, 8, "DST100", "\"DST100\""},
+    {3637, 6, 8, "FFM100", "\"FFM100\""},
+    {3979, 6, 8, "NBE100", "\"NBE100\""},
+    {4018, 6, 8, "RAA100", "\"RAA100\""},
+    {4078, 6, 8, "RIM100", "\"RIM100\""},
+    {4319, 6, 8, "J2K100", "\"J2K100\""},
+    {8165, 6, 8, "ALM100", "\"ALM100\""},
+    {9339, 6, 8, "IPG100", "\"IPG100\""},
+    {9375, 6, 8, "DCM100", "\"DCM100\""},
+    {9845, 6, 8, "EMS100", "\"EMS100\""},
+    {12337, 6, 8, "CLMD16", "\"CLMD16\""},
+    {16434, 6, 8, "DSM250", "\"DSM250\""},
+    {20067, 6, 8, "TMP100", "\"TMP100\""},
+    {20298, 6, 8, "DSM150", "\"DSM150\""},
+    {21703, 6, 8, "FPM100", "\"FPM100\""},
+    {22585, 6, 8, "DCR100", "\"DCR100\""},
+    {23603, 6, 8, "SIM100", "\"SIM100\""},
+    {26493, 6, 8, "ACM100", "\"ACM100\""},
+    {27244, 7, 9, "MBB300C", "\"MBB300C\""},
+    {28077, 8, 10, "MConnect", "\"MConnect\""}
+};
+const LookupTable lookupTableMARETRON_PRODUCT_CODE = {.kind = LOOKUP_TABLE_SORTED, .count = 29, .entries = lookupEntriesMARETRON_PRODUCT_CODE};
+
+static const LookupEntry lookupEntriesMARETRON_SOFTWARE_CODE[] = {
+    {0},
+    {1, 9, 11, "Version 1", "\"Version 1\""}
+};
+const LookupTable lookupTableMARETRON_SOFTWARE_CODE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesMARETRON_SOFTWARE_CODE};
+
+static const LookupEntry lookupEntriesMARETRON_STATUS_DEVIATION[] = {
+    {0},
+    {1, 7, 9, "Started", "\"Started\""},
+    {2, 22, 24, "Completed successfully", "\"Completed successfully\""},
+    {3, 18, 20, "Failed to complete", "\"Failed to complete\""},
+    {4, 16, 18, "Turning too fast", "\"Turning too fast\""},
+    {5, 16, 18, "Turning too slow", "\"Turning too slow\""},
+    {6, 16, 18, "Invalid movement", "\"Invalid movement\""}
+};
+const LookupTable lookupTableMARETRON_STATUS_DEVIATION = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesMARETRON_STATUS_DEVIATION};
+
+static const LookupEntry lookupEntriesMARK_TYPE[] = {
+    {0, 9, 11, "Collision", "\"Collision\""},
+    {1, 13, 15, "Turning point", "\"Turning point\""},
+    {2, 9, 11, "Reference", "\"Reference\""},
+    {3, 9, 11, "Wheelover", "\"Wheelover\""},
+    {4, 8, 10, "Waypoint", "\"Waypoint\""}
+};
+const LookupTable lookupTableMARK_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesMARK_TYPE};
+
+static const LookupEntry lookupEntriesMERCURY_COMMAND_OPCODE[] = {
+    {0, 12, 14, "Horn Control", "\"Horn Control\""},
+    {1, 25, 27, "Maintenance Reset Command", "\"Maintenance Reset Command\""},
+    {2, 26, 28, "Maintenance Reset Response", "\"Maintenance Reset Response\""},
+    {0},
+    {4, 14, 16, "Cruise Control", "\"Cruise Control\""},
+    {5, 17, 19, "Global Brightness", "\"Global Brightness\""},
+    {6, 19, 21, "Active Trim Command", "\"Active Trim Command\""},
+    {7, 18, 20, "Active Trim Status", "\"Active Trim Status\""},
+    {8, 17, 19, "Autopilot Command", "\"Autopilot Command\""},
+    {9, 14, 16, "Active Exhaust", "\"Active Exhaust\""},
+    {0},
+    {0},
+    {12, 23, 25, "Oil Level Check Command", "\"Oil Level Check Command\""},
+    {13, 24, 26, "Oil Level Reset Response", "\"Oil Level Reset Response\""}
+};
+const LookupTable lookupTableMERCURY_COMMAND_OPCODE = {.kind = LOOKUP_TABLE_DENSE, .count = 14, .entries = lookupEntriesMERCURY_COMMAND_OPCODE};
+
+static const LookupEntry lookupEntriesMOB_POSITION_SOURCE[] = {
+    {0, 32, 34, "Position estimated by the vessel", "\"Position estimated by the vessel\""},
+    {1, 32, 34, "Position reported by MOB emitter", "\"Position reported by MOB emitter\""}
+};
+const LookupTable lookupTableMOB_POSITION_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesMOB_POSITION_SOURCE};
+
+static const LookupEntry lookupEntriesMOB_STATUS[] = {
+    {0, 21, 23, "MOB Emitter Activated", "\"MOB Emitter Activated\""},
+    {1, 37, 39, "Manual on-board MOB Button Activation", "\"Manual on-board MOB Button Activation\""},
+    {2, 9, 11, "Test mode", "\"Test mode\""},
+    {3, 14, 16, "MOB Not Active", "\"MOB Not Active\""}
+};
+const LookupTable lookupTableMOB_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesMOB_STATUS};
+
+static const LookupEntry lookupEntriesNAVICO_DATA_TYPE[] = {
+    {0, 8, 10, "Altitude", "\"Altitude\""},
+    {1, 8, 10, "Position", "\"Position\""},
+    {2, 14, 16, "Position Error", "\"Position Error\""},
+    {3, 4, 6, "HDOP", "\"HDOP\""},
+    {4, 4, 6, "VDOP", "\"VDOP\""},
+    {5, 4, 6, "TDOP", "\"TDOP\""},
+    {6, 4, 6, "PDOP", "\"PDOP\""},
+    {7, 18, 20, "Geoidal Seperation", "\"Geoidal Seperation\""},
+    {8, 3, 5, "COG", "\"COG\""},
+    {9, 16, 18, "Position Quality", "\"Position Quality\""},
+    {10, 18, 20, "Position Integrity", "\"Position Integrity\""},
+    {11, 12, 14, "Sats In View", "\"Sats In View\""},
+    {12, 11, 13, "Waas Status", "\"Waas Status\""},
+    {13, 7, 9, "Bearing", "\"Bearing\""},
+    {14, 6, 8, "Course", "\"Course\""},
+    {15, 11, 13, "CDI Graphic", "\"CDI Graphic\""},
+    {16, 15, 17, "Course To Steer", "\"Course To Steer\""},
+    {17, 11, 13, "Cross Track", "\"Cross Track\""},
+    {18, 18, 20, "Velocity Made Good", "\"Velocity Made Good\""},
+    {19, 11, 13, "Destination", "\"Destination\""},
+    {20, 16, 18, "Distance To Turn", "\"Distance To Turn\""},
+    {21, 16, 18, "Distance To Dest", "\"Distance To Dest\""},
+    {22, 12, 14, "Time To Turn", "\"Time To Turn\""},
+    {23, 12, 14, "Time To Dest", "\"Time To Dest\""},
+    {24, 11, 13, "ETA At Turn", "\"ETA At Turn\""},
+    {25, 11, 13, "ETA At Dest", "\"ETA At Dest\""},
+    {26, 14, 16, "Total Distance", "\"Total Distance\""},
+    {27, 11, 13, "Steer Arrow", "\"Steer Arrow\""},
+    {28, 8, 10, "Odometer", "\"Odometer\""},
+    {29, 13, 15, "Trip Distance", "\"Trip Distance\""},
+    {30, 9, 11, "Trip Time", "\"Trip Time\""},
+    {31, 4, 6, "Date", "\"Date\""},
+    {32, 4, 6, "Time", "\"Time\""},
+    {33, 8, 10, "UTC Date", "\"UTC Date\""},
+    {34, 8, 10, "UTC Time", "\"UTC Time\""},
+    {35, 17, 19, "Local Time Offset", "\"Local Time Offset\""},
+    {36, 7, 9, "Heading", "\"Heading\""},
+    {37, 11, 13, "Was Voltage", "\"Was Voltage\""},
+    {38, 11, 13, "Current Set", "\"Current Set\""},
+    {39, 13, 15, "Current Drift", "\"Current Drift\""},
+    {40, 9, 11, "Speed SOG", "\"Speed SOG\""},
+    {41, 11, 13, "Speed Water", "\"Speed Water\""},
+    {42, 11, 13, "Speed Pitot", "\"Speed Pitot\""},
+    {43, 14, 16, "Speed Trip Avg", "\"Speed Trip Avg\""},
+    {44, 14, 16, "Speed Trip Max", "\"Speed Trip Max\""},
+    {45, 14, 16, "Speed Wind App", "\"Speed Wind App\""},
+    {46, 15, 17, "Speed Wind True", "\"Speed Wind True\""},
+    {47, 10, 12, "Temp Water", "\"Temp Water\""},
+    {48, 12, 14, "Temp Outside", "\"Temp Outside\""},
+    {49, 11, 13, "Temp Inside", "\"Temp Inside\""},
+    {50, 16, 18, "Temp Engine Room", "\"Temp Engine Room\""},
+    {51, 15, 17, "Temp Main Cabin", "\"Temp Main Cabin\""},
+    {52, 14, 16, "Temp Live Well", "\"Temp Live Well\""},
+    {53, 14, 16, "Temp Bait Well", "\"Temp Bait Well\""},
+    {54, 18, 20, "Temp Refrigeration", "\"Temp Refrigeration\""},
+    {55, 19, 21, "Temp Heating System", "\"Temp Heating System\""},
+    {56, 14, 16, "Temp Dew Point", "\"Temp Dew Point\""},
+    {57, 19, 21, "Temp Wind Chill App", "\"Temp Wind Chill App\""},
+    {58, 25, 27, "Temp Wind Chill Theoretic", "\"Temp Wind Chill Theoretic\""},
+    {59, 15, 17, "Temp Heat Index", "\"Temp Heat Index\""},
+    {60, 12, 14, "Temp Freezer", "\"Temp Freezer\""},
+    {61, 11, 13, "Engine Temp", "\"Engine Temp\""},
+    {62, 15, 17, "Engine Air Temp", "\"Engine Air Temp\""},
+    {63, 15, 17, "Engine Oil Temp", "\"Engine Oil Temp\""},
+    {64, 12, 14, "Temp Battery", "\"Temp Battery\""},
+    {65, 20, 22, "Pressure Atmospheric", "\"Pressure Atmospheric\""},
+    {66, 17, 19, "Engine Boost Pres", "\"Engine Boost Pres\""},
+    {67, 15, 17, "Engine Oil Pres", "\"Engine Oil Pres\""},
+    {68, 17, 19, "Engine Water Pres", "\"Engine Water Pres\""},
+    {69, 16, 18, "Engine Fuel Pres", "\"Engine Fuel Pres\""},
+    {70, 20, 22, "Engine Manifold Pres", "\"Engine Manifold Pres\""},
+    {71, 14, 16, "Pressure Steam", "\"Pressure Steam\""},
+    {72, 18, 20, "Pressure Compr Air", "\"Pressure Compr Air\""},
+    {73, 18, 20, "Pressure Hydraulic", "\"Pressure Hydraulic\""},
+    {74, 23, 25, "Was Generic Pressure Lo", "\"Was Generic Pressure Lo\""},
+    {75, 23, 25, "Was Generic Pressure Hi", "\"Was Generic Pressure Hi\""},
+    {76, 5, 7, "Depth", "\"Depth\""},
+    {77, 14, 16, "Water Distance", "\"Water Distance\""},
+    {78, 10, 12, "Engine RPM", "\"Engine RPM\""},
+    {79, 11, 13, "Engine Trim", "\"Engine Trim\""},
+    {80, 27, 29, "Engine Alternator Potential", "\"Engine Alternator Potential\""},
+    {81, 16, 18, "Engine Fuel Rate", "\"Engine Fuel Rate\""},
+    {82, 19, 21, "Engine Percent Load", "\"Engine Percent Load\""},
+    {83, 21, 23, "Engine Percent Torque", "\"Engine Percent Torque\""},
+    {84, 23, 25, "Was Suzuki Alarm Lev Lo", "\"Was Suzuki Alarm Lev Lo\""},
+    {85, 25, 27, "Was Suzuki Alarm Lev High", "\"Was Suzuki Alarm Lev High\""},
+    {86, 15, 17, "Tank Fuel Level", "\"Tank Fuel Level\""},
+    {87, 23, 25, "Fluid Level Fresh Water", "\"Fluid Level Fresh Water\""},
+    {88, 22, 24, "Fluid Level Gray Water", "\"Fluid Level Gray Water\""},
+    {89, 21, 23, "Fluid Level Live Well", "\"Fluid Level Live Well\""},
+    {90, 15, 17, "Fluid Level Oil", "\"Fluid Level Oil\""},
+    {91, 23, 25, "Fluid Level Black Water", "\"Fluid Level Black Water\""},
+    {92, 19, 21, "Tank Fuel Remaining", "\"Tank Fuel Remaining\""},
+    {93, 24, 26, "Fluid Volume Fresh Water", "\"Fluid Volume Fresh Water\""},
+    {94, 23, 25, "Fluid Volume Gray Water", "\"Fluid Volume Gray Water\""},
+    {95, 22, 24, "Fluid Volume Live Well", "\"Fluid Volume Live Well\""},
+    {96, 16, 18, "Fluid Volume Oil", "\"Fluid Volume Oil\""},
+    {97, 24, 26, "Fluid Volume Black Water", "\"Fluid Volume Black Water\""},
+    {98, 16, 18, "Gen Fluid Volume", "\"Gen Fluid Volume\""},
+    {99, 22, 24, "Was Tank Fuel Level Lo", "\"Was Tank Fuel Level Lo\""},
+    {100, 30, 32, "Was Fluid Level Lo Fresh Water", "\"Was Fluid Level Lo Fresh Water\""},
+    {101, 29, 31, "Was Fluid Level Lo Gray Water", "\"Was Fluid Level Lo Gray Water\""},
+    {102, 28, 30, "Was Fluid Level Lo Live Well", "\"Was Fluid Level Lo Live Well\""},
+    {103, 22, 24, "Was Fluid Level Lo Oil", "\"Was Fluid Level Lo Oil\""},
+    {104, 17, 19, "Gen Tank Capacity", "\"Gen Tank Capacity\""},
+    {105, 18, 20, "Tank Fuel Capacity", "\"Tank Fuel Capacity\""},
+    {106, 25, 27, "Tank Capacity Fresh Water", "\"Tank Capacity Fresh Water\""},
+    {107, 24, 26, "Tank Capacity Gray Water", "\"Tank Capacity Gray Water\""},
+    {108, 23, 25, "Tank Capacity Live Well", "\"Tank Capacity Live Well\""},
+    {109, 17, 19, "Tank Capacity Oil", "\"Tank Capacity Oil\""},
+    {110, 25, 27, "Tank Capacity Black Water", "\"Tank Capacity Black Water\""},
+    {111, 18, 20, "Was Tank Fuel Used", "\"Was Tank Fuel Used\""},
+    {112, 16, 18, "Engine Fuel Used", "\"Engine Fuel Used\""},
+    {113, 21, 23, "Engine Fuel Used Trip", "\"Engine Fuel Used Trip\""},
+    {114, 25, 27, "Engine Fuel Used Seasonal", "\"Engine Fuel Used Seasonal\""},
+    {115, 19, 21, "Engine Fuel K Value", "\"Engine Fuel K Value\""},
+    {116, 17, 19, "Battery Potential", "\"Battery Potential\""},
+    {117, 15, 17, "Battery Current", "\"Battery Current\""},
+    {118, 8, 10, "Trim Tab", "\"Trim Tab\""},
+    {119, 17, 19, "Was Trim Stbd Tab", "\"Was Trim Stbd Tab\""},
+    {120, 12, 14, "Rate Of Turn", "\"Rate Of Turn\""},
+    {121, 12, 14, "Attitude Yaw", "\"Attitude Yaw\""},
+    {122, 14, 16, "Attitude Pitch", "\"Attitude Pitch\""},
+    {123, 13, 15, "Attitude Roll", "\"Attitude Roll\""},
+    {124, 18, 20, "Magnetic Variation", "\"Magnetic Variation\""},
+    {125, 9, 11, "Deviation", "\"Deviation\""},
+    {126, 16, 18, "Fuel Economy Wtr", "\"Fuel Economy Wtr\""},
+    {127, 16, 18, "Fuel Economy GPS", "\"Fuel Economy GPS\""},
+    {128, 18, 20, "Was Fuel Remaining", "\"Was Fuel Remaining\""},
+    {129, 18, 20, "Was Fuel Range Wtr", "\"Was Fuel Range Wtr\""},
+    {130, 18, 20, "Was Fuel Range GPS", "\"Was Fuel Range GPS\""},
+    {131, 17, 19, "Engine Hours Used", "\"Engine Hours Used\""},
+    {132, 11, 13, "Engine Type", "\"Engine Type\""},
+    {133, 16, 18, "Vessel Fuel Rate", "\"Vessel Fuel Rate\""},
+    {134, 23, 25, "Vessel Fuel Economy Wtr", "\"Vessel Fuel Economy Wtr\""},
+    {135, 23, 25, "Vessel Fuel Economy GPS", "\"Vessel Fuel Economy GPS\""},
+    {136, 21, 23, "Vessel Fuel Remaining", "\"Vessel Fuel Remaining\""},
+    {137, 21, 23, "Vessel Fuel Range Wtr", "\"Vessel Fuel Range Wtr\""},
+    {138, 21, 23, "Vessel Fuel Range GPS", "\"Vessel Fuel Range GPS\""},
+    {139, 14, 16, "Wind App Angle", "\"Wind App Angle\""},
+    {140, 15, 17, "Wind True Angle", "\"Wind True Angle\""},
+    {141, 19, 21, "Wind True Direction", "\"Wind True Direction\""},
+    {142, 15, 17, "Humidity Inside", "\"Humidity Inside\""},
+    {143, 16, 18, "Humidity Outside", "\"Humidity Outside\""},
+    {144, 12, 14, "Set Humidity", "\"Set Humidity\""},
+    {145, 12, 14, "Rudder Angle", "\"Rudder Angle\""},
+    {146, 10, 12, "Trans Gear", "\"Trans Gear\""},
+    {147, 18, 20, "Trans Oil Pressure", "\"Trans Oil Pressure\""},
+    {148, 14, 16, "Trans Oil Temp", "\"Trans Oil Temp\""},
+    {149, 16, 18, "Cmd Rudder Angle", "\"Cmd Rudder Angle\""},
+    {150, 12, 14, "Rudder Limit", "\"Rudder Limit\""},
+    {151, 15, 17, "Off Heading Lim", "\"Off Heading Lim\""},
+    {152, 20, 22, "Radius Of Turn Order", "\"Radius Of Turn Order\""},
+    {153, 18, 20, "Rate Of Turn Order", "\"Rate Of Turn Order\""},
+    {154, 13, 15, "Off Track Lim", "\"Off Track Lim\""},
+    {155, 22, 24, "Logging Time Remaining", "\"Logging Time Remaining\""},
+    {156, 17, 19, "Position Fix Type", "\"Position Fix Type\""},
+    {157, 22, 24, "Engine Discrete Status", "\"Engine Discrete Status\""},
+    {158, 28, 30, "Transmission Discrete Status", "\"Transmission Discrete Status\""},
+    {159, 20, 22, "GPS Best Of Four Snr", "\"GPS Best Of Four Snr\""},
+    {160, 15, 17, "Gen Fluid Level", "\"Gen Fluid Level\""},
+    {161, 12, 14, "Gen Pressure", "\"Gen Pressure\""},
+    {162, 15, 17, "Gen Temperature", "\"Gen Temperature\""},
+    {163, 16, 18, "Internal Voltage", "\"Internal Voltage\""},
+    {164, 12, 14, "Depth Offset", "\"Depth Offset\""},
+    {165, 15, 17, "Structure Depth", "\"Structure Depth\""},
+    {166, 14, 16, "Loran Position", "\"Loran Position\""},
+    {167, 13, 15, "Vessel Status", "\"Vessel Status\""},
+    {168, 15, 17, "Battery DC Type", "\"Battery DC Type\""},
+    {169, 23, 25, "Battery State Of Charge", "\"Battery State Of Charge\""},
+    {170, 23, 25, "Battery State Of Health", "\"Battery State Of Health\""},
+    {171, 22, 24, "Battery Time Remaining", "\"Battery Time Remaining\""},
+    {172, 22, 24, "Battery Ripple Voltage", "\"Battery Ripple Voltage\""},
+    {173, 17, 19, "Ac1 Acceptability", "\"Ac1 Acceptability\""},
+    {174, 17, 19, "Ac2 Acceptability", "\"Ac2 Acceptability\""},
+    {175, 17, 19, "Ac3 Acceptability", "\"Ac3 Acceptability\""},
+    {176, 11, 13, "Ac1 Voltage", "\"Ac1 Voltage\""},
+    {177, 11, 13, "Ac2 Voltage", "\"Ac2 Voltage\""},
+    {178, 11, 13, "Ac3 Voltage", "\"Ac3 Voltage\""},
+    {179, 11, 13, "Ac1 Current", "\"Ac1 Current\""},
+    {180, 11, 13, "Ac2 Current", "\"Ac2 Current\""},
+    {181, 11, 13, "Ac3 Current", "\"Ac3 Current\""},
+    {182, 13, 15, "Ac1 Frequency", "\"Ac1 Frequency\""},
+    {183, 13, 15, "Ac2 Frequency", "\"Ac2 Frequency\""},
+    {184, 13, 15, "Ac3 Frequency", "\"Ac3 Frequency\""},
+    {185, 16, 18, "Ac1 Breaker Size", "\"Ac1 Breaker Size\""},
+    {186, 16, 18, "Ac2 Breaker Size", "\"Ac2 Breaker Size\""},
+    {187, 16, 18, "Ac3 Breaker Size", "\"Ac3 Breaker Size\""},
+    {188, 14, 16, "Ac1 Real Power", "\"Ac1 Real Power\""},
+    {189, 14, 16, "Ac2 Real Power", "\"Ac2 Real Power\""},
+    {190, 14, 16, "Ac3 Real Power", "\"Ac3 Real Power\""},
+    {191, 18, 20, "Ac1 Reactive Power", "\"Ac1 Reactive Power\""},
+    {192, 18, 20, "Ac2 Reactive Power", "\"Ac2 Reactive Power\""},
+    {193, 18, 20, "Ac3 Reactive Power", "\"Ac3 Reactive Power\""},
+    {194, 16, 18, "Ac1 Power Factor", "\"Ac1 Power Factor\""},
+    {195, 16, 18, "Ac2 Power Factor", "\"Ac2 Power Factor\""},
+    {196, 16, 18, "Ac3 Power Factor", "\"Ac3 Power Factor\""},
+    {197, 12, 14, "Switch State", "\"Switch State\""},
+    {198, 14, 16, "Switch Current", "\"Switch Current\""},
+    {199, 12, 14, "Switch Fault", "\"Switch Fault\""},
+    {200, 16, 18, "Switch Dim Level", "\"Switch Dim Level\""},
+    {201, 20, 22, "Previous Cmd Heading", "\"Previous Cmd Heading\""},
+    {202, 14, 16, "Cmd Wind Angle", "\"Cmd Wind Angle\""},
+    {203, 22, 24, "Was Cmd Bearing Offset", "\"Was Cmd Bearing Offset\""},
+    {204, 11, 13, "Cmd Bearing", "\"Cmd Bearing\""},
+    {205, 17, 19, "Cmd Depth Contour", "\"Cmd Depth Contour\""},
+    {206, 17, 19, "Cmd Course Change", "\"Cmd Course Change\""},
+    {207, 11, 13, "Pilot Drift", "\"Pilot Drift\""},
+    {208, 22, 24, "Pilot Distance To Turn", "\"Pilot Distance To Turn\""},
+    {209, 18, 20, "Pilot Time To Turn", "\"Pilot Time To Turn\""},
+    {210, 24, 26, "Pilot Reference Position", "\"Pilot Reference Position\""},
+    {211, 9, 11, "DC Status", "\"DC Status\""},
+    {212, 10, 12, "Ac1 Status", "\"Ac1 Status\""},
+    {213, 18, 20, "Was Switch Voltage", "\"Was Switch Voltage\""},
+    {214, 26, 28, "Battery Capacity Remaining", "\"Battery Capacity Remaining\""},
+    {215, 23, 25, "Pilot Heading Reference", "\"Pilot Heading Reference\""},
+    {216, 16, 18, "B And G Linear 1", "\"B And G Linear 1\""},
+    {217, 16, 18, "B And G Linear 2", "\"B And G Linear 2\""},
+    {218, 16, 18, "B And G Linear 3", "\"B And G Linear 3\""},
+    {219, 13, 15, "Boom Position", "\"Boom Position\""},
+    {220, 14, 16, "Sailing Course", "\"Sailing Course\""},
+    {221, 20, 22, "Daggerboard Position", "\"Daggerboard Position\""},
+    {222, 16, 18, "B And G Linear 4", "\"B And G Linear 4\""},
+    {223, 20, 22, "Heading On Next Tack", "\"Heading On Next Tack\""},
+    {224, 10, 12, "Keel Angle", "\"Keel Angle\""},
+    {225, 6, 8, "Leeway", "\"Leeway\""},
+    {226, 10, 12, "Mast Angle", "\"Mast Angle\""},
+    {227, 22, 24, "Target True Wind Angle", "\"Target True Wind Angle\""},
+    {228, 13, 15, "Keel Trim Tab", "\"Keel Trim Tab\""},
+    {229, 10, 12, "Race Timer", "\"Race Timer\""},
+    {230, 12, 14, "Canard Angle", "\"Canard Angle\""},
+    {231, 28, 30, "Next Leg Apparent Wind Angle", "\"Next Leg Apparent Wind Angle\""},
+    {232, 28, 30, "Next Leg Apparent Wind Speed", "\"Next Leg Apparent Wind Speed\""},
+    {233, 17, 19, "Target Boat Speed", "\"Target Boat Speed\""},
+    {234, 11, 13, "VMG To Wind", "\"VMG To Wind\""},
+    {235, 16, 18, "Time To Laylines", "\"Time To Laylines\""},
+    {236, 20, 22, "Distance To Laylines", "\"Distance To Laylines\""},
+    {237, 9, 11, "Aft Depth", "\"Aft Depth\""},
+    {238, 8, 10, "Forestay", "\"Forestay\""},
+    {239, 11, 13, "Polar Speed", "\"Polar Speed\""},
+    {240, 17, 19, "Polar Performance", "\"Polar Performance\""},
+    {241, 19, 21, "Tacking Performance", "\"Tacking Performance\""},
+    {242, 18, 20, "Wind Angle To Mast", "\"Wind Angle To Mast\""},
+    {243, 15, 17, "Can Bus Voltage", "\"Can Bus Voltage\""},
+    {244, 20, 22, "Internal Temperature", "\"Internal Temperature\""},
+    {245, 14, 16, "Engage Current", "\"Engage Current\""},
+    {246, 12, 14, "Uref Voltage", "\"Uref Voltage\""},
+    {247, 14, 16, "Supply Voltage", "\"Supply Voltage\""},
+    {248, 20, 22, "Destination Position", "\"Destination Position\""},
+    {249, 25, 27, "Compass Heading Reference", "\"Compass Heading Reference\""},
+    {250, 20, 22, "Cmd Rudder Direction", "\"Cmd Rudder Direction\""},
+    {251, 21, 23, "Was Engine Sync State", "\"Was Engine Sync State\""},
+    {252, 26, 28, "Engine General Maintenance", "\"Engine General Maintenance\""},
+    {253, 23, 25, "Engine Percent Throttle", "\"Engine Percent Throttle\""},
+    {254, 21, 23, "Engine Steering Angle", "\"Engine Steering Angle\""},
+    {255, 20, 22, "Engine Break In Reqd", "\"Engine Break In Reqd\""},
+    {256, 7, 9, "GPS All", "\"GPS All\""},
+    {257, 21, 23, "Engine Break In Accum", "\"Engine Break In Accum\""},
+    {258, 18, 20, "Engine Trim Status", "\"Engine Trim Status\""},
+    {259, 13, 15, "Pilot Present", "\"Pilot Present\""},
+    {260, 16, 18, "Ac1 Out Waveform", "\"Ac1 Out Waveform\""},
+    {261, 16, 18, "Ac2 Out Waveform", "\"Ac2 Out Waveform\""},
+    {262, 16, 18, "Ac3 Out Waveform", "\"Ac3 Out Waveform\""},
+    {263, 15, 17, "Ac1 Out Voltage", "\"Ac1 Out Voltage\""},
+    {264, 15, 17, "Ac2 Out Voltage", "\"Ac2 Out Voltage\""},
+    {265, 15, 17, "Ac3 Out Voltage", "\"Ac3 Out Voltage\""},
+    {266, 15, 17, "Ac1 Out Current", "\"Ac1 Out Current\""},
+    {267, 15, 17, "Ac2 Out Current", "\"Ac2 Out Current\""},
+    {268, 15, 17, "Ac3 Out Current", "\"Ac3 Out Current\""},
+    {269, 17, 19, "Ac1 Out Frequency", "\"Ac1 Out Frequency\""},
+    {270, 17, 19, "Ac2 Out Frequency", "\"Ac2 Out Frequency\""},
+    {271, 17, 19, "Ac3 Out Frequency", "\"Ac3 Out Frequency\""},
+    {272, 20, 22, "Ac1 Out Breaker Size", "\"Ac1 Out Breaker Size\""},
+    {273, 20, 22, "Ac2 Out Breaker Size", "\"Ac2 Out Breaker Size\""},
+    {274, 20, 22, "Ac3 Out Breaker Size", "\"Ac3 Out Breaker Size\""},
+    {275, 18, 20, "Ac1 Out Real Power", "\"Ac1 Out Real Power\""},
+    {276, 18, 20, "Ac2 Out Real Power", "\"Ac2 Out Real Power\""},
+    {277, 18, 20, "Ac3 Out Real Power", "\"Ac3 Out Real Power\""},
+    {278, 22, 24, "Ac1 Out Reactive Power", "\"Ac1 Out Reactive Power\""},
+    {279, 22, 24, "Ac2 Out Reactive Power", "\"Ac2 Out Reactive Power\""},
+    {280, 22, 24, "Ac3 Out Reactive Power", "\"Ac3 Out Reactive Power\""},
+    {281, 20, 22, "Ac1 Out Power Factor", "\"Ac1 Out Power Factor\""},
+    {282, 20, 22, "Ac2 Out Power Factor", "\"Ac2 Out Power Factor\""},
+    {283, 20, 22, "Ac3 Out Power Factor", "\"Ac3 Out Power Factor\""},
+    {284, 10, 12, "Ac2 Status", "\"Ac2 Status\""},
+    {285, 10, 12, "Ac3 Status", "\"Ac3 Status\""},
+    {286, 14, 16, "Ac1 Out Status", "\"Ac1 Out Status\""},
+    {287, 14, 16, "Ac2 Out Status", "\"Ac2 Out Status\""},
+    {288, 14, 16, "Ac3 Out Status", "\"Ac3 Out Status\""},
+    {289, 22, 24, "Switch Manual Override", "\"Switch Manual Override\""},
+    {290, 23, 25, "Switch Reverse Polarity", "\"Switch Reverse Polarity\""},
+    {291, 25, 27, "Switch Acsource Available", "\"Switch Acsource Available\""},
+    {292, 33, 35, "Switch Accontactor Systemsonstate", "\"Switch Accontactor Systemsonstate\""},
+    {293, 24, 26, "Charger Battery Instance", "\"Charger Battery Instance\""},
+    {294, 23, 25, "Charger Operating State", "\"Charger Operating State\""},
+    {295, 12, 14, "Charger Mode", "\"Charger Mode\""},
+    {296, 15, 17, "Charger Enabled", "\"Charger Enabled\""},
+    {297, 28, 30, "Charger Equalization Pending", "\"Charger Equalization Pending\""},
+    {298, 35, 37, "Charger Equalization Time Remaining", "\"Charger Equalization Time Remaining\""},
+    {299, 20, 22, "Inverter AC Instance", "\"Inverter AC Instance\""},
+    {300, 20, 22, "Inverter DC Instance", "\"Inverter DC Instance\""},
+    {301, 24, 26, "Inverter Operating State", "\"Inverter Operating State\""},
+    {302, 16, 18, "Inverter Enabled", "\"Inverter Enabled\""},
+    {303, 14, 16, "Thruster Power", "\"Thruster Power\""},
+    {304, 12, 14, "Fuel To Turn", "\"Fuel To Turn\""},
+    {305, 10, 12, "Engine Mil", "\"Engine Mil\""},
+    {306, 20, 22, "Engine Warning Flags", "\"Engine Warning Flags\""},
+    {307, 9, 11, "Speed Stw", "\"Speed Stw\""},
+    {308, 22, 24, "Engine Performance SOG", "\"Engine Performance SOG\""},
+    {309, 22, 24, "Engine Performance Stw", "\"Engine Performance Stw\""},
+    {310, 20, 22, "Engine Control Flags", "\"Engine Control Flags\""},
+    {311, 25, 27, "Engine Troll RPM Setpoint", "\"Engine Troll RPM Setpoint\""},
+    {312, 11, 13, "Active Helm", "\"Active Helm\""},
+    {313, 19, 21, "Cruise RPM Setpoint", "\"Cruise RPM Setpoint\""},
+    {314, 21, 23, "Cruise Speed Setpoint", "\"Cruise Speed Setpoint\""},
+    {315, 15, 17, "Cmd Pattern Dir", "\"Cmd Pattern Dir\""},
+    {316, 16, 18, "Smart Contextual", "\"Smart Contextual\""},
+    {317, 24, 26, "Sailing Time To Waypoint", "\"Sailing Time To Waypoint\""},
+    {318, 28, 30, "Sailing Distance To Waypoint", "\"Sailing Distance To Waypoint\""},
+    {319, 11, 13, "Sailing ETA", "\"Sailing ETA\""},
+    {320, 14, 16, "Generator Temp", "\"Generator Temp\""},
+    {321, 18, 20, "Generator Oil Temp", "\"Generator Oil Temp\""},
+    {322, 18, 20, "Generator Oil Pres", "\"Generator Oil Pres\""},
+    {323, 20, 22, "Generator Water Pres", "\"Generator Water Pres\""},
+    {324, 19, 21, "Generator Fuel Pres", "\"Generator Fuel Pres\""},
+    {325, 19, 21, "Generator Fuel Rate", "\"Generator Fuel Rate\""},
+    {326, 20, 22, "Generator Hours Used", "\"Generator Hours Used\""},
+    {327, 25, 27, "Generator Discrete Status", "\"Generator Discrete Status\""},
+    {328, 22, 24, "Generator Percent Load", "\"Generator Percent Load\""},
+    {329, 24, 26, "Generator Percent Torque", "\"Generator Percent Torque\""},
+    {330, 25, 27, "Generator Battery Voltage", "\"Generator Battery Voltage\""},
+    {331, 25, 27, "Generator Average Voltage", "\"Generator Average Voltage\""},
+    {332, 27, 29, "Generator Average Frequency", "\"Generator Average Frequency\""},
+    {333, 25, 27, "Generator Average Current", "\"Generator Average Current\""},
+    {334, 10, 12, "Pilot Mode", "\"Pilot Mode\""},
+    {335, 20, 22, "Pilot Response Level", "\"Pilot Response Level\""},
+    {336, 25, 27, "Cruise Smarttow Overshoot", "\"Cruise Smarttow Overshoot\""},
+    {337, 17, 19, "Pilot Cmd Heading", "\"Pilot Cmd Heading\""},
+    {338, 15, 17, "MOB Dr Position", "\"MOB Dr Position\""},
+    {339, 12, 14, "MOB Dr Range", "\"MOB Dr Range\""},
+    {340, 14, 16, "MOB Dr Bearing", "\"MOB Dr Bearing\""},
+    {341, 12, 14, "Bow Position", "\"Bow Position\""},
+    {342, 18, 20, "Start Line Bearing", "\"Start Line Bearing\""},
+    {343, 15, 17, "Start Line Bias", "\"Start Line Bias\""},
+    {344, 22, 24, "Distance To Start Line", "\"Distance To Start Line\""},
+    {345, 31, 33, "Distance To Start Line Port End", "\"Distance To Start Line Port End\""},
+    {346, 31, 33, "Distance To Start Line Stbd End", "\"Distance To Start Line Stbd End\""},
+    {347, 24, 26, "Start Line Port Position", "\"Start Line Port Position\""},
+    {348, 24, 26, "Start Line Stbd Position", "\"Start Line Stbd Position\""},
+    {349, 32, 34, "Start Line Boat Length Advantage", "\"Start Line Boat Length Advantage\""},
+    {350, 35, 37, "Distance To Start Line Boat Lengths", "\"Distance To Start Line Boat Lengths\""},
+    {351, 8, 10, "Backstay", "\"Backstay\""},
+    {352, 10, 12, "Boom Angle", "\"Boom Angle\""},
+    {353, 9, 11, "Boom Vang", "\"Boom Vang\""},
+    {354, 12, 14, "Chain Length", "\"Chain Length\""},
+    {355, 10, 12, "Cunningham", "\"Cunningham\""},
+    {356, 19, 21, "Inner Forestay Load", "\"Inner Forestay Load\""},
+    {357, 27, 29, "Inner Forestay Halyard Load", "\"Inner Forestay Halyard Load\""},
+    {358, 8, 10, "Jib Furl", "\"Jib Furl\""},
+    {359, 16, 18, "Jib Halyard Load", "\"Jib Halyard Load\""},
+    {360, 18, 20, "Optimum Wind Angle", "\"Optimum Wind Angle\""},
+    {361, 12, 14, "Outhaul Load", "\"Outhaul Load\""},
+    {362, 10, 12, "Pitch Rate", "\"Pitch Rate\""},
+    {363, 10, 12, "Plow Angle", "\"Plow Angle\""},
+    {364, 9, 11, "Roll Rate", "\"Roll Rate\""},
+    {365, 15, 17, "VMG Performance", "\"VMG Performance\""},
+    {366, 16, 18, "B And G Linear 5", "\"B And G Linear 5\""},
+    {367, 16, 18, "B And G Linear 6", "\"B And G Linear 6\""},
+    {368, 16, 18, "B And G Linear 7", "\"B And G Linear 7\""},
+    {369, 16, 18, "B And G Linear 8", "\"B And G Linear 8\""},
+    {370, 16, 18, "B And G Linear 9", "\"B And G Linear 9\""},
+    {371, 17, 19, "B And G Linear 10", "\"B And G Linear 10\""},
+    {372, 17, 19, "B And G Linear 11", "\"B And G Linear 11\""},
+    {373, 17, 19, "B And G Linear 12", "\"B And G Linear 12\""},
+    {374, 17, 19, "B And G Linear 13", "\"B And G Linear 13\""},
+    {375, 17, 19, "B And G Linear 14", "\"B And G Linear 14\""},
+    {376, 17, 19, "B And G Linear 15", "\"B And G Linear 15\""},
+    {377, 17, 19, "B And G Linear 16", "\"B And G Linear 16\""},
+    {378, 12, 14, "Keel Draught", "\"Keel Draught\""},
+    {379, 16, 18, "Pool Temperature", "\"Pool Temperature\""},
+    {380, 19, 21, "Jacuzzi Temperature", "\"Jacuzzi Temperature\""},
+    {381, 15, 17, "Trip Dr Bearing", "\"Trip Dr Bearing\""},
+    {382, 16, 18, "Trip Dr Distance", "\"Trip Dr Distance\""},
+    {383, 14, 16, "Code Zero Load", "\"Code Zero Load\""},
+    {384, 20, 22, "B And G MOB Position", "\"B And G MOB Position\""},
+    {385, 26, 28, "Distance Behind Start Line", "\"Distance Behind Start Line\""},
+    {386, 39, 41, "Distance Behind Start Line Boat Lengths", "\"Distance Behind Start Line Boat Lengths\""},
+    {387, 14, 16, "Bias Advantage", "\"Bias Advantage\""},
+    {388, 17, 19, "Opposite Tack COG", "\"Opposite Tack COG\""},
+    {389, 28, 30, "Opposite Tack Target Heading", "\"Opposite Tack Target Heading\""},
+    {390, 9, 11, "Mast Rake", "\"Mast Rake\""},
+    {391, 16, 18, "Next Leg Bearing", "\"Next Leg Bearing\""},
+    {392, 21, 23, "Next Leg Target Speed", "\"Next Leg Target Speed\""},
+    {393, 21, 23, "Ground Wind Direction", "\"Ground Wind Direction\""},
+    {394, 17, 19, "Ground Wind Speed", "\"Ground Wind Speed\""},
+    {395, 15, 17, "Mast Cant Angle", "\"Mast Cant Angle\""},
+    {396, 13, 15, "Rudder Toe In", "\"Rudder Toe In\""},
+    {397, 16, 18, "Daggerboard Port", "\"Daggerboard Port\""},
+    {398, 21, 23, "Daggerboard Starboard", "\"Daggerboard Starboard\""},
+    {399, 16, 18, "B And G Remote 0", "\"B And G Remote 0\""},
+    {400, 16, 18, "B And G Remote 1", "\"B And G Remote 1\""},
+    {401, 16, 18, "B And G Remote 2", "\"B And G Remote 2\""},
+    {402, 16, 18, "B And G Remote 3", "\"B And G Remote 3\""},
+    {403, 16, 18, "B And G Remote 4", "\"B And G Remote 4\""},
+    {404, 16, 18, "B And G Remote 5", "\"B And G Remote 5\""},
+    {405, 16, 18, "B And G Remote 6", "\"B And G Remote 6\""},
+    {406, 16, 18, "B And G Remote 7", "\"B And G Remote 7\""},
+    {407, 16, 18, "B And G Remote 8", "\"B And G Remote 8\""},
+    {408, 16, 18, "B And G Remote 9", "\"B And G Remote 9\""},
+    {409, 13, 15, "Forward Depth", "\"Forward Depth\""},
+    {410, 14, 16, "Critical Range", "\"Critical Range\""},
+    {411, 13, 15, "Caution Range", "\"Caution Range\""},
+    {412, 9, 11, "Max Range", "\"Max Range\""},
+    {413, 28, 30, "Generator Alternator Voltage", "\"Generator Alternator Voltage\""},
+    {414, 18, 20, "Trolling Prop Rate", "\"Trolling Prop Rate\""},
+    {415, 29, 31, "Trolling Cruise Control Speed", "\"Trolling Cruise Control Speed\""},
+    {416, 16, 18, "Vessel Fuel Used", "\"Vessel Fuel Used\""},
+    {417, 27, 29, "Suzuki Engine Baro Pressure", "\"Suzuki Engine Baro Pressure\""},
+    {418, 27, 29, "Suzuki Cylinder Temperature", "\"Suzuki Cylinder Temperature\""},
+    {419, 29, 31, "Suzuki Intake Air Temperature", "\"Suzuki Intake Air Temperature\""},
+    {420, 22, 24, "Suzuki Ignition Timing", "\"Suzuki Ignition Timing\""},
+    {421, 32, 34, "Suzuki Fuel Injector Pulse Width", "\"Suzuki Fuel Injector Pulse Width\""},
+    {422, 31, 33, "Was Suzuki Injected Fuel Amount", "\"Was Suzuki Injected Fuel Amount\""},
+    {423, 21, 23, "Suzuki Iac Valve Duty", "\"Suzuki Iac Valve Duty\""},
+    {424, 24, 26, "Suzuki Discrete Status 1", "\"Suzuki Discrete Status 1\""},
+    {425, 24, 26, "Suzuki Discrete Status 2", "\"Suzuki Discrete Status 2\""},
+    {426, 24, 26, "Suzuki Discrete Status 3", "\"Suzuki Discrete Status 3\""},
+    {427, 24, 26, "Suzuki Discrete Status 4", "\"Suzuki Discrete Status 4\""},
+    {428, 16, 18, "Fuel Economy Pit", "\"Fuel Economy Pit\""},
+    {429, 23, 25, "Vessel Fuel Economy Pit", "\"Vessel Fuel Economy Pit\""},
+    {430, 21, 23, "Vessel Fuel Range Pit", "\"Vessel Fuel Range Pit\""},
+    {431, 8, 10, "Waypoint", "\"Waypoint\""},
+    {432, 22, 24, "Average Wind Direction", "\"Average Wind Direction\""},
+    {433, 10, 12, "Wind Phase", "\"Wind Phase\""},
+    {434, 9, 11, "Wind Lift", "\"Wind Lift\""},
+    {435, 27, 29, "Fuel Range Seasonal Average", "\"Fuel Range Seasonal Average\""},
+    {436, 24, 26, "Fuel Range Instantaneous", "\"Fuel Range Instantaneous\""},
+    {437, 19, 21, "Vessel Fuel Economy", "\"Vessel Fuel Economy\""},
+    {438, 29, 31, "Average Fuel Economy Seasonal", "\"Average Fuel Economy Seasonal\""},
+    {439, 25, 27, "Average Fuel Economy Trip", "\"Average Fuel Economy Trip\""},
+    {440, 26, 28, "Best Fuel Economy Seasonal", "\"Best Fuel Economy Seasonal\""},
+    {441, 22, 24, "Best Fuel Economy Trip", "\"Best Fuel Economy Trip\""},
+    {442, 17, 19, "Vessel Fuel Level", "\"Vessel Fuel Level\""},
+    {443, 21, 23, "Vessel Fuel Used Trip", "\"Vessel Fuel Used Trip\""},
+    {444, 17, 19, "B And G Linear 17", "\"B And G Linear 17\""},
+    {445, 17, 19, "B And G Linear 18", "\"B And G Linear 18\""},
+    {446, 17, 19, "B And G Linear 19", "\"B And G Linear 19\""},
+    {447, 17, 19, "B And G Linear 20", "\"B And G Linear 20\""},
+    {448, 17, 19, "B And G Linear 21", "\"B And G Linear 21\""},
+    {449, 17, 19, "B And G Linear 22", "\"B And G Linear 22\""},
+    {450, 17, 19, "B And G Linear 23", "\"B And G Linear 23\""},
+    {451, 17, 19, "B And G Linear 24", "\"B And G Linear 24\""},
+    {452, 17, 19, "B And G Linear 25", "\"B And G Linear 25\""},
+    {453, 17, 19, "B And G Linear 26", "\"B And G Linear 26\""},
+    {454, 17, 19, "B And G Linear 27", "\"B And G Linear 27\""},
+    {455, 17, 19, "B And G Linear 28", "\"B And G Linear 28\""},
+    {456, 17, 19, "B And G Linear 29", "\"B And G Linear 29\""},
+    {457, 17, 19, "B And G Linear 30", "\"B And G Linear 30\""},
+    {458, 17, 19, "B And G Linear 31", "\"B And G Linear 31\""},
+    {459, 17, 19, "B And G Linear 32", "\"B And G Linear 32\""},
+    {460, 23, 25, "Origin Way Point Number", "\"Origin Way Point Number\""},
+    {461, 21, 23, "Dest Way Point Number", "\"Dest Way Point Number\""},
+    {462, 20, 22, "Arrival Notification", "\"Arrival Notification\""},
+    {463, 27, 29, "Arrival Circle Notification", "\"Arrival Circle Notification\""},
+    {464, 18, 20, "Was Nav Terminated", "\"Was Nav Terminated\""},
+    {465, 7, 9, "Bobstay", "\"Bobstay\""},
+    {466, 2, 4, "J1", "\"J1\""},
+    {467, 2, 4, "J2", "\"J2\""},
+    {468, 2, 4, "J3", "\"J3\""},
+    {469, 9, 11, "Mast Base", "\"Mast Base\""},
+    {470, 9, 11, "Mainsheet", "\"Mainsheet\""},
+    {471, 7, 9, "D0 Port", "\"D0 Port\""},
+    {472, 12, 14, "D0 Starboard", "\"D0 Starboard\""},
+    {473, 11, 13, "Runner Port", "\"Runner Port\""},
+    {474, 16, 18, "Runner Starboard", "\"Runner Starboard\""},
+    {475, 9, 11, "Foil Port", "\"Foil Port\""},
+    {476, 14, 16, "Foil Starboard", "\"Foil Starboard\""},
+    {477, 13, 15, "Sailtack Port", "\"Sailtack Port\""},
+    {478, 18, 20, "Sailtack Starboard", "\"Sailtack Starboard\""},
+    {479, 12, 14, "Deflect Port", "\"Deflect Port\""},
+    {480, 17, 19, "Deflect Starboard", "\"Deflect Starboard\""},
+    {481, 16, 18, "Rudder Load Port", "\"Rudder Load Port\""},
+    {482, 21, 23, "Rudder Load Starboard", "\"Rudder Load Starboard\""},
+    {483, 7, 9, "D1 Port", "\"D1 Port\""},
+    {484, 12, 14, "D1 Starboard", "\"D1 Starboard\""},
+    {485, 7, 9, "V0 Port", "\"V0 Port\""},
+    {486, 12, 14, "V0 Starboard", "\"V0 Starboard\""},
+    {487, 7, 9, "V1 Port", "\"V1 Port\""},
+    {488, 12, 14, "V1 Starboard", "\"V1 Starboard\""},
+    {489, 11, 13, "Gnss System", "\"Gnss System\""},
+    {490, 8, 10, "Sv Count", "\"Sv Count\""},
+    {491, 12, 14, "Gnss Op Mode", "\"Gnss Op Mode\""},
+    {492, 10, 12, "Dgnss Mode", "\"Dgnss Mode\""},
+    {493, 21, 23, "Suzuki Fuel Pump Duty", "\"Suzuki Fuel Pump Duty\""},
+    {494, 28, 30, "Speed Log Water Longitudinal", "\"Speed Log Water Longitudinal\""},
+    {495, 26, 28, "Speed Log Water Transverse", "\"Speed Log Water Transverse\""},
+    {496, 25, 27, "Speed Log Water Resultant", "\"Speed Log Water Resultant\""},
+    {497, 21, 23, "Speed Log Water Angle", "\"Speed Log Water Angle\""},
+    {498, 29, 31, "Speed Log Ground Longitudinal", "\"Speed Log Ground Longitudinal\""},
+    {499, 27, 29, "Speed Log Ground Transverse", "\"Speed Log Ground Transverse\""},
+    {500, 26, 28, "Speed Log Ground Resultant", "\"Speed Log Ground Resultant\""},
+    {501, 22, 24, "Speed Log Ground Angle", "\"Speed Log Ground Angle\""},
+    {502, 32, 34, "Speed Log Stern Water Transverse", "\"Speed Log Stern Water Transverse\""},
+    {503, 33, 35, "Speed Log Stern Ground Transverse", "\"Speed Log Stern Ground Transverse\""},
+    {504, 14, 16, "Position Datum", "\"Position Datum\""},
+    {505, 10, 12, "Speed Boat", "\"Speed Boat\""},
+    {506, 28, 30, "Was Engine Fuel Used Mercury", "\"Was Engine Fuel Used Mercury\""},
+    {507, 5, 7, "Heave", "\"Heave\""},
+    {508, 18, 20, "Speed Trip Max RPM", "\"Speed Trip Max RPM\""},
+    {509, 26, 28, "Honda Engine Status Params", "\"Honda Engine Status Params\""},
+    {510, 14, 16, "Pilot Features", "\"Pilot Features\""},
+    {511, 22, 24, "Pilot Setpoint Heading", "\"Pilot Setpoint Heading\""},
+    {512, 23, 25, "Idle Speed Control Mode", "\"Idle Speed Control Mode\""},
+    {513, 24, 26, "Idle Speed Control Value", "\"Idle Speed Control Value\""},
+    {514, 13, 15, "Trolling Mode", "\"Trolling Mode\""},
+    {515, 23, 25, "Immobilizer Lock Status", "\"Immobilizer Lock Status\""},
+    {516, 24, 26, "Engine Discrete Params 1", "\"Engine Discrete Params 1\""},
+    {517, 24, 26, "Engine Discrete Params 2", "\"Engine Discrete Params 2\""},
+    {518, 24, 26, "Engine Discrete Params 3", "\"Engine Discrete Params 3\""},
+    {519, 24, 26, "Engine Discrete Params 4", "\"Engine Discrete Params 4\""},
+    {520, 24, 26, "Engine Discrete Params 5", "\"Engine Discrete Params 5\""},
+    {521, 24, 26, "Engine Discrete Params 6", "\"Engine Discrete Params 6\""},
+    {522, 20, 22, "Idle Speed Limit Low", "\"Idle Speed Limit Low\""},
+    {523, 21, 23, "Idle Speed Limit High", "\"Idle Speed Limit High\""},
+    {524, 30, 32, "Was Trolling Variable RPM Info", "\"Was Trolling Variable RPM Info\""},
+    {525, 29, 31, "Idle Speed Control Target Rev", "\"Idle Speed Control Target Rev\""},
+    {526, 12, 14, "Idle Control", "\"Idle Control\""},
+    {527, 13, 15, "Idle Feedback", "\"Idle Feedback\""},
+    {528, 34, 36, "Immediately After Starting Control", "\"Immediately After Starting Control\""},
+    {529, 14, 16, "Gateway Params", "\"Gateway Params\""},
+    {530, 16, 18, "Gateway Protocol", "\"Gateway Protocol\""},
+    {531, 16, 18, "Engine Wall Temp", "\"Engine Wall Temp\""},
+    {532, 26, 28, "Substitute Battery Voltage", "\"Substitute Battery Voltage\""},
+    {533, 26, 28, "Yamaha Engine M6 Diag Code", "\"Yamaha Engine M6 Diag Code\""},
+    {534, 30, 32, "Wireless Sensor Battery Status", "\"Wireless Sensor Battery Status\""},
+    {535, 37, 39, "Wireless Sensor Battery Charge Status", "\"Wireless Sensor Battery Charge Status\""},
+    {536, 38, 40, "Wireless Sensor Battery Status Voltage", "\"Wireless Sensor Battery Status Voltage\""},
+    {537, 45, 47, "Wireless Sensor Battery Charge Status Current", "\"Wireless Sensor Battery Charge Status Current\""},
+    {538, 15, 17, "Fluid Type Mode", "\"Fluid Type Mode\""},
+    {539, 8, 10, "Datetime", "\"Datetime\""},
+    {540, 12, 14, "Reacher Load", "\"Reacher Load\""},
+    {541, 10, 12, "Blade Load", "\"Blade Load\""},
+    {542, 13, 15, "Staysail Load", "\"Staysail Load\""},
+    {543, 9, 11, "Tack Load", "\"Tack Load\""},
+    {544, 7, 9, "J4 Load", "\"J4 Load\""},
+    {545, 11, 13, "Solent Load", "\"Solent Load\""},
+    {546, 14, 16, "Tack Port Load", "\"Tack Port Load\""},
+    {547, 19, 21, "Tack Starboard Load", "\"Tack Starboard Load\""},
+    {548, 18, 20, "Deflect Upper Load", "\"Deflect Upper Load\""},
+    {549, 18, 20, "Deflect Lower Load", "\"Deflect Lower Load\""},
+    {550, 15, 17, "Winch Port Load", "\"Winch Port Load\""},
+    {551, 20, 22, "Winch Starboard Load", "\"Winch Starboard Load\""},
+    {552, 22, 24, "Spin Halyard Port Load", "\"Spin Halyard Port Load\""},
+    {553, 27, 29, "Spin Halyard Starboard Load", "\"Spin Halyard Starboard Load\""},
+    {554, 13, 15, "Main Halyward", "\"Main Halyward\""},
+    {555, 11, 13, "Load 1 Load", "\"Load 1 Load\""},
+    {556, 11, 13, "Load 2 Load", "\"Load 2 Load\""},
+    {557, 16, 18, "Mast Base 2 Load", "\"Mast Base 2 Load\""},
+    {558, 22, 24, "Pilot Active Perf Mode", "\"Pilot Active Perf Mode\""},
+    {559, 10, 12, "Pilot Gust", "\"Pilot Gust\""},
+    {560, 18, 20, "Pilot Tws Response", "\"Pilot Tws Response\""},
+    {561, 15, 17, "Pilot Heel Comp", "\"Pilot Heel Comp\""},
+    {562, 16, 18, "Pilot Net Course", "\"Pilot Net Course\""},
+    {563, 23, 25, "Pilot Target Wind Angle", "\"Pilot Target Wind Angle\""},
+    {564, 18, 20, "Pilot Weather Helm", "\"Pilot Weather Helm\""},
+    {565, 15, 17, "Pilot Mean Heel", "\"Pilot Mean Heel\""},
+    {566, 27, 29, "Propeller Shaft Pitch Angle", "\"Propeller Shaft Pitch Angle\""},
+    {567, 29, 31, "Propeller Shaft Pitch Percent", "\"Propeller Shaft Pitch Percent\""},
+    {568, 19, 21, "Propeller Shaft RPM", "\"Propeller Shaft RPM\""},
+    {569, 20, 22, "Thruster Pitch Angle", "\"Thruster Pitch Angle\""},
+    {570, 22, 24, "Thruster Pitch Percent", "\"Thruster Pitch Percent\""},
+    {571, 17, 19, "Ground Wind Angle", "\"Ground Wind Angle\""},
+    {572, 16, 18, "Fuel Flow Offset", "\"Fuel Flow Offset\""},
+    {573, 20, 22, "Fluid Level Gasoline", "\"Fluid Level Gasoline\""},
+    {574, 21, 23, "Fluid Volume Gasoline", "\"Fluid Volume Gasoline\""},
+    {575, 22, 24, "Tank Capacity Gasoline", "\"Tank Capacity Gasoline\""},
+    {576, 14, 16, "Cmd Xte Offset", "\"Cmd Xte Offset\""},
+    {577, 18, 20, "Engine 4Stroke Oil", "\"Engine 4Stroke Oil\""},
+    {578, 31, 33, "Wireless Sensor Signal Strength", "\"Wireless Sensor Signal Strength\""},
+    {579, 40, 42, "Wireless Sensor Software Update Progress", "\"Wireless Sensor Software Update Progress\""},
+    {580, 15, 17, "Trolling Status", "\"Trolling Status\""},
+    {581, 21, 23, "Mercury Exhaust Valve", "\"Mercury Exhaust Valve\""},
+    {582, 22, 24, "Mercury Exhaust Status", "\"Mercury Exhaust Status\""},
+    {583, 24, 26, "Yanmar Engine Ecu Alarms", "\"Yanmar Engine Ecu Alarms\""},
+    {584, 22, 24, "Yanmar Helm Ecu Alarms", "\"Yanmar Helm Ecu Alarms\""},
+    {585, 23, 25, "Yanmar Drive Ecu Alarms", "\"Yanmar Drive Ecu Alarms\""},
+    {586, 20, 22, "Dgps Correction Data", "\"Dgps Correction Data\""},
+    {587, 25, 27, "Dgps Reference Station Id", "\"Dgps Reference Station Id\""},
+    {588, 29, 31, "Dgps Reference Station Health", "\"Dgps Reference Station Health\""},
+    {589, 15, 17, "Dgps Signal Snr", "\"Dgps Signal Snr\""},
+    {590, 21, 23, "Dgps Signal Frequency", "\"Dgps Signal Frequency\""},
+    {591, 20, 22, "Dgps Signal Strength", "\"Dgps Signal Strength\""},
+    {592, 16, 18, "Engine Fuel Temp", "\"Engine Fuel Temp\""},
+    {593, 13, 15, "Depth Quality", "\"Depth Quality\""},
+    {594, 20, 22, "Number Of Active Dtc", "\"Number Of Active Dtc\""},
+    {595, 28, 30, "Yanmar Fuel Level Tank1 Port", "\"Yanmar Fuel Level Tank1 Port\""},
+    {596, 28, 30, "Yanmar Fuel Level Tank2 Port", "\"Yanmar Fuel Level Tank2 Port\""},
+    {597, 28, 30, "Yanmar Fuel Level Tank1 Stbd", "\"Yanmar Fuel Level Tank1 Stbd\""},
+    {598, 28, 30, "Yanmar Fuel Level Tank2 Stbd", "\"Yanmar Fuel Level Tank2 Stbd\""},
+    {599, 30, 32, "Yanmar Fuel Level Tank1 Center", "\"Yanmar Fuel Level Tank1 Center\""},
+    {600, 30, 32, "Yanmar Fuel Level Tank2 Center", "\"Yanmar Fuel Level Tank2 Center\""},
+    {601, 35, 37, "Yanmar Fresh Water Level Tank1 Port", "\"Yanmar Fresh Water Level Tank1 Port\""},
+    {602, 35, 37, "Yanmar Fresh Water Level Tank2 Port", "\"Yanmar Fresh Water Level Tank2 Port\""},
+    {603, 35, 37, "Yanmar Fresh Water Level Tank1 Stbd", "\"Yanmar Fresh Water Level Tank1 Stbd\""},
+    {604, 35, 37, "Yanmar Fresh Water Level Tank2 Stbd", "\"Yanmar Fresh Water Level Tank2 Stbd\""},
+    {605, 37, 39, "Yanmar Fresh Water Level Tank1 Center", "\"Yanmar Fresh Water Level Tank1 Center\""},
+    {606, 37, 39, "Yanmar Fresh Water Level Tank2 Center", "\"Yanmar Fresh Water Level Tank2 Center\""},
+    {607, 34, 36, "Yanmar Gray Water Level Tank1 Port", "\"Yanmar Gray Water Level Tank1 Port\""},
+    {608, 34, 36, "Yanmar Gray Water Level Tank2 Port", "\"Yanmar Gray Water Level Tank2 Port\""},
+    {609, 34, 36, "Yanmar Gray Water Level Tank1 Stbd", "\"Yanmar Gray Water Level Tank1 Stbd\""},
+    {610, 34, 36, "Yanmar Gray Water Level Tank2 Stbd", "\"Yanmar Gray Water Level Tank2 Stbd\""},
+    {611, 36, 38, "Yanmar Gray Water Level Tank1 Center", "\"Yanmar Gray Water Level Tank1 Center\""},
+    {612, 36, 38, "Yanmar Gray Water Level Tank2 Center", "\"Yanmar Gray Water Level Tank2 Center\""},
+    {613, 23, 25, "Rudder Angle Percentage", "\"Rudder Angle Percentage\""},
+    {614, 17, 19, "Troll Active Helm", "\"Troll Active Helm\""},
+    {615, 13, 15, "Tides Graphic", "\"Tides Graphic\""},
+    {616, 15, 17, "Anchor Distance", "\"Anchor Distance\""},
+    {617, 11, 13, "Anchor Size", "\"Anchor Size\""},
+    {618, 12, 14, "Anchor Depth", "\"Anchor Depth\""},
+    {619, 14, 16, "Anchor Bearing", "\"Anchor Bearing\""},
+    {620, 27, 29, "Honda Engine Warning Params", "\"Honda Engine Warning Params\""},
+    {621, 30, 32, "Honda Engine Discrete Params 1", "\"Honda Engine Discrete Params 1\""},
+    {622, 30, 32, "Honda Engine Discrete Params 2", "\"Honda Engine Discrete Params 2\""},
+    {623, 30, 32, "Honda Engine Discrete Params 3", "\"Honda Engine Discrete Params 3\""},
+    {624, 30, 32, "Honda Engine Discrete Params 4", "\"Honda Engine Discrete Params 4\""},
+    {625, 18, 20, "Mainsail Head Load", "\"Mainsail Head Load\""},
+    {626, 18, 20, "Mainsail Clew Load", "\"Mainsail Clew Load\""},
+    {627, 18, 20, "Mainsail Tack Load", "\"Mainsail Tack Load\""},
+    {628, 12, 14, "J1 Head Load", "\"J1 Head Load\""},
+    {629, 12, 14, "J1 Clew Load", "\"J1 Clew Load\""},
+    {630, 12, 14, "J1 Tack Load", "\"J1 Tack Load\""},
+    {631, 12, 14, "J2 Head Load", "\"J2 Head Load\""},
+    {632, 12, 14, "J2 Clew Load", "\"J2 Clew Load\""},
+    {633, 12, 14, "J2 Tack Load", "\"J2 Tack Load\""},
+    {634, 12, 14, "J3 Head Load", "\"J3 Head Load\""},
+    {635, 12, 14, "J3 Clew Load", "\"J3 Clew Load\""},
+    {636, 12, 14, "J3 Tack Load", "\"J3 Tack Load\""},
+    {637, 19, 21, "Code Zero Head Load", "\"Code Zero Head Load\""},
+    {638, 19, 21, "Code Zero Clew Load", "\"Code Zero Clew Load\""},
+    {639, 19, 21, "Code Zero Tack Load", "\"Code Zero Tack Load\""},
+    {640, 21, 23, "Suzuki Engine Alert I", "\"Suzuki Engine Alert I\""},
+    {641, 15, 17, "Engine Oil Life", "\"Engine Oil Life\""},
+    {642, 23, 25, "Engine Oil Level Status", "\"Engine Oil Level Status\""},
+    {643, 18, 20, "Trans Fluid Status", "\"Trans Fluid Status\""},
+    {644, 28, 30, "Honda Eco Status All Engines", "\"Honda Eco Status All Engines\""},
+    {645, 10, 12, "Output RPM", "\"Output RPM\""},
+    {646, 21, 23, "Suzuki Engine Alert A", "\"Suzuki Engine Alert A\""},
+    {647, 21, 23, "Suzuki Engine Alert B", "\"Suzuki Engine Alert B\""},
+    {648, 21, 23, "Suzuki Engine Alert C", "\"Suzuki Engine Alert C\""},
+    {649, 21, 23, "Suzuki Engine Alert D", "\"Suzuki Engine Alert D\""},
+    {650, 21, 23, "Suzuki Engine Alert E", "\"Suzuki Engine Alert E\""},
+    {651, 21, 23, "Suzuki Engine Alert F", "\"Suzuki Engine Alert F\""},
+    {652, 21, 23, "Suzuki Engine Alert G", "\"Suzuki Engine Alert G\""},
+    {653, 21, 23, "Suzuki Engine Alert H", "\"Suzuki Engine Alert H\""},
+    {654, 21, 23, "Suzuki Engine Alert J", "\"Suzuki Engine Alert J\""},
+    {655, 16, 18, "Suzuki Bcm Fault", "\"Suzuki Bcm Fault\""},
+    {656, 15, 17, "Suzuki Bcm Mode", "\"Suzuki Bcm Mode\""},
+    {657, 24, 26, "Suzuki Engine Kls Status", "\"Suzuki Engine Kls Status\""},
+    {658, 19, 21, "Suzuki Switch Fault", "\"Suzuki Switch Fault\""},
+    {659, 28, 30, "Suzuki Shift Position Status", "\"Suzuki Shift Position Status\""},
+    {660, 25, 27, "Vessel Fuel Used Seasonal", "\"Vessel Fuel Used Seasonal\""},
+    {661, 20, 22, "Vessel Fuel Capacity", "\"Vessel Fuel Capacity\""},
+    {662, 30, 32, "Suzuki Engine Auto Trim Status", "\"Suzuki Engine Auto Trim Status\""},
+    {663, 20, 22, "Trolling Mode Active", "\"Trolling Mode Active\""},
+    {664, 27, 29, "Trolling Mode Active Master", "\"Trolling Mode Active Master\""},
+    {665, 27, 29, "Keyless Communication State", "\"Keyless Communication State\""},
+    {666, 24, 26, "Linear Actuator Position", "\"Linear Actuator Position\""},
+    {667, 19, 21, "Engine Exhaust Temp", "\"Engine Exhaust Temp\""},
+    {668, 27, 29, "Engine Guardian Power Limit", "\"Engine Guardian Power Limit\""},
+    {669, 12, 14, "Engine State", "\"Engine State\""},
+    {670, 20, 22, "Sailing Time To Burn", "\"Sailing Time To Burn\""},
+    {671, 10, 12, "Mast Twist", "\"Mast Twist\""},
+    {672, 11, 13, "VHF Channel", "\"VHF Channel\""},
+    {673, 29, 31, "Trolling Lower Unit Direction", "\"Trolling Lower Unit Direction\""},
+    {674, 25, 27, "Propulsion Battery Status", "\"Propulsion Battery Status\""},
+    {675, 35, 37, "Propulsion Battery Isolation Status", "\"Propulsion Battery Isolation Status\""},
+    {676, 24, 26, "Propulsion Battery Error", "\"Propulsion Battery Error\""},
+    {677, 26, 28, "Propulsion Battery Voltage", "\"Propulsion Battery Voltage\""},
+    {678, 26, 28, "Propulsion Battery Current", "\"Propulsion Battery Current\""},
+    {679, 34, 36, "Propulsion Battery State Of Charge", "\"Propulsion Battery State Of Charge\""},
+    {680, 33, 35, "Propulsion Battery Time Remaining", "\"Propulsion Battery Time Remaining\""},
+    {681, 43, 45, "Propulsion Battery Highest Cell Temperature", "\"Propulsion Battery Highest Cell Temperature\""},
+    {682, 42, 44, "Propulsion Battery Lowest Cell Temperature", "\"Propulsion Battery Lowest Cell Temperature\""},
+    {683, 43, 45, "Propulsion Battery Average Cell Temperature", "\"Propulsion Battery Average Cell Temperature\""},
+    {684, 44, 46, "Propulsion Battery Maximum Discharge Current", "\"Propulsion Battery Maximum Discharge Current\""},
+    {685, 41, 43, "Propulsion Battery Maximum Charge Current", "\"Propulsion Battery Maximum Charge Current\""},
+    {686, 40, 42, "Propulsion Battery Cooling System Status", "\"Propulsion Battery Cooling System Status\""},
+    {687, 40, 42, "Propulsion Battery Heating System Status", "\"Propulsion Battery Heating System Status\""},
+    {688, 31, 33, "Propulsion Battery Storage Mode", "\"Propulsion Battery Storage Mode\""},
+    {689, 28, 30, "Propulsion Battery Chemistry", "\"Propulsion Battery Chemistry\""},
+    {690, 47, 49, "Propulsion Battery Maximum Temperature Derating", "\"Propulsion Battery Maximum Temperature Derating\""},
+    {691, 46, 48, "Propulsion Battery Maximum Temperature Shutoff", "\"Propulsion Battery Maximum Temperature Shutoff\""},
+    {692, 47, 49, "Propulsion Battery Minimum Temperature Derating", "\"Propulsion Battery Minimum Temperature Derating\""},
+    {693, 46, 48, "Propulsion Battery Minimum Temperature Shutoff", "\"Propulsion Battery Minimum Temperature Shutoff\""},
+    {694, 32, 34, "Propulsion Battery Usable Energy", "\"Propulsion Battery Usable Energy\""},
+    {695, 34, 36, "Propulsion Battery State Of Health", "\"Propulsion Battery State Of Health\""},
+    {696, 41, 43, "Propulsion Battery Discharge Cycles Count", "\"Propulsion Battery Discharge Cycles Count\""},
+    {697, 30, 32, "Propulsion Battery Full Status", "\"Propulsion Battery Full Status\""},
+    {698, 31, 33, "Propulsion Battery Empty Status", "\"Propulsion Battery Empty Status\""},
+    {699, 37, 39, "Propulsion Battery Maximum Charge Soc", "\"Propulsion Battery Maximum Charge Soc\""},
+    {700, 40, 42, "Propulsion Battery Minimum Discharge Soc", "\"Propulsion Battery Minimum Discharge Soc\""},
+    {701, 17, 19, "Active Motor Mode", "\"Active Motor Mode\""},
+    {702, 16, 18, "Motor Brake Mode", "\"Motor Brake Mode\""},
+    {703, 28, 30, "Motor Rotational Shaft Speed", "\"Motor Rotational Shaft Speed\""},
+    {704, 13, 15, "Motor Voltage", "\"Motor Voltage\""},
+    {705, 13, 15, "Motor Current", "\"Motor Current\""},
+    {706, 20, 22, "Motor Operating Mode", "\"Motor Operating Mode\""},
+    {707, 17, 19, "Motor Temperature", "\"Motor Temperature\""},
+    {708, 26, 28, "Motor Inverter Temperature", "\"Motor Inverter Temperature\""},
+    {709, 25, 27, "Motor Coolant Temperature", "\"Motor Coolant Temperature\""},
+    {710, 22, 24, "Motor Gear Temperature", "\"Motor Gear Temperature\""},
+    {711, 26, 28, "Motor Shaft Torque Percent", "\"Motor Shaft Torque Percent\""},
+    {712, 18, 20, "Motor Voltage Type", "\"Motor Voltage Type\""},
+    {713, 20, 22, "Motor Voltage Rating", "\"Motor Voltage Rating\""},
+    {714, 26, 28, "Motor Max Continuous Power", "\"Motor Max Continuous Power\""},
+    {715, 21, 23, "Motor Max Boost Power", "\"Motor Max Boost Power\""},
+    {716, 28, 30, "Motor Max Temperature Rating", "\"Motor Max Temperature Rating\""},
+    {717, 17, 19, "Motor Rated Speed", "\"Motor Rated Speed\""},
+    {718, 39, 41, "Motor Max Controller Temperature Rating", "\"Motor Max Controller Temperature Rating\""},
+    {719, 25, 27, "Motor Shaft Torque Rating", "\"Motor Shaft Torque Rating\""},
+    {720, 35, 37, "Motor DC Voltage Derating Threshold", "\"Motor DC Voltage Derating Threshold\""},
+    {721, 33, 35, "Motor DC Voltage Cutoff Threshold", "\"Motor DC Voltage Cutoff Threshold\""},
+    {722, 13, 15, "Motor Runtime", "\"Motor Runtime\""},
+    {723, 22, 24, "Sailing Ping Time Port", "\"Sailing Ping Time Port\""},
+    {724, 22, 24, "Sailing Ping Time Stbd", "\"Sailing Ping Time Stbd\""},
+    {725, 14, 16, "Heading Source", "\"Heading Source\""},
+    {726, 7, 9, "Invalid", "\"Invalid\""}
+};
+const LookupTable lookupTableNAVICO_DATA_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 727, .entries = lookupEntriesNAVICO_DATA_TYPE};
+
+static const LookupEntry lookupEntriesNAV_STATUS[] = {
+    {0, 22, 24, "Under way using engine", "\"Under way using engine\""},
+    {1, 9, 11, "At anchor", "\"At anchor\""},
+    {2, 17, 19, "Not under command", "\"Not under command\""},
+    {3, 26, 28, "Restricted maneuverability", "\"Restricted maneuverability\""},
+    {4, 26, 28, "Constrained by her draught", "\"Constrained by her draught\""},
+    {5, 6, 8, "Moored", "\"Moored\""},
+    {6, 7, 9, "Aground", "\"Aground\""},
+    {7, 18, 20, "Engaged in Fishing", "\"Engaged in Fishing\""},
+    {8, 17, 19, "Under way sailing", "\"Under way sailing\""},
+    {9, 31, 33, "Hazardous material - High Speed", "\"Hazardous material - High Speed\""},
+    {10, 35, 37, "Hazardous material - Wing in Ground", "\"Hazardous material - Wing in Ground\""},
+    {11, 33, 35, "Power-driven vessel towing astern", "\"Power-driven vessel towing astern\""},
+    {12, 53, 55, "Power-driven vessel pushing ahead or towing alongside", "\"Power-driven vessel pushing ahead or towing alongside\""},
+    {0},
+    {14, 8, 10, "AIS-SART", "\"AIS-SART\""}
+};
+const LookupTable lookupTableNAV_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 15, .entries = lookupEntriesNAV_STATUS};
+
+static const LookupEntry lookupEntriesOFF_ON[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 2, 4, "On", "\"On\""}
+};
+const LookupTable lookupTableOFF_ON = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesOFF_ON};
+
+static const LookupEntry lookupEntriesOFF_ON_CONTROL[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 2, 4, "On", "\"On\""},
+    {2, 8, 10, "Reserved", "\"Reserved\""},
+    {3, 26, 28, "Take no action (no change)", "\"Take no action (no change)\""}
+};
+const LookupTable lookupTableOFF_ON_CONTROL = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesOFF_ON_CONTROL};
+
+static const LookupEntry lookupEntriesOK_WARNING[] = {
+    {0, 2, 4, "OK", "\"OK\""},
+    {1, 7, 9, "Warning", "\"Warning\""}
+};
+const LookupTable lookupTableOK_WARNING = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesOK_WARNING};
+
+static const LookupEntry lookupEntriesPARAMETER_FIELD[] = {
+    {0, 11, 13, "Acknowledge", "\"Acknowledge\""},
+    {1, 23, 25, "Invalid parameter field", "\"Invalid parameter field\""},
+    {2, 15, 17, "Temporary error", "\"Temporary error\""},
+    {3, 22, 24, "Parameter out of range", "\"Parameter out of range\""},
+    {4, 13, 15, "Access denied", "\"Access denied\""},
+    {5, 13, 15, "Not supported", "\"Not supported\""},
+    {6, 27, 29, "Read or Write not supported", "\"Read or Write not supported\""}
+};
+const LookupTable lookupTablePARAMETER_FIELD = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesPARAMETER_FIELD};
+
+static const LookupEntry lookupEntriesPGN_ERROR_CODE[] = {
+    {0, 11, 13, "Acknowledge", "\"Acknowledge\""},
+    {1, 17, 19, "PGN not supported", "\"PGN not supported\""},
+    {2, 17, 19, "PGN not available", "\"PGN not available\""},
+    {3, 13, 15, "Access denied", "\"Access denied\""},
+    {4, 13, 15, "Not supported", "\"Not supported\""},
+    {5, 17, 19, "Tag not supported", "\"Tag not supported\""},
+    {6, 27, 29, "Read or Write not supported", "\"Read or Write not supported\""}
+};
+const LookupTable lookupTablePGN_ERROR_CODE = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesPGN_ERROR_CODE};
+
+static const LookupEntry lookupEntriesPGN_LIST_FUNCTION[] = {
+    {0, 17, 19, "Transmit PGN list", "\"Transmit PGN list\""},
+    {1, 16, 18, "Receive PGN list", "\"Receive PGN list\""}
+};
+const LookupTable lookupTablePGN_LIST_FUNCTION = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesPGN_LIST_FUNCTION};
+
+static const LookupEntry lookupEntriesPOSITION_ACCURACY[] = {
+    {0, 3, 5, "Low", "\"Low\""},
+    {1, 4, 6, "High", "\"High\""}
+};
+const LookupTable lookupTablePOSITION_ACCURACY = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesPOSITION_ACCURACY};
+
+static const LookupEntry lookupEntriesPOSITION_FIX_DEVICE[] = {
+    {0, 18, 20, "Default: undefined", "\"Default: undefined\""},
+    {1, 3, 5, "GPS", "\"GPS\""},
+    {2, 7, 9, "GLONASS", "\"GLONASS\""},
+    {3, 20, 22, "Combined GPS/GLONASS", "\"Combined GPS/GLONASS\""},
+    {4, 7, 9, "Loran-C", "\"Loran-C\""},
+    {5, 6, 8, "Chayka", "\"Chayka\""},
+    {6, 28, 30, "Integrated navigation system", "\"Integrated navigation system\""},
+    {7, 8, 10, "Surveyed", "\"Surveyed\""},
+    {8, 7, 9, "Galileo", "\"Galileo\""}
+};
+const LookupTable lookupTablePOSITION_FIX_DEVICE = {.kind = LOOKUP_TABLE_DENSE, .count = 9, .entries = lookupEntriesPOSITION_FIX_DEVICE};
+
+static const LookupEntry lookupEntriesPOWER_FACTOR[] = {
+    {0, 7, 9, "Leading", "\"Leading\""},
+    {1, 7, 9, "Lagging", "\"Lagging\""},
+    {2, 5, 7, "Error", "\"Error\""}
+};
+const LookupTable lookupTablePOWER_FACTOR = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesPOWER_FACTOR};
+
+static const LookupEntry lookupEntriesPOWER_MODE[] = {
+    {0, 4, 6, "High", "\"High\""},
+    {1, 3, 5, "Low", "\"Low\""}
+};
+const LookupTable lookupTablePOWER_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesPOWER_MODE};
+
+static const LookupEntry lookupEntriesPRESSURE_SOURCE[] = {
+    {0, 11, 13, "Atmospheric", "\"Atmospheric\""},
+    {1, 5, 7, "Water", "\"Water\""},
+    {2, 5, 7, "Steam", "\"Steam\""},
+    {3, 14, 16, "Compressed Air", "\"Compressed Air\""},
+    {4, 9, 11, "Hydraulic", "\"Hydraulic\""},
+    {5, 6, 8, "Filter", "\"Filter\""},
+    {6, 16, 18, "AltimeterSetting", "\"AltimeterSetting\""},
+    {7, 3, 5, "Oil", "\"Oil\""},
+    {8, 4, 6, "Fuel", "\"Fuel\""}
+};
+const LookupTable lookupTablePRESSURE_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 9, .entries = lookupEntriesPRESSURE_SOURCE};
+
+static const LookupEntry lookupEntriesPRIORITY[] = {
+    {0, 1, 3, "0", "\"0\""},
+    {1, 1, 3, "1", "\"1\""},
+    {2, 1, 3, "2", "\"2\""},
+    {3, 1, 3, "3", "\"3\""},
+    {4, 1, 3, "4", "\"4\""},
+    {5, 1, 3, "5", "\"5\""},
+    {6, 1, 3, "6", "\"6\""},
+    {7, 1, 3, "7", "\"7\""},
+    {8, 15, 17, "Leave unchanged", "\"Leave unchanged\""},
+    {9, 16, 18, "Reset to default", "\"Reset to default\""}
+};
+const LookupTable lookupTablePRIORITY = {.kind = LOOKUP_TABLE_DENSE, .count = 10, .entries = lookupEntriesPRIORITY};
+
+static const LookupEntry lookupEntriesRAIM_FLAG[] = {
+    {0, 10, 12, "not in use", "\"not in use\""},
+    {1, 6, 8, "in use", "\"in use\""}
+};
+const LookupTable lookupTableRAIM_FLAG = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesRAIM_FLAG};
+
+static const LookupEntry lookupEntriesRANGE_RESIDUAL_MODE[] = {
+    {0, 43, 45, "Range residuals were used to calculate data", "\"Range residuals were used to calculate data\""},
+    {1, 50, 52, "Range residuals were calculated after the position", "\"Range residuals were calculated after the position\""}
+};
+const LookupTable lookupTableRANGE_RESIDUAL_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesRANGE_RESIDUAL_MODE};
+
+static const LookupEntry lookupEntriesREPEAT_INDICATOR[] = {
+    {0, 7, 9, "Initial", "\"Initial\""},
+    {1, 20, 22, "First retransmission", "\"First retransmission\""},
+    {2, 21, 23, "Second retransmission", "\"Second retransmission\""},
+    {3, 20, 22, "Final retransmission", "\"Final retransmission\""}
+};
+const LookupTable lookupTableREPEAT_INDICATOR = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesREPEAT_INDICATOR};
+
+static const LookupEntry lookupEntriesREPORTING_INTERVAL[] = {
+    {0, 31, 33, "As given by the autonomous mode", "\"As given by the autonomous mode\""},
+    {1, 6, 8, "10 min", "\"10 min\""},
+    {2, 5, 7, "6 min", "\"6 min\""},
+    {3, 5, 7, "3 min", "\"3 min\""},
+    {4, 5, 7, "1 min", "\"1 min\""},
+    {5, 6, 8, "30 sec", "\"30 sec\""},
+    {6, 6, 8, "15 sec", "\"15 sec\""},
+    {7, 6, 8, "10 sec", "\"10 sec\""},
+    {8, 5, 7, "5 sec", "\"5 sec\""},
+    {9, 36, 38, "2 sec (not applicable to Class B CS)", "\"2 sec (not applicable to Class B CS)\""},
+    {10, 31, 33, "Next shorter reporting interval", "\"Next shorter reporting interval\""},
+    {11, 30, 32, "Next longer reporting interval", "\"Next longer reporting interval\""}
+};
+const LookupTable lookupTableREPORTING_INTERVAL = {.kind = LOOKUP_TABLE_DENSE, .count = 12, .entries = lookupEntriesREPORTING_INTERVAL};
+
+static const LookupEntry lookupEntriesRESIDUAL_MODE[] = {
+    {0, 10, 12, "Autonomous", "\"Autonomous\""},
+    {1, 21, 23, "Differential enhanced", "\"Differential enhanced\""},
+    {2, 9, 11, "Estimated", "\"Estimated\""},
+    {3, 9, 11, "Simulator", "\"Simulator\""},
+    {4, 6, 8, "Manual", "\"Manual\""}
+};
+const LookupTable lookupTableRESIDUAL_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesRESIDUAL_MODE};
+
+static const LookupEntry lookupEntriesRODE_TYPE[] = {
+    {0, 24, 26, "Chain presently detected", "\"Chain presently detected\""},
+    {1, 23, 25, "Rope presently detected", "\"Rope presently detected\""}
+};
+const LookupTable lookupTableRODE_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesRODE_TYPE};
+
+static const LookupEntry lookupEntriesSATELLITE_STATUS[] = {
+    {0, 11, 13, "Not tracked", "\"Not tracked\""},
+    {1, 7, 9, "Tracked", "\"Tracked\""},
+    {2, 4, 6, "Used", "\"Used\""},
+    {3, 16, 18, "Not tracked+Diff", "\"Not tracked+Diff\""},
+    {4, 12, 14, "Tracked+Diff", "\"Tracked+Diff\""},
+    {5, 9, 11, "Used+Diff", "\"Used+Diff\""}
+};
+const LookupTable lookupTableSATELLITE_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesSATELLITE_STATUS};
+
+static const LookupEntry lookupEntriesSBAS_SV[] = {
+    {0, 3, 5, "120", "\"120\""},
+    {1, 3, 5, "121", "\"121\""},
+    {2, 3, 5, "122", "\"122\""},
+    {3, 3, 5, "123", "\"123\""},
+    {4, 3, 5, "124", "\"124\""},
+    {5, 3, 5, "125", "\"125\""},
+    {6, 3, 5, "126", "\"126\""},
+    {7, 3, 5, "127", "\"127\""},
+    {8, 3, 5, "128", "\"128\""},
+    {9, 3, 5, "129", "\"129\""},
+    {10, 3, 5, "130", "\"130\""},
+    {11, 3, 5, "131", "\"131\""},
+    {12, 3, 5, "132", "\"132\""},
+    {13, 3, 5, "133", "\"133\""},
+    {14, 3, 5, "134", "\"134\""},
+    {15, 3, 5, "135", "\"135\""},
+    {16, 3, 5, "136", "\"136\""},
+    {17, 3, 5, "137", "\"137\""},
+    {18, 3, 5, "138", "\"138\""}
+};
+const LookupTable lookupTableSBAS_SV = {.kind = LOOKUP_TABLE_DENSE, .count = 19, .entries = lookupEntriesSBAS_SV};
+
+static const LookupEntry lookupEntriesSEATALK1_COMMAND[] = {
+    {0, 22, 24, "Depth Below Transducer", "\"Depth Below Transducer\""},
+    {1, 12, 14, "Equipment ID", "\"Equipment ID\""},
+    {0},
+    {0},
+    {0},
+    {5, 20, 22, "Engine RPM and PITCH", "\"Engine RPM and PITCH\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {16, 19, 21, "Apparent Wind Angle", "\"Apparent Wind Angle\""},
+    {17, 19, 21, "Apparent Wind Speed", "\"Apparent Wind Speed\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {32, 19, 21, "Speed through water", "\"Speed through water\""},
+    {33, 12, 14, "Trip Mileage", "\"Trip Mileage\""},
+    {34, 13, 15, "Total Mileage", "\"Total Mileage\""},
+    {35, 24, 26, "Water temperature (ST50)", "\"Water temperature (ST50)\""},
+    {36, 33, 35, "Display units for Mileage & Speed", "\"Display units for Mileage & Speed\""},
+    {37, 16, 18, "Total & Trip Log", "\"Total & Trip Log\""},
+    {38, 34, 36, "Speed through water (with average)", "\"Speed through water (with average)\""},
+    {39, 17, 19, "Water temperature", "\"Water temperature\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {48, 18, 20, "Set lamp Intensity", "\"Set lamp Intensity\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {54, 37, 39, "Cancel MOB (Man Over Board) condition", "\"Cancel MOB (Man Over Board) condition\""},
+    {0},
+    {56, 13, 15, "Codelock data", "\"Codelock data\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {80, 12, 14, "LAT position", "\"LAT position\""},
+    {81, 12, 14, "LON position", "\"LON position\""},
+    {82, 17, 19, "Speed over Ground", "\"Speed over Ground\""},
+    {83, 24, 26, "Course over Ground (COG)", "\"Course over Ground (COG)\""},
+    {84, 8, 10, "GMT-time", "\"GMT-time\""},
+    {85, 27, 29, "TRACK keystroke on GPS unit", "\"TRACK keystroke on GPS unit\""},
+    {86, 4, 6, "Date", "\"Date\""},
+    {87, 8, 10, "Sat Info", "\"Sat Info\""},
+    {88, 24, 26, "LAT/LON (raw unfiltered)", "\"LAT/LON (raw unfiltered)\""},
+    {89, 20, 22, "Set Count Down Timer", "\"Set Count Down Timer\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {97, 54, 56, "Issued by E-80 multifunction display at initialization", "\"Issued by E-80 multifunction display at initialization\""},
+    {0},
+    {0},
+    {0},
+    {101, 45, 47, "Select Fathom display units for depth display", "\"Select Fathom display units for depth display\""},
+    {102, 10, 12, "Wind alarm", "\"Wind alarm\""},
+    {0},
+    {104, 30, 32, "Alarm acknowledgment keystroke", "\"Alarm acknowledgment keystroke\""},
+    {0},
+    {0},
+    {0},
+    {108, 28, 30, "Second equipment-ID datagram", "\"Second equipment-ID datagram\""},
+    {0},
+    {110, 20, 22, "MOB (Man Over Board)", "\"MOB (Man Over Board)\""},
+    {0},
+    {112, 58, 60, "Keystroke on Raymarine A25006 ST60 Maxiview Remote Control", "\"Keystroke on Raymarine A25006 ST60 Maxiview Remote Control\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {128, 18, 20, "Set Lamp Intensity", "\"Set Lamp Intensity\""},
+    {129, 36, 38, "Sent by course computer during setup", "\"Sent by course computer during setup\""},
+    {130, 20, 22, "Target waypoint name", "\"Target waypoint name\""},
+    {131, 23, 25, "Sent by course computer", "\"Sent by course computer\""},
+    {132, 52, 54, "Compass heading Autopilot course and Rudder position", "\"Compass heading Autopilot course and Rudder position\""},
+    {133, 34, 36, "Navigation to waypoint information", "\"Navigation to waypoint information\""},
+    {134, 9, 11, "Keystroke", "\"Keystroke\""},
+    {135, 18, 20, "Set Response level", "\"Set Response level\""},
+    {136, 19, 21, "Autopilot Parameter", "\"Autopilot Parameter\""},
+    {137, 47, 49, "Compass heading sent by ST40 compass instrument", "\"Compass heading sent by ST40 compass instrument\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {144, 22, 24, "Device Indentification", "\"Device Indentification\""},
+    {145, 15, 17, "Set Rudder gain", "\"Set Rudder gain\""},
+    {146, 23, 25, "Set Autopilot Parameter", "\"Set Autopilot Parameter\""},
+    {147, 14, 16, "Enter AP-Setup", "\"Enter AP-Setup\""},
+    {0},
+    {149, 60, 62, "Replaces command 84 while autopilot is in value setting mode", "\"Replaces command 84 while autopilot is in value setting mode\""},
+    {0},
+    {0},
+    {0},
+    {153, 17, 19, "Compass variation", "\"Compass variation\""},
+    {154, 14, 16, "Version String", "\"Version String\""},
+    {0},
+    {156, 35, 37, "Compass heading and Rudder position", "\"Compass heading and Rudder position\""},
+    {0},
+    {158, 19, 21, "Waypoint definition", "\"Waypoint definition\""},
+    {0},
+    {0},
+    {161, 25, 27, "Destination Waypoint Info", "\"Destination Waypoint Info\""},
+    {162, 12, 14, "Arrival Info", "\"Arrival Info\""},
+    {0},
+    {164, 44, 46, "Broadcast query/response to identify devices", "\"Broadcast query/response to identify devices\""},
+    {165, 17, 19, "GPS and DGPS Info", "\"GPS and DGPS Info\""},
+    {0},
+    {167, 15, 17, "Unknown meaning", "\"Unknown meaning\""},
+    {168, 22, 24, "Alarm ON/OFF for Guard", "\"Alarm ON/OFF for Guard\""},
+    {0},
+    {0},
+    {171, 22, 24, "Alarm ON/OFF for Guard", "\"Alarm ON/OFF for Guard\""}
+};
+const LookupTable lookupTableSEATALK1_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 172, .entries = lookupEntriesSEATALK1_COMMAND};
+
+static const LookupEntry lookupEntriesSEATALK_ALARM_GROUP[] = {
+    {0, 10, 12, "Instrument", "\"Instrument\""},
+    {1, 9, 11, "Autopilot", "\"Autopilot\""},
+    {2, 5, 7, "Radar", "\"Radar\""},
+    {3, 13, 15, "Chart Plotter", "\"Chart Plotter\""},
+    {4, 3, 5, "AIS", "\"AIS\""},
+    {5, 19, 21, "Bluetooth Accessory", "\"Bluetooth Accessory\""}
+};
+const LookupTable lookupTableSEATALK_ALARM_GROUP = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesSEATALK_ALARM_GROUP};
+
+static const LookupEntry lookupEntriesSEATALK_ALARM_ID[] = {
+    {0, 8, 10, "No Alarm", "\"No Alarm\""},
+    {1, 13, 15, "Shallow Depth", "\"Shallow Depth\""},
+    {2, 10, 12, "Deep Depth", "\"Deep Depth\""},
+    {3, 14, 16, "Shallow Anchor", "\"Shallow Anchor\""},
+    {4, 11, 13, "Deep Anchor", "\"Deep Anchor\""},
+    {5, 10, 12, "Off Course", "\"Off Course\""},
+    {6, 8, 10, "AWA High", "\"AWA High\""},
+    {7, 7, 9, "AWA Low", "\"AWA Low\""},
+    {8, 8, 10, "AWS High", "\"AWS High\""},
+    {9, 7, 9, "AWS Low", "\"AWS Low\""},
+    {10, 8, 10, "TWA High", "\"TWA High\""},
+    {11, 7, 9, "TWA Low", "\"TWA Low\""},
+    {12, 8, 10, "TWS High", "\"TWS High\""},
+    {13, 7, 9, "TWS Low", "\"TWS Low\""},
+    {14, 10, 12, "WP Arrival", "\"WP Arrival\""},
+    {15, 15, 17, "Boat Speed High", "\"Boat Speed High\""},
+    {16, 14, 16, "Boat Speed Low", "\"Boat Speed Low\""},
+    {17, 20, 22, "Sea Temperature High", "\"Sea Temperature High\""},
+    {18, 19, 21, "Sea Temperature Low", "\"Sea Temperature Low\""},
+    {19, 11, 13, "Pilot Watch", "\"Pilot Watch\""},
+    {20, 16, 18, "Pilot Off Course", "\"Pilot Off Course\""},
+    {21, 16, 18, "Pilot Wind Shift", "\"Pilot Wind Shift\""},
+    {22, 17, 19, "Pilot Low Battery", "\"Pilot Low Battery\""},
+    {23, 26, 28, "Pilot Last Minute Of Watch", "\"Pilot Last Minute Of Watch\""},
+    {24, 18, 20, "Pilot No NMEA Data", "\"Pilot No NMEA Data\""},
+    {25, 15, 17, "Pilot Large XTE", "\"Pilot Large XTE\""},
+    {26, 20, 22, "Pilot NMEA DataError", "\"Pilot NMEA DataError\""},
+    {27, 21, 23, "Pilot CU Disconnected", "\"Pilot CU Disconnected\""},
+    {28, 18, 20, "Pilot Auto Release", "\"Pilot Auto Release\""},
+    {29, 23, 25, "Pilot Way Point Advance", "\"Pilot Way Point Advance\""},
+    {30, 19, 21, "Pilot Drive Stopped", "\"Pilot Drive Stopped\""},
+    {31, 22, 24, "Pilot Type Unspecified", "\"Pilot Type Unspecified\""},
+    {32, 26, 28, "Pilot Calibration Required", "\"Pilot Calibration Required\""},
+    {33, 18, 20, "Pilot Last Heading", "\"Pilot Last Heading\""},
+    {34, 14, 16, "Pilot No Pilot", "\"Pilot No Pilot\""},
+    {35, 20, 22, "Pilot Route Complete", "\"Pilot Route Complete\""},
+    {36, 19, 21, "Pilot Variable Text", "\"Pilot Variable Text\""},
+    {37, 11, 13, "GPS Failure", "\"GPS Failure\""},
+    {38, 3, 5, "MOB", "\"MOB\""},
+    {39, 15, 17, "Seatalk1 Anchor", "\"Seatalk1 Anchor\""},
+    {40, 25, 27, "Pilot Swapped Motor Power", "\"Pilot Swapped Motor Power\""},
+    {41, 30, 32, "Pilot Standby Too Fast To Fish", "\"Pilot Standby Too Fast To Fish\""},
+    {42, 16, 18, "Pilot No GPS Fix", "\"Pilot No GPS Fix\""},
+    {43, 16, 18, "Pilot No GPS COG", "\"Pilot No GPS COG\""},
+    {44, 14, 16, "Pilot Start Up", "\"Pilot Start Up\""},
+    {45, 14, 16, "Pilot Too Slow", "\"Pilot Too Slow\""},
+    {46, 16, 18, "Pilot No Compass", "\"Pilot No Compass\""},
+    {47, 21, 23, "Pilot Rate Gyro Fault", "\"Pilot Rate Gyro Fault\""},
+    {48, 19, 21, "Pilot Current Limit", "\"Pilot Current Limit\""},
+    {49, 28, 30, "Pilot Way Point Advance Port", "\"Pilot Way Point Advance Port\""},
+    {50, 28, 30, "Pilot Way Point Advance Stbd", "\"Pilot Way Point Advance Stbd\""},
+    {51, 18, 20, "Pilot No Wind Data", "\"Pilot No Wind Data\""},
+    {52, 19, 21, "Pilot No Speed Data", "\"Pilot No Speed Data\""},
+    {53, 19, 21, "Pilot Seatalk Fail1", "\"Pilot Seatalk Fail1\""},
+    {54, 19, 21, "Pilot Seatalk Fail2", "\"Pilot Seatalk Fail2\""},
+    {55, 30, 32, "Pilot Warning Too Fast To Fish", "\"Pilot Warning Too Fast To Fish\""},
+    {56, 24, 26, "Pilot Auto Dockside Fail", "\"Pilot Auto Dockside Fail\""},
+    {57, 19, 21, "Pilot Turn Too Fast", "\"Pilot Turn Too Fast\""},
+    {58, 17, 19, "Pilot No Nav Data", "\"Pilot No Nav Data\""},
+    {59, 24, 26, "Pilot Lost Waypoint Data", "\"Pilot Lost Waypoint Data\""},
+    {60, 20, 22, "Pilot EEPROM Corrupt", "\"Pilot EEPROM Corrupt\""},
+    {61, 26, 28, "Pilot Rudder Feedback Fail", "\"Pilot Rudder Feedback Fail\""},
+    {62, 21, 23, "Pilot Autolearn Fail1", "\"Pilot Autolearn Fail1\""},
+    {63, 21, 23, "Pilot Autolearn Fail2", "\"Pilot Autolearn Fail2\""},
+    {64, 21, 23, "Pilot Autolearn Fail3", "\"Pilot Autolearn Fail3\""},
+    {65, 21, 23, "Pilot Autolearn Fail4", "\"Pilot Autolearn Fail4\""},
+    {66, 21, 23, "Pilot Autolearn Fail5", "\"Pilot Autolearn Fail5\""},
+    {67, 21, 23, "Pilot Autolearn Fail6", "\"Pilot Autolearn Fail6\""},
+    {68, 26, 28, "Pilot Warning Cal Required", "\"Pilot Warning Cal Required\""},
+    {69, 23, 25, "Pilot Warning OffCourse", "\"Pilot Warning OffCourse\""},
+    {70, 17, 19, "Pilot Warning XTE", "\"Pilot Warning XTE\""},
+    {71, 24, 26, "Pilot Warning Wind Shift", "\"Pilot Warning Wind Shift\""},
+    {72, 25, 27, "Pilot Warning Drive Short", "\"Pilot Warning Drive Short\""},
+    {73, 26, 28, "Pilot Warning Clutch Short", "\"Pilot Warning Clutch Short\""},
+    {74, 28, 30, "Pilot Warning Solenoid Short", "\"Pilot Warning Solenoid Short\""},
+    {75, 20, 22, "Pilot Joystick Fault", "\"Pilot Joystick Fault\""},
+    {76, 22, 24, "Pilot No Joystick Data", "\"Pilot No Joystick Data\""},
+    {0},
+    {0},
+    {0},
+    {80, 21, 23, "Pilot Invalid Command", "\"Pilot Invalid Command\""},
+    {81, 18, 20, "AIS TX Malfunction", "\"AIS TX Malfunction\""},
+    {82, 22, 24, "AIS Antenna VSWR fault", "\"AIS Antenna VSWR fault\""},
+    {83, 28, 30, "AIS Rx channel 1 malfunction", "\"AIS Rx channel 1 malfunction\""},
+    {84, 28, 30, "AIS Rx channel 2 malfunction", "\"AIS Rx channel 2 malfunction\""},
+    {85, 29, 31, "AIS No sensor position in use", "\"AIS No sensor position in use\""},
+    {86, 28, 30, "AIS No valid SOG information", "\"AIS No valid SOG information\""},
+    {87, 28, 30, "AIS No valid COG information", "\"AIS No valid COG information\""},
+    {88, 13, 15, "AIS 12V alarm", "\"AIS 12V alarm\""},
+    {89, 12, 14, "AIS 6V alarm", "\"AIS 6V alarm\""},
+    {90, 38, 40, "AIS Noise threshold exceeded channel A", "\"AIS Noise threshold exceeded channel A\""},
+    {91, 38, 40, "AIS Noise threshold exceeded channel B", "\"AIS Noise threshold exceeded channel B\""},
+    {92, 24, 26, "AIS Transmitter PA fault", "\"AIS Transmitter PA fault\""},
+    {93, 13, 15, "AIS 3V3 alarm", "\"AIS 3V3 alarm\""},
+    {94, 29, 31, "AIS Rx channel 70 malfunction", "\"AIS Rx channel 70 malfunction\""},
+    {95, 24, 26, "AIS Heading lost/invalid", "\"AIS Heading lost/invalid\""},
+    {96, 21, 23, "AIS internal GPS lost", "\"AIS internal GPS lost\""},
+    {97, 22, 24, "AIS No sensor position", "\"AIS No sensor position\""},
+    {98, 16, 18, "AIS Lock failure", "\"AIS Lock failure\""},
+    {99, 24, 26, "AIS Internal GGA timeout", "\"AIS Internal GGA timeout\""},
+    {100, 26, 28, "AIS Protocol stack restart", "\"AIS Protocol stack restart\""},
+    {101, 27, 29, "Pilot No IPS communications", "\"Pilot No IPS communications\""},
+    {102, 50, 52, "Pilot Power-On or Sleep-Switch Reset While Engaged", "\"Pilot Power-On or Sleep-Switch Reset While Engaged\""},
+    {103, 36, 38, "Pilot Unexpected Reset While Engaged", "\"Pilot Unexpected Reset While Engaged\""},
+    {104, 20, 22, "AIS Dangerous Target", "\"AIS Dangerous Target\""},
+    {105, 15, 17, "AIS Lost Target", "\"AIS Lost Target\""},
+    {106, 44, 46, "AIS Safety Related Message (used to silence)", "\"AIS Safety Related Message (used to silence)\""},
+    {107, 19, 21, "AIS Connection Lost", "\"AIS Connection Lost\""},
+    {108, 6, 8, "No Fix", "\"No Fix\""},
+    {0},
+    {0},
+    {0},
+    {112, 34, 36, "Pilot Compass Calibration Complete", "\"Pilot Compass Calibration Complete\""},
+    {113, 40, 42, "AIS Transmitter Disabled - MMSI Required", "\"AIS Transmitter Disabled - MMSI Required\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {122, 28, 30, "Bluetooth Device Low Battery", "\"Bluetooth Device Low Battery\""},
+    {123, 27, 29, "Bluetooth Device Sleep Mode", "\"Bluetooth Device Sleep Mode\""},
+    {124, 41, 43, "Bluetooth Device High Battery Temperature", "\"Bluetooth Device High Battery Temperature\""},
+    {125, 36, 38, "Bluetooth Device Lost Communications", "\"Bluetooth Device Lost Communications\""}
+};
+const LookupTable lookupTableSEATALK_ALARM_ID = {.kind = LOOKUP_TABLE_DENSE, .count = 126, .entries = lookupEntriesSEATALK_ALARM_ID};
+
+static const LookupEntry lookupEntriesSEATALK_ALARM_STATUS[] = {
+    {0, 23, 25, "Alarm condition not met", "\"Alarm condition not met\""},
+    {1, 36, 38, "Alarm condition met and not silenced", "\"Alarm condition met and not silenced\""},
+    {2, 32, 34, "Alarm condition met and silenced", "\"Alarm condition met and silenced\""}
+};
+const LookupTable lookupTableSEATALK_ALARM_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSEATALK_ALARM_STATUS};
+
+static const LookupEntry lookupEntriesSEATALK_COMMAND[] = {
+    {0},
+    {0},
+    {2, 12, 14, "Rudder Limit", "\"Rudder Limit\""},
+    {3, 14, 16, "Rudder Damping", "\"Rudder Damping\""},
+    {4, 13, 15, "Rudder Offset", "\"Rudder Offset\""},
+    {0},
+    {6, 24, 26, "Reverse Rudder Reference", "\"Reverse Rudder Reference\""},
+    {0},
+    {8, 12, 14, "Cruise Speed", "\"Cruise Speed\""},
+    {0},
+    {0},
+    {11, 16, 18, "Power Steer Mode", "\"Power Steer Mode\""},
+    {12, 8, 10, "Settings", "\"Settings\""},
+    {0},
+    {0},
+    {15, 9, 11, "Wind Type", "\"Wind Type\""},
+    {0},
+    {17, 9, 11, "Auto Turn", "\"Auto Turn\""},
+    {18, 16, 18, "Calibration Lock", "\"Calibration Lock\""},
+    {0},
+    {20, 12, 14, "Gybe Inhibit", "\"Gybe Inhibit\""},
+    {21, 14, 16, "Compass Offset", "\"Compass Offset\""},
+    {22, 9, 11, "Hull Type", "\"Hull Type\""},
+    {23, 10, 12, "Drive Type", "\"Drive Type\""},
+    {0},
+    {25, 14, 16, "Response Level", "\"Response Level\""},
+    {26, 21, 23, "Max Compass Deviation", "\"Max Compass Deviation\""},
+    {27, 14, 16, "Hard Over Time", "\"Hard Over Time\""},
+    {0},
+    {29, 11, 13, "Debug Level", "\"Debug Level\""},
+    {0},
+    {0},
+    {0},
+    {33, 12, 14, "Compass Lock", "\"Compass Lock\""},
+    {34, 11, 13, "Speed Input", "\"Speed Input\""},
+    {35, 30, 32, "Compass Linearisation Progress", "\"Compass Linearisation Progress\""},
+    {36, 15, 17, "ACU Debug Level", "\"ACU Debug Level\""},
+    {37, 16, 18, "Wind Shift Alarm", "\"Wind Shift Alarm\""},
+    {38, 9, 11, "Auto Turn", "\"Auto Turn\""},
+    {39, 17, 19, "Auto Turn Timeout", "\"Auto Turn Timeout\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {129, 8, 10, "Seatalk1", "\"Seatalk1\""}
+};
+const LookupTable lookupTableSEATALK_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 130, .entries = lookupEntriesSEATALK_COMMAND};
+
+static const LookupEntry lookupEntriesSEATALK_DEVICE_ID[] = {
+    {0},
+    {0},
+    {0},
+    {3, 4, 6, "S100", "\"S100\""},
+    {0},
+    {5, 15, 17, "Course Computer", "\"Course Computer\""}
+};
+const LookupTable lookupTableSEATALK_DEVICE_ID = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesSEATALK_DEVICE_ID};
+
+static const LookupEntry lookupEntriesSEATALK_DISPLAY_COLOR[] = {
+    {0, 5, 7, "Day 1", "\"Day 1\""},
+    {0},
+    {2, 5, 7, "Day 2", "\"Day 2\""},
+    {3, 9, 11, "Red/Black", "\"Red/Black\""},
+    {4, 7, 9, "Inverse", "\"Inverse\""}
+};
+const LookupTable lookupTableSEATALK_DISPLAY_COLOR = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesSEATALK_DISPLAY_COLOR};
+
+static const LookupEntry lookupEntriesSEATALK_KEYSTROKE[] = {
+    {0},
+    {1, 4, 6, "Auto", "\"Auto\""},
+    {2, 7, 9, "Standby", "\"Standby\""},
+    {3, 4, 6, "Wind", "\"Wind\""},
+    {0},
+    {5, 2, 4, "-1", "\"-1\""},
+    {6, 3, 5, "-10", "\"-10\""},
+    {7, 2, 4, "+1", "\"+1\""},
+    {8, 3, 5, "+10", "\"+10\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {33, 10, 12, "-1 and -10", "\"-1 and -10\""},
+    {34, 10, 12, "+1 and +10", "\"+1 and +10\""},
+    {35, 5, 7, "Track", "\"Track\""}
+};
+const LookupTable lookupTableSEATALK_KEYSTROKE = {.kind = LOOKUP_TABLE_DENSE, .count = 36, .entries = lookupEntriesSEATALK_KEYSTROKE};
+
+static const LookupEntry lookupEntriesSEATALK_MESSAGE_ID[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {108, 19, 21, "Pilot Configuration", "\"Pilot Configuration\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {140, 7, 9, "Display", "\"Display\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {240, 17, 19, "Seatalk 1 Encoded", "\"Seatalk 1 Encoded\""}
+};
+const LookupTable lookupTableSEATALK_MESSAGE_ID = {.kind = LOOKUP_TABLE_DENSE, .count = 241, .entries = lookupEntriesSEATALK_MESSAGE_ID};
+
+static const LookupEntry lookupEntriesSEATALK_NETWORK_GROUP[] = {
+    {0, 4, 6, "None", "\"None\""},
+    {1, 6, 8, "Helm 1", "\"Helm 1\""},
+    {2, 6, 8, "Helm 2", "\"Helm 2\""},
+    {3, 7, 9, "Cockpit", "\"Cockpit\""},
+    {4, 9, 11, "Flybridge", "\"Flybridge\""},
+    {5, 4, 6, "Mast", "\"Mast\""},
+    {6, 7, 9, "Group 1", "\"Group 1\""},
+    {7, 7, 9, "Group 2", "\"Group 2\""},
+    {8, 7, 9, "Group 3", "\"Group 3\""},
+    {9, 7, 9, "Group 4", "\"Group 4\""},
+    {10, 7, 9, "Group 5", "\"Group 5\""}
+};
+const LookupTable lookupTableSEATALK_NETWORK_GROUP = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesSEATALK_NETWORK_GROUP};
+
+static const LookupEntry lookupEntriesSEATALK_PILOT_HULL_TYPE[] = {
+    {0, 4, 6, "Sail", "\"Sail\""},
+    {1, 16, 18, "Sail (slow turn)", "\"Sail (slow turn)\""},
+    {2, 14, 16, "Sail Catamaran", "\"Sail Catamaran\""},
+    {3, 17, 19, "Power (slow turn)", "\"Power (slow turn)\""},
+    {4, 17, 19, "Power (fast turn)", "\"Power (fast turn)\""},
+    {0},
+    {0},
+    {0},
+    {8, 5, 7, "Power", "\"Power\""}
+};
+const LookupTable lookupTableSEATALK_PILOT_HULL_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 9, .entries = lookupEntriesSEATALK_PILOT_HULL_TYPE};
+
+static const LookupEntry lookupEntriesSEATALK_PILOT_MODE[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {64, 7, 9, "Standby", "\"Standby\""},
+    {0},
+    {66, 4, 6, "Auto", "\"Auto\""},
+    {0},
+    {0},
+    {0},
+    {70, 4, 6, "Wind", "\"Wind\""},
+    {0},
+    {0},
+    {0},
+    {74, 5, 7, "Track", "\"Track\""}
+};
+const LookupTable lookupTableSEATALK_PILOT_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 75, .entries = lookupEntriesSEATALK_PILOT_MODE};
+
+static const LookupEntry lookupEntriesSEATALK_PILOT_MODE_16[] = {
+    {0, 7, 9, "Standby", "\"Standby\""},
+    {64, 23, 25, "Auto, compass commanded", "\"Auto, compass commanded\""},
+    {256, 15, 17, "Vane, Wind Mode", "\"Vane, Wind Mode\""},
+    {384, 10, 12, "Track Mode", "\"Track Mode\""},
+    {385, 51, 53, "No Drift, COG referenced (In track, course changes)", "\"No Drift, COG referenced (In track, course changes)\""}
+};
+const LookupTable lookupTableSEATALK_PILOT_MODE_16 = {.kind = LOOKUP_TABLE_SORTED, .count = 5, .entries = lookupEntriesSEATALK_PILOT_MODE_16};
+
+static const LookupEntry lookupEntriesSEATALK_SHARED[] = {
+    {0},
+    {1, 6, 8, "Shared", "\"Shared\""},
+    {2, 10, 12, "Not Shared", "\"Not Shared\""}
+};
+const LookupTable lookupTableSEATALK_SHARED = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSEATALK_SHARED};
+
+static const LookupEntry lookupEntriesSERIAL_BIT_RATE[] = {
+    {0, 2, 4, "25", "\"25\""},
+    {1, 2, 4, "50", "\"50\""},
+    {2, 3, 5, "100", "\"100\""},
+    {3, 3, 5, "200", "\"200\""},
+    {4, 3, 5, "300", "\"300\""},
+    {5, 3, 5, "600", "\"600\""},
+    {6, 4, 6, "1200", "\"1200\""},
+    {7, 4, 6, "2400", "\"2400\""},
+    {8, 4, 6, "4800", "\"4800\""},
+    {9, 4, 6, "9600", "\"9600\""},
+    {10, 5, 7, "19200", "\"19200\""},
+    {11, 5, 7, "38400", "\"38400\""},
+    {12, 5, 7, "57600", "\"57600\""}
+};
+const LookupTable lookupTableSERIAL_BIT_RATE = {.kind = LOOKUP_TABLE_DENSE, .count = 13, .entries = lookupEntriesSERIAL_BIT_RATE};
+
+static const LookupEntry lookupEntriesSERIAL_DETECTION_MODE[] = {
+    {0, 13, 15, "Auto bit rate", "\"Auto bit rate\""},
+    {1, 15, 17, "Manual bit rate", "\"Manual bit rate\""}
+};
+const LookupTable lookupTableSERIAL_DETECTION_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesSERIAL_DETECTION_MODE};
+
+static const LookupEntry lookupEntriesSHIP_TYPE[] = {
+    {0, 11, 13, "Unavailable", "\"Unavailable\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {20, 14, 16, "Wing In Ground", "\"Wing In Ground\""},
+    {21, 29, 31, "Wing In Ground (hazard cat X)", "\"Wing In Ground (hazard cat X)\""},
+    {22, 29, 31, "Wing In Ground (hazard cat Y)", "\"Wing In Ground (hazard cat Y)\""},
+    {23, 29, 31, "Wing In Ground (hazard cat Z)", "\"Wing In Ground (hazard cat Z)\""},
+    {24, 30, 32, "Wing In Ground (hazard cat OS)", "\"Wing In Ground (hazard cat OS)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {29, 42, 44, "Wing In Ground (no additional information)", "\"Wing In Ground (no additional information)\""},
+    {30, 7, 9, "Fishing", "\"Fishing\""},
+    {31, 6, 8, "Towing", "\"Towing\""},
+    {32, 37, 39, "Towing exceeds 200m or wider than 25m", "\"Towing exceeds 200m or wider than 25m\""},
+    {33, 44, 46, "Engaged in dredging or underwater operations", "\"Engaged in dredging or underwater operations\""},
+    {34, 28, 30, "Engaged in diving operations", "\"Engaged in diving operations\""},
+    {35, 30, 32, "Engaged in military operations", "\"Engaged in military operations\""},
+    {36, 7, 9, "Sailing", "\"Sailing\""},
+    {37, 8, 10, "Pleasure", "\"Pleasure\""},
+    {0},
+    {0},
+    {40, 16, 18, "High speed craft", "\"High speed craft\""},
+    {41, 31, 33, "High speed craft (hazard cat X)", "\"High speed craft (hazard cat X)\""},
+    {42, 31, 33, "High speed craft (hazard cat Y)", "\"High speed craft (hazard cat Y)\""},
+    {43, 31, 33, "High speed craft (hazard cat Z)", "\"High speed craft (hazard cat Z)\""},
+    {44, 32, 34, "High speed craft (hazard cat OS)", "\"High speed craft (hazard cat OS)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {49, 44, 46, "High speed craft (no additional information)", "\"High speed craft (no additional information)\""},
+    {50, 12, 14, "Pilot vessel", "\"Pilot vessel\""},
+    {51, 3, 5, "SAR", "\"SAR\""},
+    {52, 3, 5, "Tug", "\"Tug\""},
+    {53, 11, 13, "Port tender", "\"Port tender\""},
+    {54, 14, 16, "Anti-pollution", "\"Anti-pollution\""},
+    {55, 15, 17, "Law enforcement", "\"Law enforcement\""},
+    {56, 5, 7, "Spare", "\"Spare\""},
+    {57, 8, 10, "Spare #2", "\"Spare #2\""},
+    {58, 7, 9, "Medical", "\"Medical\""},
+    {59, 61, 63, "Ships and aircraft of States not parties to an armed conflict", "\"Ships and aircraft of States not parties to an armed conflict\""},
+    {60, 14, 16, "Passenger ship", "\"Passenger ship\""},
+    {61, 29, 31, "Passenger ship (hazard cat X)", "\"Passenger ship (hazard cat X)\""},
+    {62, 29, 31, "Passenger ship (hazard cat Y)", "\"Passenger ship (hazard cat Y)\""},
+    {63, 29, 31, "Passenger ship (hazard cat Z)", "\"Passenger ship (hazard cat Z)\""},
+    {64, 30, 32, "Passenger ship (hazard cat OS)", "\"Passenger ship (hazard cat OS)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {69, 42, 44, "Passenger ship (no additional information)", "\"Passenger ship (no additional information)\""},
+    {70, 10, 12, "Cargo ship", "\"Cargo ship\""},
+    {71, 25, 27, "Cargo ship (hazard cat X)", "\"Cargo ship (hazard cat X)\""},
+    {72, 25, 27, "Cargo ship (hazard cat Y)", "\"Cargo ship (hazard cat Y)\""},
+    {73, 25, 27, "Cargo ship (hazard cat Z)", "\"Cargo ship (hazard cat Z)\""},
+    {74, 26, 28, "Cargo ship (hazard cat OS)", "\"Cargo ship (hazard cat OS)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {79, 38, 40, "Cargo ship (no additional information)", "\"Cargo ship (no additional information)\""},
+    {80, 6, 8, "Tanker", "\"Tanker\""},
+    {81, 21, 23, "Tanker (hazard cat X)", "\"Tanker (hazard cat X)\""},
+    {82, 21, 23, "Tanker (hazard cat Y)", "\"Tanker (hazard cat Y)\""},
+    {83, 21, 23, "Tanker (hazard cat Z)", "\"Tanker (hazard cat Z)\""},
+    {84, 22, 24, "Tanker (hazard cat OS)", "\"Tanker (hazard cat OS)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {89, 34, 36, "Tanker (no additional information)", "\"Tanker (no additional information)\""},
+    {90, 5, 7, "Other", "\"Other\""},
+    {91, 20, 22, "Other (hazard cat X)", "\"Other (hazard cat X)\""},
+    {92, 20, 22, "Other (hazard cat Y)", "\"Other (hazard cat Y)\""},
+    {93, 20, 22, "Other (hazard cat Z)", "\"Other (hazard cat Z)\""},
+    {94, 21, 23, "Other (hazard cat OS)", "\"Other (hazard cat OS)\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {99, 33, 35, "Other (no additional information)", "\"Other (no additional information)\""}
+};
+const LookupTable lookupTableSHIP_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 100, .entries = lookupEntriesSHIP_TYPE};
+
+static const LookupEntry lookupEntriesSIMNET_ALARM_COMMAND[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {56, 10, 12, "Deactivate", "\"Deactivate\""},
+    {57, 8, 10, "Activate", "\"Activate\""},
+    {58, 11, 13, "Acknowledge", "\"Acknowledge\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {68, 7, 9, "Silence", "\"Silence\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {88, 17, 19, "Tack/Gybe Confirm", "\"Tack/Gybe Confirm\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {104, 13, 15, "Alarm History", "\"Alarm History\""},
+    {0},
+    {0},
+    {107, 13, 15, "MOB Activated", "\"MOB Activated\""},
+    {108, 13, 15, "MOB Cancelled", "\"MOB Cancelled\""}
+};
+const LookupTable lookupTableSIMNET_ALARM_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 109, .entries = lookupEntriesSIMNET_ALARM_COMMAND};
+
+static const LookupEntry lookupEntriesSIMNET_ALARM_ID[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {10, 13, 15, "Shallow water", "\"Shallow water\""},
+    {11, 10, 12, "Deep water", "\"Deep water\""},
+    {12, 12, 14, "Anchor depth", "\"Anchor depth\""},
+    {13, 15, 17, "True wind shift", "\"True wind shift\""},
+    {14, 14, 16, "True wind high", "\"True wind high\""},
+    {15, 13, 15, "True wind low", "\"True wind low\""},
+    {16, 14, 16, "Low boat speed", "\"Low boat speed\""},
+    {17, 12, 14, "High voltage", "\"High voltage\""},
+    {18, 11, 13, "Low voltage", "\"Low voltage\""},
+    {19, 18, 20, "Depth data missing", "\"Depth data missing\""},
+    {20, 17, 19, "Wind data missing", "\"Wind data missing\""},
+    {21, 16, 18, "Nav data missing", "\"Nav data missing\""},
+    {22, 15, 17, "Heading missing", "\"Heading missing\""},
+    {23, 3, 5, "XTE", "\"XTE\""},
+    {24, 19, 21, "Rudder data missing", "\"Rudder data missing\""},
+    {25, 23, 25, "Rudder controller fault", "\"Rudder controller fault\""},
+    {26, 18, 20, "No rudder response", "\"No rudder response\""},
+    {27, 21, 23, "Rudder drive overload", "\"Rudder drive overload\""},
+    {28, 25, 27, "High internal temperature", "\"High internal temperature\""},
+    {29, 18, 20, "AP clutch overload", "\"AP clutch overload\""},
+    {30, 20, 22, "AP clutch disengaged", "\"AP clutch disengaged\""},
+    {31, 17, 19, "High drive supply", "\"High drive supply\""},
+    {32, 16, 18, "Low drive supply", "\"Low drive supply\""},
+    {33, 32, 34, "No active autopilot control unit", "\"No active autopilot control unit\""},
+    {34, 21, 23, "No autopilot computer", "\"No autopilot computer\""},
+    {35, 11, 13, "Memory fail", "\"Memory fail\""},
+    {36, 18, 20, "Water temp missing", "\"Water temp missing\""},
+    {37, 14, 16, "Low water temp", "\"Low water temp\""},
+    {38, 15, 17, "High water temp", "\"High water temp\""},
+    {39, 15, 17, "Water temp rate", "\"Water temp rate\""},
+    {40, 4, 6, "Fish", "\"Fish\""},
+    {41, 10, 12, "No GPS fix", "\"No GPS fix\""},
+    {42, 9, 11, "WAAS/DGPS", "\"WAAS/DGPS\""},
+    {0},
+    {0},
+    {45, 7, 9, "Arrival", "\"Arrival\""},
+    {46, 6, 8, "Anchor", "\"Anchor\""},
+    {47, 8, 10, "Fuel low", "\"Fuel low\""},
+    {48, 9, 11, "Fuel high", "\"Fuel high\""},
+    {49, 8, 10, "Tank low", "\"Tank low\""},
+    {50, 9, 11, "Tank high", "\"Tank high\""},
+    {51, 3, 5, "BEP", "\"BEP\""},
+    {52, 15, 17, "Waypoint radius", "\"Waypoint radius\""},
+    {53, 3, 5, "CPA", "\"CPA\""},
+    {54, 19, 21, "AIS range to vessel", "\"AIS range to vessel\""},
+    {55, 15, 17, "AIS vessel lost", "\"AIS vessel lost\""},
+    {56, 14, 16, "Vessel message", "\"Vessel message\""},
+    {57, 9, 11, "Lightning", "\"Lightning\""},
+    {58, 14, 16, "Severe weather", "\"Severe weather\""},
+    {59, 5, 7, "Storm", "\"Storm\""},
+    {0},
+    {61, 12, 14, "Engine Check", "\"Engine Check\""},
+    {62, 23, 25, "Engine over temperature", "\"Engine over temperature\""},
+    {63, 23, 25, "Engine low oil pressure", "\"Engine low oil pressure\""},
+    {64, 20, 22, "Engine low oil level", "\"Engine low oil level\""},
+    {65, 24, 26, "Engine low fuel pressure", "\"Engine low fuel pressure\""},
+    {66, 18, 20, "Engine low voltage", "\"Engine low voltage\""},
+    {67, 24, 26, "Engine low coolant level", "\"Engine low coolant level\""},
+    {68, 17, 19, "Engine water flow", "\"Engine water flow\""},
+    {69, 20, 22, "Engine water in fuel", "\"Engine water in fuel\""},
+    {70, 13, 15, "Engine charge", "\"Engine charge\""},
+    {71, 14, 16, "Engine preheat", "\"Engine preheat\""},
+    {72, 26, 28, "Engine high boost pressure", "\"Engine high boost pressure\""},
+    {73, 16, 18, "Engine rev limit", "\"Engine rev limit\""},
+    {74, 17, 19, "Engine EGR system", "\"Engine EGR system\""},
+    {75, 24, 26, "Engine throttle position", "\"Engine throttle position\""},
+    {76, 21, 23, "Engine emergency stop", "\"Engine emergency stop\""},
+    {77, 22, 24, "Engine warning level 1", "\"Engine warning level 1\""},
+    {78, 22, 24, "Engine warning level 2", "\"Engine warning level 2\""},
+    {79, 22, 24, "Engine power reduction", "\"Engine power reduction\""},
+    {80, 18, 20, "Engine maintenance", "\"Engine maintenance\""},
+    {81, 17, 19, "Engine comm error", "\"Engine comm error\""},
+    {82, 15, 17, "Engine throttle", "\"Engine throttle\""},
+    {83, 20, 22, "Engine start protect", "\"Engine start protect\""},
+    {84, 20, 22, "Engine shutting down", "\"Engine shutting down\""},
+    {85, 18, 20, "Transmission Check", "\"Transmission Check\""},
+    {86, 29, 31, "Transmission over temperature", "\"Transmission over temperature\""},
+    {87, 29, 31, "Transmission low oil pressure", "\"Transmission low oil pressure\""},
+    {88, 26, 28, "Transmission low oil level", "\"Transmission low oil level\""},
+    {89, 10, 12, "Sail drive", "\"Sail drive\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {96, 15, 17, "Fresh water low", "\"Fresh water low\""},
+    {97, 16, 18, "Fresh water high", "\"Fresh water high\""},
+    {98, 14, 16, "Gray water low", "\"Gray water low\""},
+    {99, 15, 17, "Gray water high", "\"Gray water high\""},
+    {100, 13, 15, "Live well low", "\"Live well low\""},
+    {101, 14, 16, "Live well high", "\"Live well high\""},
+    {102, 7, 9, "Oil low", "\"Oil low\""},
+    {103, 8, 10, "Oil high", "\"Oil high\""},
+    {104, 15, 17, "Black water low", "\"Black water low\""},
+    {105, 16, 18, "Black water high", "\"Black water high\""},
+    {106, 20, 22, "Weather data missing", "\"Weather data missing\""},
+    {107, 24, 26, "AP Position data missing", "\"AP Position data missing\""},
+    {108, 21, 23, "AP Speed data missing", "\"AP Speed data missing\""},
+    {109, 21, 23, "AP Depth data missing", "\"AP Depth data missing\""},
+    {110, 23, 25, "AP Heading data missing", "\"AP Heading data missing\""},
+    {111, 19, 21, "AP Nav data missing", "\"AP Nav data missing\""},
+    {112, 13, 15, "AP Off course", "\"AP Off course\""},
+    {113, 22, 24, "AP Rudder data missing", "\"AP Rudder data missing\""},
+    {114, 20, 22, "AP Wind data missing", "\"AP Wind data missing\""},
+    {115, 16, 18, "Radar guard zone", "\"Radar guard zone\""},
+    {116, 17, 19, "MARPA target lost", "\"MARPA target lost\""},
+    {117, 17, 19, "MARPA unavailable", "\"MARPA unavailable\""},
+    {118, 16, 18, "Dangerous vessel", "\"Dangerous vessel\""},
+    {119, 11, 13, "Radar error", "\"Radar error\""},
+    {120, 14, 16, "CZone critical", "\"CZone critical\""},
+    {121, 15, 17, "CZone important", "\"CZone important\""},
+    {122, 14, 16, "CZone standard", "\"CZone standard\""},
+    {123, 13, 15, "CZone warning", "\"CZone warning\""},
+    {124, 15, 17, "True wind shift", "\"True wind shift\""},
+    {125, 13, 15, "EVC Com Error", "\"EVC Com Error\""},
+    {126, 12, 14, "EVC override", "\"EVC override\""},
+    {127, 22, 24, "High drive temperature", "\"High drive temperature\""},
+    {128, 13, 15, "Drive inhibit", "\"Drive inhibit\""},
+    {129, 23, 25, "CAN bus supply overload", "\"CAN bus supply overload\""},
+    {130, 25, 27, "Drive ref voltage missing", "\"Drive ref voltage missing\""},
+    {131, 12, 14, "Rudder limit", "\"Rudder limit\""},
+    {132, 18, 20, "Compass difference", "\"Compass difference\""},
+    {133, 17, 19, "AP Low boat speed", "\"AP Low boat speed\""},
+    {134, 23, 25, "Monitor compass missing", "\"Monitor compass missing\""},
+    {135, 26, 28, "Cross track distance limit", "\"Cross track distance limit\""},
+    {0},
+    {137, 12, 14, "End of route", "\"End of route\""},
+    {138, 17, 19, "Compass alignment", "\"Compass alignment\""},
+    {139, 7, 9, "R.A.I.M", "\"R.A.I.M\""},
+    {0},
+    {141, 11, 13, "Off heading", "\"Off heading\""},
+    {142, 14, 16, "Supply voltage", "\"Supply voltage\""},
+    {143, 19, 21, "Low CAN bus voltage", "\"Low CAN bus voltage\""},
+    {144, 15, 17, "CAN bus failure", "\"CAN bus failure\""},
+    {145, 19, 21, "Drive ready missing", "\"Drive ready missing\""},
+    {146, 22, 24, "Drive computer missing", "\"Drive computer missing\""},
+    {147, 21, 23, "External mode illegal", "\"External mode illegal\""},
+    {148, 15, 17, "Rudder too slow", "\"Rudder too slow\""},
+    {149, 10, 12, "Wheel over", "\"Wheel over\""},
+    {150, 18, 20, "Thruster inhibited", "\"Thruster inhibited\""},
+    {151, 13, 15, "Check heading", "\"Check heading\""},
+    {152, 20, 22, "True wind speed high", "\"True wind speed high\""},
+    {153, 8, 10, "Override", "\"Override\""},
+    {154, 37, 39, "Speed through water rationality fault", "\"Speed through water rationality fault\""},
+    {155, 19, 21, "No drives available", "\"No drives available\""},
+    {156, 18, 20, "Fuel remaining low", "\"Fuel remaining low\""},
+    {157, 19, 21, "Fuel remaining high", "\"Fuel remaining high\""},
+    {158, 15, 17, "Generator Check", "\"Generator Check\""},
+    {159, 26, 28, "Generator over temperature", "\"Generator over temperature\""},
+    {160, 26, 28, "Generator low oil pressure", "\"Generator low oil pressure\""},
+    {161, 23, 25, "Generator low oil level", "\"Generator low oil level\""},
+    {162, 27, 29, "Generator low fuel pressure", "\"Generator low fuel pressure\""},
+    {163, 21, 23, "Generator low voltage", "\"Generator low voltage\""},
+    {164, 27, 29, "Generator low coolant level", "\"Generator low coolant level\""},
+    {165, 20, 22, "Generator water flow", "\"Generator water flow\""},
+    {166, 23, 25, "Generator water in fuel", "\"Generator water in fuel\""},
+    {167, 16, 18, "Generator charge", "\"Generator charge\""},
+    {168, 17, 19, "Generator preheat", "\"Generator preheat\""},
+    {169, 29, 31, "Generator high boost pressure", "\"Generator high boost pressure\""},
+    {170, 19, 21, "Generator rev limit", "\"Generator rev limit\""},
+    {171, 20, 22, "Generator EGR system", "\"Generator EGR system\""},
+    {172, 27, 29, "Generator throttle position", "\"Generator throttle position\""},
+    {173, 24, 26, "Generator emergency stop", "\"Generator emergency stop\""},
+    {174, 25, 27, "Generator warning level 1", "\"Generator warning level 1\""},
+    {175, 25, 27, "Generator warning level 2", "\"Generator warning level 2\""},
+    {176, 25, 27, "Generator power reduction", "\"Generator power reduction\""},
+    {177, 21, 23, "Generator maintenance", "\"Generator maintenance\""},
+    {178, 20, 22, "Generator comm error", "\"Generator comm error\""},
+    {179, 18, 20, "Generator throttle", "\"Generator throttle\""},
+    {180, 23, 25, "Generator start protect", "\"Generator start protect\""},
+    {181, 23, 25, "Generator shutting down", "\"Generator shutting down\""},
+    {182, 17, 19, "Shallow aft depth", "\"Shallow aft depth\""},
+    {183, 13, 15, "Forward range", "\"Forward range\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {245, 20, 22, "Alarm source missing", "\"Alarm source missing\""},
+    {246, 8, 10, "External", "\"External\""},
+    {247, 13, 15, "EVC Com Error", "\"EVC Com Error\""},
+    {248, 23, 25, "Wind sensor battery low", "\"Wind sensor battery low\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {266, 12, 14, "Gasoline low", "\"Gasoline low\""},
+    {267, 13, 15, "Gasoline high", "\"Gasoline high\""},
+    {268, 15, 17, "Charging System", "\"Charging System\""},
+    {269, 13, 15, "Seawater Flow", "\"Seawater Flow\""},
+    {270, 19, 21, "Water in Drive Seal", "\"Water in Drive Seal\""},
+    {0},
+    {272, 8, 10, "Turnover", "\"Turnover\""},
+    {273, 23, 25, "Helm ECU Detect Failure", "\"Helm ECU Detect Failure\""},
+    {274, 27, 29, "Joystick ECU Detect Failure", "\"Joystick ECU Detect Failure\""},
+    {275, 24, 26, "Drive ECU Detect Failure", "\"Drive ECU Detect Failure\""},
+    {276, 16, 18, "Hot Transmission", "\"Hot Transmission\""},
+    {277, 21, 23, "Low Gear Oil Pressure", "\"Low Gear Oil Pressure\""},
+    {278, 23, 25, "Low Drive Lub Oil Level", "\"Low Drive Lub Oil Level\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {285, 16, 18, "Check Thermostat", "\"Check Thermostat\""},
+    {0},
+    {287, 19, 21, "Track offset active", "\"Track offset active\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {385, 24, 26, "Navigation Not Supported", "\"Navigation Not Supported\""}
+};
+const LookupTable lookupTableSIMNET_ALARM_ID = {.kind = LOOKUP_TABLE_DENSE, .count = 386, .entries = lookupEntriesSIMNET_ALARM_ID};
+
+static const LookupEntry lookupEntriesSIMNET_AP_EVENTS[] = {
+    {0},
+    {0},
+    {2, 17, 19, "Follow/Non Follow", "\"Follow/Non Follow\""},
+    {0},
+    {0},
+    {0},
+    {6, 7, 9, "Standby", "\"Standby\""},
+    {0},
+    {0},
+    {9, 12, 14, "Heading mode", "\"Heading mode\""},
+    {10, 8, 10, "Nav mode", "\"Nav mode\""},
+    {0},
+    {12, 13, 15, "No Drift mode", "\"No Drift mode\""},
+    {13, 18, 20, "Non Follow Up mode", "\"Non Follow Up mode\""},
+    {14, 14, 16, "Follow Up mode", "\"Follow Up mode\""},
+    {15, 9, 11, "Wind mode", "\"Wind mode\""},
+    {0},
+    {17, 4, 6, "Tack", "\"Tack\""},
+    {18, 13, 15, "Square (Turn)", "\"Square (Turn)\""},
+    {19, 6, 8, "C-Turn", "\"C-Turn\""},
+    {20, 6, 8, "U-Turn", "\"U-Turn\""},
+    {21, 13, 15, "Spiral (Turn)", "\"Spiral (Turn)\""},
+    {22, 14, 16, "Zig Zag (Turn)", "\"Zig Zag (Turn)\""},
+    {23, 13, 15, "Lazy-S (Turn)", "\"Lazy-S (Turn)\""},
+    {24, 12, 14, "Depth (Turn)", "\"Depth (Turn)\""},
+    {0},
+    {26, 13, 15, "Change course", "\"Change course\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {61, 10, 12, "Timer sync", "\"Timer sync\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {107, 13, 15, "MOB Activated", "\"MOB Activated\""},
+    {108, 15, 17, "MOB Deactivated", "\"MOB Deactivated\""},
+    {0},
+    {0},
+    {0},
+    {112, 13, 15, "Ping port end", "\"Ping port end\""},
+    {113, 18, 20, "Ping starboard end", "\"Ping starboard end\""}
+};
+const LookupTable lookupTableSIMNET_AP_EVENTS = {.kind = LOOKUP_TABLE_DENSE, .count = 114, .entries = lookupEntriesSIMNET_AP_EVENTS};
+
+static const LookupEntry lookupEntriesSIMNET_AP_MODE[] = {
+    {0},
+    {0},
+    {2, 7, 9, "Heading", "\"Heading\""},
+    {3, 4, 6, "Wind", "\"Wind\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {10, 3, 5, "Nav", "\"Nav\""},
+    {11, 8, 10, "No Drift", "\"No Drift\""}
+};
+const LookupTable lookupTableSIMNET_AP_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 12, .entries = lookupEntriesSIMNET_AP_MODE};
+
+static const LookupEntry lookupEntriesSIMNET_AP_STATUS[] = {
+    {0},
+    {0},
+    {2, 6, 8, "Manual", "\"Manual\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {16, 9, 11, "Automatic", "\"Automatic\""}
+};
+const LookupTable lookupTableSIMNET_AP_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 17, .entries = lookupEntriesSIMNET_AP_STATUS};
+
+static const LookupEntry lookupEntriesSIMNET_AUTOPILOT_MODE[] = {
+    {0, 7, 9, "Standby", "\"Standby\""},
+    {1, 7, 9, "Heading", "\"Heading\""},
+    {0},
+    {3, 6, 8, "Mode 4", "\"Mode 4\""},
+    {4, 4, 6, "Wind", "\"Wind\""},
+    {5, 13, 15, "Non-Follow-Up", "\"Non-Follow-Up\""},
+    {6, 10, 12, "Navigation", "\"Navigation\""}
+};
+const LookupTable lookupTableSIMNET_AUTOPILOT_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesSIMNET_AUTOPILOT_MODE};
+
+static const LookupEntry lookupEntriesSIMNET_AUTOPILOT_MODE_CLASS[] = {
+    {0, 7, 9, "Standby", "\"Standby\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {16, 7, 9, "Engaged", "\"Engaged\""}
+};
+const LookupTable lookupTableSIMNET_AUTOPILOT_MODE_CLASS = {.kind = LOOKUP_TABLE_DENSE, .count = 17, .entries = lookupEntriesSIMNET_AUTOPILOT_MODE_CLASS};
+
+static const LookupEntry lookupEntriesSIMNET_BACKLIGHT_LEVEL[] = {
+    {0, 9, 11, "10% (Min)", "\"10% (Min)\""},
+    {1, 8, 10, "Day mode", "\"Day mode\""},
+    {0},
+    {0},
+    {4, 10, 12, "Night mode", "\"Night mode\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {11, 3, 5, "20%", "\"20%\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {22, 3, 5, "30%", "\"30%\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {33, 3, 5, "40%", "\"40%\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {44, 3, 5, "50%", "\"50%\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {55, 3, 5, "60%", "\"60%\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {66, 3, 5, "70%", "\"70%\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {77, 3, 5, "80%", "\"80%\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {88, 3, 5, "90%", "\"90%\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {99, 10, 12, "100% (Max)", "\"100% (Max)\""}
+};
+const LookupTable lookupTableSIMNET_BACKLIGHT_LEVEL = {.kind = LOOKUP_TABLE_DENSE, .count = 100, .entries = lookupEntriesSIMNET_BACKLIGHT_LEVEL};
+
+static const LookupEntry lookupEntriesSIMNET_BARO_PRESSURE_UNIT[] = {
+    {0, 8, 10, "Millibar", "\"Millibar\""},
+    {0},
+    {2, 11, 13, "Hectopascal", "\"Hectopascal\""},
+    {0},
+    {0},
+    {5, 17, 19, "Inches of mercury", "\"Inches of mercury\""}
+};
+const LookupTable lookupTableSIMNET_BARO_PRESSURE_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesSIMNET_BARO_PRESSURE_UNIT};
+
+static const LookupEntry lookupEntriesSIMNET_COMMAND[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {50, 4, 6, "Text", "\"Text\""}
+};
+const LookupTable lookupTableSIMNET_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 51, .entries = lookupEntriesSIMNET_COMMAND};
+
+static const LookupEntry lookupEntriesSIMNET_COMPASS_AUTOCAL_MODE[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 2, 4, "On", "\"On\""},
+    {2, 11, 13, "Auto locked", "\"Auto locked\""},
+    {3, 4, 6, "Auto", "\"Auto\""}
+};
+const LookupTable lookupTableSIMNET_COMPASS_AUTOCAL_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesSIMNET_COMPASS_AUTOCAL_MODE};
+
+static const LookupEntry lookupEntriesSIMNET_DATA_SOURCE[] = {
+    {0, 7, 9, "Heading", "\"Heading\""},
+    {1, 10, 12, "Navigation", "\"Navigation\""},
+    {2, 8, 10, "Position", "\"Position\""},
+    {3, 13, 15, "Apparent Wind", "\"Apparent Wind\""},
+    {4, 9, 11, "True Wind", "\"True Wind\""},
+    {5, 19, 21, "Speed Through Water", "\"Speed Through Water\""},
+    {6, 15, 17, "Sea Temperature", "\"Sea Temperature\""},
+    {7, 12, 14, "Distance Log", "\"Distance Log\""},
+    {8, 5, 7, "Depth", "\"Depth\""},
+    {9, 15, 17, "Rudder Feedback", "\"Rudder Feedback\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {19, 15, 17, "Monitor Compass", "\"Monitor Compass\""},
+    {20, 15, 17, "Position Backup", "\"Position Backup\""},
+    {21, 17, 19, "Boat Speed Backup", "\"Boat Speed Backup\""},
+    {22, 15, 17, "Air Temperature", "\"Air Temperature\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {28, 19, 21, "Barometric Pressure", "\"Barometric Pressure\""},
+    {0},
+    {30, 10, 12, "Heel Angle", "\"Heel Angle\""},
+    {0},
+    {0},
+    {0},
+    {34, 18, 20, "Sailing Navigation", "\"Sailing Navigation\""},
+    {35, 10, 12, "Trim Angle", "\"Trim Angle\""},
+    {36, 7, 9, "Sailing", "\"Sailing\""},
+    {37, 9, 11, "Aft Depth", "\"Aft Depth\""},
+    {38, 9, 11, "Speed Log", "\"Speed Log\""},
+    {39, 11, 13, "RTCM Signal", "\"RTCM Signal\""},
+    {40, 16, 18, "RTCM Corrections", "\"RTCM Corrections\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {54, 9, 11, "Autopilot", "\"Autopilot\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {59, 25, 27, "Autopilot Function Backup", "\"Autopilot Function Backup\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {104, 17, 19, "Autopilot Control", "\"Autopilot Control\""}
+};
+const LookupTable lookupTableSIMNET_DATA_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 105, .entries = lookupEntriesSIMNET_DATA_SOURCE};
+
+static const LookupEntry lookupEntriesSIMNET_DEPTH_UNIT[] = {
+    {0, 6, 8, "Meters", "\"Meters\""},
+    {1, 4, 6, "Feet", "\"Feet\""},
+    {2, 7, 9, "Fathoms", "\"Fathoms\""}
+};
+const LookupTable lookupTableSIMNET_DEPTH_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSIMNET_DEPTH_UNIT};
+
+static const LookupEntry lookupEntriesSIMNET_DEVICE_MODEL[] = {
+    {0, 2, 4, "AC", "\"AC\""},
+    {1, 12, 14, "Other device", "\"Other device\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {100, 3, 5, "NAC", "\"NAC\""}
+};
+const LookupTable lookupTableSIMNET_DEVICE_MODEL = {.kind = LOOKUP_TABLE_DENSE, .count = 101, .entries = lookupEntriesSIMNET_DEVICE_MODEL};
+
+static const LookupEntry lookupEntriesSIMNET_DEVICE_REPORT[] = {
+    {0},
+    {0},
+    {2, 6, 8, "Status", "\"Status\""},
+    {3, 11, 13, "Send Status", "\"Send Status\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {10, 4, 6, "Mode", "\"Mode\""},
+    {11, 9, 11, "Send Mode", "\"Send Mode\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {23, 24, 26, "Sailing Processor Status", "\"Sailing Processor Status\""}
+};
+const LookupTable lookupTableSIMNET_DEVICE_REPORT = {.kind = LOOKUP_TABLE_DENSE, .count = 24, .entries = lookupEntriesSIMNET_DEVICE_REPORT};
+
+static const LookupEntry lookupEntriesSIMNET_DIRECTION[] = {
+    {0},
+    {0},
+    {2, 4, 6, "Port", "\"Port\""},
+    {3, 9, 11, "Starboard", "\"Starboard\""},
+    {4, 18, 20, "Left rudder (port)", "\"Left rudder (port)\""},
+    {5, 24, 26, "Right rudder (starboard)", "\"Right rudder (starboard)\""}
+};
+const LookupTable lookupTableSIMNET_DIRECTION = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesSIMNET_DIRECTION};
+
+static const LookupEntry lookupEntriesSIMNET_DISTANCE_SMALL_UNIT[] = {
+    {0, 4, 6, "Feet", "\"Feet\""},
+    {1, 6, 8, "Meters", "\"Meters\""},
+    {2, 5, 7, "Yards", "\"Yards\""}
+};
+const LookupTable lookupTableSIMNET_DISTANCE_SMALL_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSIMNET_DISTANCE_SMALL_UNIT};
+
+static const LookupEntry lookupEntriesSIMNET_DISTANCE_UNIT[] = {
+    {0, 14, 16, "Nautical miles", "\"Nautical miles\""},
+    {1, 10, 12, "Kilometers", "\"Kilometers\""},
+    {2, 5, 7, "Miles", "\"Miles\""}
+};
+const LookupTable lookupTableSIMNET_DISTANCE_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSIMNET_DISTANCE_UNIT};
+
+static const LookupEntry lookupEntriesSIMNET_EVENT_TYPE[] = {
+    {0},
+    {0},
+    {2, 9, 11, "Follow Up", "\"Follow Up\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {10, 10, 12, "AP Command", "\"AP Command\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {23, 5, 7, "Timer", "\"Timer\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {31, 5, 7, "Siren", "\"Siren\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {36, 19, 21, "AIS vessel selected", "\"AIS vessel selected\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {255, 5, 7, "Alarm", "\"Alarm\""}
+};
+const LookupTable lookupTableSIMNET_EVENT_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 256, .entries = lookupEntriesSIMNET_EVENT_TYPE};
+
+static const LookupEntry lookupEntriesSIMNET_HEADING_UNIT[] = {
+    {0, 8, 10, "Magnetic", "\"Magnetic\""},
+    {1, 4, 6, "True", "\"True\""}
+};
+const LookupTable lookupTableSIMNET_HEADING_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesSIMNET_HEADING_UNIT};
+
+static const LookupEntry lookupEntriesSIMNET_HOUR_DISPLAY[] = {
+    {0, 7, 9, "24 hour", "\"24 hour\""},
+    {1, 7, 9, "12 hour", "\"12 hour\""}
+};
+const LookupTable lookupTableSIMNET_HOUR_DISPLAY = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesSIMNET_HOUR_DISPLAY};
+
+static const LookupEntry lookupEntriesSIMNET_KEY_OPERATION[] = {
+    {0, 4, 6, "Read", "\"Read\""},
+    {1, 3, 5, "Set", "\"Set\""},
+    {2, 5, 7, "Reply", "\"Reply\""}
+};
+const LookupTable lookupTableSIMNET_KEY_OPERATION = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSIMNET_KEY_OPERATION};
+
+static const LookupEntry lookupEntriesSIMNET_NETWORK_GROUP[] = {
+    {0, 4, 6, "None", "\"None\""},
+    {1, 7, 9, "Default", "\"Default\""},
+    {2, 7, 9, "Group 1", "\"Group 1\""},
+    {3, 7, 9, "Group 2", "\"Group 2\""},
+    {4, 7, 9, "Group 3", "\"Group 3\""},
+    {5, 7, 9, "Group 4", "\"Group 4\""},
+    {6, 7, 9, "Group 5", "\"Group 5\""},
+    {7, 7, 9, "Group 6", "\"Group 6\""}
+};
+const LookupTable lookupTableSIMNET_NETWORK_GROUP = {.kind = LOOKUP_TABLE_DENSE, .count = 8, .entries = lookupEntriesSIMNET_NETWORK_GROUP};
+
+static const LookupEntry lookupEntriesSIMNET_NIGHT_MODE[] = {
+    {0},
+    {0},
+    {2, 3, 5, "Day", "\"Day\""},
+    {0},
+    {4, 5, 7, "Night", "\"Night\""}
+};
+const LookupTable lookupTableSIMNET_NIGHT_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesSIMNET_NIGHT_MODE};
+
+static const LookupEntry lookupEntriesSIMNET_NIGHT_MODE_COLOR[] = {
+    {0, 3, 5, "Red", "\"Red\""},
+    {1, 5, 7, "Green", "\"Green\""},
+    {2, 4, 6, "Blue", "\"Blue\""},
+    {3, 5, 7, "White", "\"White\""},
+    {4, 7, 9, "Magenta", "\"Magenta\""}
+};
+const LookupTable lookupTableSIMNET_NIGHT_MODE_COLOR = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesSIMNET_NIGHT_MODE_COLOR};
+
+static const LookupEntry lookupEntriesSIMNET_PRESSURE_UNIT[] = {
+    {0},
+    {1, 3, 5, "PSI", "\"PSI\""},
+    {0},
+    {3, 10, 12, "Kilopascal", "\"Kilopascal\""},
+    {0},
+    {5, 17, 19, "Inches of mercury", "\"Inches of mercury\""},
+    {6, 3, 5, "Bar", "\"Bar\""}
+};
+const LookupTable lookupTableSIMNET_PRESSURE_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesSIMNET_PRESSURE_UNIT};
+
+static const LookupEntry lookupEntriesSIMNET_SPEED_UNIT[] = {
+    {0, 5, 7, "Knots", "\"Knots\""},
+    {1, 19, 21, "Kilometers per hour", "\"Kilometers per hour\""},
+    {2, 14, 16, "Miles per hour", "\"Miles per hour\""}
+};
+const LookupTable lookupTableSIMNET_SPEED_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSIMNET_SPEED_UNIT};
+
+static const LookupEntry lookupEntriesSIMNET_TEMPERATURE_UNIT[] = {
+    {0, 7, 9, "Celsius", "\"Celsius\""},
+    {1, 10, 12, "Fahrenheit", "\"Fahrenheit\""}
+};
+const LookupTable lookupTableSIMNET_TEMPERATURE_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesSIMNET_TEMPERATURE_UNIT};
+
+static const LookupEntry lookupEntriesSIMNET_TIMER_EVENT[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {61, 16, 18, "Race Timer Start", "\"Race Timer Start\""},
+    {62, 15, 17, "Race Timer Stop", "\"Race Timer Stop\""},
+    {63, 15, 17, "Race Timer Sync", "\"Race Timer Sync\""},
+    {64, 16, 18, "Race Timer Reset", "\"Race Timer Reset\""},
+    {65, 20, 22, "Trip Timer Reset All", "\"Trip Timer Reset All\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {100, 17, 19, "Trip Timer Enable", "\"Trip Timer Enable\""},
+    {101, 18, 20, "Trip Timer Disable", "\"Trip Timer Disable\""}
+};
+const LookupTable lookupTableSIMNET_TIMER_EVENT = {.kind = LOOKUP_TABLE_DENSE, .count = 102, .entries = lookupEntriesSIMNET_TIMER_EVENT};
+
+static const LookupEntry lookupEntriesSIMNET_TIME_FORMAT[] = {
+    {0},
+    {1, 10, 12, "MM/dd/yyyy", "\"MM/dd/yyyy\""},
+    {2, 10, 12, "dd/MM/yyyy", "\"dd/MM/yyyy\""}
+};
+const LookupTable lookupTableSIMNET_TIME_FORMAT = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSIMNET_TIME_FORMAT};
+
+static const LookupEntry lookupEntriesSIMNET_VOLUME_UNIT[] = {
+    {0, 6, 8, "Liters", "\"Liters\""},
+    {1, 7, 9, "Gallons", "\"Gallons\""}
+};
+const LookupTable lookupTableSIMNET_VOLUME_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesSIMNET_VOLUME_UNIT};
+
+static const LookupEntry lookupEntriesSIMNET_WIND_SPEED_UNIT[] = {
+    {0, 5, 7, "Knots", "\"Knots\""},
+    {1, 17, 19, "Meters per second", "\"Meters per second\""},
+    {2, 14, 16, "Miles per hour", "\"Miles per hour\""},
+    {3, 19, 21, "Kilometers per hour", "\"Kilometers per hour\""}
+};
+const LookupTable lookupTableSIMNET_WIND_SPEED_UNIT = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesSIMNET_WIND_SPEED_UNIT};
+
+static const LookupEntry lookupEntriesSLEIPNER_THRUSTER_ACTION[] = {
+    {0},
+    {1, 6, 8, "Active", "\"Active\""},
+    {2, 7, 9, "Standby", "\"Standby\""}
+};
+const LookupTable lookupTableSLEIPNER_THRUSTER_ACTION = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSLEIPNER_THRUSTER_ACTION};
+
+static const LookupEntry lookupEntriesSLEIPNER_THRUSTER_DIRECTION[] = {
+    {0, 4, 6, "None", "\"None\""},
+    {1, 11, 13, "Direction 1", "\"Direction 1\""},
+    {2, 11, 13, "Direction 2", "\"Direction 2\""}
+};
+const LookupTable lookupTableSLEIPNER_THRUSTER_DIRECTION = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSLEIPNER_THRUSTER_DIRECTION};
+
+static const LookupEntry lookupEntriesSLEIPNER_THRUSTER_STATE[] = {
+    {0, 20, 22, "Stowing or deploying", "\"Stowing or deploying\""},
+    {1, 3, 5, "Off", "\"Off\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {10, 5, 7, "Ready", "\"Ready\""},
+    {11, 9, 11, "Thrusting", "\"Thrusting\""}
+};
+const LookupTable lookupTableSLEIPNER_THRUSTER_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 12, .entries = lookupEntriesSLEIPNER_THRUSTER_STATE};
+
+static const LookupEntry lookupEntriesSONICHUB_COMMAND[] = {
+    {0},
+    {1, 7, 9, "Init #2", "\"Init #2\""},
+    {0},
+    {0},
+    {4, 8, 10, "AM Radio", "\"AM Radio\""},
+    {5, 9, 11, "Zone Info", "\"Zone Info\""},
+    {6, 6, 8, "Source", "\"Source\""},
+    {0},
+    {8, 11, 13, "Source List", "\"Source List\""},
+    {9, 7, 9, "Control", "\"Control\""},
+    {0},
+    {0},
+    {12, 8, 10, "FM Radio", "\"FM Radio\""},
+    {13, 8, 10, "Playlist", "\"Playlist\""},
+    {14, 5, 7, "Track", "\"Track\""},
+    {15, 6, 8, "Artist", "\"Artist\""},
+    {16, 5, 7, "Album", "\"Album\""},
+    {0},
+    {0},
+    {19, 9, 11, "Menu Item", "\"Menu Item\""},
+    {20, 5, 7, "Zones", "\"Zones\""},
+    {0},
+    {0},
+    {23, 10, 12, "Max Volume", "\"Max Volume\""},
+    {24, 6, 8, "Volume", "\"Volume\""},
+    {25, 7, 9, "Init #1", "\"Init #1\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {48, 8, 10, "Position", "\"Position\""},
+    {0},
+    {50, 7, 9, "Init #3", "\"Init #3\""}
+};
+const LookupTable lookupTableSONICHUB_COMMAND = {.kind = LOOKUP_TABLE_DENSE, .count = 51, .entries = lookupEntriesSONICHUB_COMMAND};
+
+static const LookupEntry lookupEntriesSONICHUB_CONTROL[] = {
+    {0, 3, 5, "Set", "\"Set\""},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {128, 3, 5, "Ack", "\"Ack\""}
+};
+const LookupTable lookupTableSONICHUB_CONTROL = {.kind = LOOKUP_TABLE_DENSE, .count = 129, .entries = lookupEntriesSONICHUB_CONTROL};
+
+static const LookupEntry lookupEntriesSONICHUB_PLAYLIST[] = {
+    {0},
+    {1, 6, 8, "Report", "\"Report\""},
+    {0},
+    {0},
+    {4, 9, 11, "Next song", "\"Next song\""},
+    {0},
+    {6, 13, 15, "Previous song", "\"Previous song\""}
+};
+const LookupTable lookupTableSONICHUB_PLAYLIST = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesSONICHUB_PLAYLIST};
+
+static const LookupEntry lookupEntriesSONICHUB_SOURCE[] = {
+    {0, 2, 4, "AM", "\"AM\""},
+    {1, 2, 4, "FM", "\"FM\""},
+    {2, 4, 6, "iPod", "\"iPod\""},
+    {3, 3, 5, "USB", "\"USB\""},
+    {4, 3, 5, "AUX", "\"AUX\""},
+    {5, 5, 7, "AUX 2", "\"AUX 2\""},
+    {6, 3, 5, "Mic", "\"Mic\""}
+};
+const LookupTable lookupTableSONICHUB_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesSONICHUB_SOURCE};
+
+static const LookupEntry lookupEntriesSONICHUB_TUNING[] = {
+    {0},
+    {1, 10, 12, "Seeking up", "\"Seeking up\""},
+    {2, 5, 7, "Tuned", "\"Tuned\""},
+    {3, 12, 14, "Seeking down", "\"Seeking down\""}
+};
+const LookupTable lookupTableSONICHUB_TUNING = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesSONICHUB_TUNING};
+
+static const LookupEntry lookupEntriesSPEED_TYPE[] = {
+    {0, 12, 14, "Single speed", "\"Single speed\""},
+    {1, 10, 12, "Dual speed", "\"Dual speed\""},
+    {2, 18, 20, "Proportional speed", "\"Proportional speed\""}
+};
+const LookupTable lookupTableSPEED_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesSPEED_TYPE};
+
+static const LookupEntry lookupEntriesSTATION_HEALTH[] = {
+    {0, 11, 13, "Not Working", "\"Not Working\""},
+    {1, 11, 13, "Unmonitored", "\"Unmonitored\""},
+    {2, 19, 21, "Healthy Operational", "\"Healthy Operational\""},
+    {3, 17, 19, "Healthy Test Mode", "\"Healthy Test Mode\""},
+    {4, 9, 11, "Test Mode", "\"Test Mode\""}
+};
+const LookupTable lookupTableSTATION_HEALTH = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesSTATION_HEALTH};
+
+static const LookupEntry lookupEntriesSTATION_TYPE[] = {
+    {0, 27, 29, "All types of mobile station", "\"All types of mobile station\""},
+    {0},
+    {2, 35, 37, "All types of Class B mobile station", "\"All types of Class B mobile station\""},
+    {3, 27, 29, "SAR airborne mobile station", "\"SAR airborne mobile station\""},
+    {4, 12, 14, "AtoN station", "\"AtoN station\""},
+    {5, 35, 37, "Class B CS shipborne mobile station", "\"Class B CS shipborne mobile station\""},
+    {6, 16, 18, "Inland waterways", "\"Inland waterways\""},
+    {7, 14, 16, "Regional use 7", "\"Regional use 7\""},
+    {8, 14, 16, "Regional use 8", "\"Regional use 8\""},
+    {9, 14, 16, "Regional use 9", "\"Regional use 9\""}
+};
+const LookupTable lookupTableSTATION_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 10, .entries = lookupEntriesSTATION_TYPE};
+
+static const LookupEntry lookupEntriesSTEERING_MODE[] = {
+    {0, 13, 15, "Main Steering", "\"Main Steering\""},
+    {1, 20, 22, "Non-Follow-Up Device", "\"Non-Follow-Up Device\""},
+    {2, 16, 18, "Follow-Up Device", "\"Follow-Up Device\""},
+    {3, 26, 28, "Heading Control Standalone", "\"Heading Control Standalone\""},
+    {4, 15, 17, "Heading Control", "\"Heading Control\""},
+    {5, 13, 15, "Track Control", "\"Track Control\""}
+};
+const LookupTable lookupTableSTEERING_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesSTEERING_MODE};
+
+static const LookupEntry lookupEntriesSYSTEM_TIME[] = {
+    {0, 3, 5, "GPS", "\"GPS\""},
+    {1, 7, 9, "GLONASS", "\"GLONASS\""},
+    {2, 13, 15, "Radio Station", "\"Radio Station\""},
+    {3, 18, 20, "Local Cesium clock", "\"Local Cesium clock\""},
+    {4, 20, 22, "Local Rubidium clock", "\"Local Rubidium clock\""},
+    {5, 19, 21, "Local Crystal clock", "\"Local Crystal clock\""}
+};
+const LookupTable lookupTableSYSTEM_TIME = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesSYSTEM_TIME};
+
+static const LookupEntry lookupEntriesTANK_TYPE[] = {
+    {0, 4, 6, "Fuel", "\"Fuel\""},
+    {1, 5, 7, "Water", "\"Water\""},
+    {2, 10, 12, "Gray water", "\"Gray water\""},
+    {3, 9, 11, "Live well", "\"Live well\""},
+    {4, 3, 5, "Oil", "\"Oil\""},
+    {5, 11, 13, "Black water", "\"Black water\""}
+};
+const LookupTable lookupTableTANK_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesTANK_TYPE};
+
+static const LookupEntry lookupEntriesTARGET_ACQUISITION[] = {
+    {0, 6, 8, "Manual", "\"Manual\""},
+    {1, 9, 11, "Automatic", "\"Automatic\""}
+};
+const LookupTable lookupTableTARGET_ACQUISITION = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesTARGET_ACQUISITION};
+
+static const LookupEntry lookupEntriesTELEPHONE_MODE[] = {
+    {0, 26, 28, "F3E/G3E simplex, telephone", "\"F3E/G3E simplex, telephone\""},
+    {1, 25, 27, "F3E/G3E duplex, telephone", "\"F3E/G3E duplex, telephone\""},
+    {2, 14, 16, "J3E, telephone", "\"J3E, telephone\""},
+    {3, 14, 16, "H3E, telephone", "\"H3E, telephone\""},
+    {4, 35, 37, "F1B/J2B FEC NBDP, telex/teleprinter", "\"F1B/J2B FEC NBDP, telex/teleprinter\""},
+    {5, 35, 37, "F1B/J2B ARQ NBDP, telex/teleprinter", "\"F1B/J2B ARQ NBDP, telex/teleprinter\""},
+    {6, 37, 39, "F1B/J2B receive only, teleprinter/DSC", "\"F1B/J2B receive only, teleprinter/DSC\""},
+    {7, 24, 26, "F1B/J2B, teleprinter/DSC", "\"F1B/J2B, teleprinter/DSC\""},
+    {8, 24, 26, "A1A Morse, tape recorder", "\"A1A Morse, tape recorder\""},
+    {9, 29, 31, "A1A Morse, Morse key/head set", "\"A1A Morse, Morse key/head set\""},
+    {10, 24, 26, "F1C/F2C/F3C, FAX machine", "\"F1C/F2C/F3C, FAX machine\""}
+};
+const LookupTable lookupTableTELEPHONE_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesTELEPHONE_MODE};
+
+static const LookupEntry lookupEntriesTEMPERATURE_SOURCE[] = {
+    {0, 15, 17, "Sea Temperature", "\"Sea Temperature\""},
+    {1, 19, 21, "Outside Temperature", "\"Outside Temperature\""},
+    {2, 18, 20, "Inside Temperature", "\"Inside Temperature\""},
+    {3, 23, 25, "Engine Room Temperature", "\"Engine Room Temperature\""},
+    {4, 22, 24, "Main Cabin Temperature", "\"Main Cabin Temperature\""},
+    {5, 21, 23, "Live Well Temperature", "\"Live Well Temperature\""},
+    {6, 21, 23, "Bait Well Temperature", "\"Bait Well Temperature\""},
+    {7, 25, 27, "Refrigeration Temperature", "\"Refrigeration Temperature\""},
+    {8, 26, 28, "Heating System Temperature", "\"Heating System Temperature\""},
+    {9, 21, 23, "Dew Point Temperature", "\"Dew Point Temperature\""},
+    {10, 31, 33, "Apparent Wind Chill Temperature", "\"Apparent Wind Chill Temperature\""},
+    {11, 34, 36, "Theoretical Wind Chill Temperature", "\"Theoretical Wind Chill Temperature\""},
+    {12, 22, 24, "Heat Index Temperature", "\"Heat Index Temperature\""},
+    {13, 19, 21, "Freezer Temperature", "\"Freezer Temperature\""},
+    {14, 23, 25, "Exhaust Gas Temperature", "\"Exhaust Gas Temperature\""},
+    {15, 22, 24, "Shaft Seal Temperature", "\"Shaft Seal Temperature\""}
+};
+const LookupTable lookupTableTEMPERATURE_SOURCE = {.kind = LOOKUP_TABLE_DENSE, .count = 16, .entries = lookupEntriesTEMPERATURE_SOURCE};
+
+static const LookupEntry lookupEntriesTHRUSTER_DIRECTION_CONTROL[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 5, 7, "Ready", "\"Ready\""},
+    {2, 7, 9, "To Port", "\"To Port\""},
+    {3, 12, 14, "To Starboard", "\"To Starboard\""}
+};
+const LookupTable lookupTableTHRUSTER_DIRECTION_CONTROL = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesTHRUSTER_DIRECTION_CONTROL};
+
+static const LookupEntry lookupEntriesTHRUSTER_MOTOR_TYPE[] = {
+    {0, 5, 7, "12VDC", "\"12VDC\""},
+    {1, 5, 7, "24VDC", "\"24VDC\""},
+    {2, 5, 7, "48VDC", "\"48VDC\""},
+    {3, 5, 7, "24VAC", "\"24VAC\""},
+    {4, 9, 11, "Hydraulic", "\"Hydraulic\""}
+};
+const LookupTable lookupTableTHRUSTER_MOTOR_TYPE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesTHRUSTER_MOTOR_TYPE};
+
+static const LookupEntry lookupEntriesTHRUSTER_RETRACT_CONTROL[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 6, 8, "Extend", "\"Extend\""},
+    {2, 7, 9, "Retract", "\"Retract\""}
+};
+const LookupTable lookupTableTHRUSTER_RETRACT_CONTROL = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesTHRUSTER_RETRACT_CONTROL};
+
+static const LookupEntry lookupEntriesTIDE[] = {
+    {0, 7, 9, "Falling", "\"Falling\""},
+    {1, 6, 8, "Rising", "\"Rising\""}
+};
+const LookupTable lookupTableTIDE = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesTIDE};
+
+static const LookupEntry lookupEntriesTIME_STAMP[] = {
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {60, 13, 15, "Not available", "\"Not available\""},
+    {61, 17, 19, "Manual input mode", "\"Manual input mode\""},
+    {62, 19, 21, "Dead reckoning mode", "\"Dead reckoning mode\""},
+    {63, 33, 35, "Positioning system is inoperative", "\"Positioning system is inoperative\""}
+};
+const LookupTable lookupTableTIME_STAMP = {.kind = LOOKUP_TABLE_DENSE, .count = 64, .entries = lookupEntriesTIME_STAMP};
+
+static const LookupEntry lookupEntriesTRACKING[] = {
+    {0, 9, 11, "Cancelled", "\"Cancelled\""},
+    {1, 9, 11, "Acquiring", "\"Acquiring\""},
+    {2, 8, 10, "Tracking", "\"Tracking\""},
+    {3, 4, 6, "Lost", "\"Lost\""}
+};
+const LookupTable lookupTableTRACKING = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesTRACKING};
+
+static const LookupEntry lookupEntriesTRANSMISSION_INTERVAL[] = {
+    {0, 11, 13, "Acknowledge", "\"Acknowledge\""},
+    {1, 40, 42, "Transmit Interval/Priority not supported", "\"Transmit Interval/Priority not supported\""},
+    {2, 25, 27, "Transmit Interval too low", "\"Transmit Interval too low\""},
+    {3, 13, 15, "Access denied", "\"Access denied\""},
+    {4, 13, 15, "Not supported", "\"Not supported\""}
+};
+const LookupTable lookupTableTRANSMISSION_INTERVAL = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesTRANSMISSION_INTERVAL};
+
+static const LookupEntry lookupEntriesTURN_MODE[] = {
+    {0, 23, 25, "Rudder limit controlled", "\"Rudder limit controlled\""},
+    {1, 20, 22, "Turn rate controlled", "\"Turn rate controlled\""},
+    {2, 17, 19, "Radius controlled", "\"Radius controlled\""}
+};
+const LookupTable lookupTableTURN_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesTURN_MODE};
+
+static const LookupEntry lookupEntriesTX_RX_MODE[] = {
+    {0, 20, 22, "Tx A/Tx B, Rx A/Rx B", "\"Tx A/Tx B, Rx A/Rx B\""},
+    {1, 15, 17, "Tx A, Rx A/Rx B", "\"Tx A, Rx A/Rx B\""},
+    {2, 15, 17, "Tx B, Rx A/Rx B", "\"Tx B, Rx A/Rx B\""}
+};
+const LookupTable lookupTableTX_RX_MODE = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesTX_RX_MODE};
+
+static const LookupEntry lookupEntriesVIDEO_PROTOCOLS[] = {
+    {0, 3, 5, "PAL", "\"PAL\""},
+    {1, 4, 6, "NTSC", "\"NTSC\""}
+};
+const LookupTable lookupTableVIDEO_PROTOCOLS = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesVIDEO_PROTOCOLS};
+
+static const LookupEntry lookupEntriesWATERMAKER_STATE[] = {
+    {0, 7, 9, "Stopped", "\"Stopped\""},
+    {1, 8, 10, "Starting", "\"Starting\""},
+    {2, 7, 9, "Running", "\"Running\""},
+    {3, 8, 10, "Stopping", "\"Stopping\""},
+    {4, 8, 10, "Flushing", "\"Flushing\""},
+    {5, 7, 9, "Rinsing", "\"Rinsing\""},
+    {6, 10, 12, "Initiating", "\"Initiating\""},
+    {7, 6, 8, "Manual", "\"Manual\""}
+};
+const LookupTable lookupTableWATERMAKER_STATE = {.kind = LOOKUP_TABLE_DENSE, .count = 8, .entries = lookupEntriesWATERMAKER_STATE};
+
+static const LookupEntry lookupEntriesWATER_REFERENCE[] = {
+    {0, 12, 14, "Paddle wheel", "\"Paddle wheel\""},
+    {1, 10, 12, "Pitot tube", "\"Pitot tube\""},
+    {2, 7, 9, "Doppler", "\"Doppler\""},
+    {3, 25, 27, "Correlation (ultra sound)", "\"Correlation (ultra sound)\""},
+    {4, 16, 18, "Electro Magnetic", "\"Electro Magnetic\""}
+};
+const LookupTable lookupTableWATER_REFERENCE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesWATER_REFERENCE};
+
+static const LookupEntry lookupEntriesWAVEFORM[] = {
+    {0, 9, 11, "Sine wave", "\"Sine wave\""},
+    {1, 18, 20, "Modified sine wave", "\"Modified sine wave\""}
+};
+const LookupTable lookupTableWAVEFORM = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesWAVEFORM};
+
+static const LookupEntry lookupEntriesWINDLASS_DIRECTION[] = {
+    {0, 3, 5, "Off", "\"Off\""},
+    {1, 4, 6, "Down", "\"Down\""},
+    {2, 2, 4, "Up", "\"Up\""}
+};
+const LookupTable lookupTableWINDLASS_DIRECTION = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesWINDLASS_DIRECTION};
+
+static const LookupEntry lookupEntriesWINDLASS_MOTION[] = {
+    {0, 16, 18, "Windlass stopped", "\"Windlass stopped\""},
+    {1, 20, 22, "Deployment occurring", "\"Deployment occurring\""},
+    {2, 19, 21, "Retrieval occurring", "\"Retrieval occurring\""}
+};
+const LookupTable lookupTableWINDLASS_MOTION = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesWINDLASS_MOTION};
+
+static const LookupEntry lookupEntriesWIND_REFERENCE[] = {
+    {0, 33, 35, "True (ground referenced to North)", "\"True (ground referenced to North)\""},
+    {1, 46, 48, "Magnetic (ground referenced to Magnetic North)", "\"Magnetic (ground referenced to Magnetic North)\""},
+    {2, 8, 10, "Apparent", "\"Apparent\""},
+    {3, 22, 24, "True (boat referenced)", "\"True (boat referenced)\""},
+    {4, 23, 25, "True (water referenced)", "\"True (water referenced)\""}
+};
+const LookupTable lookupTableWIND_REFERENCE = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesWIND_REFERENCE};
+
+static const LookupEntry lookupEntriesWP_IDENTIFICATION_METHOD[] = {
+    {0, 20, 22, "Waypoints in WP list", "\"Waypoints in WP list\""},
+    {1, 27, 29, "Waypoints embedded in route", "\"Waypoints embedded in route\""}
+};
+const LookupTable lookupTableWP_IDENTIFICATION_METHOD = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesWP_IDENTIFICATION_METHOD};
+
+static const LookupEntry lookupEntriesWP_NAVIGATION_METHOD[] = {
+    {0, 12, 14, "Great Circle", "\"Great Circle\""},
+    {1, 10, 12, "Rhumb Line", "\"Rhumb Line\""}
+};
+const LookupTable lookupTableWP_NAVIGATION_METHOD = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesWP_NAVIGATION_METHOD};
+
+static const LookupEntry lookupEntriesWP_POSITION_RESOLUTION[] = {
+    {0, 17, 19, "more than 0.1 min", "\"more than 0.1 min\""},
+    {1, 17, 19, "<0.01 .. 0.1] min", "\"<0.01 .. 0.1] min\""},
+    {2, 19, 21, "<0.001 .. 0.01] min", "\"<0.001 .. 0.01] min\""},
+    {3, 21, 23, "<0.0001 .. 0.001] min", "\"<0.0001 .. 0.001] min\""},
+    {4, 17, 19, "<0 .. 0.0001] min", "\"<0 .. 0.0001] min\""}
+};
+const LookupTable lookupTableWP_POSITION_RESOLUTION = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesWP_POSITION_RESOLUTION};
+
+static const LookupEntry lookupEntriesWP_ROUTE_STATUS[] = {
+    {0, 6, 8, "Active", "\"Active\""},
+    {1, 8, 10, "Inactive", "\"Inactive\""},
+    {2, 7, 9, "Deleted", "\"Deleted\""}
+};
+const LookupTable lookupTableWP_ROUTE_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 3, .entries = lookupEntriesWP_ROUTE_STATUS};
+
+static const LookupEntry lookupEntriesYES_NO[] = {
+    {0, 2, 4, "No", "\"No\""},
+    {1, 3, 5, "Yes", "\"Yes\""}
+};
+const LookupTable lookupTableYES_NO = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesYES_NO};
+
+static const LookupEntry lookupEntriesYES_NO_1BIT[] = {
+    {0, 2, 4, "No", "\"No\""},
+    {1, 3, 5, "Yes", "\"Yes\""}
+};
+const LookupTable lookupTableYES_NO_1BIT = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesYES_NO_1BIT};
+
+static const LookupEntry lookupEntriesZONE_SIZE[] = {
+    {0, 4, 6, "1 nm", "\"1 nm\""},
+    {1, 4, 6, "2 nm", "\"2 nm\""},
+    {2, 4, 6, "3 nm", "\"3 nm\""},
+    {3, 4, 6, "4 nm", "\"4 nm\""},
+    {4, 4, 6, "5 nm", "\"5 nm\""},
+    {5, 4, 6, "6 nm", "\"6 nm\""}
+};
+const LookupTable lookupTableZONE_SIZE = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesZONE_SIZE};
+
+static const LookupEntry lookupEntriesDISABLED_SATELLITES[] = {
+    {0, 13, 15, "Disable SV #1", "\"Disable SV #1\""},
+    {1, 13, 15, "Disable SV #2", "\"Disable SV #2\""},
+    {2, 13, 15, "Disable SV #3", "\"Disable SV #3\""},
+    {3, 13, 15, "Disable SV #4", "\"Disable SV #4\""},
+    {4, 13, 15, "Disable SV #5", "\"Disable SV #5\""},
+    {5, 13, 15, "Disable SV #6", "\"Disable SV #6\""},
+    {6, 13, 15, "Disable SV #7", "\"Disable SV #7\""},
+    {7, 13, 15, "Disable SV #8", "\"Disable SV #8\""},
+    {8, 13, 15, "Disable SV #9", "\"Disable SV #9\""},
+    {9, 14, 16, "Disable SV #10", "\"Disable SV #10\""},
+    {10, 14, 16, "Disable SV #11", "\"Disable SV #11\""},
+    {11, 14, 16, "Disable SV #12", "\"Disable SV #12\""},
+    {12, 14, 16, "Disable SV #13", "\"Disable SV #13\""},
+    {13, 14, 16, "Disable SV #14", "\"Disable SV #14\""},
+    {14, 14, 16, "Disable SV #15", "\"Disable SV #15\""},
+    {15, 14, 16, "Disable SV #16", "\"Disable SV #16\""},
+    {16, 14, 16, "Disable SV #17", "\"Disable SV #17\""},
+    {17, 14, 16, "Disable SV #18", "\"Disable SV #18\""},
+    {18, 14, 16, "Disable SV #19", "\"Disable SV #19\""},
+    {19, 14, 16, "Disable SV #20", "\"Disable SV #20\""},
+    {20, 14, 16, "Disable SV #21", "\"Disable SV #21\""},
+    {21, 14, 16, "Disable SV #22", "\"Disable SV #22\""},
+    {22, 14, 16, "Disable SV #23", "\"Disable SV #23\""},
+    {23, 14, 16, "Disable SV #24", "\"Disable SV #24\""},
+    {24, 14, 16, "Disable SV #25", "\"Disable SV #25\""},
+    {25, 14, 16, "Disable SV #26", "\"Disable SV #26\""},
+    {26, 14, 16, "Disable SV #27", "\"Disable SV #27\""},
+    {27, 14, 16, "Disable SV #28", "\"Disable SV #28\""},
+    {28, 14, 16, "Disable SV #29", "\"Disable SV #29\""},
+    {29, 14, 16, "Disable SV #30", "\"Disable SV #30\""},
+    {30, 14, 16, "Disable SV #31", "\"Disable SV #31\""},
+    {31, 14, 16, "Disable SV #32", "\"Disable SV #32\""},
+    {32, 14, 16, "Disable SV #33", "\"Disable SV #33\""},
+    {33, 14, 16, "Disable SV #34", "\"Disable SV #34\""},
+    {34, 14, 16, "Disable SV #35", "\"Disable SV #35\""},
+    {35, 14, 16, "Disable SV #36", "\"Disable SV #36\""},
+    {36, 14, 16, "Disable SV #37", "\"Disable SV #37\""},
+    {37, 14, 16, "Disable SV #38", "\"Disable SV #38\""},
+    {38, 14, 16, "Disable SV #39", "\"Disable SV #39\""},
+    {39, 14, 16, "Disable SV #40", "\"Disable SV #40\""}
+};
+const LookupTable lookupTableDISABLED_SATELLITES = {.kind = LOOKUP_TABLE_DENSE, .count = 40, .entries = lookupEntriesDISABLED_SATELLITES};
+
+static const LookupEntry lookupEntriesENGINE_STATUS_1[] = {
+    {0, 12, 14, "Check Engine", "\"Check Engine\""},
+    {1, 16, 18, "Over Temperature", "\"Over Temperature\""},
+    {2, 16, 18, "Low Oil Pressure", "\"Low Oil Pressure\""},
+    {3, 13, 15, "Low Oil Level", "\"Low Oil Level\""},
+    {4, 17, 19, "Low Fuel Pressure", "\"Low Fuel Pressure\""},
+    {5, 18, 20, "Low System Voltage", "\"Low System Voltage\""},
+    {6, 17, 19, "Low Coolant Level", "\"Low Coolant Level\""},
+    {7, 10, 12, "Water Flow", "\"Water Flow\""},
+    {8, 13, 15, "Water In Fuel", "\"Water In Fuel\""},
+    {9, 16, 18, "Charge Indicator", "\"Charge Indicator\""},
+    {10, 17, 19, "Preheat Indicator", "\"Preheat Indicator\""},
+    {11, 19, 21, "High Boost Pressure", "\"High Boost Pressure\""},
+    {12, 18, 20, "Rev Limit Exceeded", "\"Rev Limit Exceeded\""},
+    {13, 10, 12, "EGR System", "\"EGR System\""},
+    {14, 24, 26, "Throttle Position Sensor", "\"Throttle Position Sensor\""},
+    {15, 14, 16, "Emergency Stop", "\"Emergency Stop\""}
+};
+const LookupTable lookupTableENGINE_STATUS_1 = {.kind = LOOKUP_TABLE_DENSE, .count = 16, .entries = lookupEntriesENGINE_STATUS_1};
+
+static const LookupEntry lookupEntriesENGINE_STATUS_2[] = {
+    {0, 15, 17, "Warning Level 1", "\"Warning Level 1\""},
+    {1, 15, 17, "Warning Level 2", "\"Warning Level 2\""},
+    {2, 15, 17, "Power Reduction", "\"Power Reduction\""},
+    {3, 18, 20, "Maintenance Needed", "\"Maintenance Needed\""},
+    {4, 17, 19, "Engine Comm Error", "\"Engine Comm Error\""},
+    {5, 25, 27, "Sub or Secondary Throttle", "\"Sub or Secondary Throttle\""},
+    {6, 21, 23, "Neutral Start Protect", "\"Neutral Start Protect\""},
+    {7, 20, 22, "Engine Shutting Down", "\"Engine Shutting Down\""}
+};
+const LookupTable lookupTableENGINE_STATUS_2 = {.kind = LOOKUP_TABLE_DENSE, .count = 8, .entries = lookupEntriesENGINE_STATUS_2};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_GROUP_BITFIELD[] = {
+    {0, 4, 6, "File", "\"File\""},
+    {1, 13, 15, "Playlist Name", "\"Playlist Name\""},
+    {2, 10, 12, "Genre Name", "\"Genre Name\""},
+    {3, 10, 12, "Album Name", "\"Album Name\""},
+    {4, 11, 13, "Artist Name", "\"Artist Name\""},
+    {5, 10, 12, "Track Name", "\"Track Name\""},
+    {6, 12, 14, "Station Name", "\"Station Name\""},
+    {7, 14, 16, "Station Number", "\"Station Number\""},
+    {8, 16, 18, "Favourite Number", "\"Favourite Number\""},
+    {9, 10, 12, "Play Queue", "\"Play Queue\""},
+    {10, 12, 14, "Content Info", "\"Content Info\""}
+};
+const LookupTable lookupTableENTERTAINMENT_GROUP_BITFIELD = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesENTERTAINMENT_GROUP_BITFIELD};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_PLAY_STATUS_BITFIELD[] = {
+    {0, 4, 6, "Play", "\"Play\""},
+    {1, 5, 7, "Pause", "\"Pause\""},
+    {2, 4, 6, "Stop", "\"Stop\""},
+    {3, 5, 7, "FF 1x", "\"FF 1x\""},
+    {4, 5, 7, "FF 2x", "\"FF 2x\""},
+    {5, 5, 7, "FF 3x", "\"FF 3x\""},
+    {6, 5, 7, "FF 4x", "\"FF 4x\""},
+    {7, 5, 7, "RW 1x", "\"RW 1x\""},
+    {8, 5, 7, "RW 2x", "\"RW 2x\""},
+    {9, 5, 7, "RW 3x", "\"RW 3x\""},
+    {10, 5, 7, "RW 4x", "\"RW 4x\""},
+    {11, 10, 12, "Skip ahead", "\"Skip ahead\""},
+    {12, 9, 11, "Skip back", "\"Skip back\""},
+    {13, 9, 11, "Jog ahead", "\"Jog ahead\""},
+    {14, 8, 10, "Jog back", "\"Jog back\""},
+    {15, 7, 9, "Seek up", "\"Seek up\""},
+    {16, 9, 11, "Seek down", "\"Seek down\""},
+    {17, 7, 9, "Scan up", "\"Scan up\""},
+    {18, 9, 11, "Scan down", "\"Scan down\""},
+    {19, 7, 9, "Tune up", "\"Tune up\""},
+    {20, 9, 11, "Tune down", "\"Tune down\""},
+    {21, 16, 18, "Slow motion .75x", "\"Slow motion .75x\""},
+    {22, 15, 17, "Slow motion .5x", "\"Slow motion .5x\""},
+    {23, 16, 18, "Slow motion .25x", "\"Slow motion .25x\""},
+    {24, 17, 19, "Slow motion .125x", "\"Slow motion .125x\""},
+    {25, 15, 17, "Source renaming", "\"Source renaming\""}
+};
+const LookupTable lookupTableENTERTAINMENT_PLAY_STATUS_BITFIELD = {.kind = LOOKUP_TABLE_DENSE, .count = 26, .entries = lookupEntriesENTERTAINMENT_PLAY_STATUS_BITFIELD};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_REPEAT_BITFIELD[] = {
+    {0, 4, 6, "Song", "\"Song\""},
+    {1, 10, 12, "Play queue", "\"Play queue\""}
+};
+const LookupTable lookupTableENTERTAINMENT_REPEAT_BITFIELD = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesENTERTAINMENT_REPEAT_BITFIELD};
+
+static const LookupEntry lookupEntriesENTERTAINMENT_SHUFFLE_BITFIELD[] = {
+    {0, 10, 12, "Play queue", "\"Play queue\""},
+    {1, 3, 5, "All", "\"All\""}
+};
+const LookupTable lookupTableENTERTAINMENT_SHUFFLE_BITFIELD = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesENTERTAINMENT_SHUFFLE_BITFIELD};
+
+static const LookupEntry lookupEntriesFURUNO_BASELINE_STATUS[] = {
+    {0, 20, 22, "Baseline Antenna 1-2", "\"Baseline Antenna 1-2\""},
+    {1, 20, 22, "Baseline Antenna 2-3", "\"Baseline Antenna 2-3\""},
+    {2, 20, 22, "Baseline Antenna 3-4", "\"Baseline Antenna 3-4\""},
+    {3, 20, 22, "Baseline Antenna 4-1", "\"Baseline Antenna 4-1\""},
+    {4, 20, 22, "Baseline Antenna 1-3", "\"Baseline Antenna 1-3\""},
+    {5, 20, 22, "Baseline Antenna 2-4", "\"Baseline Antenna 2-4\""}
+};
+const LookupTable lookupTableFURUNO_BASELINE_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesFURUNO_BASELINE_STATUS};
+
+static const LookupEntry lookupEntriesSIMNET_ALERT_BITFIELD[] = {
+    {0, 10, 12, "No GPS fix", "\"No GPS fix\""},
+    {0},
+    {2, 32, 34, "No active autopilot control unit", "\"No active autopilot control unit\""},
+    {0},
+    {4, 21, 23, "No autopilot computer", "\"No autopilot computer\""},
+    {0},
+    {6, 18, 20, "AP clutch overload", "\"AP clutch overload\""},
+    {0},
+    {8, 20, 22, "AP clutch disengaged", "\"AP clutch disengaged\""},
+    {0},
+    {10, 23, 25, "Rudder controller fault", "\"Rudder controller fault\""},
+    {0},
+    {12, 18, 20, "No rudder response", "\"No rudder response\""},
+    {0},
+    {14, 21, 23, "Rudder drive overload", "\"Rudder drive overload\""},
+    {0},
+    {16, 17, 19, "High drive supply", "\"High drive supply\""},
+    {0},
+    {18, 16, 18, "Low drive supply", "\"Low drive supply\""},
+    {0},
+    {20, 11, 13, "Memory fail", "\"Memory fail\""},
+    {0},
+    {22, 24, 26, "AP position data missing", "\"AP position data missing\""},
+    {0},
+    {24, 21, 23, "AP speed data missing", "\"AP speed data missing\""},
+    {0},
+    {26, 21, 23, "AP depth data missing", "\"AP depth data missing\""},
+    {0},
+    {28, 23, 25, "AP heading data missing", "\"AP heading data missing\""},
+    {0},
+    {30, 19, 21, "AP nav data missing", "\"AP nav data missing\""},
+    {0},
+    {32, 22, 24, "AP rudder data missing", "\"AP rudder data missing\""},
+    {0},
+    {34, 20, 22, "AP wind data missing", "\"AP wind data missing\""},
+    {0},
+    {36, 13, 15, "AP off course", "\"AP off course\""},
+    {0},
+    {38, 22, 24, "High drive temperature", "\"High drive temperature\""},
+    {0},
+    {40, 13, 15, "Drive inhibit", "\"Drive inhibit\""},
+    {0},
+    {42, 12, 14, "Rudder limit", "\"Rudder limit\""},
+    {0},
+    {44, 22, 24, "Drive computer missing", "\"Drive computer missing\""},
+    {0},
+    {46, 19, 21, "Drive ready missing", "\"Drive ready missing\""},
+    {0},
+    {48, 13, 15, "EVC com error", "\"EVC com error\""},
+    {0},
+    {50, 12, 14, "EVC override", "\"EVC override\""},
+    {0},
+    {52, 19, 21, "Low CAN bus voltage", "\"Low CAN bus voltage\""},
+    {0},
+    {54, 23, 25, "CAN bus supply overload", "\"CAN bus supply overload\""},
+    {0},
+    {56, 23, 25, "Wind sensor battery low", "\"Wind sensor battery low\""}
+};
+const LookupTable lookupTableSIMNET_ALERT_BITFIELD = {.kind = LOOKUP_TABLE_DENSE, .count = 57, .entries = lookupEntriesSIMNET_ALERT_BITFIELD};
+
+static const LookupEntry lookupEntriesSIMNET_AP_MODE_BITFIELD[] = {
+    {0},
+    {0},
+    {0},
+    {3, 7, 9, "Standby", "\"Standby\""},
+    {4, 7, 9, "Heading", "\"Heading\""},
+    {0},
+    {6, 3, 5, "Nav", "\"Nav\""},
+    {0},
+    {8, 8, 10, "No Drift", "\"No Drift\""},
+    {0},
+    {10, 4, 6, "Wind", "\"Wind\""}
+};
+const LookupTable lookupTableSIMNET_AP_MODE_BITFIELD = {.kind = LOOKUP_TABLE_DENSE, .count = 11, .entries = lookupEntriesSIMNET_AP_MODE_BITFIELD};
+
+static const LookupEntry lookupEntriesSTATION_STATUS[] = {
+    {0, 14, 16, "Station in use", "\"Station in use\""},
+    {1, 7, 9, "Low SNR", "\"Low SNR\""},
+    {2, 11, 13, "Cycle Error", "\"Cycle Error\""},
+    {3, 5, 7, "Blink", "\"Blink\""}
+};
+const LookupTable lookupTableSTATION_STATUS = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesSTATION_STATUS};
+
+static const LookupEntry lookupEntriesTHRUSTER_CONTROL_EVENTS[] = {
+    {0, 35, 37, "Another device controlling thruster", "\"Another device controlling thruster\""},
+    {1, 42, 44, "Boat speed too fast to safely use thruster", "\"Boat speed too fast to safely use thruster\""}
+};
+const LookupTable lookupTableTHRUSTER_CONTROL_EVENTS = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesTHRUSTER_CONTROL_EVENTS};
+
+static const LookupEntry lookupEntriesTHRUSTER_MOTOR_EVENTS[] = {
+    {0, 29, 31, "Motor over temperature cutout", "\"Motor over temperature cutout\""},
+    {1, 25, 27, "Motor over current cutout", "\"Motor over current cutout\""},
+    {2, 21, 23, "Low oil level warning", "\"Low oil level warning\""},
+    {3, 28, 30, "Oil over temperature warning", "\"Oil over temperature warning\""},
+    {4, 31, 33, "Controller under voltage cutout", "\"Controller under voltage cutout\""},
+    {5, 20, 22, "Manufacturer defined", "\"Manufacturer defined\""}
+};
+const LookupTable lookupTableTHRUSTER_MOTOR_EVENTS = {.kind = LOOKUP_TABLE_DENSE, .count = 6, .entries = lookupEntriesTHRUSTER_MOTOR_EVENTS};
+
+static const LookupEntry lookupEntriesTRANSMISSION_STATUS_1[] = {
+    {0, 18, 20, "Check Transmission", "\"Check Transmission\""},
+    {1, 16, 18, "Over Temperature", "\"Over Temperature\""},
+    {2, 16, 18, "Low Oil Pressure", "\"Low Oil Pressure\""},
+    {3, 13, 15, "Low Oil Level", "\"Low Oil Level\""},
+    {4, 10, 12, "Sail Drive", "\"Sail Drive\""}
+};
+const LookupTable lookupTableTRANSMISSION_STATUS_1 = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesTRANSMISSION_STATUS_1};
+
+static const LookupEntry lookupEntriesWINDLASS_CONTROL[] = {
+    {0, 35, 37, "Another device controlling windlass", "\"Another device controlling windlass\""}
+};
+const LookupTable lookupTableWINDLASS_CONTROL = {.kind = LOOKUP_TABLE_DENSE, .count = 1, .entries = lookupEntriesWINDLASS_CONTROL};
+
+static const LookupEntry lookupEntriesWINDLASS_MONITORING[] = {
+    {0, 32, 34, "Controller under voltage cut-out", "\"Controller under voltage cut-out\""},
+    {1, 31, 33, "Controller over current cut-out", "\"Controller over current cut-out\""},
+    {2, 35, 37, "Controller over temperature cut-out", "\"Controller over temperature cut-out\""},
+    {3, 20, 22, "Manufacturer defined", "\"Manufacturer defined\""}
+};
+const LookupTable lookupTableWINDLASS_MONITORING = {.kind = LOOKUP_TABLE_DENSE, .count = 4, .entries = lookupEntriesWINDLASS_MONITORING};
+
+static const LookupEntry lookupEntriesWINDLASS_OPERATION[] = {
+    {0, 12, 14, "System error", "\"System error\""},
+    {1, 12, 14, "Sensor error", "\"Sensor error\""},
+    {2, 27, 29, "No windlass motion detected", "\"No windlass motion detected\""},
+    {3, 34, 36, "Retrieval docking distance reached", "\"Retrieval docking distance reached\""},
+    {4, 19, 21, "End of rode reached", "\"End of rode reached\""}
+};
+const LookupTable lookupTableWINDLASS_OPERATION = {.kind = LOOKUP_TABLE_DENSE, .count = 5, .entries = lookupEntriesWINDLASS_OPERATION};
+
+static const LookupEntry lookupEntriesWP_CHANGE[] = {
+    {0, 36, 38, "Change in main data (Position, Name)", "\"Change in main data (Position, Name)\""},
+    {1, 49, 51, "Change in supplementary parameters (or new added)", "\"Change in supplementary parameters (or new added)\""},
+    {2, 65, 67, "Changed number of WPs in Route/WP-List, and/or name changed/added", "\"Changed number of WPs in Route/WP-List, and/or name changed/added\""},
+    {3, 53, 55, "Route: Change supplementary parameters (or new added)", "\"Route: Change supplementary parameters (or new added)\""},
+    {0},
+    {0},
+    {6, 27, 29, "Other not specified changed", "\"Other not specified changed\""}
+};
+const LookupTable lookupTableWP_CHANGE = {.kind = LOOKUP_TABLE_DENSE, .count = 7, .entries = lookupEntriesWP_CHANGE};
+
+static const LookupEntry lookupEntriesWP_CRITICAL_PARAMETERS[] = {
+    {0, 17, 19, "Navigation Method", "\"Navigation Method\""},
+    {1, 9, 11, "XTE Limit", "\"XTE Limit\""}
+};
+const LookupTable lookupTableWP_CRITICAL_PARAMETERS = {.kind = LOOKUP_TABLE_DENSE, .count = 2, .entries = lookupEntriesWP_CRITICAL_PARAMETERS};
+
+static const LookupEntry lookupEntriesDEVICE_FUNCTION[] = {
+    {130, 10, 12, "Diagnostic", "\"Diagnostic\""},
+    {140, 18, 20, "Bus Traffic Logger", "\"Bus Traffic Logger\""},
+    {110, 16, 18, "Alarm Enunciator", "\"Alarm Enunciator\""},
+    {130, 50, 52, "Emergency Position Indicating Radio Beacon (EPIRB)", "\"Emergency Position Indicating Radio Beacon (EPIRB)\""},
+    {135, 13, 15, "Man Overboard", "\"Man Overboard\""},
+    {140, 20, 22, "Voyage Data Recorder", "\"Voyage Data Recorder\""},
+    {150, 6, 8, "Camera", "\"Camera\""},
+    {130, 10, 12, "PC Gateway", "\"PC Gateway\""},
+    {131, 27, 29, "NMEA 2000 to Analog Gateway", "\"NMEA 2000 to Analog Gateway\""},
+    {132, 27, 29, "Analog to NMEA 2000 Gateway", "\"Analog to NMEA 2000 Gateway\""},
+    {133, 27, 29, "NMEA 2000 to Serial Gateway", "\"NMEA 2000 to Serial Gateway\""},
+    {135, 17, 19, "NMEA 0183 Gateway", "\"NMEA 0183 Gateway\""},
+    {136, 20, 22, "NMEA Network Gateway", "\"NMEA Network Gateway\""},
+    {137, 26, 28, "NMEA 2000 Wireless Gateway", "\"NMEA 2000 Wireless Gateway\""},
+    {140, 6, 8, "Router", "\"Router\""},
+    {150, 6, 8, "Bridge", "\"Bridge\""},
+    {160, 8, 10, "Repeater", "\"Repeater\""},
+    {130, 20, 22, "Binary Event Monitor", "\"Binary Event Monitor\""},
+    {140, 15, 17, "Load Controller", "\"Load Controller\""},
+    {141, 11, 13, "AC/DC Input", "\"AC/DC Input\""},
+    {150, 19, 21, "Function Controller", "\"Function Controller\""},
+    {140, 6, 8, "Engine", "\"Engine\""},
+    {141, 23, 25, "DC Generator/Alternator", "\"DC Generator/Alternator\""},
+    {142, 25, 27, "Solar Panel (Solar Array)", "\"Solar Panel (Solar Array)\""},
+    {143, 19, 21, "Wind Generator (DC)", "\"Wind Generator (DC)\""},
+    {144, 9, 11, "Fuel Cell", "\"Fuel Cell\""},
+    {145, 20, 22, "Network Power Supply", "\"Network Power Supply\""},
+    {151, 12, 14, "AC Generator", "\"AC Generator\""},
+    {152, 6, 8, "AC Bus", "\"AC Bus\""},
+    {153, 24, 26, "AC Mains (Utility/Shore)", "\"AC Mains (Utility/Shore)\""},
+    {154, 9, 11, "AC Output", "\"AC Output\""},
+    {160, 33, 35, "Power Converter - Battery Charger", "\"Power Converter - Battery Charger\""},
+    {161, 42, 44, "Power Converter - Battery Charger+Inverter", "\"Power Converter - Battery Charger+Inverter\""},
+    {162, 26, 28, "Power Converter - Inverter", "\"Power Converter - Inverter\""},
+    {163, 20, 22, "Power Converter - DC", "\"Power Converter - DC\""},
+    {170, 7, 9, "Battery", "\"Battery\""},
+    {180, 14, 16, "Engine Gateway", "\"Engine Gateway\""},
+    {130, 20, 22, "Follow-up Controller", "\"Follow-up Controller\""},
+    {140, 15, 17, "Mode Controller", "\"Mode Controller\""},
+    {150, 9, 11, "Autopilot", "\"Autopilot\""},
+    {155, 6, 8, "Rudder", "\"Rudder\""},
+    {160, 15, 17, "Heading Sensors", "\"Heading Sensors\""},
+    {170, 24, 26, "Trim (Tabs)/Interceptors", "\"Trim (Tabs)/Interceptors\""},
+    {180, 35, 37, "Attitude (Pitch, Roll, Yaw) Control", "\"Attitude (Pitch, Roll, Yaw) Control\""},
+    {130, 21, 23, "Engineroom Monitoring", "\"Engineroom Monitoring\""},
+    {140, 6, 8, "Engine", "\"Engine\""},
+    {141, 23, 25, "DC Generator/Alternator", "\"DC Generator/Alternator\""},
+    {150, 17, 19, "Engine Controller", "\"Engine Controller\""},
+    {151, 12, 14, "AC Generator", "\"AC Generator\""},
+    {155, 5, 7, "Motor", "\"Motor\""},
+    {160, 14, 16, "Engine Gateway", "\"Engine Gateway\""},
+    {165, 12, 14, "Transmission", "\"Transmission\""},
+    {170, 22, 24, "Throttle/Shift Control", "\"Throttle/Shift Control\""},
+    {180, 8, 10, "Actuator", "\"Actuator\""},
+    {190, 15, 17, "Gauge Interface", "\"Gauge Interface\""},
+    {200, 11, 13, "Gauge Large", "\"Gauge Large\""},
+    {210, 11, 13, "Gauge Small", "\"Gauge Small\""},
+    {130, 12, 14, "Bottom Depth", "\"Bottom Depth\""},
+    {135, 18, 20, "Bottom Depth/Speed", "\"Bottom Depth/Speed\""},
+    {136, 30, 32, "Bottom Depth/Speed/Temperature", "\"Bottom Depth/Speed/Temperature\""},
+    {140, 16, 18, "Ownship Attitude", "\"Ownship Attitude\""},
+    {145, 23, 25, "Ownship Position (GNSS)", "\"Ownship Position (GNSS)\""},
+    {150, 26, 28, "Ownship Position (Loran C)", "\"Ownship Position (Loran C)\""},
+    {155, 5, 7, "Speed", "\"Speed\""},
+    {160, 19, 21, "Turn Rate Indicator", "\"Turn Rate Indicator\""},
+    {170, 21, 23, "Integrated Navigation", "\"Integrated Navigation\""},
+    {175, 28, 30, "Integrated Navigation System", "\"Integrated Navigation System\""},
+    {190, 21, 23, "Navigation Management", "\"Navigation Management\""},
+    {195, 37, 39, "Automatic Identification System (AIS)", "\"Automatic Identification System (AIS)\""},
+    {200, 5, 7, "Radar", "\"Radar\""},
+    {201, 16, 18, "Infrared Imaging", "\"Infrared Imaging\""},
+    {205, 5, 7, "ECDIS", "\"ECDIS\""},
+    {210, 3, 5, "ECS", "\"ECS\""},
+    {220, 16, 18, "Direction Finder", "\"Direction Finder\""},
+    {230, 13, 15, "Voyage Status", "\"Voyage Status\""},
+    {130, 5, 7, "EPIRB", "\"EPIRB\""},
+    {140, 3, 5, "AIS", "\"AIS\""},
+    {150, 3, 5, "DSC", "\"DSC\""},
+    {160, 25, 27, "Data Receiver/Transceiver", "\"Data Receiver/Transceiver\""},
+    {170, 9, 11, "Satellite", "\"Satellite\""},
+    {180, 23, 25, "Radio-telephone (MF/HF)", "\"Radio-telephone (MF/HF)\""},
+    {190, 14, 16, "Radiotelephone", "\"Radiotelephone\""},
+    {130, 11, 13, "Temperature", "\"Temperature\""},
+    {140, 8, 10, "Pressure", "\"Pressure\""},
+    {150, 11, 13, "Fluid Level", "\"Fluid Level\""},
+    {160, 4, 6, "Flow", "\"Flow\""},
+    {170, 8, 10, "Humidity", "\"Humidity\""},
+    {130, 17, 19, "Time/Date Systems", "\"Time/Date Systems\""},
+    {140, 3, 5, "VDR", "\"VDR\""},
+    {150, 26, 28, "Integrated Instrumentation", "\"Integrated Instrumentation\""},
+    {160, 24, 26, "General Purpose Displays", "\"General Purpose Displays\""},
+    {170, 18, 20, "General Sensor Box", "\"General Sensor Box\""},
+    {180, 19, 21, "Weather Instruments", "\"Weather Instruments\""},
+    {190, 18, 20, "Transducer/General", "\"Transducer/General\""},
+    {200, 19, 21, "NMEA 0183 Converter", "\"NMEA 0183 Converter\""},
+    {130, 11, 13, "Atmospheric", "\"Atmospheric\""},
+    {160, 7, 9, "Aquatic", "\"Aquatic\""},
+    {130, 4, 6, "HVAC", "\"HVAC\""},
+    {130, 13, 15, "Scale (Catch)", "\"Scale (Catch)\""},
+    {130, 16, 18, "Button Interface", "\"Button Interface\""},
+    {135, 16, 18, "Switch Interface", "\"Switch Interface\""},
+    {140, 16, 18, "Analog Interface", "\"Analog Interface\""},
+    {130, 7, 9, "Display", "\"Display\""},
+    {140, 16, 18, "Alarm Enunciator", "\"Alarm Enunciator\""},
+    {130, 17, 19, "Multimedia Player", "\"Multimedia Player\""},
+    {140, 21, 23, "Multimedia Controller", "\"Multimedia Controller\""}
+};
+static const LookupRange lookupRangesDEVICE_FUNCTION[] = {
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 2},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {2, 5},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {7, 10},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {17, 4},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {21, 16},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {37, 7},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {44, 13},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {57, 18},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {75, 7},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {82, 5},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {87, 8},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {95, 2},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {97, 1},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {98, 1},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {99, 3},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {102, 2},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {104, 2}
+};
+const LookupTable lookupTableDEVICE_FUNCTION = {.kind = LOOKUP_TABLE_TRIPLET, .count = 106, .entries = lookupEntriesDEVICE_FUNCTION, .rangeCount = 126, .ranges = lookupRangesDEVICE_FUNCTION};
+
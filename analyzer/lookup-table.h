@@ -0,0 +1,116 @@
+/*
+
+Lookup tables generated by keel (lookup-table-generated-data.h).
+
+(C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+
+This file is part of CANboat.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#ifndef LOOKUP_TABLE_H_INCLUDED
+#define LOOKUP_TABLE_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* One enumeration value. The JSON form is escaped and quoted already, so
+ * printing a lookup is a single append of `json`/`jsonLen` (or `name`/
+ * `nameLen` in text mode) instead of a "%s" format over a C string.
+ */
+typedef struct LookupEntry
+{
+  uint32_t    value;   /* Key: val2 for a triplet; not consulted in a dense table */
+  uint16_t    nameLen; /* strlen(name) */
+  uint16_t    jsonLen; /* strlen(json) */
+  const char *name;    /* Plain text, as returned by lookupXXX(); NULL for a gap in a dense table */
+  const char *json;    /* "name" escaped and quoted for JSON output */
+} LookupEntry;
+
+typedef struct LookupRange
+{
+  uint32_t start; /* First entry with this val1 */
+  uint32_t count; /* Number of entries with this val1, sorted by val2 */
+} LookupRange;
+
+typedef enum LookupTableKind
+{
+  LOOKUP_TABLE_DENSE,  /* entries[] is indexed by the key */
+  LOOKUP_TABLE_SORTED, /* entries[] is sorted by key, for a binary search */
+  LOOKUP_TABLE_TRIPLET /* ranges[val1] selects a slice of entries[], sorted by val2 */
+} LookupTableKind;
+
+typedef struct LookupTable
+{
+  LookupTableKind    kind;
+  uint32_t           count; /* Number of entries[] */
+  const LookupEntry *entries;
+  uint32_t           rangeCount; /* TRIPLET only: number of ranges[], i.e. highest val1 + 1 */
+  const LookupRange *ranges;     /* TRIPLET only */
+} LookupTable;
+
+static inline const LookupEntry *lookupTableSearch(const LookupEntry *entries, uint32_t count, size_t val)
+{
+  uint32_t start = 0;
+  uint32_t end   = count;
+
+  while (start < end)
+  {
+    uint32_t mid = start + (end - start) / 2;
+
+    if (entries[mid].value == val)
+    {
+      return &entries[mid];
+    }
+    if (entries[mid].value < val)
+    {
+      start = mid + 1;
+    }
+    else
+    {
+      end = mid;
+    }
+  }
+  return NULL;
+}
+
+/* Returns the entry for `val`, or NULL when the enumeration does not name it. */
+static inline const LookupEntry *lookupTableFind(const LookupTable *table, size_t val)
+{
+  if (table->kind == LOOKUP_TABLE_DENSE)
+  {
+    if (val < table->count && table->entries[val].name != NULL)
+    {
+      return &table->entries[val];
+    }
+    return NULL;
+  }
+  return lookupTableSearch(table->entries, table->count, val);
+}
+
+/* Returns the entry for the (val1, val2) pair of a triplet enumeration, or NULL. */
+static inline const LookupEntry *lookupTableFindTriplet(const LookupTable *table, size_t val1, size_t val2)
+{
+  const LookupRange *range;
+
+  if (val1 >= table->rangeCount)
+  {
+    return NULL;
+  }
+  range = &table->ranges[val1];
+  return lookupTableSearch(table->entries + range->start, range->count, val2);
+}
+
+#endif
@@ -25,32 +25,38 @@ limitations under the License.
 #include "analyzer.h"
 
 /*
- The source below expands to many C functions, depending on whether EXPLAIN is set or
- not. When compiled for `analyzer-explain`, the macro is set, and the code will generate
- a function for every lookup that looks like this:
+ The pair, bitfield and triplet enumerations are data: keel emits them into
+ lookup-table-generated-data.h as dense or sorted arrays (a two-level table for
+ the triplets) whose entries carry the plain string, the JSON-escaped and quoted
+ string, and both lengths. fieldPrintLookup() appends those straight into the
+ output buffer; the lookupXXX() functions below serve every other caller:
 
-    void lookupYES_NO(EnumPairCallback cb)
+    const char *lookupYES_NO(size_t val)
     {
-      (cb)(0, "No");
-      (cb)(1, "Yes");
+      const LookupEntry *e = lookupTableFind(&lookupTableYES_NO, val);
+      if (e != NULL)
+      {
+        return e->name;
+      }
+      return NULL;
     }
 
- When the EXPLAIN macro is not set, and this is compiled for `analyzer`, the code generated
- will look like this:
+ The fieldtype enumerations stay switch statements, as each case also has to
+ resolve (once) and publish the Field that describes the value that follows:
 
-    const char *lookupYES_NO(size_t val)
+    const char *lookupSETTING_TYPE(size_t val)
     {
       switch (val)
       {
-        case 0: return "No";
-        case 1: return "Yes";
+        case 0: { static Field f; ...; g_ftf = &f; return "Depth"; }
+        ...
       }
       return NULL;
     }
 
- This does away with all long sparse arrays that we had before this, and the C optimizers
- generally do an excellent job of creating jump tables to create this code, as this is a
- very typical pattern of code used by code generators (like this one :-) )
+ LOOKUP_END closes both shapes, which is why the table-backed functions end on
+ an empty block of their own. `make lookup-bench` compares the tables against
+ the switch statements they replaced (lookup-bench.c).
 */
 
 #define LOOKUP_PAIR_FUNCTION function.pair
@@ -58,46 +64,32 @@ limitations under the License.
 #define LOOKUP_TRIPLET_FUNCTION function.triplet
 #define LOOKUP_FIELDTYPE_FUNCTION function.pair
 
+#include LOOKUP_TABLE_GENERATED_DATA
 
-// Generate functions that lookup the value using switch statements. Compilers
-// are really good at optimizing long switch statements, as lex/yacc style generated
-// code uses that a lot.
-
-#define LOOKUP_TYPE(type, length)      \
-  const char *lookup##type(size_t val) \
-  {                                    \
-    switch (val)                       \
-    {
-#define LOOKUP(type, n, str) \
-  case n:                    \
-    return str;
-
-#define LOOKUP_TYPE_BITFIELD(type, length) \
-  const char *lookup##type(size_t val)     \
-  {                                        \
-    switch (val)                           \
-    {
-#define LOOKUP_BITFIELD(type, n, str) \
-  case n:                             \
-    return str;
-
-#define LOOKUP_TYPE_TRIPLET(type, length)            \
-  const char *lookup##type(size_t val1, size_t val2) \
-  {                                                  \
-    switch (val1 * 256 + val2)                       \
+#define LOOKUP_TYPE(type, length)                                   \
+  const char *lookup##type(size_t val)                              \
+  {                                                                 \
+    const LookupEntry *e = lookupTableFind(&lookupTable##type, val); \
+    if (e != NULL)                                                  \
+    {                                                               \
+      return e->name;                                               \
+    }                                                               \
     {
-#define LOOKUP_TRIPLET(type, n1, n2, str) \
-  case n1 * 256 + n2:                     \
-    return str;
-
-#define LOOKUP_TYPE_TRIPLET(type, length)            \
-  const char *lookup##type(size_t val1, size_t val2) \
-  {                                                  \
-    switch (val1 * 256 + val2)                       \
+#define LOOKUP(type, n, str)
+
+#define LOOKUP_TYPE_BITFIELD(type, length) LOOKUP_TYPE(type, length)
+#define LOOKUP_BITFIELD(type, n, str)
+
+#define LOOKUP_TYPE_TRIPLET(type, length)                                          \
+  const char *lookup##type(size_t val1, size_t val2)                               \
+  {                                                                                \
+    const LookupEntry *e = lookupTableFindTriplet(&lookupTable##type, val1, val2); \
+    if (e != NULL)                                                                 \
+    {                                                                              \
+      return e->name;                                                              \
+    }                                                                              \
     {
-#define LOOKUP_TRIPLET(type, n1, n2, str) \
-  case n1 * 256 + n2:                     \
-    return str;
+#define LOOKUP_TRIPLET(type, n1, n2, str)
 
 #define LOOKUP_TYPE_FIELDTYPE(type, length) \
   const char *lookup##type(size_t val)      \
@@ -124,6 +116,7 @@ limitations under the License.
       f.lookup.size                   = bits;                    \
       f.lookup.type                   = LOOKUP_TYPE_##lt;        \
       f.lookup.LOOKUP_##lt##_FUNCTION = lookup##ln;              \
+      f.lookup.table                  = &lookupTable##ln;        \
       fillFieldTypeLookupField(&f, xstr(ftype), n, str, ft);     \
     }                                                            \
     g_ftf = &f;                                                  \
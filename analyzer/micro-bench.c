@@ -0,0 +1,808 @@
+/*
+
+Microbenchmarks for the analyzer's inner loops: extractNumber(), the input
+parsers, fast-packet and ISO-TP reassembly, the timestamp helpers,
+sbAppendFormatV(), utf16_to_utf8(), the fieldPrint*() functions and the
+keel-generated PGN decoders.
+
+analyzer.c is included rather than linked so the static reassembly code is
+reachable; its main() is renamed out of the way.
+
+Methodology: each kernel is first calibrated to run for about
+BENCH_SAMPLE_NS per sample, then run BENCH_WARMUP times untimed, then
+timed for `-r` samples. The report gives the fastest and the median sample
+in ns per operation, the median in cycle-counter ticks per operation where
+the CPU has one (x86 TSC, AArch64 CNTVCT; these count at a fixed reference
+rate, not core clock), and the spread (max - min) / median of the samples.
+A spread above a few percent means the machine was not quiet.
+
+(C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+
+This file is part of CANboat.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#define main analyzerMain
+#include "analyzer.c"
+#undef main
+
+#include "utf.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAS_CYCLE_COUNTER
+static inline uint64_t readCycles(void)
+{
+  return __rdtsc();
+}
+#elif defined(__aarch64__)
+#define HAS_CYCLE_COUNTER
+static inline uint64_t readCycles(void)
+{
+  uint64_t v;
+
+  __asm__ volatile("mrs %0, cntvct_el0" : "=r"(v));
+  return v;
+}
+#else
+static inline uint64_t readCycles(void)
+{
+  return 0;
+}
+#endif
+
+#define BENCH_SAMPLE_NS (20000000) /* Calibrated length of one timed sample */
+#define BENCH_WARMUP (2)
+#define BENCH_MAX_REPEAT (51)
+
+typedef void (*BenchFn)(const void *ctx, size_t iterations);
+
+static int          benchRepeat = 11;
+static char       **benchFilter;
+static int          benchFilterCount;
+static FILE        *report;
+static char        *sinkData;
+static size_t       sinkLen;
+static volatile int64_t sink;
+static uint8_t      benchData[MAX_PGN_SIZE];
+
+static uint64_t nowNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+static int compareDouble(const void *a, const void *b)
+{
+  double x = *(const double *) a;
+  double y = *(const double *) b;
+
+  return (x > y) - (x < y);
+}
+
+static bool isSelected(const char *name)
+{
+  if (benchFilterCount == 0)
+  {
+    return true;
+  }
+  for (int i = 0; i < benchFilterCount; i++)
+  {
+    if (strstr(name, benchFilter[i]) != NULL)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* The analyzer writes every decoded message to stdout; keep that in memory so
+ * that the kernels are not timed against write(2). Rewound between samples.
+ */
+static void resetSink(void)
+{
+  fflush(stdout);
+  rewind(stdout);
+  mreset();
+}
+
+static void runBench(const char *name, BenchFn fn, const void *ctx)
+{
+  double   ns[BENCH_MAX_REPEAT];
+  double   ticks[BENCH_MAX_REPEAT];
+  size_t   iterations = 1;
+  uint64_t elapsed;
+
+  if (!isSelected(name))
+  {
+    return;
+  }
+
+  for (;;)
+  {
+    uint64_t start = nowNs();
+
+    fn(ctx, iterations);
+    elapsed = nowNs() - start;
+    resetSink();
+    if (elapsed >= BENCH_SAMPLE_NS / 8 || iterations >= (SIZE_MAX >> 4))
+    {
+      break;
+    }
+    iterations *= 2;
+  }
+  iterations = CB_MAX(1, (size_t) ((double) iterations * BENCH_SAMPLE_NS / CB_MAX(elapsed, 1)));
+
+  for (int i = 0; i < BENCH_WARMUP; i++)
+  {
+    fn(ctx, iterations);
+    resetSink();
+  }
+  for (int i = 0; i < benchRepeat; i++)
+  {
+    uint64_t start  = nowNs();
+    uint64_t cycles = readCycles();
+
+    fn(ctx, iterations);
+    cycles = readCycles() - cycles;
+    ns[i]    = (double) (nowNs() - start) / iterations;
+    ticks[i] = (double) cycles / iterations;
+    resetSink();
+  }
+  qsort(ns, benchRepeat, sizeof(ns[0]), compareDouble);
+  qsort(ticks, benchRepeat, sizeof(ticks[0]), compareDouble);
+
+  fprintf(report,
+          "%-46s %10.1f %10.1f %10.1f %7.1f%%\n",
+          name,
+          ns[0],
+          ns[benchRepeat / 2],
+          ticks[benchRepeat / 2],
+          100.0 * (ns[benchRepeat - 1] - ns[0]) / ns[benchRepeat / 2]);
+  fflush(report);
+}
+
+/* extractNumber() */
+
+typedef struct
+{
+  size_t startBit;
+  size_t bits;
+} ExtractCase;
+
+static void benchExtractNumber(const void *ctx, size_t iterations)
+{
+  const ExtractCase *c = ctx;
+  int64_t            value;
+  int64_t            maxValue;
+  int64_t            acc = 0;
+
+  for (size_t i = 0; i < iterations; i++)
+  {
+    extractNumber(NULL, benchData + (i & 63), 16, c->startBit, c->bits, &value, &maxValue);
+    acc += value;
+  }
+  sink = acc;
+}
+
+/* Input parsers. They tokenize in place, so each iteration parses a fresh
+ * copy of the line; the copy is part of the cost, as it is in main().
+ * parseRawFormatAirmar is absent: it sizes the payload as strlen / 2 but
+ * wants a separator after every byte, so it only accepts one-byte frames.
+ */
+
+typedef struct
+{
+  const char *name;
+  const char *line;
+  int (*parse)(char *msg, RawMessage *m, bool showJson);
+} ParseCase;
+
+static int parseGarminCSVRelative(char *msg, RawMessage *m, bool json)
+{
+  return parseRawFormatGarminCSV(msg, m, json, false);
+}
+
+static const ParseCase parseCases[] = {
+    {"parseRawFormatPlain", "2011-11-24-22:42:04.388,2,127251,36,255,8,7d,0b,7d,02,00,ff,ff,ff\n", parseRawFormatPlain},
+    {"parseRawFormatFast",
+     "2026-06-08T01:51:24.232,3,129029,52,255,43,ff,84,50,90,ed,fb,03,c0,f2,28,38,52,24,f4,02,00,66,c0,75,30,4b,18,ea,d7,8a,43,01,"
+     "00,00,00,00,24,fc,1a,32,00,46,00,4a,01,00,00,00\n",
+     parseRawFormatFast},
+    {"parseRawFormatChetco", "$PCDIN,01F119,00000000,0F,2AAF00D1067414FF*59\n", parseRawFormatChetco},
+    {"parseRawFormatGarminCSV", "0,486942,127508,Battery Status,Garmin,6,255,2,1,8,0x017505FF7FFFFFFF\n", parseGarminCSVRelative},
+    {"parseRawFormatYDWG02", "00:29:58.617 R 0DFF180D A2 8C 50 C0 FF FF FF FF\n", parseRawFormatYDWG02},
+    {"parseRawFormatActisenseN2KAscii", "A000159.990 CCFF7 0FF63 3B9F0000000002FF\n", parseRawFormatActisenseN2KAscii},
+};
+
+static void benchParse(const void *ctx, size_t iterations)
+{
+  const ParseCase *c   = ctx;
+  size_t           len = strlen(c->line) + 1;
+  char             line[MAX_MSG_LINE_LENGTH];
+  RawMessage       m;
+  int64_t          acc = 0;
+
+  for (size_t i = 0; i < iterations; i++)
+  {
+    memcpy(line, c->line, len);
+    acc += c->parse(line, &m, true) + m.len;
+  }
+  sink = acc;
+}
+
+/* Fast-packet and ISO-TP reassembly. The frames of one message are fed in a
+ * fixed order; every message uses the next sequence counter, as on a bus.
+ */
+
+#define FAST_PGN 129029
+#define FAST_SIZE 43
+#define FAST_FRAMES (1 + (FAST_SIZE - FASTPACKET_BUCKET_0_SIZE + FASTPACKET_BUCKET_N_SIZE - 1) / FASTPACKET_BUCKET_N_SIZE)
+
+static const uint8_t fastPayload[FAST_SIZE] = {0xff, 0x84, 0x50, 0x90, 0xed, 0xfb, 0x03, 0xc0, 0xf2, 0x28, 0x38,
+                                               0x52, 0x24, 0xf4, 0x02, 0x00, 0x66, 0xc0, 0x75, 0x30, 0x4b, 0x18,
+                                               0xea, 0xd7, 0x8a, 0x43, 0x01, 0x00, 0x00, 0x00, 0x00, 0x24, 0xfc,
+                                               0x1a, 0x32, 0x00, 0x46, 0x00, 0x4a, 0x01, 0x00, 0x00, 0x00};
+
+typedef struct
+{
+  const uint8_t *order; /* FAST_FRAMES frame indexes, or NULL to decode the assembled payload directly */
+} FastCase;
+
+static const uint8_t fastInOrder[FAST_FRAMES]   = {0, 1, 2, 3, 4, 5, 6};
+static const uint8_t fastReordered[FAST_FRAMES] = {2, 0, 4, 1, 6, 3, 5};
+
+static void makeFastFrame(RawMessage *msg, uint8_t seq, uint8_t frame)
+{
+  strcpy(msg->timestamp, "2026-06-08T01:51:24.232Z");
+  msg->prio    = 3;
+  msg->pgn     = FAST_PGN;
+  msg->src     = 52;
+  msg->dst     = 255;
+  msg->len     = 8;
+  msg->data[0] = (uint8_t) ((seq << 5) | frame);
+  if (frame == 0)
+  {
+    msg->data[1] = FAST_SIZE;
+    memcpy(&msg->data[2], fastPayload, FASTPACKET_BUCKET_0_SIZE);
+  }
+  else
+  {
+    size_t idx = FASTPACKET_BUCKET_0_SIZE + (frame - 1) * FASTPACKET_BUCKET_N_SIZE;
+
+    memset(&msg->data[1], 0xff, FASTPACKET_BUCKET_N_SIZE);
+    memcpy(&msg->data[1], fastPayload + idx, CB_MIN(FASTPACKET_BUCKET_N_SIZE, FAST_SIZE - idx));
+  }
+}
+
+static void benchFastPacket(const void *ctx, size_t iterations)
+{
+  const FastCase *c = ctx;
+  RawMessage      msg;
+
+  for (size_t i = 0; i < iterations; i++)
+  {
+    if (c->order == NULL)
+    {
+      makeFastFrame(&msg, 0, 0);
+      printPgn(&msg, fastPayload, FAST_SIZE, false, showJson);
+    }
+    else
+    {
+      for (size_t f = 0; f < FAST_FRAMES; f++)
+      {
+        makeFastFrame(&msg, (uint8_t) (i & 7), c->order[f]);
+        printCanFormat(&msg);
+      }
+    }
+    if ((i & 255) == 255)
+    {
+      resetSink();
+    }
+  }
+}
+
+#define ISO_TP_SIZE (223)
+#define ISO_TP_PACKETS ((ISO_TP_SIZE + FASTPACKET_BUCKET_N_SIZE - 1) / FASTPACKET_BUCKET_N_SIZE)
+
+typedef struct
+{
+  bool reversed; /* Data transfer packets in reverse sequence order */
+} IsoTpCase;
+
+static void benchIsoTp(const void *ctx, size_t iterations)
+{
+  const IsoTpCase *c = ctx;
+  RawMessage       msg;
+
+  strcpy(msg.timestamp, "2026-06-08T01:51:24.232Z");
+  msg.prio = 6;
+  msg.src  = 17;
+  msg.dst  = 255;
+  msg.len  = 8;
+  for (size_t i = 0; i < iterations; i++)
+  {
+    msg.pgn     = PGN_ISO_TP_CM;
+    msg.data[0] = ISO_TP_CM_BAM;
+    msg.data[1] = ISO_TP_SIZE & 0xff;
+    msg.data[2] = ISO_TP_SIZE >> 8;
+    msg.data[3] = ISO_TP_PACKETS;
+    msg.data[4] = 0xff;
+    msg.data[5] = 0x00; // Target PGN 65280, filtered out below so nothing is decoded
+    msg.data[6] = 0xff;
+    msg.data[7] = 0x00;
+    printCanFormat(&msg);
+
+    msg.pgn = PGN_ISO_TP_DT;
+    for (size_t p = 0; p < ISO_TP_PACKETS; p++)
+    {
+      msg.data[0] = (uint8_t) (c->reversed ? ISO_TP_PACKETS - p : p + 1);
+      memcpy(&msg.data[1], benchData + p, FASTPACKET_BUCKET_N_SIZE);
+      printCanFormat(&msg);
+    }
+  }
+}
+
+/* The generated decoders, on single-frame PGNs that are mostly numbers. Each
+ * is timed with its numeric fields printed inline, with every field going
+ * through printField() (as with -si or -bytes), and through the generic
+ * printFields() loop (as with -generic).
+ */
+
+typedef enum
+{
+  DECODE_INLINE,
+  DECODE_PRINT_FIELD,
+  DECODE_GENERIC
+} DecodeMode;
+
+typedef struct
+{
+  const char *name;
+  uint32_t    pgn;
+  uint8_t     data[8];
+} DecodeCase;
+
+static const DecodeCase decodeCases[] = {
+    {"127488 engine rapid", 127488, {0x00, 0x40, 0x1f, 0x64, 0x00, 0x05, 0xff, 0xff}},
+    {"127250 vessel heading", 127250, {0x01, 0x10, 0x27, 0xff, 0x7f, 0x32, 0x00, 0xfd}},
+    {"130306 wind data", 130306, {0x02, 0xf4, 0x01, 0x80, 0x3e, 0xfa, 0xff, 0xff}},
+    {"130312 temperature", 130312, {0x03, 0x01, 0x02, 0x9b, 0x73, 0xff, 0xff, 0xff}},
+};
+
+static const char *decodeModeNames[] = {"inline", "printField", "generic"};
+
+typedef struct
+{
+  const DecodeCase *c;
+  DecodeMode        mode;
+} DecodeRun;
+
+static Pgn *findPgn(uint32_t pgn)
+{
+  for (size_t i = 0; i < pgnListSize; i++)
+  {
+    if (pgnList[i].pgn == pgn)
+    {
+      return &pgnList[i];
+    }
+  }
+  return NULL;
+}
+
+static void benchDecode(const void *ctx, size_t iterations)
+{
+  const DecodeRun *run     = ctx;
+  Pgn             *pgn     = findPgn(run->c->pgn);
+  PgnDecoder       decoder = pgn->decoder;
+  bool             wasInline = inlineNumbers;
+  RawMessage       msg;
+
+  strcpy(msg.timestamp, "2026-06-08T01:51:24.232Z");
+  msg.prio = 2;
+  msg.pgn  = run->c->pgn;
+  msg.src  = 17;
+  msg.dst  = 255;
+  msg.len  = sizeof(run->c->data);
+  memcpy(msg.data, run->c->data, sizeof(run->c->data));
+
+  inlineNumbers = (run->mode == DECODE_INLINE);
+  if (run->mode == DECODE_GENERIC)
+  {
+    pgn->decoder = NULL;
+  }
+  for (size_t i = 0; i < iterations; i++)
+  {
+    printPgn(&msg, msg.data, msg.len, false, showJson);
+    if ((i & 255) == 255)
+    {
+      resetSink();
+    }
+  }
+  pgn->decoder  = decoder;
+  inlineNumbers = wasInline;
+}
+
+/* Timestamps */
+
+static void benchFmtTimestamp(const void *ctx, size_t iterations)
+{
+  char     str[DATE_LENGTH];
+  uint64_t when = UINT64_C(1780000000000);
+  int64_t  acc  = 0;
+
+  (void) ctx;
+  for (size_t i = 0; i < iterations; i++)
+  {
+    acc += fmtTimestamp(str, when + i)[22]; // One message per ms
+  }
+  sink = acc;
+}
+
+static void benchFmtTimestampUs(const void *ctx, size_t iterations)
+{
+  char     str[DATE_LENGTH];
+  uint64_t when = UINT64_C(1780000000000000);
+  int64_t  acc  = 0;
+
+  (void) ctx;
+  for (size_t i = 0; i < iterations; i++)
+  {
+    acc += fmtTimestampUs(str, when + i * 250)[25]; // One message per 250 us
+  }
+  sink = acc;
+}
+
+static void benchNormalizeTimestamp(const void *ctx, size_t iterations)
+{
+  const char *in = ctx;
+  char        out[DATE_LENGTH];
+  int64_t     acc = 0;
+
+  for (size_t i = 0; i < iterations; i++)
+  {
+    normalizeTimestamp(in, out, sizeof(out));
+    acc += out[0];
+  }
+  sink = acc;
+}
+
+static void benchScanTimestamp(const void *ctx, size_t iterations)
+{
+  const char *in = ctx;
+  uint64_t    when;
+  int64_t     acc = 0;
+
+  for (size_t i = 0; i < iterations; i++)
+  {
+    scanTimestamp(in, &when);
+    acc += (int64_t) when;
+  }
+  sink = acc;
+}
+
+/* sbAppendFormatV(), by way of sbAppendFormat() */
+
+typedef enum
+{
+  FORMAT_STRING,
+  FORMAT_INTS,
+  FORMAT_DOUBLE,
+  FORMAT_INT64
+} FormatCase;
+
+static void benchFormat(const void *ctx, size_t iterations)
+{
+  FormatCase   c  = *(const FormatCase *) ctx;
+  StringBuffer sb = sbNew;
+
+  for (size_t i = 0; i < iterations; i++)
+  {
+    switch (c)
+    {
+      case FORMAT_STRING:
+        sbAppendFormat(&sb, ",\"%s\":", "Wind Speed");
+        break;
+      case FORMAT_INTS:
+        sbAppendFormat(&sb, "%u,%u,%u,", (unsigned) i & 7, (unsigned) i & 255, 127251U);
+        break;
+      case FORMAT_DOUBLE:
+        sbAppendFormat(&sb, "%.3f", (double) i * 0.01);
+        break;
+      case FORMAT_INT64:
+        sbAppendFormat(&sb, "%" PRId64, (int64_t) i * 1000003);
+        break;
+    }
+    if ((i & 1023) == 1023)
+    {
+      sbEmpty(&sb);
+    }
+  }
+  sink = (int64_t) sbGetLength(&sb);
+  sbClean(&sb);
+}
+
+/* utf16_to_utf8() */
+
+typedef struct
+{
+  utf16_t text[32];
+  size_t  len;
+} Utf16Case;
+
+static const Utf16Case utf16Ascii = {{'S', 'e', 'a', 't', 'a', 'l', 'k', ' ', 'N', 'G', ' ', 'p', 'i', 'l', 'o', 't',
+                                      ' ', 'c', 'o', 'n', 't', 'r', 'o', 'l', 'l', 'e', 'r', ' ', 'p', '7', '0', 's'},
+                                     32};
+static const Utf16Case utf16Mixed = {{'K', 0x00f6, 'r', 's', ' ', 0x20ac, ' ', 0xd83d, 0xdea2, ' ', 'B', 0x00e5, 't', 0x00e6,
+                                      'r', 'e', ' ', 0x00d8, 's', 't', ' ', 0x4e1c, 0x6d77, ' ', 0xd83c, 0xdf0a, ' ', 'e',
+                                      'n', 'd', '.', '!'},
+                                     32};
+
+static void benchUtf16(const void *ctx, size_t iterations)
+{
+  const Utf16Case *c = ctx;
+  utf8_t           out[4 * 32 + 1];
+  int64_t          acc = 0;
+
+  for (size_t i = 0; i < iterations; i++)
+  {
+    acc += utf16_to_utf8(c->text, c->len, out, sizeof(out));
+  }
+  sink = acc;
+}
+
+/* fieldPrint*() */
+
+typedef struct
+{
+  const char            *name;
+  FieldPrintFunctionType pf;
+} PrintFunction;
+
+/* fieldPrintVariable and fieldPrintKeyValue depend on the fields decoded
+ * before them and are only meaningful through printFields().
+ */
+static const PrintFunction printFunctions[] = {
+    {"fieldPrintBinary", fieldPrintBinary},
+    {"fieldPrintBitLookup", fieldPrintBitLookup},
+    {"fieldPrintDate", fieldPrintDate},
+    {"fieldPrintDecimal", fieldPrintDecimal},
+    {"fieldPrintFloat", fieldPrintFloat},
+    {"fieldPrintLatLon", fieldPrintLatLon},
+    {"fieldPrintLookup", fieldPrintLookup},
+    {"fieldPrintMMSI", fieldPrintMMSI},
+    {"fieldPrintName", fieldPrintName},
+    {"fieldPrintNumber", fieldPrintNumber},
+    {"fieldPrintPGN", fieldPrintPGN},
+    {"fieldPrintReserved", fieldPrintReserved},
+    {"fieldPrintSpare", fieldPrintSpare},
+    {"fieldPrintStringFix", fieldPrintStringFix},
+    {"fieldPrintStringLAU", fieldPrintStringLAU},
+    {"fieldPrintStringLZ", fieldPrintStringLZ},
+    {"fieldPrintTime", fieldPrintTime},
+};
+
+typedef struct
+{
+  const Field   *field;
+  const uint8_t *data;
+} PrintCase;
+
+/* A length-and-encoding prefixed ASCII string, for STRING_LAU and STRING_LZ. */
+static const uint8_t stringData[MAX_PGN_SIZE] = {18, 1, 'S', 'a', 'i', 'l', 'i', 'n', 'g', ' ', 'v', 'e', 's', 's', 'e', 'l', ' ', '1'};
+
+static void benchFieldPrint(const void *ctx, size_t iterations)
+{
+  const PrintCase *c     = ctx;
+  const Field     *field = c->field;
+  int64_t          acc   = 0;
+
+  for (size_t i = 0; i < iterations; i++)
+  {
+    size_t bits = (field->size != 0) ? field->size : field->ft->size; // As printField() sizes it
+
+    mreset();
+    acc += (field->ft->pf)(field, field->name, c->data, MAX_PGN_SIZE, 0, &bits);
+  }
+  sink = acc;
+}
+
+/* The first field in the PGN list that is printed with `pf`, preferring one
+ * with a fixed size so the printer is timed on a typical width.
+ */
+static const Field *findFieldFor(FieldPrintFunctionType pf)
+{
+  const Field *variable = NULL;
+
+  for (size_t i = 0; i < pgnListSize; i++)
+  {
+    for (size_t j = 0; j < pgnList[i].fieldCount; j++)
+    {
+      const Field *f = &pgnList[i].fieldList[j];
+
+      if (f->ft == NULL || f->ft->pf != pf || f->proprietary)
+      {
+        continue;
+      }
+      if (f->size != 0 || f->ft->size != 0)
+      {
+        return f;
+      }
+      if (variable == NULL)
+      {
+        variable = f;
+      }
+    }
+  }
+  return variable;
+}
+
+static void benchUsage(char **argv)
+{
+  fprintf(stderr,
+          "Usage: %s [-r repetitions] [-list] [name-substring ...]\n"
+          "  Runs every microbenchmark whose name contains one of the substrings (default all).\n",
+          argv[0]);
+  exit(1);
+}
+
+int main(int argc, char **argv)
+{
+  static const ExtractCase extractCases[] = {{0, 1},  {3, 1},  {0, 4},  {3, 4},  {0, 8},  {3, 8},  {0, 12},
+                                             {3, 12}, {0, 16}, {3, 16}, {0, 32}, {3, 32}, {0, 64}, {3, 60}};
+  static const FastCase    fastDecode    = {NULL};
+  static const FastCase    fastOrdered   = {fastInOrder};
+  static const FastCase    fastShuffled  = {fastReordered};
+  static const IsoTpCase   isoTpOrdered  = {false};
+  static const IsoTpCase   isoTpReversed = {true};
+  static const FormatCase  formatCases[] = {FORMAT_STRING, FORMAT_INTS, FORMAT_DOUBLE, FORMAT_INT64};
+  static const char       *formatNames[] = {"\"%s\"", "%u,%u,%u", "%.3f", "%" PRId64};
+  char                     name[128];
+
+  setProgName(argv[0]);
+  for (int i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+    {
+      benchRepeat = atoi(argv[++i]);
+      benchRepeat = CB_MIN(CB_MAX(benchRepeat, 1), BENCH_MAX_REPEAT);
+    }
+    else if (argv[i][0] == '-')
+    {
+      benchUsage(argv);
+    }
+    else
+    {
+      benchFilter      = &argv[i];
+      benchFilterCount = argc - i;
+      break;
+    }
+  }
+
+  for (size_t i = 0; i < sizeof(benchData); i++)
+  {
+    benchData[i] = (uint8_t) (i * 37 + 1);
+  }
+
+  showJson = true;
+  fillLookups();
+  fillFieldType(true);
+  checkPgnList();
+  attachPgnDecoders();
+
+  report = stdout;
+  stdout = open_memstream(&sinkData, &sinkLen);
+  if (stdout == NULL)
+  {
+    die("Cannot open memory stream");
+  }
+
+  fprintf(report,
+          "%-46s %10s %10s %10s %8s\n",
+          "kernel (per operation)",
+          "min ns",
+          "median ns",
+#ifdef HAS_CYCLE_COUNTER
+          "ticks",
+#else
+          "-",
+#endif
+          "spread");
+
+  for (size_t i = 0; i < ARRAY_SIZE(extractCases); i++)
+  {
+    snprintf(name, sizeof(name), "extractNumber/%zu bits at bit %zu", extractCases[i].bits, extractCases[i].startBit);
+    runBench(name, benchExtractNumber, &extractCases[i]);
+  }
+
+  for (size_t i = 0; i < ARRAY_SIZE(parseCases); i++)
+  {
+    char       line[MAX_MSG_LINE_LENGTH];
+    RawMessage m;
+    int        r;
+
+    strcpy(line, parseCases[i].line);
+    r = parseCases[i].parse(line, &m, true);
+    if (r != 0)
+    {
+      logError("%s rejects its sample line (%d); skipped\n", parseCases[i].name, r);
+      continue;
+    }
+    snprintf(name, sizeof(name), "parse/%s", parseCases[i].name);
+    runBench(name, benchParse, &parseCases[i]);
+  }
+
+  runBench("reassembly/fast-packet decode only", benchFastPacket, &fastDecode);
+  runBench("reassembly/fast-packet in order + decode", benchFastPacket, &fastOrdered);
+  runBench("reassembly/fast-packet reordered + decode", benchFastPacket, &fastShuffled);
+  onlyPgn        = 1; // Reassemble ISO-TP transfers without decoding them
+  onlyPgnList[0] = 1;
+  runBench("reassembly/iso-tp 223 bytes in order", benchIsoTp, &isoTpOrdered);
+  runBench("reassembly/iso-tp 223 bytes reversed", benchIsoTp, &isoTpReversed);
+  onlyPgn = 0;
+
+  for (size_t i = 0; i < ARRAY_SIZE(decodeCases); i++)
+  {
+    for (DecodeMode mode = DECODE_INLINE; mode <= DECODE_GENERIC; mode++)
+    {
+      DecodeRun run = {&decodeCases[i], mode};
+
+      if (findPgn(decodeCases[i].pgn) == NULL || findPgn(decodeCases[i].pgn)->decoder == NULL)
+      {
+        continue;
+      }
+      snprintf(name, sizeof(name), "decode/%s %s", decodeCases[i].name, decodeModeNames[mode]);
+      runBench(name, benchDecode, &run);
+    }
+  }
+
+  runBench("time/fmtTimestamp", benchFmtTimestamp, NULL);
+  runBench("time/fmtTimestampUs", benchFmtTimestampUs, NULL);
+  runBench("time/normalizeTimestamp canonical", benchNormalizeTimestamp, "2026-06-08T01:51:24.232Z");
+  runBench("time/normalizeTimestamp dashed", benchNormalizeTimestamp, "2011-11-24-22:42:04.388");
+  runBench("time/normalizeTimestamp time of day", benchNormalizeTimestamp, "00:29:58.617");
+  runBench("time/scanTimestamp", benchScanTimestamp, "2026-06-08T01:51:24.232Z");
+
+  for (size_t i = 0; i < ARRAY_SIZE(formatCases); i++)
+  {
+    snprintf(name, sizeof(name), "sbAppendFormatV/%s", formatNames[i]);
+    runBench(name, benchFormat, &formatCases[i]);
+  }
+
+  runBench("utf16_to_utf8/32 ascii", benchUtf16, &utf16Ascii);
+  runBench("utf16_to_utf8/32 mixed", benchUtf16, &utf16Mixed);
+
+  for (size_t i = 0; i < ARRAY_SIZE(printFunctions); i++)
+  {
+    PrintCase c = {findFieldFor(printFunctions[i].pf), benchData};
+
+    if (c.field == NULL)
+    {
+      continue;
+    }
+    if (c.field->ft->pf == fieldPrintStringLAU || c.field->ft->pf == fieldPrintStringLZ)
+    {
+      c.data = stringData;
+    }
+    snprintf(name, sizeof(name), "print/%s (%s)", printFunctions[i].name, c.field->ft->name);
+    runBench(name, benchFieldPrint, &c);
+  }
+
+  fclose(stdout);
+  free(sinkData);
+  return 0;
+}
@@ -0,0 +1,9318 @@
+/* ==========================================================================
+*
+*   GENERATED FILE - DO NOT EDIT.
+*
+*   Every line below is written by `keel` from the YAML database in
+*   database/. Editing this file achieves nothing: the next `make generated`
+*   overwrites it, and CI fails the build on the resulting diff.
+*
+*   To change a PGN, a lookup or a field type, edit the YAML:
+*
+*       database/pgns/<pgn>-<id>.yaml     one file per PGN variant
+*       database/lookups/<NAME>.yaml      one file per enumeration
+*       database/fieldtypes.yaml          the field-type hierarchy
+*
+*   then regenerate and check it in:
+*
+*       make generated
+*
+*   See keel/DESIGN.md, or run `keel edit` for the browser editor.
+*
+* ==========================================================================
+*
+* (C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+* Part of CANboat; licensed under the Apache License, Version 2.0.
+*/
+
+/* 59392 0xe8000xeeffStandardizedSingleFrameAddressed: 1 field(s), 8 byte(s) */
+static bool decode0xe8000xeeffStandardizedSingleFrameAddressed(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 59392 isoAcknowledgement: 4 field(s), 8 byte(s) */
+static bool decodeIsoAcknowledgement(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[1], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 59904 isoRequest: 1 field(s), 3 byte(s) */
+static bool decodeIsoRequest(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length > 3)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 3);
+  }
+  return true;
+}
+
+/* 60160 isoTransportProtocolDataTransfer: 2 field(s), 8 byte(s) */
+static bool decodeIsoTransportProtocolDataTransfer(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[0], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 60416 isoTransportProtocolConnectionManagementRequestToSend: 5 field(s), 8 byte(s) */
+static bool decodeIsoTransportProtocolConnectionManagementRequestToSend(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[1] | ((uint64_t) data[2] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[2], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) data[4]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[3], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[4], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 60416 isoTransportProtocolConnectionManagementClearToSend: 5 field(s), 8 byte(s) */
+static bool decodeIsoTransportProtocolConnectionManagementClearToSend(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[1], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[2]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[2], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[4], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 60416 isoTransportProtocolConnectionManagementEndOfMessage: 5 field(s), 8 byte(s) */
+static bool decodeIsoTransportProtocolConnectionManagementEndOfMessage(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[1] | ((uint64_t) data[2] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[2], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[4], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 60416 isoTransportProtocolConnectionManagementBroadcastAnnounce: 5 field(s), 8 byte(s) */
+static bool decodeIsoTransportProtocolConnectionManagementBroadcastAnnounce(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[1] | ((uint64_t) data[2] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[2], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[4], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 60416 isoTransportProtocolConnectionManagementAbort: 4 field(s), 8 byte(s) */
+static bool decodeIsoTransportProtocolConnectionManagementAbort(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 60928 isoAddressClaim: 10 field(s), 8 byte(s) */
+static bool decodeIsoAddressClaim(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) (data[2] & 0x1f) << 16));
+    if (value > 2097148)
+    {
+      printInlineEmpty(&f[0], value - 2097151);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 21, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) (data[4] & 0x7));
+    if (value > 6)
+    {
+      printInlineEmpty(&f[2], value - 7);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) (data[4] >> 3));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[3], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 35, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[4], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[5], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[6], NULL, data, length, 49, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) (data[7] & 0xf));
+    if (value > 13)
+    {
+      printInlineEmpty(&f[7], value - 15);
+    }
+    else
+    {
+      printInlineKey(&f[7]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[7], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[8], NULL, data, length, 60, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) (data[7] >> 7));
+    if (value > 1)
+    {
+      printInlineEmpty(&f[9], value - 1);
+    }
+    else
+    {
+      printInlineKey(&f[9]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[9], NULL, data, length, 63, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 61184 0xef00ManufacturerProprietarySingleFrameAddressed: 4 field(s), 8 byte(s) */
+static bool decode0xef00ManufacturerProprietarySingleFrameAddressed(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 11, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[2], NULL, data, length, 13, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 61440 0xf0000xfeffStandardizedSingleFrameNonAddressed: 4 field(s), 8 byte(s) */
+static bool decode0xf0000xfeffStandardizedSingleFrameNonAddressed(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 11, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[2], NULL, data, length, 13, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 61442 electronicTransmissionController1: 11 field(s), 8 byte(s) */
+static bool decodeElectronicTransmissionController1(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) (data[0] & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[0], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) ((data[0] >> 2) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[1], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 2, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) ((data[0] >> 4) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[2], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 4, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) (data[0] >> 6));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[3], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 6, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[1] | ((uint64_t) data[2] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[4], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.25;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f rpm", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[5], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[5]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (!printField(&f[6], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[7], NULL, data, length, 34, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[8], NULL, data, length, 36, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) data[5] | ((uint64_t) data[6] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[9], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[9]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[9], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[7]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[10], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[10]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[10], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 61443 ecu2: 13 field(s), 8 byte(s) */
+static bool decodeEcu2(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) (data[0] & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[0], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) ((data[0] >> 2) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[1], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 2, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) ((data[0] >> 4) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[2], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 4, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) (data[0] >> 6));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[3], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 6, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[4], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[2]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[5], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[5]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " %%", value);
+      }
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[6], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[6]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[6], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) data[4]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[7], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[7]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[7], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) (data[5] & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[8], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[8]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[8], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) ((data[5] >> 2) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[9], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[9]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[9], NULL, data, length, 42, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[10], NULL, data, length, 44, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) data[6]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[11], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[11]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[11], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[7]);
+    if (value & INT64_C(0x80))
+    {
+      value |= ~INT64_C(0x7f);
+    }
+    if (value > 124)
+    {
+      printInlineEmpty(&f[12], value - 127);
+    }
+    else
+    {
+      printInlineKey(&f[12]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " %%", value);
+      }
+    }
+  }
+  else if (!printField(&f[12], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 61444 ecu1: 9 field(s), 8 byte(s) */
+static bool decodeEcu1(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) (data[0] & 0xf));
+    if (value > 14)
+    {
+      printInlineEmpty(&f[0], value - 15);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) (data[0] >> 4));
+    if (value > 14)
+    {
+      printInlineEmpty(&f[1], value - 15);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 4, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    if (value & INT64_C(0x80))
+    {
+      value |= ~INT64_C(0x7f);
+    }
+    if (value > 124)
+    {
+      printInlineEmpty(&f[2], value - 127);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " %%", value);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[2]);
+    if (value & INT64_C(0x80))
+    {
+      value |= ~INT64_C(0x7f);
+    }
+    if (value > 124)
+    {
+      printInlineEmpty(&f[3], value - 127);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " %%", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) data[3] | ((uint64_t) data[4] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[4], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f rpm", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[5]);
+    if (value > 253)
+    {
+      printInlineEmpty(&f[5], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[5]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) (data[6] & 0xf));
+    if (value > 14)
+    {
+      printInlineEmpty(&f[6], value - 15);
+    }
+    else
+    {
+      printInlineKey(&f[6]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[6], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[7], NULL, data, length, 52, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[7]);
+    if (value & INT64_C(0x80))
+    {
+      value |= ~INT64_C(0x7f);
+    }
+    if (value > 124)
+    {
+      printInlineEmpty(&f[8], value - 127);
+    }
+    else
+    {
+      printInlineKey(&f[8]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " %%", value);
+      }
+    }
+  }
+  else if (!printField(&f[8], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 61445 electronicTransmissionController2: 5 field(s), 8 byte(s) */
+static bool decodeElectronicTransmissionController2(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    if (value & INT64_C(0x80))
+    {
+      value |= ~INT64_C(0x7f);
+    }
+    if (value > 124)
+    {
+      printInlineEmpty(&f[0], value - 127);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[1] | ((uint64_t) data[2] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[1]);
+      mprintf("%.3f", a);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value & INT64_C(0x80))
+    {
+      value |= ~INT64_C(0x7f);
+    }
+    if (value > 124)
+    {
+      printInlineEmpty(&f[2], value - 127);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[4], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 61450 engineGasFlowRate1: 4 field(s), 8 byte(s) */
+static bool decodeEngineGasFlowRate1(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.05;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f kg/h", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.05;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f kg/h", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.05;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f kg/h", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64709 aftertreatment1ScrExhaustGasTemperature2: 3 field(s), 8 byte(s) */
+static bool decodeAftertreatment1ScrExhaustGasTemperature2(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[0], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) (data[2] & 0x1f));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[1], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[2], NULL, data, length, 21, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64740 engineFuelProperties: 4 field(s), 8 byte(s) */
+static bool decodeEngineFuelProperties(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[3], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64751 engineFluidLevelPressure11: 4 field(s), 8 byte(s) */
+static bool decodeEngineFluidLevelPressure11(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64776 engineOilMessage: 4 field(s), 8 byte(s) */
+static bool decodeEngineOilMessage(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.015625;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f cP", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 3.05175781e-5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.5f", a);
+      }
+      else
+      {
+        mprintf("%.5f g/cm3", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0001220703125;
+
+      printInlineKey(&f[2]);
+      mprintf("%.4f", a);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[3], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64777 fuelConsumption: 2 field(s), 8 byte(s) */
+static bool decodeFuelConsumption(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[0], value - 4294967295);
+    }
+    else
+    {
+      double a = (double) value * 0.5;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f L", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[1], value - 4294967295);
+    }
+    else
+    {
+      double a = (double) value * 0.5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f L", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64800 aftertreatment1DieselOxidationCatalyst: 7 field(s), 8 byte(s) */
+static bool decodeAftertreatment1DieselOxidationCatalyst(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[0], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[1], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) (data[6] & 0x1f));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[3], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) (data[6] >> 5) | ((uint64_t) (data[7] & 0x3) << 3));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[4], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[4]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 53, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) ((data[7] >> 2) & 0x1f));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[5], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[5]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 58, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[6], NULL, data, length, 63, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64908 aftertreatment1GasParameters: 3 field(s), 8 byte(s) */
+static bool decodeAftertreatment1GasParameters(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64914 engineOperatingInformation: 18 field(s), 8 byte(s) */
+static bool decodeEngineOperatingInformation(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) (data[0] & 0xf));
+    if (value > 13)
+    {
+      printInlineEmpty(&f[0], value - 15);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) ((data[0] >> 4) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[1], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 4, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) (data[0] >> 6));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[2], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 6, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) (data[3] & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[4], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[4]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) ((data[3] >> 2) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[5], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[5]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 26, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) ((data[3] >> 4) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[6], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[6]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[6], NULL, data, length, 28, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) (data[3] >> 6));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[7], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[7]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[7], NULL, data, length, 30, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) (data[4] & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[8], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[8]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[8], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) ((data[4] >> 2) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[9], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[9]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[9], NULL, data, length, 34, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) ((data[4] >> 4) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[10], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[10]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[10], NULL, data, length, 36, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) (data[4] >> 6));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[11], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[11]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[11], NULL, data, length, 38, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) (data[5] & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[12], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[12]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[12], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) ((data[5] >> 2) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[13], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[13]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[13], NULL, data, length, 42, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) ((data[5] >> 4) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[14], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[14]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[14], NULL, data, length, 44, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) (data[5] >> 6));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[15], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[15]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[15], NULL, data, length, 46, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) data[6]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[16], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[16]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[16], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[7]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[17], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[17]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[17], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64946 aftertreatment1IntermediateGas: 7 field(s), 8 byte(s) */
+static bool decodeAftertreatment1IntermediateGas(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[0], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[1], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) (data[6] & 0x1f));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[3], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) (data[6] >> 5) | ((uint64_t) (data[7] & 0x3) << 3));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[4], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[4]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 53, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) ((data[7] >> 2) & 0x1f));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[5], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[5]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 58, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[6], NULL, data, length, 63, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64947 aftertreatment1OutletGas2: 6 field(s), 8 byte(s) */
+static bool decodeAftertreatment1OutletGas2(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[0], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) (data[4] & 0x1f));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[2], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 37, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) (data[5] & 0x1f));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[4], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[4]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[5], NULL, data, length, 45, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64948 aftertreatment1IntakeGas2: 6 field(s), 8 byte(s) */
+static bool decodeAftertreatment1IntakeGas2(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[0], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) (data[4] & 0x1f));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[2], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 37, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) (data[5] & 0x1f));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[4], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[4]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[5], NULL, data, length, 45, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 64976 intakeExhaustConditions2: 7 field(s), 8 byte(s) */
+static bool decodeIntakeExhaustConditions2(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[0], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.0005;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[1], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.0005;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[2]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[2], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.0005;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[3], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.02;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) data[4]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[4], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.1;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f kPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) data[5] | ((uint64_t) data[6] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[5], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001;
+
+      printInlineKey(&f[5]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[7]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[6], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.02;
+
+      printInlineKey(&f[6]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[6], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65001 bus1PhaseCBasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeBus1PhaseCBasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65002 bus1PhaseBBasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeBus1PhaseBBasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65003 bus1PhaseABasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeBus1PhaseABasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65004 bus1AverageBasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeBus1AverageBasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65005 utilityTotalAcEnergy: 2 field(s), 8 byte(s) */
+static bool decodeUtilityTotalAcEnergy(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[0], value - 4294967295);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " kWh", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[1], value - 4294967295);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " kWh", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65006 utilityPhaseCAcReactivePower: 4 field(s), 8 byte(s) */
+static bool decodeUtilityPhaseCAcReactivePower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VAR", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 6.103515625e-5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.5f", a);
+      }
+      else
+      {
+        mprintf("%.5f Cos Phi", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 34, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65007 utilityPhaseCAcPower: 2 field(s), 8 byte(s) */
+static bool decodeUtilityPhaseCAcPower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " W", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[1], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VA", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65008 utilityPhaseCBasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeUtilityPhaseCBasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " A", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65009 utilityPhaseBAcReactivePower: 4 field(s), 8 byte(s) */
+static bool decodeUtilityPhaseBAcReactivePower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VAR", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 6.103515625e-5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.5f", a);
+      }
+      else
+      {
+        mprintf("%.5f Cos Phi", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 34, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65010 utilityPhaseBAcPower: 2 field(s), 8 byte(s) */
+static bool decodeUtilityPhaseBAcPower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " W", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[1], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VA", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65011 utilityPhaseBBasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeUtilityPhaseBBasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " A", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65012 utilityPhaseAAcReactivePower: 4 field(s), 8 byte(s) */
+static bool decodeUtilityPhaseAAcReactivePower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VAR", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 6.103515625e-5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.5f", a);
+      }
+      else
+      {
+        mprintf("%.5f Cos Phi", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 50, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65013 utilityPhaseAAcPower: 2 field(s), 8 byte(s) */
+static bool decodeUtilityPhaseAAcPower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " W", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[1], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VA", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65014 utilityPhaseABasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeUtilityPhaseABasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " A", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65015 utilityTotalAcReactivePower: 4 field(s), 8 byte(s) */
+static bool decodeUtilityTotalAcReactivePower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VAR", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 6.103515625e-5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.5f", a);
+      }
+      else
+      {
+        mprintf("%.5f Cos Phi", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 50, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65016 utilityTotalAcPower: 2 field(s), 8 byte(s) */
+static bool decodeUtilityTotalAcPower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " W", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[1], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VA", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65017 utilityAverageBasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeUtilityAverageBasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " A", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65018 generatorTotalAcEnergy: 2 field(s), 8 byte(s) */
+static bool decodeGeneratorTotalAcEnergy(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[0], value - 4294967295);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " kWh", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[1], value - 4294967295);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " kWh", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65019 generatorPhaseCAcReactivePower: 4 field(s), 8 byte(s) */
+static bool decodeGeneratorPhaseCAcReactivePower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VAR", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 6.103515625e-5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.5f", a);
+      }
+      else
+      {
+        mprintf("%.5f Cos Phi", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 50, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65020 generatorPhaseCAcPower: 2 field(s), 8 byte(s) */
+static bool decodeGeneratorPhaseCAcPower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " W", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[1], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VA", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65021 generatorPhaseCBasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeGeneratorPhaseCBasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " A", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65022 generatorPhaseBAcReactivePower: 4 field(s), 8 byte(s) */
+static bool decodeGeneratorPhaseBAcReactivePower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VAR", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 6.103515625e-5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.5f", a);
+      }
+      else
+      {
+        mprintf("%.5f Cos Phi", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 50, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65023 generatorPhaseBAcPower: 2 field(s), 8 byte(s) */
+static bool decodeGeneratorPhaseBAcPower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " W", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[1], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VA", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65024 generatorPhaseBBasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeGeneratorPhaseBBasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " A", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65025 generatorPhaseAAcReactivePower: 4 field(s), 8 byte(s) */
+static bool decodeGeneratorPhaseAAcReactivePower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VAR", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 6.103515625e-5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.5f", a);
+      }
+      else
+      {
+        mprintf("%.5f Cos Phi", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 50, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65026 generatorPhaseAAcPower: 2 field(s), 8 byte(s) */
+static bool decodeGeneratorPhaseAAcPower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " W", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[1], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VA", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65027 generatorPhaseABasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeGeneratorPhaseABasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " A", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65028 generatorTotalAcReactivePower: 4 field(s), 8 byte(s) */
+static bool decodeGeneratorTotalAcReactivePower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VAR", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 6.103515625e-5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.5f", a);
+      }
+      else
+      {
+        mprintf("%.5f Cos Phi", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[3], NULL, data, length, 50, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65029 generatorTotalAcPower: 2 field(s), 8 byte(s) */
+static bool decodeGeneratorTotalAcPower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[0], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " W", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    value += -2000000000;
+    if (value > 147483644)
+    {
+      printInlineEmpty(&f[1], value - 147483647);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " VA", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65030 generatorAverageBasicAcQuantities: 4 field(s), 8 byte(s) */
+static bool decodeGeneratorAverageBasicAcQuantities(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " V", value);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f Hz", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " A", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65031 exhaustTemperature: 4 field(s), 8 byte(s) */
+static bool decodeExhaustTemperature(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[0], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[1], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[2], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[3], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65130 engineFuelLubeSystems: 13 field(s), 8 byte(s) */
+static bool decodeEngineFuelLubeSystems(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[0], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[1], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.02;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[2]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[2], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.02;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[3], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) data[4]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[4], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 4.0;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f kPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) (data[5] & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[5], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[5]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) ((data[5] >> 2) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[6], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[6]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[6], NULL, data, length, 42, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) ((data[5] >> 4) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[7], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[7]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[7], NULL, data, length, 44, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) (data[5] >> 6));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[8], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[8]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[8], NULL, data, length, 46, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) (data[6] & 0x7));
+    if (value > 6)
+    {
+      printInlineEmpty(&f[9], value - 7);
+    }
+    else
+    {
+      printInlineKey(&f[9]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[9], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) ((data[6] >> 3) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[10], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[10]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[10], NULL, data, length, 51, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[11], NULL, data, length, 53, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[7]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[12], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.02;
+
+      printInlineKey(&f[12]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[12], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65188 engineTemperature2: 4 field(s), 8 byte(s) */
+static bool decodeEngineTemperature2(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[0], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[1], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.0078125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f kPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[3], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65189 intakeManifoldInformation2: 6 field(s), 8 byte(s) */
+static bool decodeIntakeManifoldInformation2(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    value += 233;
+    if (value > 485)
+    {
+      printInlineEmpty(&f[0], value - 488);
+    }
+    else
+    {
+      double a = (double) value * 1.0 + -273.15;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    value += 233;
+    if (value > 485)
+    {
+      printInlineEmpty(&f[1], value - 488);
+    }
+    else
+    {
+      double a = (double) value * 1.0 + -273.15;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[2]);
+    value += 233;
+    if (value > 485)
+    {
+      printInlineEmpty(&f[2], value - 488);
+    }
+    else
+    {
+      double a = (double) value * 1.0 + -273.15;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    value += 233;
+    if (value > 485)
+    {
+      printInlineEmpty(&f[3], value - 488);
+    }
+    else
+    {
+      double a = (double) value * 1.0 + -273.15;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) data[4]);
+    value += 233;
+    if (value > 485)
+    {
+      printInlineEmpty(&f[4], value - 488);
+    }
+    else
+    {
+      double a = (double) value * 1.0 + -273.15;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[5], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65190 intakeManifoldInformation1: 4 field(s), 8 byte(s) */
+static bool decodeIntakeManifoldInformation1(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f kPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f kPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f kPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f kPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65201 ecuHistory: 2 field(s), 8 byte(s) */
+static bool decodeEcuHistory(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[0], value - 4294967295);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f km", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[1], value - 4294967295);
+    }
+    else
+    {
+      double a = (double) value * 0.05;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f h", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65213 fanDrive: 7 field(s), 8 byte(s) */
+static bool decodeFanDrive(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[0], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) (data[1] & 0xf));
+    if (value > 13)
+    {
+      printInlineEmpty(&f[1], value - 15);
+    }
+    else
+    {
+      printInlineKey(&f[1]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[2], NULL, data, length, 12, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f rpm", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[4], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.01;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) data[6]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[5], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.005;
+
+      printInlineKey(&f[5]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (!printField(&f[6], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65214 electronicEngineController4: 7 field(s), 8 byte(s) */
+static bool decodeElectronicEngineController4(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.5;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f kW", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f rpm", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) (data[4] & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[2], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) ((data[4] >> 2) & 0x3));
+    if (value > 2)
+    {
+      printInlineEmpty(&f[3], value - 3);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 34, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[4], NULL, data, length, 36, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[5]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[5], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[5]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[6], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65240 isoCommandedAddress: 11 field(s), 9 byte(s) */
+static bool decodeIsoCommandedAddress(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 21, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) (data[4] & 0x7));
+    if (value > 6)
+    {
+      printInlineEmpty(&f[2], value - 7);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) (data[4] >> 3));
+    if (value > 29)
+    {
+      printInlineEmpty(&f[3], value - 31);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 35, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[4], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[5], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[6], NULL, data, length, 49, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) (data[7] & 0xf));
+    if (value > 13)
+    {
+      printInlineEmpty(&f[7], value - 15);
+    }
+    else
+    {
+      printInlineKey(&f[7]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[7], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[8], NULL, data, length, 60, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[9], NULL, data, length, 63, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 8)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 9)
+  {
+    value = (int64_t) ((uint64_t) data[8]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[10], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[10]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[10], NULL, data, length, 64, &bits, true))
+  {
+    return false;
+  }
+  if (length > 9)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 9);
+  }
+  return true;
+}
+
+/* 65243 engineFluidLevelPressure2: 4 field(s), 8 byte(s) */
+static bool decodeEngineFluidLevelPressure2(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.00390625;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f MPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.00390625;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f MPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.00390625;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f MPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[6] | ((uint64_t) data[7] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[3], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.00390625;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f MPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65244 idleOperation: 2 field(s), 8 byte(s) */
+static bool decodeIdleOperation(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[0], value - 4294967295);
+    }
+    else
+    {
+      double a = (double) value * 0.5;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f L", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65247 ecu3: 5 field(s), 8 byte(s) */
+static bool decodeEcu3(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    if (value & INT64_C(0x80))
+    {
+      value |= ~INT64_C(0x7f);
+    }
+    if (value > 124)
+    {
+      printInlineEmpty(&f[0], value - 127);
+    }
+    else
+    {
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " %%", value);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[1] | ((uint64_t) data[2] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.125;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f rpm", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[2], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[2]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) data[4]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[3], value - 255);
+    }
+    else
+    {
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%" PRId64, value);
+      }
+      else
+      {
+        mprintf("%" PRId64 " %%", value);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (!printField(&f[4], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65253 engineHours: 2 field(s), 8 byte(s) */
+static bool decodeEngineHours(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[1], value - 4294967295);
+    }
+    else
+    {
+      double a = (double) value * 1000.0;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f r", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65257 fuelConsumptionLiquid1: 2 field(s), 8 byte(s) */
+static bool decodeFuelConsumptionLiquid1(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8) | ((uint64_t) data[2] << 16) | ((uint64_t) data[3] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[0], value - 4294967295);
+    }
+    else
+    {
+      double a = (double) value * 0.5;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f L", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8) | ((uint64_t) data[6] << 16) | ((uint64_t) data[7] << 24));
+    if (value > 4294967292)
+    {
+      printInlineEmpty(&f[1], value - 4294967295);
+    }
+    else
+    {
+      double a = (double) value * 0.5;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f L", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65262 engineTemp1: 6 field(s), 8 byte(s) */
+static bool decodeEngineTemp1(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    value += 233;
+    if (value > 485)
+    {
+      printInlineEmpty(&f[0], value - 488);
+    }
+    else
+    {
+      double a = (double) value * 1.0 + -273.15;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    value += 233;
+    if (value > 485)
+    {
+      printInlineEmpty(&f[1], value - 488);
+    }
+    else
+    {
+      double a = (double) value * 1.0 + -273.15;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[2], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[3], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) data[6]);
+    value += 233;
+    if (value > 485)
+    {
+      printInlineEmpty(&f[4], value - 488);
+    }
+    else
+    {
+      double a = (double) value * 1.0 + -273.15;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[7]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[5], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[5]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65266 fuelEconomy: 5 field(s), 8 byte(s) */
+static bool decodeFuelEconomy(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[0] | ((uint64_t) data[1] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[0], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.05;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f L/h", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[2] | ((uint64_t) data[3] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001953125;
+
+      printInlineKey(&f[1]);
+      mprintf("%.3f", a);
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[2], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.001953125;
+
+      printInlineKey(&f[2]);
+      mprintf("%.3f", a);
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) data[6]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[3], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (!printField(&f[4], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65269 ambientConditions: 2 field(s), 8 byte(s) */
+static bool decodeAmbientConditions(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[0], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.005;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65270 inletExhaustConditions: 7 field(s), 8 byte(s) */
+static bool decodeInletExhaustConditions(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[0], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.02;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[1], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.02;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[2]);
+    value += 233;
+    if (value > 485)
+    {
+      printInlineEmpty(&f[2], value - 488);
+    }
+    else
+    {
+      double a = (double) value * 1.0 + -273.15;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[3], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.02;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 5)
+  {
+    value = (int64_t) ((uint64_t) data[4]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[4], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.0005;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 5)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) data[5] | ((uint64_t) data[6] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[5], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[5]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 40, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) data[7]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[6], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.005;
+
+      printInlineKey(&f[6]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[6], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65271 vehicleElectricalPower: 3 field(s), 8 byte(s) */
+static bool decodeVehicleElectricalPower(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    if (value > 65532)
+    {
+      printInlineEmpty(&f[1], value - 65535);
+    }
+    else
+    {
+      double a = (double) value * 0.05;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f V", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (!printField(&f[2], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65272 transmissionFluids1: 8 field(s), 8 byte(s) */
+static bool decodeTransmissionFluids1(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+  int64_t      value;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 1)
+  {
+    value = (int64_t) ((uint64_t) data[0]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[0], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 16.0;
+
+      printInlineKey(&f[0]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f kPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 2)
+  {
+    value = (int64_t) ((uint64_t) data[1]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[1], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.4;
+
+      printInlineKey(&f[1]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f %%", a);
+      }
+    }
+  }
+  else if (!printField(&f[1], NULL, data, length, 8, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 3)
+  {
+    value = (int64_t) ((uint64_t) data[2]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[2], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.02;
+
+      printInlineKey(&f[2]);
+      if (showJson)
+      {
+        mprintf("%.3f", a);
+      }
+      else
+      {
+        mprintf("%.3f bar", a);
+      }
+    }
+  }
+  else if (!printField(&f[2], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 3)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 4)
+  {
+    value = (int64_t) ((uint64_t) data[3]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[3], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 16.0;
+
+      printInlineKey(&f[3]);
+      if (showJson)
+      {
+        mprintf("%.0f", a);
+      }
+      else
+      {
+        mprintf("%.0f kPa", a);
+      }
+    }
+  }
+  else if (!printField(&f[3], NULL, data, length, 24, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 4)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 6)
+  {
+    value = (int64_t) ((uint64_t) data[4] | ((uint64_t) data[5] << 8));
+    value += -273;
+    if (value > 65259)
+    {
+      printInlineEmpty(&f[4], value - 65262);
+    }
+    else
+    {
+      double a = (double) value * 0.03125 + -273.15;
+
+      printInlineKey(&f[4]);
+      if (showJson)
+      {
+        mprintf("%.2f", a);
+      }
+      else
+      {
+        mprintf("%.2f C", a);
+      }
+    }
+  }
+  else if (!printField(&f[4], NULL, data, length, 32, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 6)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 7)
+  {
+    value = (int64_t) ((uint64_t) data[6]);
+    if (value > 252)
+    {
+      printInlineEmpty(&f[5], value - 255);
+    }
+    else
+    {
+      double a = (double) value * 0.5;
+
+      printInlineKey(&f[5]);
+      if (showJson)
+      {
+        mprintf("%.1f", a);
+      }
+      else
+      {
+        mprintf("%.1f L", a);
+      }
+    }
+  }
+  else if (!printField(&f[5], NULL, data, length, 48, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 7)
+  {
+    return true;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) (data[7] & 0xf));
+    if (value > 13)
+    {
+      printInlineEmpty(&f[6], value - 15);
+    }
+    else
+    {
+      printInlineKey(&f[6]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[6], NULL, data, length, 56, &bits, true))
+  {
+    return false;
+  }
+  if (inlineNumbers && length >= 8)
+  {
+    value = (int64_t) ((uint64_t) (data[7] >> 4));
+    if (value > 13)
+    {
+      printInlineEmpty(&f[7], value - 15);
+    }
+    else
+    {
+      printInlineKey(&f[7]);
+      mprintf("%" PRId64, value);
+    }
+  }
+  else if (!printField(&f[7], NULL, data, length, 60, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 65280 0xff000xffffManufacturerProprietarySingleFrameNonAddressed: 4 field(s), 8 byte(s) */
+static bool decode0xff000xffffManufacturerProprietarySingleFrameNonAddressed(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 11, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[2], NULL, data, length, 13, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length > 8)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 8);
+  }
+  return true;
+}
+
+/* 126208 0x1ed000x1ee00StandardizedFastPacketAddressed: 1 field(s), 223 byte(s) */
+static bool decode0x1ed000x1ee00StandardizedFastPacketAddressed(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length > 223)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 223);
+  }
+  return true;
+}
+
+/* 126720 0x1ef000x1efffManufacturerProprietaryFastPacketAddressed: 4 field(s), 223 byte(s) */
+static bool decode0x1ef000x1efffManufacturerProprietaryFastPacketAddressed(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 1)
+  {
+    return true;
+  }
+  if (!printField(&f[1], NULL, data, length, 11, &bits, true))
+  {
+    return false;
+  }
+  if (!printField(&f[2], NULL, data, length, 13, &bits, true))
+  {
+    return false;
+  }
+  if (length <= 2)
+  {
+    return true;
+  }
+  if (!printField(&f[3], NULL, data, length, 16, &bits, true))
+  {
+    return false;
+  }
+  if (length > 223)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 223);
+  }
+  return true;
+}
+
+/* 126976 0x1f0000x1feffStandardizedMixedSingleFastPacketNonAddressed: 1 field(s), 223 byte(s) */
+static bool decode0x1f0000x1feffStandardizedMixedSingleFastPacketNonAddressed(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length > 223)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 223);
+  }
+  return true;
+}
+
+/* 130816 0x1ff000x1ffffManufacturerSpecificFastPacketNonAddressed: 1 field(s), 223 byte(s) */
+static bool decode0x1ff000x1ffffManufacturerSpecificFastPacketNonAddressed(const Pgn *pgn, const uint8_t *data, int length)
+{
+  const Field *f = pgn->fieldList;
+  size_t       bits;
+
+  if (length <= 0)
+  {
+    return true;
+  }
+  if (!printField(&f[0], NULL, data, length, 0, &bits, true))
+  {
+    return false;
+  }
+  if (length > 223)
+  {
+    logDebug("PGN %u has unknown bytes at end: %u\n", pgn->pgn, length - 223);
+  }
+  return true;
+}
+
+static const PgnDecoderEntry pgnDecoderList[] = {
+    {0, 59392, "0xe8000xeeffStandardizedSingleFrameAddressed", decode0xe8000xeeffStandardizedSingleFrameAddressed},
+    {1, 59392, "isoAcknowledgement", decodeIsoAcknowledgement},
+    {2, 59904, "isoRequest", decodeIsoRequest},
+    {3, 60160, "isoTransportProtocolDataTransfer", decodeIsoTransportProtocolDataTransfer},
+    {4, 60416, "isoTransportProtocolConnectionManagementRequestToSend", decodeIsoTransportProtocolConnectionManagementRequestToSend},
+    {5, 60416, "isoTransportProtocolConnectionManagementClearToSend", decodeIsoTransportProtocolConnectionManagementClearToSend},
+    {6, 60416, "isoTransportProtocolConnectionManagementEndOfMessage", decodeIsoTransportProtocolConnectionManagementEndOfMessage},
+    {7, 60416, "isoTransportProtocolConnectionManagementBroadcastAnnounce", decodeIsoTransportProtocolConnectionManagementBroadcastAnnounce},
+    {8, 60416, "isoTransportProtocolConnectionManagementAbort", decodeIsoTransportProtocolConnectionManagementAbort},
+    {9, 60928, "isoAddressClaim", decodeIsoAddressClaim},
+    {10, 61184, "0xef00ManufacturerProprietarySingleFrameAddressed", decode0xef00ManufacturerProprietarySingleFrameAddressed},
+    {11, 61440, "0xf0000xfeffStandardizedSingleFrameNonAddressed", decode0xf0000xfeffStandardizedSingleFrameNonAddressed},
+    {12, 61442, "electronicTransmissionController1", decodeElectronicTransmissionController1},
+    {13, 61443, "ecu2", decodeEcu2},
+    {14, 61444, "ecu1", decodeEcu1},
+    {15, 61445, "electronicTransmissionController2", decodeElectronicTransmissionController2},
+    {16, 61450, "engineGasFlowRate1", decodeEngineGasFlowRate1},
+    {17, 64709, "aftertreatment1ScrExhaustGasTemperature2", decodeAftertreatment1ScrExhaustGasTemperature2},
+    {18, 64740, "engineFuelProperties", decodeEngineFuelProperties},
+    {19, 64751, "engineFluidLevelPressure11", decodeEngineFluidLevelPressure11},
+    {20, 64776, "engineOilMessage", decodeEngineOilMessage},
+    {21, 64777, "fuelConsumption", decodeFuelConsumption},
+    {22, 64800, "aftertreatment1DieselOxidationCatalyst", decodeAftertreatment1DieselOxidationCatalyst},
+    {23, 64908, "aftertreatment1GasParameters", decodeAftertreatment1GasParameters},
+    {24, 64914, "engineOperatingInformation", decodeEngineOperatingInformation},
+    {25, 64946, "aftertreatment1IntermediateGas", decodeAftertreatment1IntermediateGas},
+    {26, 64947, "aftertreatment1OutletGas2", decodeAftertreatment1OutletGas2},
+    {27, 64948, "aftertreatment1IntakeGas2", decodeAftertreatment1IntakeGas2},
+    {28, 64976, "intakeExhaustConditions2", decodeIntakeExhaustConditions2},
+    {29, 65001, "bus1PhaseCBasicAcQuantities", decodeBus1PhaseCBasicAcQuantities},
+    {30, 65002, "bus1PhaseBBasicAcQuantities", decodeBus1PhaseBBasicAcQuantities},
+    {31, 65003, "bus1PhaseABasicAcQuantities", decodeBus1PhaseABasicAcQuantities},
+    {32, 65004, "bus1AverageBasicAcQuantities", decodeBus1AverageBasicAcQuantities},
+    {33, 65005, "utilityTotalAcEnergy", decodeUtilityTotalAcEnergy},
+    {34, 65006, "utilityPhaseCAcReactivePower", decodeUtilityPhaseCAcReactivePower},
+    {35, 65007, "utilityPhaseCAcPower", decodeUtilityPhaseCAcPower},
+    {36, 65008, "utilityPhaseCBasicAcQuantities", decodeUtilityPhaseCBasicAcQuantities},
+    {37, 65009, "utilityPhaseBAcReactivePower", decodeUtilityPhaseBAcReactivePower},
+    {38, 65010, "utilityPhaseBAcPower", decodeUtilityPhaseBAcPower},
+    {39, 65011, "utilityPhaseBBasicAcQuantities", decodeUtilityPhaseBBasicAcQuantities},
+    {40, 65012, "utilityPhaseAAcReactivePower", decodeUtilityPhaseAAcReactivePower},
+    {41, 65013, "utilityPhaseAAcPower", decodeUtilityPhaseAAcPower},
+    {42, 65014, "utilityPhaseABasicAcQuantities", decodeUtilityPhaseABasicAcQuantities},
+    {43, 65015, "utilityTotalAcReactivePower", decodeUtilityTotalAcReactivePower},
+    {44, 65016, "utilityTotalAcPower", decodeUtilityTotalAcPower},
+    {45, 65017, "utilityAverageBasicAcQuantities", decodeUtilityAverageBasicAcQuantities},
+    {46, 65018, "generatorTotalAcEnergy", decodeGeneratorTotalAcEnergy},
+    {47, 65019, "generatorPhaseCAcReactivePower", decodeGeneratorPhaseCAcReactivePower},
+    {48, 65020, "generatorPhaseCAcPower", decodeGeneratorPhaseCAcPower},
+    {49, 65021, "generatorPhaseCBasicAcQuantities", decodeGeneratorPhaseCBasicAcQuantities},
+    {50, 65022, "generatorPhaseBAcReactivePower", decodeGeneratorPhaseBAcReactivePower},
+    {51, 65023, "generatorPhaseBAcPower", decodeGeneratorPhaseBAcPower},
+    {52, 65024, "generatorPhaseBBasicAcQuantities", decodeGeneratorPhaseBBasicAcQuantities},
+    {53, 65025, "generatorPhaseAAcReactivePower", decodeGeneratorPhaseAAcReactivePower},
+    {54, 65026, "generatorPhaseAAcPower", decodeGeneratorPhaseAAcPower},
+    {55, 65027, "generatorPhaseABasicAcQuantities", decodeGeneratorPhaseABasicAcQuantities},
+    {56, 65028, "generatorTotalAcReactivePower", decodeGeneratorTotalAcReactivePower},
+    {57, 65029, "generatorTotalAcPower", decodeGeneratorTotalAcPower},
+    {58, 65030, "generatorAverageBasicAcQuantities", decodeGeneratorAverageBasicAcQuantities},
+    {59, 65031, "exhaustTemperature", decodeExhaustTemperature},
+    {60, 65130, "engineFuelLubeSystems", decodeEngineFuelLubeSystems},
+    {61, 65188, "engineTemperature2", decodeEngineTemperature2},
+    {62, 65189, "intakeManifoldInformation2", decodeIntakeManifoldInformation2},
+    {63, 65190, "intakeManifoldInformation1", decodeIntakeManifoldInformation1},
+    {64, 65201, "ecuHistory", decodeEcuHistory},
+    {65, 65213, "fanDrive", decodeFanDrive},
+    {66, 65214, "electronicEngineController4", decodeElectronicEngineController4},
+    {68, 65240, "isoCommandedAddress", decodeIsoCommandedAddress},
+    {69, 65243, "engineFluidLevelPressure2", decodeEngineFluidLevelPressure2},
+    {70, 65244, "idleOperation", decodeIdleOperation},
+    {71, 65247, "ecu3", decodeEcu3},
+    {72, 65253, "engineHours", decodeEngineHours},
+    {73, 65257, "fuelConsumptionLiquid1", decodeFuelConsumptionLiquid1},
+    {74, 65262, "engineTemp1", decodeEngineTemp1},
+    {75, 65266, "fuelEconomy", decodeFuelEconomy},
+    {76, 65269, "ambientConditions", decodeAmbientConditions},
+    {77, 65270, "inletExhaustConditions", decodeInletExhaustConditions},
+    {78, 65271, "vehicleElectricalPower", decodeVehicleElectricalPower},
+    {79, 65272, "transmissionFluids1", decodeTransmissionFluids1},
+    {80, 65280, "0xff000xffffManufacturerProprietarySingleFrameNonAddressed", decode0xff000xffffManufacturerProprietarySingleFrameNonAddressed},
+    {81, 126208, "0x1ed000x1ee00StandardizedFastPacketAddressed", decode0x1ed000x1ee00StandardizedFastPacketAddressed},
+    {82, 126720, "0x1ef000x1efffManufacturerProprietaryFastPacketAddressed", decode0x1ef000x1efffManufacturerProprietaryFastPacketAddressed},
+    {83, 126976, "0x1f0000x1feffStandardizedMixedSingleFastPacketNonAddressed", decode0x1f0000x1feffStandardizedMixedSingleFastPacketNonAddressed},
+    {84, 130816, "0x1ff000x1ffffManufacturerSpecificFastPacketNonAddressed", decode0x1ff000x1ffffManufacturerSpecificFastPacketNonAddressed}
+};
@@ -41,7 +41,7 @@ Pgn pgnList[] = {
      PACKET_COMPLETE,
      PACKET_SINGLE,
      {
-      {.name = "Control", .camelName = "control", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_CONTROL, .lookup.name = "ISO_CONTROL"},
+      {.name = "Control", .camelName = "control", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_CONTROL, .lookup.table = &lookupTableISO_CONTROL, .lookup.name = "ISO_CONTROL"},
       {.name = "Group Function", .camelName = "groupFunction", .fieldType = "UINT8", .resolution = 1.0},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 24, .resolution = 1.0},
       {.name = "PGN", .camelName = "pgn", .fieldType = "PGN", .size = 24, .description = "Parameter Group Number of requested information"}
@@ -78,7 +78,7 @@ Pgn pgnList[] = {
      PACKET_COMPLETE,
      PACKET_SINGLE,
      {
-      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 16, .description = "RTS", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.name = "ISO_COMMAND"},
+      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 16, .description = "RTS", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.table = &lookupTableISO_COMMAND, .lookup.name = "ISO_COMMAND"},
       {.name = "Message size", .camelName = "messageSize", .fieldType = "UINT16", .resolution = 1.0, .description = "bytes"},
       {.name = "Packets", .camelName = "packets", .fieldType = "UINT8", .resolution = 1.0, .description = "packets"},
       {.name = "Packets reply", .camelName = "packetsReply", .fieldType = "UINT8", .resolution = 1.0, .description = "packets sent in response to CTS"},
@@ -94,7 +94,7 @@ Pgn pgnList[] = {
      PACKET_COMPLETE,
      PACKET_SINGLE,
      {
-      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 17, .description = "CTS", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.name = "ISO_COMMAND"},
+      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 17, .description = "CTS", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.table = &lookupTableISO_COMMAND, .lookup.name = "ISO_COMMAND"},
       {.name = "Max packets", .camelName = "maxPackets", .fieldType = "UINT8", .resolution = 1.0, .description = "Number of frames that can be sent before another CTS is required"},
       {.name = "Next SID", .camelName = "nextSid", .fieldType = "UINT8", .resolution = 1.0, .description = "Number of next frame to be transmitted"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 16, .resolution = 1.0},
@@ -110,7 +110,7 @@ Pgn pgnList[] = {
      PACKET_COMPLETE,
      PACKET_SINGLE,
      {
-      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 19, .description = "EOM", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.name = "ISO_COMMAND"},
+      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 19, .description = "EOM", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.table = &lookupTableISO_COMMAND, .lookup.name = "ISO_COMMAND"},
       {.name = "Total message size", .camelName = "totalMessageSize", .fieldType = "UINT16", .resolution = 1.0, .description = "bytes"},
       {.name = "Total number of frames received", .camelName = "totalNumberOfFramesReceived", .fieldType = "UINT8", .resolution = 1.0, .description = "Total number of of frames received"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 8, .resolution = 1.0},
@@ -126,7 +126,7 @@ Pgn pgnList[] = {
      PACKET_COMPLETE,
      PACKET_SINGLE,
      {
-      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 32, .description = "BAM", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.name = "ISO_COMMAND"},
+      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 32, .description = "BAM", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.table = &lookupTableISO_COMMAND, .lookup.name = "ISO_COMMAND"},
       {.name = "Message size", .camelName = "messageSize", .fieldType = "UINT16", .resolution = 1.0, .description = "bytes"},
       {.name = "Packets", .camelName = "packets", .fieldType = "UINT8", .resolution = 1.0, .description = "frames"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 8, .resolution = 1.0},
@@ -142,7 +142,7 @@ Pgn pgnList[] = {
      PACKET_COMPLETE,
      PACKET_SINGLE,
      {
-      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 255, .description = "Abort", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.name = "ISO_COMMAND"},
+      {.name = "Group Function Code", .camelName = "groupFunctionCode", .fieldType = "LOOKUP", .size = 8, .resolution = 1.0, .hasMatchValue = true, .matchValue = 255, .description = "Abort", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupISO_COMMAND, .lookup.table = &lookupTableISO_COMMAND, .lookup.name = "ISO_COMMAND"},
       {.name = "Reason", .camelName = "reason", .fieldType = "BINARY", .size = 8, .resolution = 1.0},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 24, .resolution = 1.0},
       {.name = "PGN", .camelName = "pgn", .fieldType = "PGN", .size = 24}
@@ -158,14 +158,14 @@ Pgn pgnList[] = {
      PACKET_SINGLE,
      {
       {.name = "Unique Number", .camelName = "uniqueNumber", .fieldType = "UNSIGNED_INTEGER", .size = 21, .resolution = 1.0, .description = "ISO Identity Number"},
-      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
+      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.table = &lookupTableJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
       {.name = "Device Instance Lower", .camelName = "deviceInstanceLower", .fieldType = "UNSIGNED_INTEGER", .size = 3, .resolution = 1.0, .description = "ISO ECU Instance"},
       {.name = "Device Instance Upper", .camelName = "deviceInstanceUpper", .fieldType = "UNSIGNED_INTEGER", .size = 5, .resolution = 1.0, .description = "ISO Function Instance"},
-      {.name = "Device Function", .camelName = "deviceFunction", .fieldType = "INDIRECT_LOOKUP", .size = 8, .resolution = 1.0, .description = "ISO Function", .lookup.type = LOOKUP_TYPE_TRIPLET, LOOKUP_TRIPLET_MEMBER = lookupDEVICE_FUNCTION, .lookup.name = "DEVICE_FUNCTION", .lookup.val1Order = 7},
+      {.name = "Device Function", .camelName = "deviceFunction", .fieldType = "INDIRECT_LOOKUP", .size = 8, .resolution = 1.0, .description = "ISO Function", .lookup.type = LOOKUP_TYPE_TRIPLET, LOOKUP_TRIPLET_MEMBER = lookupDEVICE_FUNCTION, .lookup.table = &lookupTableDEVICE_FUNCTION, .lookup.name = "DEVICE_FUNCTION", .lookup.val1Order = 7},
       {.name = "Spare", .camelName = "spare", .fieldType = "SPARE", .size = 1, .resolution = 1.0},
-      {.name = "Device Class", .camelName = "deviceClass", .fieldType = "LOOKUP", .size = 7, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupDEVICE_CLASS, .lookup.name = "DEVICE_CLASS"},
+      {.name = "Device Class", .camelName = "deviceClass", .fieldType = "LOOKUP", .size = 7, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupDEVICE_CLASS, .lookup.table = &lookupTableDEVICE_CLASS, .lookup.name = "DEVICE_CLASS"},
       {.name = "System Instance", .camelName = "systemInstance", .fieldType = "UNSIGNED_INTEGER", .size = 4, .resolution = 1.0, .description = "ISO Device Class Instance"},
-      {.name = "Industry Group", .camelName = "industryGroup", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
+      {.name = "Industry Group", .camelName = "industryGroup", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.table = &lookupTableINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
       {.name = "Arbitrary address capable", .camelName = "arbitraryAddressCapable", .fieldType = "UNSIGNED_INTEGER", .size = 1, .resolution = 1.0, .description = "Field indicates whether the device is capable to claim arbitrary source address. Value is 1 for NMEA200 devices. Could be 0 for J1939 device claims"}
      },
      .camelDescription = "isoAddressClaim",
@@ -177,9 +177,9 @@ Pgn pgnList[] = {
      PACKET_FIELDS_UNKNOWN | PACKET_FIELD_LENGTHS_UNKNOWN | PACKET_RESOLUTION_UNKNOWN,
      PACKET_SINGLE,
      {
-      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
+      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.table = &lookupTableJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 2, .resolution = 1.0},
-      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
+      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.table = &lookupTableINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
       {.name = "Data", .camelName = "data", .fieldType = "BINARY", .size = 48, .resolution = 1.0}
      },
      .camelDescription = "0xef00ManufacturerProprietarySingleFrameAddressed",
@@ -191,9 +191,9 @@ Pgn pgnList[] = {
      PACKET_FIELDS_UNKNOWN | PACKET_FIELD_LENGTHS_UNKNOWN | PACKET_RESOLUTION_UNKNOWN,
      PACKET_SINGLE,
      {
-      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
+      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.table = &lookupTableJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 2, .resolution = 1.0},
-      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
+      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.table = &lookupTableINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
       {.name = "Data", .camelName = "data", .fieldType = "BINARY", .size = 48, .resolution = 1.0}
      },
      .camelDescription = "0xf0000xfeffStandardizedSingleFrameNonAddressed",
@@ -211,8 +211,8 @@ Pgn pgnList[] = {
       {.name = "Torque Converter Lockup Transition in Progress", .camelName = "torqueConverterLockupTransitionInProgress", .fieldType = "UNSIGNED_INTEGER", .size = 2, .resolution = 1.0},
       {.name = "Transmission Output Shaft Speed", .camelName = "transmissionOutputShaftSpeed", .fieldType = "ROTATION_UFIX16_RPM"},
       {.name = "Percent Clutch Slip", .camelName = "percentClutchSlip", .fieldType = "UINT8", .resolution = 1.0},
-      {.name = "Engine Momentary Overspeed Enable", .camelName = "engineMomentaryOverspeedEnable", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupYES_NO, .lookup.name = "YES_NO"},
-      {.name = "Progressive Shift Disable", .camelName = "progressiveShiftDisable", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupYES_NO, .lookup.name = "YES_NO"},
+      {.name = "Engine Momentary Overspeed Enable", .camelName = "engineMomentaryOverspeedEnable", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupYES_NO, .lookup.table = &lookupTableYES_NO, .lookup.name = "YES_NO"},
+      {.name = "Progressive Shift Disable", .camelName = "progressiveShiftDisable", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupYES_NO, .lookup.table = &lookupTableYES_NO, .lookup.name = "YES_NO"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 4, .resolution = 1.0},
       {.name = "Transmission Input Shaft Speed", .camelName = "transmissionInputShaftSpeed", .fieldType = "UINT16", .resolution = 1.0},
       {.name = "Source Address of Controlling Device for Transmission Control", .camelName = "sourceAddressOfControllingDeviceForTransmissionControl", .fieldType = "UINT8", .resolution = 1.0}
@@ -547,7 +547,7 @@ Pgn pgnList[] = {
      {
       {.name = "Reactive Power", .camelName = "reactivePower", .fieldType = "POWER_UINT16_VAR"},
       {.name = "Power factor", .camelName = "powerFactor", .fieldType = "UINT16", .resolution = 6.103515625e-5, .unit = "Cos Phi"},
-      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
+      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.table = &lookupTablePOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 30, .resolution = 1.0}
      },
      .camelDescription = "utilityPhaseCAcReactivePower"},
@@ -581,7 +581,7 @@ Pgn pgnList[] = {
      {
       {.name = "Reactive Power", .camelName = "reactivePower", .fieldType = "POWER_UINT16_VAR"},
       {.name = "Power factor", .camelName = "powerFactor", .fieldType = "UINT16", .resolution = 6.103515625e-5, .unit = "Cos Phi"},
-      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
+      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.table = &lookupTablePOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 30, .resolution = 1.0}
      },
      .camelDescription = "utilityPhaseBAcReactivePower"},
@@ -615,7 +615,7 @@ Pgn pgnList[] = {
      {
       {.name = "Reactive Power", .camelName = "reactivePower", .fieldType = "POWER_FIX32_VAR_OFFSET", .hasSign = true},
       {.name = "Power factor", .camelName = "powerFactor", .fieldType = "UINT16", .resolution = 6.103515625e-5, .unit = "Cos Phi"},
-      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
+      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.table = &lookupTablePOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 14, .resolution = 1.0}
      },
      .camelDescription = "utilityPhaseAAcReactivePower"},
@@ -649,7 +649,7 @@ Pgn pgnList[] = {
      {
       {.name = "Reactive Power", .camelName = "reactivePower", .fieldType = "POWER_FIX32_VAR_OFFSET", .hasSign = true},
       {.name = "Power factor", .camelName = "powerFactor", .fieldType = "UINT16", .resolution = 6.103515625e-5, .unit = "Cos Phi"},
-      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
+      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.table = &lookupTablePOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 14, .resolution = 1.0}
      },
      .camelDescription = "utilityTotalAcReactivePower"},
@@ -693,7 +693,7 @@ Pgn pgnList[] = {
      {
       {.name = "Reactive Power", .camelName = "reactivePower", .fieldType = "POWER_FIX32_VAR_OFFSET", .hasSign = true},
       {.name = "Power factor", .camelName = "powerFactor", .fieldType = "UINT16", .resolution = 6.103515625e-5, .unit = "Cos Phi"},
-      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
+      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.table = &lookupTablePOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 14, .resolution = 1.0}
      },
      .camelDescription = "generatorPhaseCAcReactivePower"},
@@ -727,7 +727,7 @@ Pgn pgnList[] = {
      {
       {.name = "Reactive Power", .camelName = "reactivePower", .fieldType = "POWER_FIX32_VAR_OFFSET", .hasSign = true},
       {.name = "Power factor", .camelName = "powerFactor", .fieldType = "UINT16", .resolution = 6.103515625e-5, .unit = "Cos Phi"},
-      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
+      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.table = &lookupTablePOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 14, .resolution = 1.0}
      },
      .camelDescription = "generatorPhaseBAcReactivePower"},
@@ -761,7 +761,7 @@ Pgn pgnList[] = {
      {
       {.name = "Reactive Power", .camelName = "reactivePower", .fieldType = "POWER_FIX32_VAR_OFFSET", .hasSign = true},
       {.name = "Power factor", .camelName = "powerFactor", .fieldType = "UINT16", .resolution = 6.103515625e-5, .unit = "Cos Phi"},
-      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
+      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.table = &lookupTablePOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 14, .resolution = 1.0}
      },
      .camelDescription = "generatorPhaseAAcReactivePower"},
@@ -795,7 +795,7 @@ Pgn pgnList[] = {
      {
       {.name = "Reactive Power", .camelName = "reactivePower", .fieldType = "POWER_FIX32_VAR_OFFSET", .hasSign = true},
       {.name = "Power factor", .camelName = "powerFactor", .fieldType = "UINT16", .resolution = 6.103515625e-5, .unit = "Cos Phi"},
-      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
+      {.name = "Power Factor Lagging", .camelName = "powerFactorLagging", .fieldType = "LOOKUP", .size = 2, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupPOWER_FACTOR, .lookup.table = &lookupTablePOWER_FACTOR, .lookup.name = "POWER_FACTOR"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 14, .resolution = 1.0}
      },
      .camelDescription = "generatorTotalAcReactivePower"},
@@ -974,14 +974,14 @@ Pgn pgnList[] = {
      PACKET_ISO_TP,
      {
       {.name = "Unique Number", .camelName = "uniqueNumber", .fieldType = "BINARY", .size = 21, .resolution = 1.0, .description = "ISO Identity Number"},
-      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .unit = "Manufacturer Code", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
+      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .unit = "Manufacturer Code", .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.table = &lookupTableJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
       {.name = "Device Instance Lower", .camelName = "deviceInstanceLower", .fieldType = "UNSIGNED_INTEGER", .size = 3, .resolution = 1.0, .description = "ISO ECU Instance"},
       {.name = "Device Instance Upper", .camelName = "deviceInstanceUpper", .fieldType = "UNSIGNED_INTEGER", .size = 5, .resolution = 1.0, .description = "ISO Function Instance"},
-      {.name = "Device Function", .camelName = "deviceFunction", .fieldType = "INDIRECT_LOOKUP", .size = 8, .resolution = 1.0, .description = "ISO Function", .lookup.type = LOOKUP_TYPE_TRIPLET, LOOKUP_TRIPLET_MEMBER = lookupDEVICE_FUNCTION, .lookup.name = "DEVICE_FUNCTION", .lookup.val1Order = 7},
+      {.name = "Device Function", .camelName = "deviceFunction", .fieldType = "INDIRECT_LOOKUP", .size = 8, .resolution = 1.0, .description = "ISO Function", .lookup.type = LOOKUP_TYPE_TRIPLET, LOOKUP_TRIPLET_MEMBER = lookupDEVICE_FUNCTION, .lookup.table = &lookupTableDEVICE_FUNCTION, .lookup.name = "DEVICE_FUNCTION", .lookup.val1Order = 7},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 1, .resolution = 1.0},
-      {.name = "Device Class", .camelName = "deviceClass", .fieldType = "LOOKUP", .size = 7, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupDEVICE_CLASS, .lookup.name = "DEVICE_CLASS"},
+      {.name = "Device Class", .camelName = "deviceClass", .fieldType = "LOOKUP", .size = 7, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupDEVICE_CLASS, .lookup.table = &lookupTableDEVICE_CLASS, .lookup.name = "DEVICE_CLASS"},
       {.name = "System Instance", .camelName = "systemInstance", .fieldType = "UNSIGNED_INTEGER", .size = 4, .resolution = 1.0, .description = "ISO Device Class Instance"},
-      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
+      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.table = &lookupTableINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
       {.name = "Reserved", .camelName = "reserved10", .fieldType = "RESERVED", .size = 1, .resolution = 1.0},
       {.name = "New Source Address", .camelName = "newSourceAddress", .fieldType = "UINT8", .resolution = 1.0}
      },
@@ -1144,9 +1144,9 @@ Pgn pgnList[] = {
      PACKET_FIELDS_UNKNOWN | PACKET_FIELD_LENGTHS_UNKNOWN | PACKET_RESOLUTION_UNKNOWN,
      PACKET_SINGLE,
      {
-      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
+      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.table = &lookupTableJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 2, .resolution = 1.0},
-      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
+      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.table = &lookupTableINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
       {.name = "Data", .camelName = "data", .fieldType = "BINARY", .size = 48, .resolution = 1.0}
      },
      .camelDescription = "0xff000xffffManufacturerProprietarySingleFrameNonAddressed",
@@ -1169,9 +1169,9 @@ Pgn pgnList[] = {
      PACKET_FIELDS_UNKNOWN | PACKET_FIELD_LENGTHS_UNKNOWN | PACKET_RESOLUTION_UNKNOWN,
      PACKET_FAST,
      {
-      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
+      {.name = "Manufacturer Code", .camelName = "manufacturerCode", .fieldType = "LOOKUP", .size = 11, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupJ1939_MANUFACTURER_CODE, .lookup.table = &lookupTableJ1939_MANUFACTURER_CODE, .lookup.name = "J1939_MANUFACTURER_CODE"},
       {.name = "Reserved", .camelName = "reserved", .fieldType = "RESERVED", .size = 2, .resolution = 1.0},
-      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
+      {.name = "Industry Code", .camelName = "industryCode", .fieldType = "LOOKUP", .size = 3, .resolution = 1.0, .lookup.type = LOOKUP_TYPE_PAIR, LOOKUP_PAIR_MEMBER = lookupINDUSTRY_CODE, .lookup.table = &lookupTableINDUSTRY_CODE, .lookup.name = "INDUSTRY_CODE"},
       {.name = "Data", .camelName = "data", .fieldType = "BINARY", .size = 1768, .resolution = 1.0}
      },
      .camelDescription = "0x1ef000x1efffManufacturerProprietaryFastPacketAddressed",
@@ -23,6 +23,7 @@ limitations under the License.
 #include <float.h>
 
 #include "common.h"
+#include "lookup-table.h"
 #include "parse.h"
 #include "pow.h"
 
@@ -68,8 +69,9 @@ struct LookupInfo
     void (*tripletEnumerator)(EnumTripletCallback);
     void (*fieldtypeEnumerator)(EnumFieldtypeCallback);
   } function;
-  uint8_t val1Order; // Which field is the first field in a tripletEnumerator
-  size_t  size;      // Used in analyzer only
+  uint8_t            val1Order; // Which field is the first field in a tripletEnumerator
+  size_t             size;      // Used in analyzer only
+  const LookupTable *table;     // The same enumeration as data with pre-rendered strings; NULL for FIELDTYPE lookups
 };
 
 #define LOOKUP_PAIR_MEMBER .lookup.function.pair
@@ -77,6 +79,16 @@ struct LookupInfo
 #define LOOKUP_TRIPLET_MEMBER .lookup.function.triplet
 #define LOOKUP_FIELDTYPE_MEMBER .lookup.function.pair
 
+/* A field name pre-rendered with separator and punctuation, `,"name":` in JSON
+ * and `; name = ` in text mode, so that printing the key is a single append.
+ * Filled in by fillFieldType(); len excludes the '\0'.
+ */
+typedef struct
+{
+  const char *str;
+  size_t      len;
+} FieldKey;
+
 typedef struct
 {
   const char *name;
@@ -109,6 +121,7 @@ typedef struct
   uint8_t    reservedCount; /* Resolved number of reserved special values (0..3): Unknown, OutOfRange, Reserved. */
   size_t     bitOffset;     // Bit offset from start of data, e.g. lower 3 bits = bit#, bit 4.. is byte offset
   char      *camelName;
+  FieldKey   key[2][2]; // [showCamel][showJson]: the name as printField() writes it ahead of the value
   LookupInfo lookup;
   FieldType *ft;
   Pgn       *pgn;
@@ -123,9 +136,15 @@ typedef struct
  * initializers from database/ (see keel/DESIGN.md).
  */
 
-#define LOOKUP_TYPE(type, length) extern const char *lookup##type(size_t val);
-#define LOOKUP_TYPE_TRIPLET(type, length) extern const char *lookup##type(size_t val1, size_t val2);
-#define LOOKUP_TYPE_BITFIELD(type, length) extern const char *lookup##type(size_t val);
+#define LOOKUP_TYPE(type, length)    \
+  extern const char *lookup##type(size_t val); \
+  extern const LookupTable lookupTable##type;
+#define LOOKUP_TYPE_TRIPLET(type, length)                     \
+  extern const char *lookup##type(size_t val1, size_t val2); \
+  extern const LookupTable lookupTable##type;
+#define LOOKUP_TYPE_BITFIELD(type, length)      \
+  extern const char *lookup##type(size_t val); \
+  extern const LookupTable lookupTable##type;
 #define LOOKUP_TYPE_FIELDTYPE(type, length) extern const char *lookup##type(size_t val);
 
 #include "lookup-j1939-generated-data.h"
@@ -160,6 +179,9 @@ const char *PACKET_TYPE_STR[PACKET_MIXED + 1] = {"Single", "Fast", "ISO", "Mixed
 extern const char *PACKET_TYPE_STR[];
 #endif
 
+/* Generated straight-line decoder for a fixed-layout PGN; see pgn.h. */
+typedef bool (*PgnDecoder)(const Pgn *pgn, const uint8_t *data, int length);
+
 struct Pgn
 {
   char      *description;
@@ -183,8 +205,17 @@ struct Pgn
   uint8_t     repeatingStart2;  /* At which field does the second set start? */
   uint8_t     repeatingField1;  /* Which field explains how often the repeating fields set #1 repeats? 255 = there is no field */
   uint8_t     repeatingField2;  /* Which field explains how often the repeating fields set #2 repeats? 255 = there is no field */
+  PgnDecoder  decoder;          /* Filled by C: the generated decoder, or NULL to use the generic printFields() */
 };
 
+typedef struct PgnDecoderEntry
+{
+  size_t      index;            /* Index into pgnList[] */
+  uint32_t    pgn;              /* Cross-checked against pgnList[index] before use */
+  const char *camelDescription; /* Ditto */
+  PgnDecoder  decoder;
+} PgnDecoderEntry;
+
 typedef struct PgnRange
 {
   uint32_t    pgnStart;
@@ -86,6 +86,12 @@ extern void minsert(size_t location, const char *str)
   mbuf.data[mbuf.len] = '\0';
 }
 
+// Append a string of known length, such as a pre-rendered lookup string
+extern void mappend(const char *str, size_t len)
+{
+  sbAppendData(&mbuf, str, len);
+}
+
 extern void mwrite(FILE *stream)
 {
   fwrite(sbGet(&mbuf), sizeof(char), sbGetLength(&mbuf), stream);
@@ -670,8 +676,9 @@ extern bool fieldPrintLookup(const Field   *field,
                              size_t         startBit,
                              size_t        *bits)
 {
-  char        lookfor[20];
-  const char *s = NULL;
+  char               lookfor[20];
+  const char        *s = NULL;
+  const LookupEntry *e = NULL;
 
   int64_t value;
   int64_t maxValue;
@@ -717,7 +724,14 @@ extern bool fieldPrintLookup(const Field   *field,
       {
         g_ftf = NULL;
       }
-      s = (*field->lookup.function.pair)((size_t) value);
+      if (field->lookup.table != NULL)
+      {
+        e = lookupTableFind(field->lookup.table, (size_t) value);
+      }
+      else
+      {
+        s = (*field->lookup.function.pair)((size_t) value);
+      }
     }
     else if (field->lookup.type == LOOKUP_TYPE_TRIPLET)
     {
@@ -727,13 +741,38 @@ extern bool fieldPrintLookup(const Field   *field,
 
       if (field->pgn != NULL && extractNumberByOrder(field->pgn, field->lookup.val1Order, data, dataLen, &val1))
       {
-        s = (*field->lookup.function.triplet)((size_t) val1, (size_t) value);
+        if (field->lookup.table != NULL)
+        {
+          e = lookupTableFindTriplet(field->lookup.table, (size_t) val1, (size_t) value);
+        }
+        else
+        {
+          s = (*field->lookup.function.triplet)((size_t) val1, (size_t) value);
+        }
       }
     }
     // BIT is handled in fieldPrintBitLookup
   }
 
-  if (s != NULL)
+  if (e != NULL)
+  {
+    // The table holds the string ready for output, quotes and all
+    if (showJsonValue)
+    {
+      mprintf("%" PRId64 ",\"name\":", value);
+      mappend(e->json, e->jsonLen);
+      mappend("}", 1);
+    }
+    else if (showJson)
+    {
+      mappend(e->json, e->jsonLen);
+    }
+    else
+    {
+      mappend(e->name, e->nameLen);
+    }
+  }
+  else if (s != NULL)
   {
     if (showJsonValue)
     {
@@ -1012,9 +1051,40 @@ extern bool fieldPrintBitLookup(const Field   *field,
     logDebug("RES_BITFIELD is bit %u value %" PRIx64 " set? = %d\n", bit, bitValue, isSet);
     if (isSet)
     {
-      const char *s = (*field->lookup.function.pair)(bit);
+      const LookupEntry *e = NULL;
+      const char        *s = NULL;
+
+      if (field->lookup.table != NULL)
+      {
+        e = lookupTableFind(field->lookup.table, bit);
+      }
+      else
+      {
+        s = (*field->lookup.function.pair)(bit);
+      }
 
-      if (s != NULL)
+      if (e != NULL)
+      {
+        if (showJsonValue)
+        {
+          mprintf("%s{\"value\":%" PRId64 ",\"name\":", sep, bitValue);
+          mappend(e->json, e->jsonLen);
+          mappend("}", 1);
+        }
+        else
+        {
+          mappend(sep, strlen(sep));
+          if (showJson)
+          {
+            mappend(e->json, e->jsonLen);
+          }
+          else
+          {
+            mappend(e->name, e->nameLen);
+          }
+        }
+      }
+      else if (s != NULL)
       {
         if (showJsonValue)
         {
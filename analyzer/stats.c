@@ -0,0 +1,204 @@
+/*
+
+Runtime statistics for the analyzer (-stats): what came in per input format,
+what was decoded per PGN and how long that took, how the fast-packet and ISO
+TP reassembly fared, and how much output was produced.
+
+(C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+
+This file is part of CANboat.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#include "analyzer.h"
+#include "common.h"
+
+bool  statsEnabled = false;
+Stats stats;
+
+static uint64_t statsStartNs;
+static uint64_t statsIntervalNs;
+static uint64_t statsNextDumpNs;
+
+uint64_t statsNow(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + (uint64_t) ts.tv_nsec;
+}
+
+void statsInit(int intervalSeconds)
+{
+  stats.pgn = calloc(pgnListSize, sizeof(stats.pgn[0]));
+  if (stats.pgn == NULL)
+  {
+    die("Out of memory");
+  }
+  statsEnabled    = true;
+  statsStartNs    = statsNow();
+  statsIntervalNs = (uint64_t) CB_MAX(intervalSeconds, 0) * 1000000000;
+  statsNextDumpNs = statsStartNs + statsIntervalNs;
+}
+
+static size_t histogramBucket(uint64_t ns)
+{
+  size_t bucket = 0;
+
+  ns >>= 7;
+  while (ns != 0 && bucket < STATS_HISTOGRAM_BUCKETS - 1)
+  {
+    ns >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+void statsDecoded(const Pgn *pgn, size_t bytes, uint64_t startNs, size_t outputBytes)
+{
+  PgnStats *p  = &stats.pgn[pgn - pgnList];
+  uint64_t  ns = statsNow() - startNs;
+
+  p->messages++;
+  p->bytes += bytes;
+  p->decodeNs += ns;
+  p->decodeHistogram[histogramBucket(ns)]++;
+  stats.decoded++;
+  stats.outputBytes += outputBytes;
+}
+
+void statsSlotTaken(size_t *inUse, size_t *peak)
+{
+  (*inUse)++;
+  if (*inUse > *peak)
+  {
+    *peak = *inUse;
+  }
+}
+
+void statsTick(const char *const *formatNames, size_t formatCount)
+{
+  uint64_t now;
+
+  if (statsIntervalNs == 0)
+  {
+    return;
+  }
+  now = statsNow();
+  if (now >= statsNextDumpNs)
+  {
+    statsDump(formatNames, formatCount);
+    statsNextDumpNs = now + statsIntervalNs;
+  }
+}
+
+/*
+ * Write the statistics gathered so far to stderr as a single line of JSON.
+ * In test mode (-fixtime) everything that depends on the clock is left out, so
+ * the result can be compared against a reference.
+ */
+void statsDump(const char *const *formatNames, size_t formatCount)
+{
+  StringBuffer sb     = sbNew;
+  bool         timing = !fixedTime;
+  const char  *s      = "";
+
+  sbAppendString(&sb, "{\"stats\":{");
+  if (timing)
+  {
+    sbAppendFormat(&sb, "\"elapsedMs\":%" PRIu64 ",", (statsNow() - statsStartNs) / 1000000);
+  }
+
+  sbAppendString(&sb, "\"input\":{");
+  for (size_t i = 0; i < CB_MIN(formatCount, STATS_FORMATS); i++)
+  {
+    if (stats.parsed[i] != 0 || stats.parseErrors[i] != 0)
+    {
+      sbAppendFormat(
+          &sb, "%s\"%s\":{\"messages\":%" PRIu64 ",\"errors\":%" PRIu64 "}", s, formatNames[i], stats.parsed[i], stats.parseErrors[i]);
+      s = ",";
+    }
+  }
+
+  sbAppendFormat(&sb,
+                 "},\"output\":{\"messages\":%" PRIu64 ",\"analysisErrors\":%" PRIu64 ",\"bytes\":%" PRIu64 "}",
+                 stats.decoded,
+                 stats.analysisErrors,
+                 stats.outputBytes);
+  sbAppendFormat(&sb,
+                 ",\"fastPacket\":{\"completed\":%" PRIu64 ",\"incomplete\":%" PRIu64 ",\"dropped\":%" PRIu64
+                 ",\"slotsInUse\":%zu,\"peakSlotsInUse\":%zu}",
+                 stats.fastPacketCompleted,
+                 stats.fastPacketIncomplete,
+                 stats.fastPacketDropped,
+                 stats.fastPacketSlotsInUse,
+                 stats.fastPacketSlotsPeak);
+  sbAppendFormat(&sb,
+                 ",\"isoTp\":{\"completed\":%" PRIu64 ",\"aborted\":%" PRIu64 ",\"restarted\":%" PRIu64 ",\"dropped\":%" PRIu64
+                 ",\"rejected\":%" PRIu64 ",\"slotsInUse\":%zu,\"peakSlotsInUse\":%zu}",
+                 stats.isoTpCompleted,
+                 stats.isoTpAborted,
+                 stats.isoTpRestarted,
+                 stats.isoTpDropped,
+                 stats.isoTpRejected,
+                 stats.isoTpSlotsInUse,
+                 stats.isoTpSlotsPeak);
+
+  if (timing)
+  {
+    sbAppendString(&sb, ",\"decodeHistogramNs\":[");
+    for (size_t b = 0; b < STATS_HISTOGRAM_BUCKETS - 1; b++)
+    {
+      sbAppendFormat(&sb, "%s%" PRIu64, b ? "," : "", UINT64_C(1) << (7 + b));
+    }
+    sbAppendString(&sb, ",null]");
+  }
+
+  sbAppendString(&sb, ",\"pgns\":[");
+  s = "";
+  for (size_t i = 0; i < pgnListSize; i++)
+  {
+    const PgnStats *p = &stats.pgn[i];
+
+    if (p->messages == 0)
+    {
+      continue;
+    }
+    sbAppendFormat(&sb,
+                   "%s{\"pgn\":%u,\"id\":\"%s\",\"messages\":%" PRIu64 ",\"bytes\":%" PRIu64,
+                   s,
+                   pgnList[i].pgn,
+                   pgnList[i].camelDescription,
+                   p->messages,
+                   p->bytes);
+    if (timing)
+    {
+      sbAppendFormat(&sb, ",\"decodeNs\":%" PRIu64 ",\"decodeHistogram\":[", p->decodeNs);
+      for (size_t b = 0; b < STATS_HISTOGRAM_BUCKETS; b++)
+      {
+        sbAppendFormat(&sb, "%s%" PRIu64, b ? "," : "", p->decodeHistogram[b]);
+      }
+      sbAppendChar(&sb, ']');
+    }
+    sbAppendChar(&sb, '}');
+    s = ",";
+  }
+  sbAppendString(&sb, "]}}\n");
+
+  fflush(stdout);
+  fputs(sbGet(&sb), stderr);
+  fflush(stderr);
+  sbClean(&sb);
+}
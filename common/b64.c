@@ -27,7 +27,7 @@ static const char B64EncodeTable[65]
        'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r',
        's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/', '='};
 
-static int B64DecodeTable[256] = {
+static const int8_t B64DecodeTable[256] = {
     -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
     -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, 64, -1, -1,
     -1, 0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
@@ -42,7 +42,7 @@ static const char AISEncodeTable[65]
        'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', '`', 'a', 'b', 'c',
        'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w'};
 
-static int AISDecodeTable[256] = {
+static const int8_t AISDecodeTable[256] = {
     -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15,
     16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -137,14 +137,29 @@ void sbAppendEncodeBase64(StringBuffer *sb, const uint8_t *data, size_t len, enu
   }
 }
 
-void sbAppendDecodeBase64(StringBuffer *sb, const char *data, size_t len, enum Base64Encoding encoding)
+/**
+ * B64 decode data straight into a caller supplied buffer.
+ *
+ * Runs of four plain characters, which is nearly all of any payload, are
+ * decoded a group at a time: the four table values are or-ed together and a
+ * single test rejects the group if any of them is whitespace, padding or
+ * invalid. Only such groups and the tail go through the general loop.
+ *
+ * @param dst      binary output
+ * @param dstSize  size of 'dst'; output beyond it is dropped
+ * @param data     base64 input data
+ * @param len      length of 'data'
+ * @return         number of bytes stored in 'dst'
+ */
+size_t decodeBase64(uint8_t *dst, size_t dstSize, const char *data, size_t len, enum Base64Encoding encoding)
 {
   const uint8_t *s    = (const uint8_t *) data;
   const uint8_t *end  = s + len;
-  uint8_t       *d    = 0;
+  uint8_t       *d    = dst;
+  uint8_t       *dEnd = dst + dstSize;
   uint32_t       n    = 0;
   int            iter = 0;
-  const int     *decodeTable;
+  const int8_t  *decodeTable;
 
   switch (encoding)
   {
@@ -157,8 +172,24 @@ void sbAppendDecodeBase64(StringBuffer *sb, const char *data, size_t len, enum B
       break;
   }
 
-  sbEnsureCapacity(sb, len * 3 / 4 + 8 + sbGetLength(sb));
-  d = (uint8_t *) sbGet(sb) + sbGetLength(sb);
+  while (end - s >= 4 && dEnd - d >= 3)
+  {
+    int c0 = decodeTable[s[0]];
+    int c1 = decodeTable[s[1]];
+    int c2 = decodeTable[s[2]];
+    int c3 = decodeTable[s[3]];
+
+    if (((c0 | c1 | c2 | c3) & ~0x3f) != 0) // Whitespace, padding or invalid
+    {
+      break;
+    }
+    n    = (uint32_t) c0 << 18 | (uint32_t) c1 << 12 | (uint32_t) c2 << 6 | (uint32_t) c3;
+    d[0] = (uint8_t) (n >> 16);
+    d[1] = (uint8_t) (n >> 8);
+    d[2] = (uint8_t) (n);
+    d += 3;
+    s += 4;
+  }
 
   while (s < end)
   {
@@ -179,25 +210,33 @@ void sbAppendDecodeBase64(StringBuffer *sb, const char *data, size_t len, enum B
         iter++;
         if (iter == 4) // Every 4 characters we have 24 bits of output data
         {
-          *d++ = (uint8_t) (n >> 16);
-          *d++ = (uint8_t) (n >> 8);
-          *d++ = (uint8_t) (n);
+          for (int i = 0; i < 3 && d < dEnd; i++)
+          {
+            *d++ = (uint8_t) (n >> (16 - 8 * i));
+          }
           n    = 0;
           iter = 0;
         }
     }
   }
 
-  // Handle any remainder
-  if (iter == 3)
-  {
-    *d++ = (uint8_t) (n >> 10);
-    *d++ = (uint8_t) (n >> 2);
-  }
-  else if (iter == 2)
+  // Handle any remainder: three characters hold two bytes, two hold one
+  if (iter >= 2)
   {
-    *d++ = (uint8_t) (n >> 4);
+    n <<= 6 * (4 - iter);
+    for (int i = 0; i < iter - 1 && d < dEnd; i++)
+    {
+      *d++ = (uint8_t) (n >> (16 - 8 * i));
+    }
   }
 
-  sb->len = d - (uint8_t *) sbGet(sb);
+  return d - dst;
+}
+
+void sbAppendDecodeBase64(StringBuffer *sb, const char *data, size_t len, enum Base64Encoding encoding)
+{
+  size_t size = len * 3 / 4 + 8;
+
+  sbEnsureCapacity(sb, size + sbGetLength(sb));
+  sb->len += decodeBase64((uint8_t *) sbGet(sb) + sbGetLength(sb), size, data, len, encoding);
 }
@@ -29,51 +29,194 @@ static LogLevel logLevel = LOGLEVEL_INFO;
 static char *progName;
 static char  fixedTimestamp[DATE_LENGTH];
 
-uint64_t getNow(void)
+uint64_t getNowUs(void)
 {
   struct timeval tv;
 
   if (*fixedTimestamp != '\0')
   {
-    return UINT64_C(1672527600000); // 2023-01-01 00:00
+    return UINT64_C(1672527600000000); // 2023-01-01 00:00
   }
 
   if (gettimeofday(&tv, (void *) 0) == 0)
   {
-    uint64_t t    = tv.tv_sec;
-    uint64_t msec = tv.tv_usec / 1000L;
-
-    return t * 1000L + msec;
+    return (uint64_t) tv.tv_sec * 1000000L + (uint64_t) tv.tv_usec;
   }
   return 0L;
 }
 
+uint64_t getNow(void)
+{
+  return getNowUs() / 1000L;
+}
+
+/*
+ * Consecutive timestamps nearly always fall in the same second, so the
+ * "YYYY-MM-DDTHH:MM:SS" part is only formatted when the second changes; the
+ * fraction is written digit by digit.
+ */
+static time_t cachedSecond = (time_t) -1;
+static char   cachedSecondStr[DATE_LENGTH];
+static size_t cachedSecondLen;
+
+static const char *fmtTimestampFraction(char str[DATE_LENGTH], time_t t, uint32_t fraction, int digits)
+{
+  char *p;
+
+  if (t != cachedSecond)
+  {
+    struct tm tm;
+
+    gmtime_r(&t, &tm);
+    cachedSecondLen = strftime(cachedSecondStr, DATE_LENGTH - 9, "%Y-%m-%dT%H:%M:%S", &tm);
+    cachedSecond    = t;
+  }
+  memcpy(str, cachedSecondStr, cachedSecondLen);
+
+  p    = str + cachedSecondLen;
+  *p++ = '.';
+  for (int i = digits - 1; i >= 0; i--)
+  {
+    p[i] = (char) ('0' + fraction % 10);
+    fraction /= 10;
+  }
+  p += digits;
+  *p++ = 'Z';
+  *p   = '\0';
+  return str;
+}
+
 const char *fmtTimestamp(char str[DATE_LENGTH], uint64_t when)
 {
   if (fixedTimestamp[0] != '\0')
   {
     return (const char *) fixedTimestamp;
   }
+  if (when == UINT64_C(0))
+  {
+    when = getNow();
+  }
+  return fmtTimestampFraction(str, (time_t) (when / 1000L), (uint32_t) (when % 1000L), 3);
+}
+
+const char *fmtTimestampUs(char str[DATE_LENGTH], uint64_t whenUs)
+{
+  if (fixedTimestamp[0] != '\0')
+  {
+    return (const char *) fixedTimestamp;
+  }
+  if (whenUs == UINT64_C(0))
+  {
+    whenUs = getNowUs();
+  }
+  return fmtTimestampFraction(str, (time_t) (whenUs / 1000000L), (uint32_t) (whenUs % 1000000L), 6);
+}
+
+/*
+ * Days since 1970-01-01 for a date in the proleptic Gregorian calendar, without
+ * going through struct tm and timegm(). Eras of 400 years repeat exactly, so
+ * the day within the era follows from the year of the era and the day of a
+ * year that starts on March 1st (which puts the leap day last).
+ */
+int64_t daysFromCivil(int64_t year, unsigned int month, unsigned int day)
+{
+  int64_t      era;
+  unsigned int yoe;
+  unsigned int doy;
+  unsigned int doe;
+
+  year -= month <= 2;
+  era = (year >= 0 ? year : year - 399) / 400;
+  yoe = (unsigned int) (year - era * 400);
+  doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int64_t) doe - 719468;
+}
+
+static bool scanDigits(const char *s, size_t n, unsigned int *value)
+{
+  unsigned int v = 0;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    if (s[i] < '0' || s[i] > '9')
+    {
+      return false;
+    }
+    v = v * 10 + (unsigned int) (s[i] - '0');
+  }
+  *value = v;
+  return true;
+}
+
+/*
+ * Consecutive lines of a log nearly always share their date and second, so the
+ * epoch second of the last "YYYY-MM-DD?HH:MM:SS" prefix scanned is kept and
+ * reused when the next one is identical.
+ */
+#define TIMESTAMP_SECOND_LENGTH (19)
+
+static char    cachedScanPrefix[TIMESTAMP_SECOND_LENGTH + 1];
+static int64_t cachedScanSecond;
+static bool    cachedScanValid;
+
+/*
+ * Scan a UTC timestamp with the fixed layout "YYYY-MM-DD?HH:MM:SS" where '?' is
+ * 'T', '-' or ' ', optionally followed by a '.' or ',' fraction (the first
+ * three digits are the milliseconds, the rest is skipped) and a 'Z'.
+ * Returns a pointer just past the timestamp, or NULL when `s` does not hold
+ * one.
+ */
+const char *scanTimestamp(const char *s, uint64_t *when)
+{
+  int64_t      second;
+  unsigned int ms = 0;
+  const char  *p  = s + TIMESTAMP_SECOND_LENGTH;
+
+  if (cachedScanValid && strncmp(s, cachedScanPrefix, TIMESTAMP_SECOND_LENGTH) == 0)
+  {
+    second = cachedScanSecond;
+  }
   else
   {
-    time_t    t;
-    struct tm tm;
-    int       msec;
-    size_t    len;
+    unsigned int year, month, day, hour, minute, sec;
 
-    if (when == UINT64_C(0))
+    if (!scanDigits(s, 4, &year) || s[4] != '-' || !scanDigits(s + 5, 2, &month) || s[7] != '-' || !scanDigits(s + 8, 2, &day)
+        || (s[10] != 'T' && s[10] != '-' && s[10] != ' ') || !scanDigits(s + 11, 2, &hour) || s[13] != ':'
+        || !scanDigits(s + 14, 2, &minute) || s[16] != ':' || !scanDigits(s + 17, 2, &sec))
     {
-      when = getNow();
+      return NULL;
     }
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || sec > 59)
+    {
+      return NULL;
+    }
+    second = daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + sec;
+    if (second < 0)
+    {
+      return NULL;
+    }
+    memcpy(cachedScanPrefix, s, TIMESTAMP_SECOND_LENGTH);
+    cachedScanSecond = second;
+    cachedScanValid  = true;
+  }
 
-    t    = when / 1000L;
-    msec = when % 1000L;
-    gmtime_r(&t, &tm);
-    strftime(str, DATE_LENGTH - 5, "%Y-%m-%dT%H:%M:%S", &tm);
-    len = strlen(str);
-    snprintf(str + len, DATE_LENGTH - len, ".%3.3dZ", msec);
-    return str;
+  if (*p == '.' || *p == ',')
+  {
+    unsigned int scale = 100;
+
+    for (p++; *p >= '0' && *p <= '9'; p++)
+    {
+      ms += (unsigned int) (*p - '0') * scale;
+      scale /= 10;
+    }
+  }
+  if (*p == 'Z')
+  {
+    p++;
   }
+  *when = (uint64_t) second * 1000 + ms;
+  return p;
 }
 
 const char *fmtNow(char str[DATE_LENGTH])
@@ -270,28 +413,36 @@ char hexDigit(uint8_t b)
 
 void sbAppendEncodeHex(StringBuffer *sb, const void *data, size_t len, char separator)
 {
+  const uint8_t *s = data;
+  char          *d;
+
   sbEnsureCapacity(sb, sb->len + len * 3);
+  d = sb->data + sb->len;
 
-  for (; len > 0; len--, data++)
+  for (size_t i = 0; i < len; i++)
   {
-    sbAppendFormat(sb, "%c%c", hexDigit(((uint8_t *) data)[0] >> 4), hexDigit(((uint8_t *) data)[0] & 0x0f));
-    if (len > 1 && separator != '\0')
+    if (i > 0 && separator != '\0')
     {
-      sbAppendData(sb, &separator, 1);
+      *d++ = separator;
     }
+    *d++ = hexDigit(s[i] >> 4);
+    *d++ = hexDigit(s[i] & 0x0f);
   }
+  *d      = '\0';
+  sb->len = d - sb->data;
 }
 
-void sbAppendDecodeHex(StringBuffer *sb, const char *data, size_t len)
+/*
+ * Hex decode data straight into a caller supplied buffer, storing at most
+ * dstSize bytes. Returns the number of bytes stored.
+ */
+size_t decodeHex(uint8_t *dst, size_t dstSize, const char *data, size_t len)
 {
   uint8_t  nibble1;
   uint8_t  nibble2;
-  uint8_t *d;
-
-  sbEnsureCapacity(sb, len / 2 + 1 + sbGetLength(sb));
-  d = (uint8_t *) sbGet(sb) + sbGetLength(sb);
+  uint8_t *d = dst;
 
-  while (len >= 2)
+  while (len >= 2 && d < dst + dstSize)
   {
     nibble1 = (*data >= 'a') ? (*data - 'a' + 10) : (*data >= 'A' ? (*data - 'A' + 10) : (*data - '0'));
     data++;
@@ -301,7 +452,13 @@ void sbAppendDecodeHex(StringBuffer *sb, const char *data, size_t len)
     len -= 2;
   }
 
-  sb->len = d - (uint8_t *) sbGet(sb);
+  return d - dst;
+}
+
+void sbAppendDecodeHex(StringBuffer *sb, const char *data, size_t len)
+{
+  sbEnsureCapacity(sb, len / 2 + 1 + sbGetLength(sb));
+  sb->len += decodeHex((uint8_t *) sbGet(sb) + sbGetLength(sb), len / 2, data, len);
 }
 
 void sbAppendString(StringBuffer *sb, const char *string)
@@ -584,6 +741,78 @@ char *sbSearchChar(const StringBuffer *const in, char c)
   return 0;
 }
 
+void rbAppendData(ReadBuffer *rb, const void *data, size_t len)
+{
+  if (rb->start > 0 && rb->start >= rbGetLength(rb))
+  {
+    sbDelete(&rb->sb, 0, rb->start);
+    rb->start = 0;
+  }
+  sbAppendData(&rb->sb, data, len);
+}
+
+void rbConsume(ReadBuffer *rb, size_t len)
+{
+  if (len >= rbGetLength(rb))
+  {
+    rbEmpty(rb);
+    return;
+  }
+  rb->start += len;
+}
+
+char *rbSearchChar(const ReadBuffer *rb, char c)
+{
+  return memchr(rbGet(rb), c, rbGetLength(rb));
+}
+
+bool rbGetLine(ReadBuffer *rb, char *line, size_t size)
+{
+  char  *p = rbSearchChar(rb, '\n');
+  size_t len;
+
+  if (p == NULL)
+  {
+    return false;
+  }
+  len = CB_MIN((size_t) (p - rbGet(rb)) + 1, size - 1);
+  memcpy(line, rbGet(rb), len);
+  line[len] = '\0';
+  rbConsume(rb, p - rbGet(rb) + 1);
+  return true;
+}
+
+void lwLineDone(LineWriter *lw)
+{
+  if (sbGetLength(&lw->sb) >= LINE_WRITER_FLUSH_SIZE)
+  {
+    lwFlush(lw);
+  }
+}
+
+void lwFlush(LineWriter *lw)
+{
+  const char *p   = sbGet(&lw->sb);
+  size_t      len = sbGetLength(&lw->sb);
+
+  while (len > 0)
+  {
+    ssize_t r = write(lw->fd, p, len);
+
+    if (r < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (r <= 0)
+    {
+      logAbort("Cannot write to output\n");
+    }
+    p += r;
+    len -= (size_t) r;
+  }
+  sbEmpty(&lw->sb);
+}
+
 /*
  * Table 1 - Mapping of ISO 11783 into CAN's Arbitration and Control Fields
 29 Bit Identifiers
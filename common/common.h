@@ -130,6 +130,9 @@ void  sbDelete(StringBuffer *sb, size_t start, size_t end);
 void  sbEnsureCapacity(StringBuffer *const sb, size_t len);
 char *sbSearchChar(const StringBuffer *const sb, char c);
 
+size_t decodeHex(uint8_t *dst, size_t dstSize, const char *data, size_t len);                                  // hex to binary
+size_t decodeBase64(uint8_t *dst, size_t dstSize, const char *data, size_t len, enum Base64Encoding encoding); // base64 to binary
+
 #define sbGet(sb) ((sb)->data ? (sb)->data : "")
 #define sbGetLength(sb) ((sb)->len)
 #define sbTerminate(sb)             \
@@ -159,6 +162,48 @@ char *sbSearchChar(const StringBuffer *const sb, char c);
     (sb)->len   = 0;    \
   }
 
+/*
+ * Input that has been read but not yet handled. Lines and frames are consumed
+ * by advancing `start`; the consumed bytes are only dropped, with one memmove,
+ * when new data is appended and they make up at least half of the buffer. That
+ * keeps taking a large read apart message by message linear.
+ */
+typedef struct ReadBuffer
+{
+  StringBuffer sb;
+  size_t       start;
+} ReadBuffer;
+
+void  rbAppendData(ReadBuffer *rb, const void *data, size_t len);
+void  rbConsume(ReadBuffer *rb, size_t len);
+char *rbSearchChar(const ReadBuffer *rb, char c);
+bool  rbGetLine(ReadBuffer *rb, char *line, size_t size); // up to and including '\n', truncated to size - 1
+
+#define rbGet(rb) (sbGet(&(rb)->sb) + (rb)->start)
+#define rbGetLength(rb) (sbGetLength(&(rb)->sb) - (rb)->start)
+#define rbEmpty(rb)     \
+  {                     \
+    sbEmpty(&(rb)->sb); \
+    (rb)->start = 0;    \
+  }
+
+/*
+ * Output lines that are collected and written with one write() per batch
+ * instead of one per line. Append a complete line to `sb` and call
+ * lwLineDone(); call lwFlush() once the input at hand has been handled, so a
+ * live stream is never held back longer than that.
+ */
+typedef struct LineWriter
+{
+  StringBuffer sb;
+  int          fd;
+} LineWriter;
+
+#define LINE_WRITER_FLUSH_SIZE (65536)
+
+void lwLineDone(LineWriter *lw); // flushes once LINE_WRITER_FLUSH_SIZE bytes are pending
+void lwFlush(LineWriter *lw);    // aborts the program when the output cannot be written
+
 bool getJSONValue(const char *message, const char *fieldName, char *value, size_t len);
 bool getJSONLookupValue(const char *message, const char *fieldName, char *value, size_t len);
 bool getJSONLookupName(const char *message, const char *fieldName, char *value, size_t len);
@@ -173,8 +218,12 @@ void emitCanboatStartupRecord(const char *source, const char *device);
 
 #define DATE_LENGTH 60
 const char *fmtNow(char str[DATE_LENGTH]);
-const char *fmtTimestamp(char str[DATE_LENGTH], uint64_t timestamp);
+const char *fmtTimestamp(char str[DATE_LENGTH], uint64_t timestamp);     // timestamp in ms since the epoch, 0 = now
+const char *fmtTimestampUs(char str[DATE_LENGTH], uint64_t timestampUs); // timestamp in us since the epoch, 0 = now
 uint64_t    getNow(void);
+uint64_t    getNowUs(void);
+int64_t     daysFromCivil(int64_t year, unsigned int month, unsigned int day);
+const char *scanTimestamp(const char *s, uint64_t *when); // "YYYY-MM-DD[T- ]HH:MM:SS[.fff][Z]" as UTC ms; NULL if not
 
 uint8_t scanNibble(char c);
 int     scanHex(char **p, uint8_t *m);
@@ -262,9 +311,9 @@ int writeSerial(SOCKET handle, const uint8_t *data, size_t len);
 
 /*
  * The largest payload that any reassembled NMEA 2000 message can have; this is
- * what a RawMessage must be able to hold. Note that only the transports above
- * reassemble; a message that is to be *transmitted* still has to fit in a fast
- * packet, since none of the writers implement ISO TP.
+ * what a RawMessage must be able to hold. Of the writers only socketcan-writer
+ * transmits larger than a fast packet, as an ISO TP broadcast (BAM); the others
+ * still need the message to fit in a fast packet.
  */
 #define MAX_PGN_SIZE (ISOTP_MAX_SIZE)
 
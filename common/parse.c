@@ -456,7 +456,7 @@ int parseRawFormatYDWG02(char *msg, RawMessage *m, bool showJson)
   return setParsedValues(m, prio, pgn, dst, src, i);
 }
 
-bool parseFastFormat(StringBuffer *in, RawMessage *msg)
+bool parseFastFormat(const char *in, RawMessage *msg)
 {
   unsigned int prio;
   unsigned int pgn;
@@ -464,20 +464,20 @@ bool parseFastFormat(StringBuffer *in, RawMessage *msg)
   unsigned int dst;
   unsigned int bytes;
 
-  char        *p;
+  const char  *p;
   int          i;
   unsigned int b;
   unsigned int byt;
   int          r;
 
-  p = strchr(sbGet(in), '\n');
+  p = strchr(in, '\n');
   if (!p)
   {
     return false;
   }
 
   // Skip the timestamp
-  p = strchr(sbGet(in), ',');
+  p = strchr(in, ',');
   if (!p)
   {
     return false;
@@ -488,13 +488,13 @@ bool parseFastFormat(StringBuffer *in, RawMessage *msg)
   {
     if (bytes > MAX_PGN_SIZE)
     {
-      logError("Message size %u exceeds maximum %u: %s\n", bytes, MAX_PGN_SIZE, sbGet(in));
+      logError("Message size %u exceeds maximum %u: %s\n", bytes, MAX_PGN_SIZE, in);
       return false;
     }
 
     // now store the timestamp, unchanged
     memset(msg->timestamp, 0, sizeof msg->timestamp);
-    memcpy(msg->timestamp, sbGet(in), CB_MIN(p - sbGet(in), sizeof msg->timestamp - 1));
+    memcpy(msg->timestamp, in, CB_MIN(p - in, sizeof msg->timestamp - 1));
 
     msg->prio = prio;
     msg->pgn  = pgn;
@@ -512,14 +512,14 @@ bool parseFastFormat(StringBuffer *in, RawMessage *msg)
       }
       else
       {
-        logError("Unable to parse incoming message '%s' data byte %u\n", sbGet(in), b);
+        logError("Unable to parse incoming message '%s' data byte %u\n", in, b);
         return false;
       }
       p += i;
     }
     return true;
   }
-  logError("Unable to parse incoming message '%s', r = %d\n", sbGet(in), r);
+  logError("Unable to parse incoming message '%s', r = %d\n", in, r);
   return false;
 }
 
@@ -593,6 +593,35 @@ int parseRawFormatActisenseN2KAscii(char *msg, RawMessage *m, bool showJson)
   return 0;
 }
 
+/*
+ * The local-time form goes through mktime(), which consults the timezone
+ * rules every call. Its result only depends on the "YYYY-MM-DD HH:MM:SS"
+ * prefix, so that is cached for the next line in the same second.
+ */
+static char   cachedLocalPrefix[20];
+static time_t cachedLocalEpoch;
+
+static bool isLocalTimestampLayout(const char *msg)
+{
+  return strlen(msg) > 19 && msg[4] == '-' && msg[7] == '-' && msg[10] == ' ' && msg[13] == ':' && msg[16] == ':' && msg[19] == '.';
+}
+
+/*
+ * The sscanf() calls below read the fraction as a plain number, which is right
+ * for the usual three millisecond digits. Sub-millisecond timestamps (such as
+ * socketcan-serial -ts us) carry more; only their leading three digits count.
+ */
+static int fractionMillis(const char *msg, int milli)
+{
+  const char *f = strchr(msg, '.');
+
+  if (f != NULL && strspn(f + 1, "0123456789") > 3)
+  {
+    return (f[1] - '0') * 100 + (f[2] - '0') * 10 + (f[3] - '0');
+  }
+  return milli;
+}
+
 bool parseTimestamp(const char *msg, uint64_t *when)
 {
   struct tm t;
@@ -609,11 +638,18 @@ bool parseTimestamp(const char *msg, uint64_t *when)
   p = strstr(msg, "Z,");
   if (p)
   {
+    // The canonical YYYY-MM-DDTHH:MM:SS.mmmZ, or with sub-millisecond digits, which the sscanf() below reads the same way
+    if (p - msg >= 23 && msg[10] == 'T' && msg[19] == '.' && scanTimestamp(msg, when) == p + 1)
+    {
+      logDebug("parseTimestamp '%s' => %" PRIu64 "\n", msg, *when);
+      return true;
+    }
     if (sscanf(msg, "%d-%d-%dT%d:%d:%d.%dZ", &year, &month, &day, &hour, &min, &sec, &milli) < 6)
     {
       logDebug("Unable to parse timestamp '%s'\n", msg);
       return false;
     }
+    milli      = fractionMillis(msg, milli);
     t.tm_year  = year - 1900;
     t.tm_mon   = month - 1;
     t.tm_mday  = day;
@@ -623,6 +659,12 @@ bool parseTimestamp(const char *msg, uint64_t *when)
     t.tm_isdst = -1;
     epoch      = timegm(&t);
   }
+  else if (isLocalTimestampLayout(msg) && cachedLocalPrefix[0] != '\0' && strncmp(msg, cachedLocalPrefix, 19) == 0)
+  {
+    sscanf(msg + 19, ".%d", &milli);
+    milli = fractionMillis(msg, milli);
+    epoch = cachedLocalEpoch;
+  }
   else
   {
     if (sscanf(msg, "%d-%d-%d %d:%d:%d.%d", &year, &month, &day, &hour, &min, &sec, &milli) < 6)
@@ -630,6 +672,7 @@ bool parseTimestamp(const char *msg, uint64_t *when)
       logDebug("Unable to parse timestamp '%s'\n", msg);
       return false;
     }
+    milli      = fractionMillis(msg, milli);
     t.tm_year  = year - 1900;
     t.tm_mon   = month - 1;
     t.tm_mday  = day;
@@ -638,12 +681,17 @@ bool parseTimestamp(const char *msg, uint64_t *when)
     t.tm_sec   = sec;
     t.tm_isdst = -1;
     epoch      = mktime(&t);
+    if (isLocalTimestampLayout(msg))
+    {
+      memcpy(cachedLocalPrefix, msg, 19);
+      cachedLocalEpoch = epoch;
+    }
   }
 
-  logDebug("parseTimestamp '%s' => %d-%d-%d %d:%d:%d.%03d\n", msg, year, month, day, hour, min, sec, milli);
-
   *when = epoch * UINT64_C(1000) + milli;
 
+  logDebug("parseTimestamp '%s' => %" PRIu64 "\n", msg, *when);
+
   return true;
 }
 
@@ -675,6 +723,30 @@ static bool allDigits(const char *p, size_t n)
   return true;
 }
 
+/*
+ * Normalize what follows `HH:MM:SS` into exactly three millisecond digits. An optional `.`/`,`
+ * then digits; anything after the digit run (a trailing `Z`, a timezone) is dropped -- canboat
+ * timestamps are UTC-naive. The fraction is padded/truncated: `.1` -> `100`, `.107` -> `107`,
+ * `.10734` -> `107`, nothing at all -> `000`.
+ */
+static bool normalizeFraction(const char *s, char ms[4])
+{
+  memcpy(ms, "000", 4);
+  if (*s == '\0')
+  {
+    return true;
+  }
+  if (*s != '.' && *s != ',')
+  {
+    return false;
+  }
+  for (size_t i = 1, j = 0; j < 3 && isdigit((unsigned char) s[i]); i++, j++)
+  {
+    ms[j] = s[i];
+  }
+  return true;
+}
+
 /*
  * Parse `HH:MM:SS` with an optional `.`/`,` fraction from `s` and write `HH:MM:SS.mmm` into `out`.
  * Returns true on success; false (leaving `out` untouched) when the shape or field ranges don't
@@ -704,21 +776,10 @@ static bool normalizeTime(const char *s, char *out)
     }
   }
 
-  /* Optional fractional seconds: a `.`/`,` at index 8 then digits. Anything after the digit run (a
-   * trailing `Z`, a timezone) is dropped -- canboat timestamps are UTC-naive. Pad/truncate the
-   * fraction to exactly three digits (milliseconds): `.1` -> `100`, `.107` -> `107`,
-   * `.10734` -> `107`. */
-  char ms[4] = "000";
-  if (len > 8)
+  char ms[4];
+  if (!normalizeFraction(s + 8, ms))
   {
-    if (s[8] != '.' && s[8] != ',')
-    {
-      return false;
-    }
-    for (size_t i = 9, j = 0; i < len && j < 3 && isdigit((unsigned char) s[i]); i++, j++)
-    {
-      ms[j] = s[i];
-    }
+    return false;
   }
 
   memcpy(out, s, 8);
@@ -736,6 +797,24 @@ static bool isCanonicalTimestamp(const char *ts)
          && allDigits(ts + 11, 2) && allDigits(ts + 14, 2) && allDigits(ts + 17, 2) && allDigits(ts + 20, 3);
 }
 
+/*
+ * Consecutive messages nearly always share their date and second. The canonical
+ * `YYYY-MM-DDTHH:MM:SS` of the last date-bearing timestamp is kept, keyed on the first 19
+ * characters of its input, so for the next one only the fraction needs normalizing.
+ */
+#define NORMALIZED_SECOND_LENGTH (19)
+
+static char cachedSecondIn[NORMALIZED_SECOND_LENGTH + 1];
+static char cachedSecondOut[NORMALIZED_SECOND_LENGTH + 1];
+static bool cachedSecondValid;
+
+static void cacheNormalizedSecond(const char *in, const char *out)
+{
+  memcpy(cachedSecondIn, in, NORMALIZED_SECOND_LENGTH);
+  memcpy(cachedSecondOut, out, NORMALIZED_SECOND_LENGTH);
+  cachedSecondValid = true;
+}
+
 void normalizeTimestamp(const char *in, char *out, size_t outLen)
 {
   if (outLen < DATE_LENGTH)
@@ -748,10 +827,32 @@ void normalizeTimestamp(const char *in, char *out, size_t outLen)
     return;
   }
 
-  /* Fast path: the common live-gateway form is already canonical, so avoid re-parsing it. */
+  /* Fast path: same second as the previous timestamp. */
+  if (cachedSecondValid && strncmp(in, cachedSecondIn, NORMALIZED_SECOND_LENGTH) == 0)
+  {
+    char ms[4];
+
+    if (normalizeFraction(in + NORMALIZED_SECOND_LENGTH, ms))
+    {
+      memcpy(out, cachedSecondOut, NORMALIZED_SECOND_LENGTH);
+      out[19] = '.';
+      memcpy(out + 20, ms, 3);
+      out[23] = 'Z';
+      out[24] = 0;
+      return;
+    }
+  }
+
+  /* The common live-gateway form is already canonical, so avoid re-parsing it. */
   if (isCanonicalTimestamp(in))
   {
+    char time[13];
+
     memcpy(out, in, strlen(in) + 1);
+    if (normalizeTime(in + 11, time)) // Only cache what the date-bearing path below would accept
+    {
+      cacheNormalizedSecond(in, out);
+    }
     return;
   }
 
@@ -776,6 +877,10 @@ void normalizeTimestamp(const char *in, char *out, size_t outLen)
         memcpy(out + 11, time, strlen(time));
         out[11 + strlen(time)] = 'Z';
         out[12 + strlen(time)] = 0;
+        if (t == in)
+        {
+          cacheNormalizedSecond(in, out);
+        }
         return;
       }
     }
@@ -36,7 +36,7 @@ typedef struct
   uint8_t  data[MAX_PGN_SIZE];
 } RawMessage;
 
-bool parseFastFormat(StringBuffer *src, RawMessage *msg);
+bool parseFastFormat(const char *src, RawMessage *msg);
 bool parseInt(const char **msg, int *value, int defValue);
 bool parseConst(const char **msg, const char *str);
 
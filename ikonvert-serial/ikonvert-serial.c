@@ -60,16 +60,16 @@ int speed    = 230400;
 
 // Yeah globals. We're trying to avoid malloc()/free() to run quickly on limited memory hardware
 StringBuffer writeBuffer; // What we still have to write to device
-StringBuffer readBuffer;  // What we have already read from device
-StringBuffer inBuffer;    // What we have already read from stdin but is not complete yet
-StringBuffer dataBuffer;  // Temporary buffer during parse or generate
+ReadBuffer   readBuffer;  // What we have already read from device
+ReadBuffer   inBuffer;    // What we have already read from stdin but is not complete yet
+LineWriter   outWriter;   // FAST lines for stdout, written once per read
 StringBuffer txList;      // TX list to send to iKonvert
 StringBuffer rxList;      // RX list to send to iKonvert
 
 uint64_t lastNow; // Epoch time of last timestamp
 
-static void processInBuffer(StringBuffer *in, StringBuffer *out);
-static bool processReadBuffer(StringBuffer *in, int out);
+static void processInBuffer(ReadBuffer *in, StringBuffer *out);
+static bool processReadBuffer(ReadBuffer *in, LineWriter *out);
 static void initializeDevice(void);
 static void sendNextInitCommand(void);
 
@@ -304,6 +304,7 @@ int main(int argc, char **argv)
     }
   }
 
+  outWriter.fd = STDOUT;
   fputs(CANBOAT_FORMAT_FAST_HEADER, stdout);
   emitCanboatStartupRecord("ikonvert-serial", device);
 
@@ -330,7 +331,7 @@ int main(int argc, char **argv)
       r = read(handle, data, sizeof data);
       if (r > 0)
       {
-        sbAppendData(&readBuffer, data, r);
+        rbAppendData(&readBuffer, data, r);
       }
       if (r < 0)
       {
@@ -347,7 +348,7 @@ int main(int argc, char **argv)
       r = read(STDIN, data, sizeof data);
       if (r > 0)
       {
-        sbAppendData(&inBuffer, data, r);
+        rbAppendData(&inBuffer, data, r);
         processInBuffer(&inBuffer, &writeBuffer);
       }
       if (r < 0)
@@ -377,10 +378,10 @@ int main(int argc, char **argv)
       }
     }
 
-    if (sbGetLength(&readBuffer) > 0)
+    if (rbGetLength(&readBuffer) > 0)
     {
-      logDebug("readBuffer len=%zu\n", sbGetLength(&readBuffer));
-      receivedSomething = processReadBuffer(&readBuffer, STDOUT);
+      logDebug("readBuffer len=%zu\n", rbGetLength(&readBuffer));
+      receivedSomething = processReadBuffer(&readBuffer, &outWriter);
     }
 
     // The isReady() function already aborted the program
@@ -419,14 +420,14 @@ int main(int argc, char **argv)
 /* Received data from stdin. Once it is a full command parse it as FORMAT_FAST then convert to
  * format desired by device.
  */
-static void processInBuffer(StringBuffer *in, StringBuffer *out)
+static void processInBuffer(ReadBuffer *in, StringBuffer *out)
 {
   RawMessage msg;
   char      *p;
 
-  while ((p = strchr(sbGet(in), '\n')) != 0)
+  while ((p = rbSearchChar(in, '\n')) != 0)
   {
-    if (!readonly && parseFastFormat(in, &msg) && msg.pgn < CANBOAT_PGN_START)
+    if (!readonly && parseFastFormat(rbGet(in), &msg) && msg.pgn < CANBOAT_PGN_START)
     {
       if (msg.len > FASTPACKET_MAX_SIZE)
       {
@@ -458,21 +459,18 @@ static void processInBuffer(StringBuffer *in, StringBuffer *out)
 
     if (passthru)
     {
-      ssize_t r = write(STDOUT, sbGet(in), p + 1 - sbGet(in));
-
-      if (r <= 0)
-      {
-        logAbort("Cannot write to output\n");
-      }
+      sbAppendData(&outWriter.sb, rbGet(in), p + 1 - rbGet(in));
+      lwLineDone(&outWriter);
     }
-    sbDelete(in, 0, p + 1 - sbGet(in));
+    rbConsume(in, p + 1 - rbGet(in));
   }
+  lwFlush(&outWriter);
 
   if (!p)
   {
-    if (sbGetLength(in) > sizeof("2019-01-20T14:42:04.636Z,0,129540,") + 3 * FASTPACKET_MAX_SIZE)
+    if (rbGetLength(in) > sizeof("2019-01-20T14:42:04.636Z,0,129540,") + 3 * FASTPACKET_MAX_SIZE)
     {
-      sbEmpty(in);
+      rbEmpty(in);
     }
     return;
   }
@@ -487,10 +485,10 @@ static void computeIKonvertTime(RawMessage *msg)
   fmtTimestamp(msg->timestamp, UINT64_C(0));
 }
 
-static bool parseIKonvertFormat(StringBuffer *in, RawMessage *msg)
+static bool parseIKonvertFormat(char *in, RawMessage *msg)
 {
-  char        *end = sbGet(in) + strlen(sbGet(in)); // not sbGetLength as 'in' has been truncated
-  char        *p   = sbGet(in);
+  char        *end = in + strlen(in); // the record has been terminated in place
+  char        *p   = in;
   int          r;
   unsigned int pgn;
   unsigned int prio;
@@ -514,15 +512,12 @@ static bool parseIKonvertFormat(StringBuffer *in, RawMessage *msg)
   p += i;
   if (hexMode)
   {
-    sbAppendDecodeHex(&dataBuffer, p, end - p);
+    msg->len = decodeHex(msg->data, FASTPACKET_MAX_SIZE, p, end - p);
   }
   else
   {
-    sbAppendDecodeBase64(&dataBuffer, p, end - p, BASE64_RFC);
+    msg->len = decodeBase64(msg->data, FASTPACKET_MAX_SIZE, p, end - p, BASE64_RFC);
   }
-  msg->len = CB_MIN(sbGetLength(&dataBuffer), FASTPACKET_MAX_SIZE);
-  memcpy(msg->data, sbGet(&dataBuffer), msg->len);
-  sbEmpty(&dataBuffer);
   computeIKonvertTime(msg);
   return true;
 }
@@ -781,22 +776,22 @@ static bool parseIKonvertAsciiMessage(const char *msg, RawMessage *n2k)
   return false;
 }
 
-static bool processReadBuffer(StringBuffer *in, int out)
+static bool processReadBuffer(ReadBuffer *in, LineWriter *out)
 {
-  RawMessage  msg;
-  char       *p;
-  const char *w;
-  bool        allowInit = true;
-  bool        ret       = false;
-
-  logDebug("processReadBuffer len=%zu\n", sbGetLength(in));
-  while ((p = sbSearchChar(in, '\n')) != 0)
+  RawMessage msg;
+  char      *p;
+  char      *w;
+  bool       allowInit = true;
+  bool       ret       = false;
+
+  logDebug("processReadBuffer len=%zu\n", rbGetLength(in));
+  while ((p = rbSearchChar(in, '\n')) != 0)
   {
-    w = sbGet(in);
+    w = rbGet(in);
     if ((p - w > sizeof IKONVERT_ASCII_PREFIX) && (w[0] == '$' || w[0] == '!'))
     {
       logDebug("processReadBuffer found record len=%zu\n", p - w);
-      memset(&msg, 0, sizeof msg);
+      msg.len = 0; // Only a parsed message sets it; the rest of msg is never read without it
 
       p[0] = 0;
 
@@ -811,16 +806,16 @@ static bool processReadBuffer(StringBuffer *in, int out)
       // the init state machine. Parse them unconditionally —
       // including in -w mode — so the device handshake can
       // complete and we ever leave N2NET_OFFLINE.
-      if (parseIKonvertAsciiMessage(sbGet(in), &msg))
+      if (parseIKonvertAsciiMessage(w, &msg))
       {
-        logDebug("ASCII message [%s] handled\n", sbGet(in));
+        logDebug("ASCII message [%s] handled\n", w);
         if (allowInit)
         {
           sendNextInitCommand();
           allowInit = false;
         }
       }
-      else if (parseIKonvertFormat(in, &msg))
+      else if (parseIKonvertFormat(w, &msg))
       {
         sequentialStatusMessages = 0;
         if (sendInitState > 0)
@@ -837,38 +832,30 @@ static bool processReadBuffer(StringBuffer *in, int out)
       }
       else
       {
-        logError("Ignoring unknown or invalid message '%s'\n", sbGet(in));
+        logError("Ignoring unknown or invalid message '%s'\n", w);
       }
 
       if (msg.len > 0)
       {
-        ssize_t r;
-
         // Format msg as FAST message
-        sbAppendFormat(&dataBuffer, "%s,%u,%u,%u,%u,%u,", msg.timestamp, msg.prio, msg.pgn, msg.src, msg.dst, msg.len);
-        sbAppendEncodeHex(&dataBuffer, msg.data, msg.len, ',');
-        sbAppendString(&dataBuffer, "\n");
-
-        r = write(out, sbGet(&dataBuffer), sbGetLength(&dataBuffer));
-        if (r <= 0)
-        {
-          logAbort("Cannot write to output\n");
-        }
-
-        sbEmpty(&dataBuffer);
+        sbAppendFormat(&out->sb, "%s,%u,%u,%u,%u,%u,", msg.timestamp, msg.prio, msg.pgn, msg.src, msg.dst, msg.len);
+        sbAppendEncodeHex(&out->sb, msg.data, msg.len, ',');
+        sbAppendChar(&out->sb, '\n');
+        lwLineDone(out);
       }
     }
     else
     {
-      logDebug("Junk record len=%zu\n", p + 1 - sbGet(in));
+      logDebug("Junk record len=%zu\n", p + 1 - w);
     }
-    sbDelete(in, 0, p + 1 - sbGet(in));
+    rbConsume(in, p + 1 - w);
   }
-  if (sbGetLength(in) > 0 && *sbGet(in) != '$' && *sbGet(in) != '!')
+  if (rbGetLength(in) > 0 && *rbGet(in) != '$' && *rbGet(in) != '!')
   {
     // Remove any gibberish from buffer
-    sbEmpty(in);
+    rbEmpty(in);
   }
+  lwFlush(out);
 
   return ret;
 }
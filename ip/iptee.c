@@ -18,11 +18,16 @@ limitations under the License.
 
 */
 
+#include <poll.h>
 #include <signal.h>
 
 #include "common.h"
 
 #define LINESIZE MAX_MSG_LINE_LENGTH
+#define STDIN_READ_SIZE (65536)
+#define DEFAULT_QUEUE_KB (256)
+#define RECONNECT_INTERVAL (2000) /* ms between attempts to reopen a failed connection or server */
+#define EXIT_DRAIN_TIMEOUT (5000) /* ms that queued output may still take after EOF on stdin */
 
 bool writeonly = false;
 
@@ -33,6 +38,12 @@ typedef enum ConnectionType
   ServerTCP
 } ConnectionType;
 
+typedef enum OverflowPolicy
+{
+  OverflowDropOldest,
+  OverflowDisconnect
+} OverflowPolicy;
+
 typedef union sockaddr_union
 {
   struct sockaddr     any;
@@ -40,19 +51,51 @@ typedef union sockaddr_union
   struct sockaddr_in6 in6;
 } sockaddr_union;
 
+/*
+ * A connection given on the command line (reconnect is set) or a client that
+ * connected to one of our servers. Nothing is ever sent with a blocking call:
+ * what a TCP peer cannot take yet waits in its queue, which is bounded by
+ * queueLimit so that one stalled peer cannot hold up stdin or the others.
+ */
 typedef struct Client
 {
   int            fd;
   ConnectionType ct;
   bool           reconnect;
+  bool           connecting; // non-blocking connect() not finished yet
+  bool           midLine;    // the queue starts with the rest of a partly sent line
   char          *host;
   char          *port;
   sockaddr_union sockaddr;
   socklen_t      socklen;
+  ReadBuffer     queue;   // Output the peer has not accepted yet
+  uint64_t       dropped; // Lines dropped because the queue was full
+  uint64_t       retryAt; // When to reopen a failed connection or server
 } Client;
 
-Client client[256]; /* Surely this is enough connections? */
-int    clients;
+Client *client;
+size_t  clients;
+size_t  clientAlloc;
+
+static size_t         queueLimit = DEFAULT_QUEUE_KB * 1024;
+static OverflowPolicy overflow   = OverflowDropOldest;
+static LineWriter     outWriter;
+
+static Client *newClient(void)
+{
+  if (clients == clientAlloc)
+  {
+    clientAlloc = clientAlloc ? clientAlloc * 2 : 16;
+    client      = realloc(client, clientAlloc * sizeof(client[0]));
+    if (client == NULL)
+    {
+      die("Out of memory");
+    }
+  }
+  memset(&client[clients], 0, sizeof(client[0]));
+  client[clients].fd = -1;
+  return &client[clients++];
+}
 
 int ipConnect(const char *host, const char *service, ConnectionType ct, struct sockaddr *sockaddr, socklen_t *socklen)
 {
@@ -68,26 +111,34 @@ int ipConnect(const char *host, const char *service, ConnectionType ct, struct s
   if (n != 0)
   {
     logError("Unable to open connection to %s:%s: %s\n", host, service, gai_strerror(n));
+    return -1;
   }
 
   for (addr = res; addr; addr = addr->ai_next)
   {
+    unsigned long nonblock = 1;
+
     sockfd = socket(addr->ai_family, addr->ai_socktype, addr->ai_protocol);
     if (sockfd < 0)
     {
       continue;
     }
+    ioctl(sockfd, FIONBIO, &nonblock); /* Set to non-blocking */
 
     if (ct == ServerTCP)
     {
-      if (!bind(sockfd, addr->ai_addr, addr->ai_addrlen) && !listen(sockfd, 10))
+      int on = 1;
+
+      setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+      if (!bind(sockfd, addr->ai_addr, addr->ai_addrlen) && !listen(sockfd, 64))
       {
         break;
       }
     }
     else if (ct == ClientTCP)
     {
-      if (!connect(sockfd, addr->ai_addr, addr->ai_addrlen))
+      /* Completes in the background; the socket turns writable when done */
+      if (!connect(sockfd, addr->ai_addr, addr->ai_addrlen) || errno == EINPROGRESS)
       {
         break;
       }
@@ -111,88 +162,346 @@ int ipConnect(const char *host, const char *service, ConnectionType ct, struct s
 
   freeaddrinfo(res);
 
-  if (sockfd >= 0 && ct != ClientUDP)
+  if (sockfd >= 0 && ct == ServerTCP)
   {
-    unsigned long nonblock = 1;
-    ioctl(sockfd, FIONBIO, &nonblock); /* Set to non-blocking */
-    logInfo("Opened %s %s:%s\n", ((ct == ServerTCP) ? "server for" : "connection to"), host, service);
+    logInfo("Opened server for %s:%s\n", host, service);
   }
 
   return sockfd;
 }
 
-int storeNewClient(int i, int sockfd)
+int storeNewClient(Client *c, int sockfd)
 {
-  char portstr[10];
+  char          portstr[10];
+  unsigned long nonblock = 1;
 
-  client[i].socklen = sizeof(client[i].sockaddr);
-  if (getpeername(sockfd, &client[i].sockaddr.any, &client[i].socklen))
+  c->socklen = sizeof(c->sockaddr);
+  if (getpeername(sockfd, &c->sockaddr.any, &c->socklen))
   {
     logError("Unknown incoming client\n");
     close(sockfd);
     return 0;
   }
 
-  if (client[i].host)
+  if (c->host)
   {
-    free(client[i].host);
-    client[i].host = 0;
+    free(c->host);
+    c->host = 0;
   }
-  if (client[i].port)
+  if (c->port)
   {
-    free(client[i].port);
-    client[i].port = 0;
+    free(c->port);
+    c->port = 0;
   }
 
-  client[i].host = calloc(INET6_ADDRSTRLEN + 2, 1);
-  if (client[i].sockaddr.any.sa_family == AF_INET)
+  c->host = calloc(INET6_ADDRSTRLEN + 2, 1);
+  if (c->sockaddr.any.sa_family == AF_INET)
   {
-    inet_ntop(client[i].sockaddr.any.sa_family, &client[i].sockaddr.in.sin_addr, client[i].host, INET6_ADDRSTRLEN + 1);
-    snprintf(portstr, sizeof(portstr), "%u", ntohs(client[i].sockaddr.in.sin_port));
-    client[i].port = strdup(portstr);
+    inet_ntop(c->sockaddr.any.sa_family, &c->sockaddr.in.sin_addr, c->host, INET6_ADDRSTRLEN + 1);
+    snprintf(portstr, sizeof(portstr), "%u", ntohs(c->sockaddr.in.sin_port));
+    c->port = strdup(portstr);
   }
-  else if (client[i].sockaddr.any.sa_family == AF_INET6)
+  else if (c->sockaddr.any.sa_family == AF_INET6)
   {
-    inet_ntop(client[i].sockaddr.any.sa_family, &client[i].sockaddr.in6.sin6_addr, client[i].host, INET6_ADDRSTRLEN + 1);
-    snprintf(portstr, sizeof(portstr), "%u", ntohs(client[i].sockaddr.in6.sin6_port));
-    client[i].port = strdup(portstr);
+    inet_ntop(c->sockaddr.any.sa_family, &c->sockaddr.in6.sin6_addr, c->host, INET6_ADDRSTRLEN + 1);
+    snprintf(portstr, sizeof(portstr), "%u", ntohs(c->sockaddr.in6.sin6_port));
+    c->port = strdup(portstr);
   }
   else
   {
-    logAbort("Unknown family %d\n", client[i].sockaddr.any.sa_family);
+    logAbort("Unknown family %d\n", c->sockaddr.any.sa_family);
   }
 
-  client[i].fd        = sockfd;
-  client[i].ct        = ClientTCP;
-  client[i].reconnect = false;
+  ioctl(sockfd, FIONBIO, &nonblock); /* accept() does not pass this on everywhere */
+  c->fd        = sockfd;
+  c->ct        = ClientTCP;
+  c->reconnect = false;
 
-  logDebug("New TCP client socket %d addr %s port %s\n", sockfd, client[i].host, portstr);
+  logDebug("New TCP client socket %d addr %s port %s\n", sockfd, c->host, portstr);
+  return 1;
+}
 
-  if (i >= clients)
+static void reportDropped(Client *c)
+{
+  if (c->dropped > 0)
   {
-    clients = i + 1;
+    logError("%s:%s was too slow, dropped %" PRIu64 " lines\n", c->host, c->port, c->dropped);
+    c->dropped = 0;
   }
-  return 1;
 }
 
-int main(int argc, char **argv)
+static void closeClient(Client *c)
 {
-  char          *host = 0;
-  char          *port = 0;
-  ConnectionType ct   = ClientUDP; // Default client type is UDP
-  char           msg[LINESIZE];
-  int            r;
-  int            i;
-  size_t         len;
+  reportDropped(c);
+  close(c->fd);
+  c->fd         = -1;
+  c->connecting = false;
+  c->midLine    = false;
+  c->retryAt    = getNow() + RECONNECT_INTERVAL;
+  sbClean(&c->queue.sb);
+  c->queue.start = 0;
+}
 
-  setProgName(argv[0]);
+/* Accept every pending connection on a server socket. */
+static void acceptClients(int listenfd)
+{
+  int sockfd;
 
-  signal(SIGPIPE, SIG_IGN);
+  while ((sockfd = accept(listenfd, 0, 0)) >= 0)
+  {
+    Client *c = NULL;
+
+    for (size_t j = 0; j < clients; j++)
+    {
+      if (client[j].fd == -1 && !client[j].reconnect)
+      {
+        c = &client[j];
+        break;
+      }
+    }
+    storeNewClient(c ? c : newClient(), sockfd);
+  }
+  if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR && errno != ECONNABORTED)
+  {
+    logError("accept: %s\n", strerror(errno));
+  }
+}
+
+/* Send as much of the queue as the peer takes without blocking. */
+static void flushClient(Client *c)
+{
+  while (rbGetLength(&c->queue) > 0)
+  {
+    ssize_t r = send(c->fd, rbGet(&c->queue), rbGetLength(&c->queue), 0);
+
+    if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+    {
+      return;
+    }
+    if (r <= 0)
+    {
+      logError("error on %s:%s: %s\n", c->host, c->port, r == 0 ? "EOF" : strerror(errno));
+      closeClient(c);
+      return;
+    }
+    c->midLine = rbGet(&c->queue)[r - 1] != '\n';
+    rbConsume(&c->queue, (size_t) r);
+  }
+  reportDropped(c);
+}
+
+/*
+ * Make room for `need` more bytes by dropping the oldest whole lines. A line
+ * that has been partly sent is finished first, or the peer would see it
+ * spliced onto a later one.
+ */
+static void dropOldest(Client *c, size_t need)
+{
+  char  *q    = rbGet(&c->queue);
+  size_t qlen = rbGetLength(&c->queue);
+  size_t keep = 0;
+  size_t end;
+
+  if (c->midLine)
+  {
+    char *p = memchr(q, '\n', qlen);
+
+    keep = p ? (size_t) (p - q) + 1 : qlen;
+  }
+  for (end = keep; end < qlen && qlen - (end - keep) + need > queueLimit; c->dropped++)
+  {
+    char *p = memchr(q + end, '\n', qlen - end);
+
+    end = p ? (size_t) (p - q) + 1 : qlen;
+  }
+  if (keep == 0)
+  {
+    rbConsume(&c->queue, end);
+  }
+  else if (end > keep)
+  {
+    sbDelete(&c->queue.sb, c->queue.start + keep, c->queue.start + end);
+  }
+}
+
+static void sendTcp(Client *c, const char *msg, size_t len)
+{
+  if (rbGetLength(&c->queue) == 0 && !c->connecting)
+  {
+    ssize_t r = send(c->fd, msg, len, 0);
+
+    if (r == (ssize_t) len)
+    {
+      return;
+    }
+    if (r < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+    {
+      logError("error on %s:%s: %s\n", c->host, c->port, strerror(errno));
+      closeClient(c);
+      return;
+    }
+    if (r > 0)
+    {
+      c->midLine = true;
+      msg += r;
+      len -= (size_t) r;
+    }
+  }
+
+  if (rbGetLength(&c->queue) + len > queueLimit)
+  {
+    if (overflow == OverflowDisconnect)
+    {
+      logError("%s:%s is %zu bytes behind, disconnecting\n", c->host, c->port, rbGetLength(&c->queue));
+      closeClient(c);
+      return;
+    }
+    dropOldest(c, len);
+    if (rbGetLength(&c->queue) + len > queueLimit)
+    {
+      c->dropped++;
+      return;
+    }
+  }
+  rbAppendData(&c->queue, msg, len);
+}
+
+static void sendLine(const char *msg, size_t len)
+{
+  for (size_t i = 0; i < clients; i++)
+  {
+    Client *c = &client[i];
+
+    if (c->fd < 0 || c->ct == ServerTCP)
+    {
+      continue;
+    }
+    if (c->ct == ClientTCP)
+    {
+      sendTcp(c, msg, len);
+    }
+    else if (sendto(c->fd, msg, len, 0, &c->sockaddr.any, c->socklen) < 0 && errno != EAGAIN && errno != EWOULDBLOCK
+             && errno != ENOBUFS)
+    {
+      logError("error on %s:%s: %s\n", c->host, c->port, strerror(errno));
+      closeClient(c);
+    }
+  }
+  if (!writeonly)
+  {
+    logDebug("Writing %.*s\n", (int) len, msg);
+    sbAppendData(&outWriter.sb, msg, len);
+    lwLineDone(&outWriter);
+  }
+}
+
+/* Hand every complete line in the input to the clients; at EOF also the rest. */
+static void sendLines(ReadBuffer *in, bool eof)
+{
+  char *p;
+
+  while ((p = rbSearchChar(in, '\n')) != NULL || rbGetLength(in) >= LINESIZE - 1 || (eof && rbGetLength(in) > 0))
+  {
+    size_t len = p ? (size_t) (p - rbGet(in)) + 1 : CB_MIN(rbGetLength(in), LINESIZE - 1);
+
+    len = CB_MIN(len, LINESIZE - 1); // As fgets() would have split it
+    sendLine(rbGet(in), len);
+    rbConsume(in, len);
+  }
+  lwFlush(&outWriter);
+}
+
+/* Reopen connections and servers given on the command line that are due. */
+static void reconnectClients(uint64_t now)
+{
+  for (size_t i = 0; i < clients; i++)
+  {
+    Client *c = &client[i];
+
+    if (c->fd < 0 && c->reconnect && now >= c->retryAt)
+    {
+      c->fd         = ipConnect(c->host, c->port, c->ct, &c->sockaddr.any, &c->socklen);
+      c->connecting = c->fd >= 0 && c->ct == ClientTCP;
+      c->retryAt    = now + RECONNECT_INTERVAL;
+    }
+  }
+}
+
+static bool queuesEmpty(void)
+{
+  for (size_t i = 0; i < clients; i++)
+  {
+    if (client[i].fd >= 0 && rbGetLength(&client[i].queue) > 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
 
-  for (i = 0; i < sizeof(client) / sizeof(client[0]); i++)
+/* How long poll() may sleep: until the next reconnect, or the drain deadline after EOF. */
+static int pollTimeout(uint64_t now, uint64_t drainUntil)
+{
+  uint64_t due = drainUntil;
+
+  for (size_t i = 0; i < clients; i++)
   {
-    client[i].fd = -1;
+    if (client[i].fd < 0 && client[i].reconnect && (due == 0 || client[i].retryAt < due))
+    {
+      due = client[i].retryAt;
+    }
+  }
+  if (due == 0)
+  {
+    return -1;
   }
+  return due > now ? (int) CB_MIN(due - now, INT32_MAX) : 0;
+}
+
+/*
+ * Print the usage, after the argument that could not be parsed if there is
+ * one, and exit.
+ */
+static void usage(const char *badArg)
+{
+  if (badArg != NULL)
+  {
+    fprintf(stderr, "Unknown or invalid argument %s\n", badArg);
+  }
+  fprintf(stderr,
+          "Usage: iptee [-w] [-d] [-q] [-queue <kB>] [-overflow drop|disconnect] [-s|-t|-u] host port [host port ...] | -version\n\n"
+          "This program forwards stdin to the given TCP and UDP ports.\n"
+          "Stdin is also forwarded to stdout unless -w is used.\n"
+          "\n"
+          "Options:\n"
+          "-w - writeonly - only write to network clients/servers, not stdout\n"
+          "-d - debug     - log debug information\n"
+          "-q - quiet     - do not log status information\n"
+          "-s - server    - host and port are a TCP server\n"
+          "-u - udp       - host and port are a UDP address that data is sent to\n"
+          "-t - tcp       - host and port are a TCP server that data is sent to\n"
+          "-queue <kB>    - output held for each TCP peer that falls behind (default %d)\n"
+          "-overflow drop|disconnect - when that is full, drop its oldest lines (default)\n"
+          "                 or disconnect it\n" COPYRIGHT,
+          DEFAULT_QUEUE_KB);
+  exit(1);
+}
+
+int main(int argc, char **argv)
+{
+  char          *host       = 0;
+  char          *port       = 0;
+  ConnectionType ct         = ClientUDP; // Default client type is UDP
+  ReadBuffer     in         = {0};
+  struct pollfd *fds        = NULL;
+  size_t        *fdClient   = NULL;
+  size_t         fdAlloc    = 0;
+  bool           eof        = false;
+  uint64_t       drainUntil = 0;
+
+  setProgName(argv[0]);
+
+  signal(SIGPIPE, SIG_IGN);
 
   while (argc > 1)
   {
@@ -225,26 +534,60 @@ int main(int argc, char **argv)
     {
       ct = ServerTCP;
     }
+    else if (strcasecmp(argv[1], "-queue") == 0)
+    {
+      char *end;
+      long  kb;
+
+      if (argc < 3)
+      {
+        usage(argv[1]);
+      }
+      argc--;
+      argv++;
+      kb = strtol(argv[1], &end, 10);
+      if (end == argv[1] || *end != '\0' || kb < 1 || (unsigned long) kb > SIZE_MAX / 1024)
+      {
+        usage(argv[1]);
+      }
+      queueLimit = (size_t) kb * 1024;
+    }
+    else if (strcasecmp(argv[1], "-overflow") == 0)
+    {
+      if (argc < 3)
+      {
+        usage(argv[1]);
+      }
+      argc--;
+      argv++;
+      if (strcasecmp(argv[1], "drop") == 0)
+      {
+        overflow = OverflowDropOldest;
+      }
+      else if (strcasecmp(argv[1], "disconnect") == 0)
+      {
+        overflow = OverflowDisconnect;
+      }
+      else
+      {
+        usage(argv[1]);
+      }
+    }
     else if (!host)
     {
       host = argv[1];
     }
     else
     {
-      port = argv[1];
-
-      client[clients].fd        = -1;
-      client[clients].host      = host;
-      client[clients].port      = port;
-      client[clients].ct        = ct;
-      client[clients].reconnect = true;
-      clients++;
-      if (clients > sizeof(client) / sizeof(client[0]))
-      {
-        logAbort("Too many connections requested\n");
-      }
-      host = 0;
-      port = 0;
+      Client *c = newClient();
+
+      port         = argv[1];
+      c->host      = host;
+      c->port      = port;
+      c->ct        = ct;
+      c->reconnect = true;
+      host         = 0;
+      port         = 0;
     }
     argc--;
     argv++;
@@ -252,94 +595,137 @@ int main(int argc, char **argv)
 
   if (!clients)
   {
-    fprintf(stderr,
-            "Usage: iptee [-w] [-d] [-q] [-s|-t|-u] host port [host port ...] | -version\n\n"
-            "This program forwards stdin to the given TCP and UDP ports.\n"
-            "Stdin is also forwarded to stdout unless -w is used.\n"
-            "\n"
-            "Options:\n"
-            "-w - writeonly - only write to network clients/servers, not stdout\n"
-            "-d - debug     - log debug information\n"
-            "-q - quiet     - do not log status information\n"
-            "-s - server    - host and port are a TCP server\n"
-            "-u - udp       - host and port are a UDP address that data is sent to\n"
-            "-t - tcp       - host and port are a TCP server that data is sent to\n" COPYRIGHT);
-    exit(1);
+    usage(NULL);
   }
-  logInfo("Sending lines to %d servers\n", clients);
+  if (host != NULL)
+  {
+    usage(host); /* No port to go with it */
+  }
+  logInfo("Sending lines to %zu servers\n", clients);
+
+  outWriter.fd = STDOUT;
+  reconnectClients(getNow());
 
-  while (fgets(msg, sizeof(msg), stdin))
+  for (;;)
   {
-    len = strlen(msg);
+    nfds_t nfds = 0;
+    int    r;
+
+    if (eof && (queuesEmpty() || getNow() >= drainUntil))
+    {
+      break;
+    }
+    if (fdAlloc < clients + 1)
+    {
+      fdAlloc  = clientAlloc + 1;
+      fds      = realloc(fds, fdAlloc * sizeof(fds[0]));
+      fdClient = realloc(fdClient, fdAlloc * sizeof(fdClient[0]));
+      if (fds == NULL || fdClient == NULL)
+      {
+        die("Out of memory");
+      }
+    }
+    if (!eof)
+    {
+      fds[nfds++] = (struct pollfd) {.fd = STDIN_FILENO, .events = POLLIN};
+    }
+    for (size_t i = 0; i < clients; i++)
+    {
+      Client *c = &client[i];
+      short   events;
+
+      if (c->fd < 0 || c->ct == ClientUDP)
+      {
+        continue;
+      }
+      if (c->ct == ServerTCP)
+      {
+        events = POLLIN;
+      }
+      else
+      {
+        events = POLLIN | ((c->connecting || rbGetLength(&c->queue) > 0) ? POLLOUT : 0);
+      }
+      fdClient[nfds] = i;
+      fds[nfds++]    = (struct pollfd) {.fd = c->fd, .events = events};
+    }
 
-    for (i = 0; i < clients; i++)
+    r = poll(fds, nfds, pollTimeout(getNow(), drainUntil));
+    if (r < 0 && errno != EINTR)
     {
-      if ((client[i].fd < 0) && (client[i].reconnect))
+      logAbort("poll: %s\n", strerror(errno));
+    }
+
+    for (nfds_t f = 0; r > 0 && f < nfds; f++)
+    {
+      Client *c;
+
+      if (fds[f].revents == 0)
       {
-        client[i].fd = ipConnect(client[i].host, client[i].port, client[i].ct, &client[i].sockaddr.any, &client[i].socklen);
+        continue;
       }
-      if (client[i].fd >= 0)
+      if (f == 0 && !eof)
       {
-        if (client[i].ct == ServerTCP)
+        char    buf[STDIN_READ_SIZE];
+        ssize_t n = read(STDIN_FILENO, buf, sizeof(buf));
+
+        if (n > 0)
         {
-          int sockfd = accept(client[i].fd, 0, 0);
-
-          if (sockfd >= 0)
-          {
-            int j;
-
-            for (j = 0; j < sizeof(client) / sizeof(client[0]); j++)
-            {
-              if (client[j].fd == -1 && client[j].reconnect == false)
-              {
-                storeNewClient(j, sockfd);
-                break;
-              }
-            }
-            if (j == sizeof(client) / sizeof(client[0]))
-            {
-              logError("no room for new client\n");
-              close(sockfd);
-            }
-          }
+          rbAppendData(&in, buf, (size_t) n);
         }
-        else if (client[i].ct == ClientTCP)
+        else if (n == 0 || (errno != EAGAIN && errno != EINTR))
         {
-          r = send(client[i].fd, msg, len, 0);
-          if (r == 0)
-          {
-            logError("EOF on %s:%s\n", client[i].host, client[i].port);
-            close(client[i].fd);
-            client[i].fd = -1;
-          }
-          if (r < 0)
-          {
-            logError("error on %s:%s: %s\n", client[i].host, client[i].port, strerror(errno));
-            close(client[i].fd);
-            client[i].fd = -1;
-          }
+          eof        = true;
+          drainUntil = getNow() + EXIT_DRAIN_TIMEOUT;
         }
-        else
+        sendLines(&in, eof);
+        continue;
+      }
+
+      c = &client[fdClient[f]];
+      if (c->ct == ServerTCP)
+      {
+        acceptClients(c->fd);
+        continue;
+      }
+      if (c->connecting && (fds[f].revents & (POLLOUT | POLLERR | POLLHUP)) != 0)
+      {
+        int       err    = 0;
+        socklen_t errlen = sizeof(err);
+
+        getsockopt(c->fd, SOL_SOCKET, SO_ERROR, &err, &errlen);
+        if (err != 0)
         {
-          r = sendto(client[i].fd, msg, len, 0, &client[i].sockaddr.any, client[i].socklen);
-          if (r < 0)
-          {
-            logError("error on %s:%s: %s\n", client[i].host, client[i].port, strerror(errno));
-            close(client[i].fd);
-            client[i].fd = -1;
-          }
+          logError("Unable to open connection to %s:%s: %s\n", c->host, c->port, strerror(err));
+          closeClient(c);
+          continue;
         }
+        c->connecting = false;
+        logInfo("Opened connection to %s:%s\n", c->host, c->port);
       }
-    }
-    if (!writeonly)
-    {
-      logDebug("Writing %s\n", msg);
-      if (write(1, msg, len) == -1)
+      if ((fds[f].revents & (POLLIN | POLLERR | POLLHUP)) != 0)
+      {
+        char    drain[512];
+        ssize_t n = recv(c->fd, drain, sizeof(drain), 0); /* Whatever clients say is ignored */
+
+        if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+        {
+          logInfo("%s:%s closed the connection\n", c->host, c->port);
+          closeClient(c);
+          continue;
+        }
+      }
+      if ((fds[f].revents & POLLOUT) != 0)
       {
-        logError("Cannot write to stdout\n");
-        return 1;
-      };
+        flushClient(c);
+      }
     }
+
+    reconnectClients(getNow());
+  }
+  for (size_t i = 0; i < clients; i++)
+  {
+    reportDropped(&client[i]);
   }
   return 0;
 }
@@ -0,0 +1,152 @@
+#
+# (C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+#
+# This file is part of CANboat.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+# Usage: overflow.py <iptee> drop|disconnect
+#
+# Runs iptee against a TCP server that accepts the connection but does not
+# read from it until all of stdin has been written, so the per-client queue
+# overflows. Checks that stdout still gets every line and that the slow
+# client gets what the -overflow policy promises:
+#
+# drop:       whole lines in their original order, with every line that is
+#             missing counted in the "dropped" report.
+# disconnect: an unbroken start of the input, then the connection is closed.
+#
+
+import re
+import selectors
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+
+LINES = 250000
+QUEUE_KB = 64
+TIMEOUT = 30
+
+iptee = sys.argv[1]
+policy = sys.argv[2]
+
+lines = [b'%07d,%s\n' % (n, b'x' * 55) for n in range(LINES)]
+index = {line: n for n, line in enumerate(lines)}
+data = b''.join(lines)
+
+server = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+server.setsockopt(socket.SOL_SOCKET, socket.SO_RCVBUF, 4096)
+server.bind(('127.0.0.1', 0))
+server.listen(8)
+server.settimeout(TIMEOUT)
+port = server.getsockname()[1]
+
+out = tempfile.TemporaryFile()
+err = tempfile.TemporaryFile()
+proc = subprocess.Popen([iptee, '-q', '-queue', str(QUEUE_KB), '-overflow', policy, '-t', '127.0.0.1', str(port)],
+                        stdin=subprocess.PIPE, stdout=out, stderr=err)
+
+# The slow client: connected, but nothing is read while stdin is written
+conns = [server.accept()[0]]
+proc.stdin.write(data)
+proc.stdin.close()
+
+# Now read everything, including any connection iptee made again later
+received = {}
+sel = selectors.DefaultSelector()
+server.setblocking(False)
+sel.register(server, selectors.EVENT_READ)
+
+
+def readFrom(c):
+    c.setblocking(False)
+    sel.register(c, selectors.EVENT_READ)
+    received[c] = bytearray()
+
+
+for c in conns:
+    readFrom(c)
+deadline = time.monotonic() + TIMEOUT
+while proc.poll() is None or len(sel.get_map()) > 1:
+    if time.monotonic() > deadline:
+        proc.kill()
+        sys.exit('timed out waiting for iptee')
+    for key, _ in sel.select(timeout=1):
+        if key.fileobj is server:
+            try:
+                c = server.accept()[0]
+            except BlockingIOError:
+                continue
+            conns.append(c)
+            readFrom(c)
+            continue
+        chunk = key.fileobj.recv(65536)
+        if chunk:
+            received[key.fileobj] += chunk
+        else:
+            sel.unregister(key.fileobj)
+
+if proc.wait(timeout=TIMEOUT) != 0:
+    sys.exit('iptee exited with %d' % proc.returncode)
+out.seek(0)
+err.seek(0)
+stdout = out.read()
+stderr = err.read().decode()
+
+if stdout != data:
+    sys.exit('stdout got %d of %d bytes' % (len(stdout), len(data)))
+print('stdout: all %d lines' % LINES)
+
+
+def wholeLines(buf, what):
+    '''The lines in buf, which must all be input lines in their original order'''
+    last = -1
+    got = buf.split(b'\n')
+    if got[-1] != b'':
+        sys.exit('%s ends in a partial line' % what)
+    for line in got[:-1]:
+        n = index.get(line + b'\n')
+        if n is None:
+            sys.exit('%s got a broken line %r' % (what, line[:40]))
+        if n <= last:
+            sys.exit('%s got line %d after line %d' % (what, n, last))
+        last = n
+    return len(got) - 1
+
+
+first = bytes(received[conns[0]])
+if policy == 'drop':
+    if len(conns) != 1:
+        sys.exit('drop: the client was connected %d times' % len(conns))
+    got = wholeLines(first, 'drop')
+    dropped = sum(int(n) for n in re.findall(r'dropped (\d+) lines', stderr))
+    if dropped == 0:
+        sys.exit('drop: nothing was dropped, the client was not slow enough')
+    if got + dropped != LINES:
+        sys.exit('drop: received %d and reported %d dropped of %d lines' % (got, dropped, LINES))
+    print('drop: slow client got whole lines in order, the rest was reported as dropped')
+else:
+    if 'disconnecting' not in stderr:
+        sys.exit('disconnect: iptee did not report a disconnect')
+    if len(first) >= len(data):
+        sys.exit('disconnect: the slow client got everything')
+    # Nothing is dropped, so every connection gets an unbroken stretch of the
+    # input, starting with a whole line; the first one from the start.
+    for c in conns:
+        buf = bytes(received[c])
+        start = int(buf[:7]) * len(lines[0]) if buf else 0
+        if data[start:start + len(buf)] != buf or (c is conns[0] and start != 0):
+            sys.exit('disconnect: a connection got %d bytes that are not a stretch of the input' % len(buf))
+    print('disconnect: slow client got the start of the input and was disconnected')
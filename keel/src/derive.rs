@@ -12,7 +12,7 @@
 //! The migration golden test (emitted XML == analyzer-explain output) is what
 //! proves this port correct across the whole database.
 
-use crate::model::Database;
+use crate::model::{Database, Field};
 
 pub fn c_min(x: f64, y: f64) -> f64 {
     if x <= y { x } else { y } // analyzer.h: ((x) <= (y) ? (x) : (y))
@@ -310,24 +310,12 @@ fn fill_pgn_list(db: &mut Database, marine: bool) -> Result<(), String> {
                 );
             }
 
-            // reservedCount (fieldtype.c lines 448-462)
-            if f.special_values.is_some() {
-                f.reserved_count = count;
-            } else if f.res_bits != 0
-                && f.res_bits < 64
-                && f.res_resolution > 0.0
-                && !f.res_range_max.is_nan()
-            {
-                let raw_max: u64 = (1u64 << f.res_bits) - 1;
-                let raw_range_max = (f.res_range_max / f.res_resolution + 0.5) as u64;
-                f.reserved_count = if raw_range_max >= raw_max {
-                    0
-                } else {
-                    ((raw_max - raw_range_max).min(by_size as u64)) as u32
-                };
-            } else {
-                f.reserved_count = by_size;
-            }
+            f.reserved_count = reserved_count(
+                f.res_bits,
+                f.res_resolution,
+                f.res_range_max,
+                f.special_values,
+            );
 
             f.order = order;
         }
@@ -362,6 +350,143 @@ fn fill_pgn_list(db: &mut Database, marine: bool) -> Result<(), String> {
     Ok(())
 }
 
+/// reservedCount (fieldtype.c lines 448-462): the number of top-of-range
+/// sentinels left above the field's raw rangeMax.
+fn reserved_count(bits: u32, resolution: f64, range_max: f64, special_values: Option<u32>) -> u32 {
+    let by_size = reserved_count_for_size(bits);
+    if let Some(count) = special_values {
+        count
+    } else if bits != 0 && bits < 64 && resolution > 0.0 && !range_max.is_nan() {
+        let raw_max: u64 = (1u64 << bits) - 1;
+        let raw_range_max = (range_max / resolution + 0.5) as u64;
+        if raw_range_max >= raw_max {
+            0
+        } else {
+            (raw_max - raw_range_max).min(by_size as u64) as u32
+        }
+    } else {
+        by_size
+    }
+}
+
+/// A numeric field as fieldPrintNumber() sees it in the analyzer's default
+/// (non-SI) mode, after fixupUnit() has folded the display unit into the
+/// resolution and offset.
+pub struct DisplayNumber {
+    pub resolution: f64,
+    pub unit_offset: f64,
+    pub unit: Option<String>,
+    pub precision: u32,
+    /// Largest raw value that is printed as a number; anything above it is
+    /// one of the Unknown / OutOfRange / Reserved sentinels.
+    pub valid_max: i64,
+    /// The raw maximum extractNumber() reports, sentinels included.
+    pub raw_max: i64,
+}
+
+/// Port of fillFieldType() for one field with showSI = false, followed by
+/// the threshold test of print.c extractNumberNotEmpty(). Only meaningful
+/// for fields narrower than 64 bits with a resolution.
+pub fn display_number(db: &Database, f: &Field) -> DisplayNumber {
+    let ft = &db.fieldtypes[f.ft];
+    let has_sign = ft.has_sign == Some(true);
+    let radian_to_degree = 360.0 / 2.0 / std::f64::consts::PI;
+
+    let mut resolution = f.res_resolution;
+    let mut unit_offset = 0.0;
+    let mut unit = f.res_unit.clone();
+    let mut precision = 0;
+    let mut range_max = f.range_max.unwrap_or(0.0);
+    if range_max.is_nan() || range_max == 0.0 {
+        range_max = ft.range_max;
+    }
+
+    // fixupUnit(), NOT SI branch
+    if resolution != 0.0 {
+        match unit.as_deref() {
+            Some("C") => {
+                resolution /= 3600.0;
+                range_max /= 3600.0;
+                unit = Some("Ah".into());
+            }
+            Some("Pa") => {
+                resolution /= 100000.0;
+                range_max /= 100000.0;
+                precision = 3;
+                unit = Some("bar".into());
+            }
+            Some("K") if !has_sign => {
+                unit_offset = -273.15;
+                range_max += -275.15;
+                unit = Some("C".into());
+            }
+            Some("rad") => {
+                resolution *= radian_to_degree;
+                range_max *= radian_to_degree;
+                range_max = c_max(range_max, 360.0);
+                precision = 1;
+                unit = Some("deg".into());
+            }
+            Some("rad/s") => {
+                resolution *= radian_to_degree;
+                range_max *= radian_to_degree;
+                unit = Some("deg/s".into());
+            }
+            _ => {}
+        }
+    }
+
+    let count = f
+        .special_values
+        .unwrap_or_else(|| reserved_count_for_size(f.res_bits));
+    if f.res_bits != 0 && resolution != 0.0 && ft.has_sign.is_some() && range_max.is_nan() {
+        let pair_lookup = f.lookup.as_ref().and_then(|n| db.lookups.get(n));
+        range_max = get_max_range(
+            f.res_bits,
+            resolution,
+            has_sign,
+            f.res_offset,
+            pair_lookup,
+            count,
+        );
+    }
+    let reserved = reserved_count(f.res_bits, resolution, range_max, f.special_values) as i64;
+
+    // extractNumber(): the raw maximum, shifted by an Excess-K offset
+    let mut raw_max = (1i64 << f.res_bits) - 1;
+    if has_sign {
+        raw_max >>= 1;
+    }
+    raw_max += f.res_offset as i64;
+
+    // extractNumberNotEmpty(): a rangeMax that converts exactly to the raw
+    // maximum means every bit pattern is valid.
+    let mut valid_max = raw_max - reserved;
+    if range_max > 0.0 && resolution > 0.0 {
+        let range_max_raw = range_max / resolution + 0.5;
+        if range_max_raw < 9223372036854775808.0 && range_max_raw as i64 == raw_max {
+            valid_max = raw_max;
+        }
+    }
+
+    if precision == 0 {
+        let mut r = resolution;
+        while r > 0.0 && r < 1.0 {
+            precision += 1;
+            r *= 10.0;
+        }
+    }
+
+    DisplayNumber {
+        resolution,
+        unit_offset,
+        unit,
+        precision,
+        valid_max,
+        raw_max,
+    }
+}
+
 /// Port of analyzer-explain.c getMinimalPgnLength().
 fn fill_pgn_length(pgn: &mut crate::model::Pgn) -> Result<(), String> {
     let field_count = pgn.fields.len() as u32;
@@ -4,9 +4,13 @@
 //!
 //!   analyzer/lookup-generated-data.h             - lookups the marine tree uses
 //!   analyzer/lookup-j1939-generated-data.h       - lookups the J1939 tree uses
+//!   analyzer/lookup-table-generated-data.h       - the same lookups as data
+//!                                                  tables with JSON strings
 //!   analyzer/physicalquantity-generated-data.h   - PhysicalQuantity statics + list
 //!   analyzer/fieldtype-generated-data.h          - fieldTypeList[]
 //!   analyzer/pgn-generated-data.h                - pgnList[]
+//!   analyzer/pgn-decoder-generated.h             - straight-line decoders for
+//!                                                  the fixed-layout PGNs
 //!
 //! The hand-written halves (structs, macros, prototypes) stay in pgn.h /
 //! fieldtype.h, which #include the data files inside their GLOBALS blocks.
@@ -19,7 +23,7 @@
 //! generated headers must reproduce docs/canboat.xml byte-for-byte, and the
 //! analyzer test suite must pass.
 
-use crate::derive::default_field_resolution;
+use crate::derive::{self, default_field_resolution};
 use crate::model::{Database, Field, FieldType, Interval, Pgn};
 
 const BANNER: &str = "\
@@ -211,6 +215,133 @@ pub fn emit_lookup_h(db: &Database, j1939: bool) -> String {
     out
 }
 
+// ---------------------------------------------------------------------------
+// lookup-table-generated-data.h
+// ---------------------------------------------------------------------------
+
+/// The string as it appears in JSON output, quotes included.
+fn json_str(s: &str) -> String {
+    let mut out = String::with_capacity(s.len() + 2);
+    out.push('"');
+    for c in s.chars() {
+        match c {
+            '"' => out.push_str("\\\""),
+            '\\' => out.push_str("\\\\"),
+            '\n' => out.push_str("\\n"),
+            '\r' => out.push_str("\\r"),
+            '\t' => out.push_str("\\t"),
+            c if (c as u32) < 0x20 => out.push_str(&format!("\\u{:04x}", c as u32)),
+            _ => out.push(c),
+        }
+    }
+    out.push('"');
+    out
+}
+
+fn lookup_entry(value: u64, name: &str) -> String {
+    let json = json_str(name);
+    let key = u32::try_from(value).expect("lookup keys fit the uint32_t LookupEntry.value");
+    format!(
+        "    {{{key}, {}, {}, {}, {}}}",
+        name.len(),
+        json.len(),
+        c_str(name),
+        c_str(&json)
+    )
+}
+
+/// A table is dense -- indexed straight by key -- while the gaps cost no
+/// more than a few times the entries themselves; otherwise the entries are
+/// kept sorted for a binary search.
+fn is_dense(pairs: &[(u64, String)]) -> bool {
+    let max = pairs.iter().map(|(v, _)| *v).max().unwrap_or(0);
+    max < 256 || max < 8 * pairs.len() as u64
+}
+
+fn emit_pair_table(out: &mut String, name: &str, pairs: &[(u64, String)]) {
+    let mut sorted: Vec<&(u64, String)> = pairs.iter().collect();
+    sorted.sort_by_key(|(v, _)| *v);
+    let (kind, rows): (&str, Vec<String>) = if is_dense(pairs) {
+        let max = sorted.last().map(|(v, _)| *v).unwrap_or(0);
+        let mut rows = vec!["    {0}".to_string(); (max + 1) as usize];
+        for (v, n) in &sorted {
+            rows[*v as usize] = lookup_entry(*v, n);
+        }
+        ("LOOKUP_TABLE_DENSE", rows)
+    } else {
+        (
+            "LOOKUP_TABLE_SORTED",
+            sorted.iter().map(|(v, n)| lookup_entry(*v, n)).collect(),
+        )
+    };
+    out.push_str(&format!(
+        "static const LookupEntry lookupEntries{name}[] = {{\n{}\n}};\n",
+        rows.join(",\n")
+    ));
+    out.push_str(&format!(
+        "const LookupTable lookupTable{name} = {{.kind = {kind}, .count = {}, .entries = lookupEntries{name}}};\n\n",
+        rows.len()
+    ));
+}
+
+/// Two levels: ranges[val1] is the slice of entries[] carrying that val1,
+/// and the slice is sorted by val2 for a binary search.
+fn emit_triplet_table(out: &mut String, name: &str, triplets: &[(u64, u64, String)]) {
+    let mut sorted: Vec<&(u64, u64, String)> = triplets.iter().collect();
+    sorted.sort_by_key(|(v1, v2, _)| (*v1, *v2));
+    let range_count = sorted.last().map(|(v1, _, _)| *v1 + 1).unwrap_or(0) as usize;
+    let mut ranges = vec![(0usize, 0usize); range_count];
+    for (i, (v1, _, _)) in sorted.iter().enumerate() {
+        let r = &mut ranges[*v1 as usize];
+        if r.1 == 0 {
+            r.0 = i;
+        }
+        r.1 += 1;
+    }
+    let rows: Vec<String> = sorted
+        .iter()
+        .map(|(_, v2, n)| lookup_entry(*v2, n))
+        .collect();
+    out.push_str(&format!(
+        "static const LookupEntry lookupEntries{name}[] = {{\n{}\n}};\n",
+        rows.join(",\n")
+    ));
+    let range_rows: Vec<String> = ranges
+        .iter()
+        .map(|(start, count)| format!("    {{{start}, {count}}}"))
+        .collect();
+    out.push_str(&format!(
+        "static const LookupRange lookupRanges{name}[] = {{\n{}\n}};\n",
+        range_rows.join(",\n")
+    ));
+    out.push_str(&format!(
+        "const LookupTable lookupTable{name} = {{.kind = LOOKUP_TABLE_TRIPLET, .count = {}, .entries = lookupEntries{name}, .rangeCount = {range_count}, .ranges = lookupRanges{name}}};\n\n",
+        rows.len()
+    ));
+}
+
+/// The pair, bitfield and triplet enumerations as data: every string comes
+/// pre-rendered for JSON (escaped and quoted) with both lengths, so the
+/// analyzer appends it with a single memcpy. lookup.c includes this file and
+/// implements the lookupXXX() functions on top of it; fieldtype lookups keep
+/// their switch because every hit also resolves a Field.
+pub fn emit_lookup_table_h(db: &Database, j1939: bool) -> String {
+    let keep = db.lookups_used(j1939);
+    let mut out = String::with_capacity(512 << 10);
+    out.push_str(BANNER);
+
+    for lk in db.ordered_lookups_for("pair", &keep) {
+        emit_pair_table(&mut out, &lk.name, &lk.pairs);
+    }
+    for lk in db.ordered_lookups_for("bit", &keep) {
+        emit_pair_table(&mut out, &lk.name, &lk.pairs);
+    }
+    for lk in db.ordered_lookups_for("triplet", &keep) {
+        emit_triplet_table(&mut out, &lk.name, &lk.triplets);
+    }
+    out
+}
+
 // ---------------------------------------------------------------------------
 // physicalquantity-generated-data.h
 // ---------------------------------------------------------------------------
@@ -403,6 +534,9 @@ fn emit_field(db: &Database, f: &Field) -> String {
         };
         parts.push(format!(".lookup.type = {type_sym}"));
         parts.push(format!("{member} = lookup{name}"));
+        if kind != "fieldtype" {
+            parts.push(format!(".lookup.table = &lookupTable{name}"));
+        }
         parts.push(format!(".lookup.name = {}", c_str(name)));
         if let Some(order) = f.lookup_indirect_order {
             parts.push(format!(".lookup.val1Order = {order}"));
@@ -498,3 +632,249 @@ pub fn emit_pgn_data_h(db: &Database, j1939: bool) -> String {
     out.push_str("\n};\n");
     out
 }
+
+// ---------------------------------------------------------------------------
+// pgn-decoder-generated.h
+// ---------------------------------------------------------------------------
+
+/// Print functions that decide their own width or reach into another PGN's
+/// definition at runtime; a PGN carrying one keeps the generic interpreter.
+const DYNAMIC_PRINT_FUNCTIONS: [&str; 2] = ["fieldPrintVariable", "fieldPrintKeyValue"];
+
+/// A PGN gets a straight-line decoder when every field sits at a bit offset
+/// known at generation time: no repeating sets, no variable-width field, no
+/// proprietary field (printField skips those for standard reference PGNs,
+/// which shifts every later field), nothing whose width comes off the wire.
+fn is_fixed_layout(db: &Database, p: &Pgn) -> bool {
+    if p.is_variable || p.fields.is_empty() {
+        return false;
+    }
+    for rep in [&p.repeating1, &p.repeating2].into_iter().flatten() {
+        if rep.count > 0 {
+            return false;
+        }
+    }
+    p.fields.iter().all(|f| {
+        let ft = &db.fieldtypes[f.ft];
+        f.res_bits != 0
+            && !ft.variable_size
+            && !f.proprietary
+            && !f.dynamic_field_length
+            && f.bit_length_field.is_none()
+            && !ft
+                .print_function
+                .as_deref()
+                .is_some_and(|pf| DYNAMIC_PRINT_FUNCTIONS.contains(&pf))
+    })
+}
+
+fn decoder_symbol(p: &Pgn) -> String {
+    let mut chars = p.id.chars();
+    match chars.next() {
+        Some(c) => format!("decode{}{}", c.to_ascii_uppercase(), chars.as_str()),
+        None => format!("decode{}", p.pgn),
+    }
+}
+
+/// A field that fieldPrintNumber() would print and that the decoder can
+/// print inline: narrower than 64 bits, with a resolution, not the reference
+/// PGN that fillGlobalsBasedOnField() latches, and not a primary key (those
+/// gain a "key" member in -nv mode).
+fn is_inline_number(db: &Database, f: &Field) -> bool {
+    let ft = &db.fieldtypes[f.ft];
+    ft.print_function.as_deref() == Some("fieldPrintNumber")
+        && f.res_bits > 0
+        && f.res_bits < 64
+        && f.res_resolution > 0.0
+        && !f.primary_key
+        && f.name != "PGN"
+}
+
+/// The raw bits of a field at a constant offset, ORed together per byte in
+/// the order extractNumber() collects them: least significant bits first.
+fn extract_expr(start_bit: u32, bits: u32) -> String {
+    let mut terms: Vec<String> = Vec::new();
+    let mut byte = start_bit >> 3;
+    let mut first = start_bit & 7;
+    let mut remaining = bits;
+    let mut magnitude = 0;
+    while remaining > 0 {
+        let in_this_byte = (8 - first).min(remaining);
+        let mut term = format!("data[{byte}]");
+        if first > 0 {
+            term = format!("(data[{byte}] >> {first})");
+        }
+        if first + in_this_byte < 8 {
+            term = format!("({term} & 0x{:x})", (1u32 << in_this_byte) - 1);
+        }
+        term = format!("(uint64_t) {term}");
+        if magnitude > 0 {
+            term = format!("({term} << {magnitude})");
+        }
+        terms.push(term);
+        magnitude += in_this_byte;
+        remaining -= in_this_byte;
+        first += in_this_byte;
+        if first >= 8 {
+            first -= 8;
+            byte += 1;
+        }
+    }
+    terms.join(" | ")
+}
+
+/// fieldPrintNumber() for one field, specialised on the unit, resolution,
+/// offset and precision that fillFieldType() gives it without -si, and on
+/// the sentinel threshold of extractNumberNotEmpty().
+fn emit_inline_number(db: &Database, f: &Field, i: usize, start_bit: u32) -> String {
+    let ft = &db.fieldtypes[f.ft];
+    let d = derive::display_number(db, f);
+    let end_byte = (start_bit + f.res_bits).div_ceil(8);
+    let mut out = String::new();
+
+    out.push_str(&format!(
+        "  if (inlineNumbers && length >= {end_byte})\n  {{\n"
+    ));
+    out.push_str(&format!(
+        "    value = (int64_t) ({});\n",
+        extract_expr(start_bit, f.res_bits)
+    ));
+    if f.res_offset != 0 {
+        out.push_str(&format!("    value += {};\n", f.res_offset));
+    } else if ft.has_sign == Some(true) {
+        out.push_str(&format!(
+            "    if (value & INT64_C(0x{:x}))\n    {{\n      value |= ~INT64_C(0x{:x});\n    }}\n",
+            1u64 << (f.res_bits - 1),
+            d.raw_max
+        ));
+    }
+    out.push_str(&format!(
+        "    if (value > {})\n    {{\n      printInlineEmpty(&f[{i}], value - {});\n    }}\n    else\n    {{\n",
+        d.valid_max, d.raw_max
+    ));
+    let unit = d.unit.as_deref();
+    if d.resolution == 1.0 && d.unit_offset == 0.0 {
+        out.push_str(&format!("      printInlineKey(&f[{i}]);\n"));
+        match unit {
+            Some(u) => out.push_str(&format!(
+                "      if (showJson)\n      {{\n        mprintf(\"%\" PRId64, value);\n      }}\n      else\n      {{\n        mprintf(\"%\" PRId64 {}, value);\n      }}\n",
+                c_str(&format!(" {}", u.replace('%', "%%")))
+            )),
+            None => out.push_str("      mprintf(\"%\" PRId64, value);\n"),
+        }
+    } else {
+        let p = d.precision;
+        let scaled = if d.unit_offset != 0.0 {
+            format!(
+                "(double) value * {} + {}",
+                c_double(d.resolution),
+                c_double(d.unit_offset)
+            )
+        } else {
+            format!("(double) value * {}", c_double(d.resolution))
+        };
+        out.push_str(&format!(
+            "      double a = {scaled};\n\n      printInlineKey(&f[{i}]);\n"
+        ));
+        match unit {
+            Some("m") => out.push_str(&format!(
+                "      if (showJson)\n      {{\n        mprintf(\"%.{p}f\", a);\n      }}\n      else if (a >= 1000.0)\n      {{\n        mprintf(\"%.{}f km\", a / 1000);\n      }}\n      else\n      {{\n        mprintf(\"%.{p}f m\", a);\n      }}\n",
+                p + 3
+            )),
+            Some(u) => out.push_str(&format!(
+                "      if (showJson)\n      {{\n        mprintf(\"%.{p}f\", a);\n      }}\n      else\n      {{\n        mprintf({}, a);\n      }}\n",
+                c_str(&format!("%.{p}f {}", u.replace('%', "%%")))
+            )),
+            None => out.push_str(&format!("      mprintf(\"%.{p}f\", a);\n")),
+        }
+    }
+    out.push_str("    }\n  }\n  else ");
+    out
+}
+
+/// One function per fixed-layout PGN variant. Numeric fields are printed
+/// inline by emit_inline_number(); every other field, and a numeric field
+/// in -si or -bytes mode or cut short by the message length, is a
+/// printField() call at a constant bit offset, printing the field's
+/// pre-rendered key (Field.key, filled in at startup). The length test in
+/// front of each is the generic loop's `(startBit >> 3) < length`, folded.
+/// A truncated field cuts the message short in both paths, so the decoders
+/// print exactly what printFields() would.
+fn emit_decoder(db: &Database, p: &Pgn) -> String {
+    let mut out = String::with_capacity(2 << 10);
+    out.push_str(&format!(
+        "/* {} {}: {} field(s), {} byte(s) */\n",
+        p.pgn,
+        p.id,
+        p.fields.len(),
+        p.length
+    ));
+    out.push_str(&format!(
+        "static bool {}(const Pgn *pgn, const uint8_t *data, int length)\n{{\n",
+        decoder_symbol(p)
+    ));
+    out.push_str("  const Field *f = pgn->fieldList;\n  size_t       bits;\n");
+    if p.fields.iter().any(|f| is_inline_number(db, f)) {
+        out.push_str("  int64_t      value;\n");
+    }
+    out.push('\n');
+
+    let mut start_bit = 0u32;
+    let mut checked_byte: Option<u32> = None;
+    for (i, f) in p.fields.iter().enumerate() {
+        let byte = start_bit >> 3;
+        if checked_byte != Some(byte) {
+            out.push_str(&format!(
+                "  if (length <= {byte})\n  {{\n    return true;\n  }}\n"
+            ));
+            checked_byte = Some(byte);
+        }
+        if is_inline_number(db, f) {
+            out.push_str(&emit_inline_number(db, f, i, start_bit));
+        } else {
+            out.push_str("  ");
+        }
+        out.push_str(&format!(
+            "if (!printField(&f[{i}], NULL, data, length, {start_bit}, &bits, true))\n  {{\n    return false;\n  }}\n"
+        ));
+        start_bit += f.res_bits;
+    }
+    out.push_str(&format!(
+        "  if (length > {})\n  {{\n    logDebug(\"PGN %u has unknown bytes at end: %u\\n\", pgn->pgn, length - {});\n  }}\n",
+        start_bit >> 3,
+        start_bit >> 3
+    ));
+    out.push_str("  return true;\n}\n");
+    out
+}
+
+/// The decoders are static functions for analyzer.c, which includes this
+/// file once printField() is declared. `pgnDecoderList` names each one by
+/// its pgnList[] index; attachPgnDecoders() cross-checks the PGN and id
+/// before wiring it into Pgn.decoder, so a header that is out of step with
+/// the tables fails loudly instead of decoding the wrong PGN.
+pub fn emit_pgn_decoder_h(db: &Database, j1939: bool) -> String {
+    let list = if j1939 { &db.pgns_j1939 } else { &db.pgns };
+    let mut out = String::with_capacity(1 << 20);
+    out.push_str(BANNER);
+
+    let mut entries: Vec<String> = Vec::new();
+    for (index, p) in list.iter().enumerate() {
+        if !is_fixed_layout(db, p) {
+            continue;
+        }
+        out.push_str(&emit_decoder(db, p));
+        out.push('\n');
+        entries.push(format!(
+            "    {{{index}, {}, {}, {}}}",
+            p.pgn,
+            c_str(&p.id),
+            decoder_symbol(p)
+        ));
+    }
+
+    out.push_str("static const PgnDecoderEntry pgnDecoderList[] = {\n");
+    out.push_str(&entries.join(",\n"));
+    out.push_str("\n};\n");
+    out
+}
@@ -27,6 +27,14 @@ pub fn emit_artifacts(
             root.join("analyzer/lookup-j1939-generated-data.h"),
             emit_c::emit_lookup_h(db, true),
         ),
+        (
+            root.join("analyzer/lookup-table-generated-data.h"),
+            emit_c::emit_lookup_table_h(db, false),
+        ),
+        (
+            root.join("analyzer/lookup-j1939-table-generated-data.h"),
+            emit_c::emit_lookup_table_h(db, true),
+        ),
         (
             root.join("analyzer/physicalquantity-generated-data.h"),
             emit_c::emit_physicalquantity_data_h(db),
@@ -43,5 +51,13 @@ pub fn emit_artifacts(
             root.join("analyzer/pgn-j1939-generated-data.h"),
             emit_c::emit_pgn_data_h(db, true),
         ),
+        (
+            root.join("analyzer/pgn-decoder-generated.h"),
+            emit_c::emit_pgn_decoder_h(db, false),
+        ),
+        (
+            root.join("analyzer/pgn-j1939-decoder-generated.h"),
+            emit_c::emit_pgn_decoder_h(db, true),
+        ),
     ]
 }
@@ -162,6 +162,14 @@ fn run() -> Result<i32, String> {
                     root.join("analyzer/lookup-j1939-generated-data.h"),
                     emit_c::emit_lookup_h(&db, true),
                 ),
+                (
+                    root.join("analyzer/lookup-table-generated-data.h"),
+                    emit_c::emit_lookup_table_h(&db, false),
+                ),
+                (
+                    root.join("analyzer/lookup-j1939-table-generated-data.h"),
+                    emit_c::emit_lookup_table_h(&db, true),
+                ),
                 (
                     root.join("analyzer/physicalquantity-generated-data.h"),
                     emit_c::emit_physicalquantity_data_h(&db),
@@ -178,6 +186,14 @@ fn run() -> Result<i32, String> {
                     root.join("analyzer/pgn-j1939-generated-data.h"),
                     emit_c::emit_pgn_data_h(&db, true),
                 ),
+                (
+                    root.join("analyzer/pgn-decoder-generated.h"),
+                    emit_c::emit_pgn_decoder_h(&db, false),
+                ),
+                (
+                    root.join("analyzer/pgn-j1939-decoder-generated.h"),
+                    emit_c::emit_pgn_decoder_h(&db, true),
+                ),
                 // The Rust tables. These used to be produced by a build
                 // script in each crate, which could not be published: a
                 // build script cannot read `database/`, which sits above
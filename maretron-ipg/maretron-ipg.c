@@ -66,13 +66,14 @@ static const char   *password = "";
 
 // Yeah globals. We're trying to avoid malloc()/free() to run quickly on limited memory hardware
 StringBuffer writeBuffer; // What we still have to write to device
-StringBuffer readBuffer;  // What we have already read from device
-StringBuffer inBuffer;    // What we have already read from stdin but is not complete yet
+ReadBuffer   readBuffer;  // What we have already read from device
+ReadBuffer   inBuffer;    // What we have already read from stdin but is not complete yet
+LineWriter   outWriter;   // FAST lines for stdout, written once per read
 
 static void                sendConnect(void);
 static void                sendSetModeBinary(void);
-static void                processInBuffer(StringBuffer *in, StringBuffer *out);
-static bool                processReadBuffer(StringBuffer *in, int out);
+static void                processInBuffer(ReadBuffer *in, StringBuffer *out);
+static bool                processReadBuffer(ReadBuffer *in, LineWriter *out);
 static void                handleTextMessage(char *line);
 static char               *ensureDefaultPort(const char *url);
 static MaretronParseResult parseMaretronFrame(const uint8_t *buf, size_t buf_len, MaretronFrame *out, size_t *consumed);
@@ -84,7 +85,7 @@ static bool                buildMaretronFrame(uint8_t       *out,
                                               uint8_t        dst,
                                               const uint8_t *payload,
                                               size_t         payload_len);
-static void                writeCsvFrame(int out, uint64_t timestamp_ms, const MaretronFrame *frame);
+static void                writeCsvFrame(LineWriter *out, uint64_t timestamp_ms, const MaretronFrame *frame);
 
 int main(int argc, char **argv)
 {
@@ -203,6 +204,7 @@ int main(int argc, char **argv)
     logAbort("Cannot open TCP stream %s\n", urlWithPort);
   }
 
+  outWriter.fd = STDOUT;
   fputs(CANBOAT_FORMAT_FAST_HEADER, stdout);
   emitCanboatStartupRecord("maretron-ipg", device);
 
@@ -242,7 +244,7 @@ int main(int argc, char **argv)
       r = read(handle, data, sizeof data);
       if (r > 0)
       {
-        sbAppendData(&readBuffer, data, r);
+        rbAppendData(&readBuffer, data, r);
       }
       if (r < 0)
       {
@@ -259,7 +261,7 @@ int main(int argc, char **argv)
       r = read(STDIN, data, sizeof data);
       if (r > 0)
       {
-        sbAppendData(&inBuffer, data, r);
+        rbAppendData(&inBuffer, data, r);
         processInBuffer(&inBuffer, &writeBuffer);
       }
       if (r < 0)
@@ -289,10 +291,10 @@ int main(int argc, char **argv)
       }
     }
 
-    if (sbGetLength(&readBuffer) > 0)
+    if (rbGetLength(&readBuffer) > 0)
     {
-      logDebug("readBuffer len=%zu\n", sbGetLength(&readBuffer));
-      processReadBuffer(&readBuffer, STDOUT);
+      logDebug("readBuffer len=%zu\n", rbGetLength(&readBuffer));
+      processReadBuffer(&readBuffer, &outWriter);
     }
   }
 
@@ -304,14 +306,14 @@ int main(int argc, char **argv)
 /* Received data from stdin. Once it is a full canboat plain-CSV line, parse it as
  * FORMAT_FAST then encode as a Maretron 0xA5 frame and append to the writeBuffer.
  */
-static void processInBuffer(StringBuffer *in, StringBuffer *out)
+static void processInBuffer(ReadBuffer *in, StringBuffer *out)
 {
   RawMessage msg;
   char      *p;
 
-  while ((p = strchr(sbGet(in), '\n')) != 0)
+  while ((p = rbSearchChar(in, '\n')) != 0)
   {
-    if (!readonly && parseFastFormat(in, &msg) && msg.pgn < CANBOAT_PGN_START)
+    if (!readonly && parseFastFormat(rbGet(in), &msg) && msg.pgn < CANBOAT_PGN_START)
     {
       uint8_t frame[6 + FASTPACKET_MAX_SIZE];
       size_t  frame_len = 0;
@@ -329,21 +331,18 @@ static void processInBuffer(StringBuffer *in, StringBuffer *out)
 
     if (passthru)
     {
-      ssize_t r = write(STDOUT, sbGet(in), p + 1 - sbGet(in));
-
-      if (r <= 0)
-      {
-        logAbort("Cannot write to output\n");
-      }
+      sbAppendData(&outWriter.sb, rbGet(in), p + 1 - rbGet(in));
+      lwLineDone(&outWriter);
     }
-    sbDelete(in, 0, p + 1 - sbGet(in));
+    rbConsume(in, p + 1 - rbGet(in));
   }
+  lwFlush(&outWriter);
 
   if (!p)
   {
-    if (sbGetLength(in) > sizeof("2019-01-20T14:42:04.636Z,0,129540,") + 3 * FASTPACKET_MAX_SIZE)
+    if (rbGetLength(in) > sizeof("2019-01-20T14:42:04.636Z,0,129540,") + 3 * FASTPACKET_MAX_SIZE)
     {
-      sbEmpty(in);
+      rbEmpty(in);
     }
     return;
   }
@@ -482,13 +481,11 @@ static bool buildMaretronFrame(uint8_t       *out,
   return true;
 }
 
-static void writeCsvFrame(int out, uint64_t timestamp_ms, const MaretronFrame *frame)
+static void writeCsvFrame(LineWriter *out, uint64_t timestamp_ms, const MaretronFrame *frame)
 {
-  char         dateStr[DATE_LENGTH];
-  StringBuffer sb = sbNew;
-  ssize_t      r;
+  char dateStr[DATE_LENGTH];
 
-  sbAppendFormat(&sb,
+  sbAppendFormat(&out->sb,
                  "%s,%u,%u,%u,%u,%u,",
                  fmtTimestamp(dateStr, timestamp_ms),
                  frame->prio,
@@ -496,15 +493,9 @@ static void writeCsvFrame(int out, uint64_t timestamp_ms, const MaretronFrame *f
                  frame->src,
                  frame->dst,
                  frame->payload_len);
-  sbAppendEncodeHex(&sb, frame->payload, frame->payload_len, ',');
-  sbAppendString(&sb, "\n");
-
-  r = write(out, sbGet(&sb), sbGetLength(&sb));
-  if (r <= 0)
-  {
-    logAbort("Cannot write to output\n");
-  }
-  sbClean(&sb);
+  sbAppendEncodeHex(&out->sb, frame->payload, frame->payload_len, ',');
+  sbAppendChar(&out->sb, '\n');
+  lwLineDone(out);
 }
 
 static void sendConnect(void)
@@ -593,15 +584,15 @@ static char *ensureDefaultPort(const char *url)
   return out;
 }
 
-static bool processReadBuffer(StringBuffer *in, int out)
+static bool processReadBuffer(ReadBuffer *in, LineWriter *out)
 {
   bool receivedData = false;
 
-  logDebug("processReadBuffer len=%zu\n", sbGetLength(in));
-  while (sbGetLength(in) > 0)
+  logDebug("processReadBuffer len=%zu\n", rbGetLength(in));
+  while (rbGetLength(in) > 0)
   {
-    const uint8_t *p     = (const uint8_t *) sbGet(in);
-    size_t         rem   = sbGetLength(in);
+    const uint8_t *p     = (const uint8_t *) rbGet(in);
+    size_t         rem   = rbGetLength(in);
     uint8_t        first = p[0];
 
     if (state == IPG_AWAIT_HANDSHAKE)
@@ -609,10 +600,10 @@ static bool processReadBuffer(StringBuffer *in, int out)
       char *nul = memchr(p, 0, rem);
       if (nul == NULL)
       {
-        return receivedData;
+        break;
       }
-      handleTextMessage((char *) sbGet(in));
-      sbDelete(in, 0, (size_t) ((const uint8_t *) nul + 1 - p));
+      handleTextMessage(rbGet(in));
+      rbConsume(in, (size_t) ((const uint8_t *) nul + 1 - p));
       continue;
     }
 
@@ -625,19 +616,19 @@ static bool processReadBuffer(StringBuffer *in, int out)
 
       if (r == MARETRON_FRAME_NEED_MORE)
       {
-        return receivedData;
+        break;
       }
       if (r == MARETRON_FRAME_INVALID)
       {
         logDebug("Invalid sync at start of frame, dropping 1 byte\n");
-        sbDelete(in, 0, 1);
+        rbConsume(in, 1);
         continue;
       }
       if (!writeonly)
       {
         writeCsvFrame(out, getNow(), &frame);
       }
-      sbDelete(in, 0, consumed);
+      rbConsume(in, consumed);
       receivedData = true;
       continue;
     }
@@ -647,9 +638,9 @@ static bool processReadBuffer(StringBuffer *in, int out)
       char *nul = memchr(p, 0, rem);
       if (nul == NULL)
       {
-        return receivedData;
+        break;
       }
-      sbDelete(in, 0, (size_t) ((const uint8_t *) nul + 1 - p));
+      rbConsume(in, (size_t) ((const uint8_t *) nul + 1 - p));
       continue;
     }
 
@@ -658,16 +649,17 @@ static bool processReadBuffer(StringBuffer *in, int out)
       char *nul = memchr(p, 0, rem);
       if (nul == NULL)
       {
-        return receivedData;
+        break;
       }
-      handleTextMessage((char *) sbGet(in));
-      sbDelete(in, 0, (size_t) ((const uint8_t *) nul + 1 - p));
+      handleTextMessage(rbGet(in));
+      rbConsume(in, (size_t) ((const uint8_t *) nul + 1 - p));
       continue;
     }
 
     logDebug("Out-of-sync byte 0x%02x, dropping\n", first);
-    sbDelete(in, 0, 1);
+    rbConsume(in, 1);
   }
+  lwFlush(out);
 
   return receivedData;
 }
@@ -23,9 +23,6 @@ limitations under the License.
 
 */
 
-#define _XOPEN_SOURCE   /* to get strptime() */
-#define _DEFAULT_SOURCE /* to get timegm() in glibc > 2.19 */
-#define _BSD_SOURCE     /* to get timegm in glibc <= 2.19 */
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -37,17 +34,11 @@ limitations under the License.
 #include "common.h"
 #include "license.h"
 
-#define FORMAT_DT "%Y-%m-%dT%H:%M:%S"
-#define FORMAT_MS "%d"
-
 int main(int argc, char **argv)
 {
-  char      line[8192];
-  struct tm tm;
-  char     *r;
-  int       ms;
-  uint64_t  now;
-  uint64_t  prev = UINT64_C(0);
+  char     line[8192];
+  uint64_t now;
+  uint64_t prev = UINT64_C(0);
 
   setProgName(argv[0]);
   while (argc > 1)
@@ -67,17 +58,10 @@ int main(int argc, char **argv)
 
   while (fgets(line, sizeof(line), stdin))
   {
-    memset(&tm, 0, sizeof(tm));
-    ms = 0;
-
-    r = strptime(line, FORMAT_DT, &tm);
-    if (r)
+    if (scanTimestamp(line, &now) == NULL)
     {
-      sscanf(r + 1, FORMAT_MS, &ms);
+      now = UINT64_C(0); // No timestamp, so no delay
     }
-    now = timegm(&tm);
-    logDebug("%-1.24s = %" PRIu64 " s r='%-1.10s'\n", line, now, r);
-    now = now * UINT64_C(1000) + ms;
     logDebug("%-1.24s = %" PRIu64 " ms\n", line, now);
 
     if (now > prev && now < prev + UINT64_C(10000))
@@ -43,9 +43,15 @@ limitations under the License.
 #define _GNU_SOURCE
 #include <linux/can.h>
 #include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
+#include <linux/sockios.h>
 #include <net/if.h>
+#include <signal.h>
+#include <sys/epoll.h>
 #include <sys/ioctl.h>
+#include <sys/signalfd.h>
 #include <sys/socket.h>
+#include <sys/timerfd.h>
 
 #include "common.h"
 #include "fastpacket-table.h"
@@ -54,6 +60,9 @@ limitations under the License.
 #define PGN_ISO_ACK (59392)
 #define PGN_ISO_REQUEST (59904)
 #define PGN_ISO_ADDRESS_CLAIM (60928)
+#define PGN_ISO_COMMANDED_ADDRESS (65240)
+#define PGN_ISO_TP_CM (60416)
+#define PGN_ISO_TP_DT (60160)
 #define PGN_GROUP_FUNCTION (126208)
 #define PGN_PGN_LIST (126464)
 #define PGN_PRODUCT_INFO (126996)
@@ -97,7 +106,81 @@ limitations under the License.
 #define CAN_STUFFING_NUMER (120)      /* ~20% average bit-stuffing inflation */
 #define CAN_STUFFING_DENOM (100)
 
+/* Bus utilisation per source and per PGN, over a one minute window that
+ * slides in UTIL_SLOTS steps. The same bit estimate as the bus load above,
+ * but counted per frame, so a fast packet's per-frame overhead is on the
+ * bill of whoever sends it. */
+#define UTIL_SLOTS (6)
+#define UTIL_SLOT_MS (10000)
+#define UTIL_PGNS (512) /* distinct PGNs tracked per interface; a power of two */
+#define UTIL_TOP (5)    /* top talkers listed in the network status */
+
+/* Fast-packet reassembly: MAX_FASTPACKETS slots per interface, found
+ * through a hash on PGN, source and sequence number. A packet whose frames
+ * stop coming is dropped FASTPACKET_TIMEOUT_US after its first frame,
+ * the ISO 11783-3 T1 time between consecutive frames being 750 ms. */
 #define MAX_FASTPACKETS (64)
+#define FASTPACKET_HASH_BITS (7)
+#define FASTPACKET_HASH_BUCKETS (1 << FASTPACKET_HASH_BITS)
+#define FASTPACKET_TIMEOUT_US (750000)
+
+/* ISO 11783-3 Transport Protocol reassembly (-isotp): one transfer per
+ * source and destination, BAM ones going to the global address. A transfer
+ * is dropped after ISO_TP_TIMEOUT_US without a frame, the longest of the
+ * T1..T3 times in the standard. */
+#define ISO_TP_CM_RTS (16)
+#define ISO_TP_CM_BAM (32)
+#define ISO_TP_CM_ABORT (255)
+#define ISO_TP_SLOTS (16)
+#define ISO_TP_TIMEOUT_US (1250000)
+
+typedef struct
+{
+  uint32_t bits; /* before bit stuffing */
+  uint32_t frames;
+} UtilCount;
+
+typedef struct
+{
+  uint64_t  slotStart; /* ms; when the current slot began */
+  size_t    slot;      /* the slot being filled */
+  size_t    slotsUsed; /* slots the window spans so far, 1..UTIL_SLOTS */
+  UtilCount src[UTIL_SLOTS][256];
+  UtilCount srcTotal[256]; /* sum over the slots */
+  uint32_t  pgn[UTIL_PGNS]; /* open addressing: PGN + 1, 0 = free */
+  size_t    pgnCount;
+  UtilCount pgnSlot[UTIL_SLOTS][UTIL_PGNS];
+  UtilCount pgnTotal[UTIL_PGNS];
+} BusUtil;
+
+/* The network status lists at most this many sources with dropped messages. */
+#define NETWORK_STATUS_MAX_DROP_SOURCES (16)
+
+/* Receive batching: readCan() pulls up to rxBatch frames per recvmmsg()
+ * and at most RX_BUDGET frames per main loop iteration. */
+#define RX_BATCH_DEFAULT (32)
+#define RX_BATCH_MAX (256)
+#define RX_BUDGET (256)
+
+/* Receive filters (-pgn / -src), pushed down into the kernel as
+ * CAN_RAW_FILTER entries: one per PGN x source combination plus the PGNs
+ * the address claim needs, well under CAN_RAW_FILTER_MAX. */
+#define MAX_FILTER_PGNS (16)
+#define MAX_FILTER_SRCS (16)
+#define CAN_ID_PDU1_PGN_MASK (0x03ff0000) /* R, DP and PF; PS is the destination */
+#define CAN_ID_PDU2_PGN_MASK (0x03ffff00) /* R, DP, PF and PS (group extension) */
+#define CAN_ID_SRC_MASK (0x000000ff)
+
+/* A hardware RX timestamp further than this from the kernel's software
+ * stamp is taken to run on the adapter's own clock, not wall-clock time. */
+#define HW_TIMESTAMP_MAX_SKEW_US (1000000)
+
+enum RxTimestampMode
+{
+  RX_TIMESTAMP_MS, /* SO_TIMESTAMP, millisecond output (the canboat default) */
+  RX_TIMESTAMP_US, /* SO_TIMESTAMPNS, microsecond output */
+  RX_TIMESTAMP_HW  /* SO_TIMESTAMPING: adapter stamps, software fallback; microsecond output */
+};
 
 enum ClaimState
 {
@@ -130,23 +213,15 @@ static unsigned int    systemInstance   = 15;
 static bool            arbitraryCapable = true;
 static uint64_t        deviceName       = 0;
 static unsigned int    preferredAddress = 0;
-static unsigned int    address          = 0;
-static enum ClaimState claimState       = CLAIM_PENDING;
-static uint64_t        claimDeadline    = 0;        /* ms; end of contention window */
-static bool            addressUsed[N2K_MAX_ADDR + 1]; /* addresses seen claimed by others */
+static bool            claimEnabled     = true; /* false with -n */
 
-/* Heartbeat (PGN 126993): emitted every heartbeatInterval ms once claimed. */
-static long     heartbeatInterval = HEARTBEAT_DEFAULT_INTERVAL; /* 0 disables */
-static uint8_t  heartbeatSeq      = 0;
-static uint64_t nextHeartbeat     = 0; /* ms; when to send the next heartbeat */
+/* Heartbeat (PGN 126993): emitted every heartbeatInterval ms once claimed;
+ * this is the default, a Group Function request can change it per bus. */
+static long heartbeatInterval = HEARTBEAT_DEFAULT_INTERVAL; /* 0 disables */
 
 /* Network status (synthetic PGN 262400): emitted to stdout every
  * NETWORK_STATUS_INTERVAL_MS, populated from kernel CAN counters. */
-static const char *canIface          = NULL; /* interface name, for /sys reads */
-static uint64_t    startTime         = 0;     /* ms; for the uptime field */
-static uint64_t    nextNetworkStatus = 0;     /* ms; when to emit next */
-static uint32_t    busBitrate        = FALLBACK_BITRATE_BPS; /* bits/s, read once */
-static bool        seenAddr[256];             /* distinct source addresses seen */
+static uint64_t startTime = 0; /* ms; for the uptime field */
 
 /* One read of the four kernel counters needed for the bus-load delta. The
  * sysfs counters are 32-bit here; deltas use modular subtraction so a counter
@@ -159,21 +234,84 @@ typedef struct
   uint32_t txPackets;
   uint64_t when; /* ms */
 } LoadSample;
-static LoadSample prevLoadSample;
-static bool       havePrevLoadSample = false;
-
-/* Outbound buffer drained one frame per select() POLLOUT, so a burst of
- * frames (fast-packet PGN, claim flurry, …) never blocks the main loop
- * waiting for the kernel CAN qdisc to drain. The queue holds about 1s of
- * bus time at 250 kbit/s with default txqueuelen, which is enough to
- * survive realistic write bursts and still keep RX / claim timers
- * responsive. */
+
+/* -pgn / -src receive filters; empty means everything. */
+static uint32_t filterPgn[MAX_FILTER_PGNS];
+static size_t   filterPgnCount = 0;
+static uint8_t  filterSrc[MAX_FILTER_SRCS];
+static size_t   filterSrcCount = 0;
+
+/* recvmmsg() buffers, one entry per frame in a batch. The control buffer
+ * is sized for the largest timestamp, SO_TIMESTAMPING's three timespecs. */
+static int                  rxBatch         = RX_BATCH_DEFAULT;
+static enum RxTimestampMode rxTimestampMode = RX_TIMESTAMP_MS;
+static bool                 rxHwClockWarned = false;
+static struct can_frame     rxFrames[RX_BATCH_MAX];
+static struct iovec         rxIov[RX_BATCH_MAX];
+static struct mmsghdr       rxMsgs[RX_BATCH_MAX];
+static char                 rxControl[RX_BATCH_MAX][CMSG_SPACE(3 * sizeof(struct timespec))];
+
+/* Outbound buffer drained whenever epoll reports the CAN socket writable,
+ * so a burst of frames (fast-packet PGN, claim flurry, …) never blocks the
+ * main loop waiting for the kernel CAN qdisc to drain. The queue holds
+ * about 1s of bus time at 250 kbit/s with default txqueuelen, which is
+ * enough to survive realistic write bursts and still keep RX / claim
+ * timers responsive. */
 #define TX_BUFFER_CAPACITY 1024
-static struct can_frame txBuffer[TX_BUFFER_CAPACITY];
-static size_t           txHead       = 0; /* oldest unsent frame */
-static size_t           txTail       = 0; /* next free slot */
-static size_t           txCount      = 0;
-static size_t           txOverflowed = 0;
+
+/* txDrain() hands the kernel up to TX_BATCH frames per sendmmsg(). */
+#define TX_BATCH (32)
+
+/* With -txprio <n>, frames with a CAN priority below n go into the urgent
+ * queue, which is always drained first: an autopilot command must not wait
+ * behind the frames of a Product Information or PGN List burst. Frames of
+ * one PGN share a priority, so a fast packet still goes out in order. */
+enum TxQueueId
+{
+  TX_QUEUE_URGENT,
+  TX_QUEUE_NORMAL,
+  TX_QUEUES
+};
+
+typedef struct
+{
+  struct can_frame frames[TX_BUFFER_CAPACITY];
+  size_t           head; /* oldest unsent frame */
+  size_t           tail; /* next free slot */
+  size_t           count;
+} TxQueue;
+
+static unsigned int txUrgentPriority = 0; /* -txprio; 0 = a single first in, first out queue */
+
+static struct iovec   txIov[TX_BATCH];
+static struct mmsghdr txMsgs[TX_BATCH];
+
+/* A full qdisc answers ENOBUFS without the socket ever becoming
+ * unwritable, so no EPOLLOUT edge follows; retry after about the time a
+ * few frames take on the wire instead. */
+#define TX_RETRY_MS (2)
+
+/*
+ * The main loop is an epoll reactor. The CAN socket and stdin are read
+ * edge-triggered, and each timer is a timerfd that is re-armed only when
+ * its deadline changes.
+ */
+enum EventSource
+{
+  EVENT_CAN,
+  EVENT_UTIL, /* the unfiltered socket of an interface, see openUtilSocket() */
+  EVENT_STDIN,
+  EVENT_SIGNAL, /* SIGUSR1: write the utilisation of every interface to stderr */
+  EVENT_TIMER   /* any Timer; the timer itself is found by its fd */
+};
+
+typedef struct
+{
+  int      fd;
+  uint64_t deadline; /* ms, as getNow(); 0 = disarmed */
+} Timer;
+
+static Timer rxTimeoutTimer; /* -t: lastFrame + timeout, over all interfaces */
 
 /* PGNs we originate / consume, reported via PGN 126464 on request. */
 static const uint32_t txPgnList[] = {PGN_ISO_ACK, PGN_ISO_REQUEST, PGN_ISO_ADDRESS_CLAIM, PGN_GROUP_FUNCTION,
@@ -185,15 +323,36 @@ typedef struct
   bool     used;
   uint32_t pgn;
   uint8_t  src;
-  uint8_t  seq;     /* 3-bit sequence id (high bits of frame[0]) */
-  uint8_t  size;    /* declared total payload length */
-  uint8_t  fill;    /* bytes received so far */
-  uint8_t  nextIdx; /* expected frame index */
-  uint64_t when;    /* timestamp of the first frame */
+  uint8_t  seq;       /* 3-bit sequence id (high bits of frame[0]) */
+  uint8_t  size;      /* declared total payload length */
+  uint32_t frames;    /* bit n is set once frame n is in */
+  uint32_t allFrames; /* the frames the declared size needs; 0 until frame 0 is in */
+  uint64_t when;      /* timestamp of the first frame received, us */
+  uint16_t next;      /* hash chain or free list: slot index + 1, 0 ends it */
   uint8_t  data[FASTPACKET_MAX_SIZE];
 } FastPacket;
 
-static FastPacket fastPackets[MAX_FASTPACKETS];
+typedef struct
+{
+  bool     used;
+  uint8_t  src;
+  uint8_t  dst; /* N2K_ADDR_GLOBAL for a BAM */
+  uint8_t  prio;
+  uint8_t  packets;
+  uint32_t pgn; /* the PGN being transferred */
+  size_t   size;
+  uint32_t received[(ISOTP_MAX_PACKETS + 31) / 32]; /* bit n is set once sequence n + 1 is in */
+  uint64_t when;                                    /* us, the TP.CM that opened the transfer */
+  uint64_t last;                                    /* us, the latest frame */
+  uint8_t  data[ISOTP_MAX_SIZE];
+} IsoTpSession;
+
+/* -isotp: reassemble TP.CM / TP.DT transfers into single messages. */
+static bool isoTpEnabled = false;
+
+/* -reorder: accept the frames of a fast packet in any order, as the
+ * analyzer does, instead of dropping the packet at the first gap. */
+static bool fastPacketAnyOrder = false;
 
 /* Per-canId outbound fast-packet sequence counter. The upper 3 bits of
  * every fast-packet `frame[0]` carry this value; a strict receiver
@@ -211,14 +370,95 @@ typedef struct
   uint32_t canId;
   uint8_t  seq; /* next value to emit, 0..7 */
 } TxFastSeq;
-static TxFastSeq txFastSeq[TX_FAST_SEQ_SLOTS];
 
-static uint8_t getNextFastSeq(uint32_t canId)
+/*
+ * Everything that belongs to one CAN interface: its socket, the fast-packet
+ * reassembly, the address claim, the transmit buffer and the network-status
+ * bookkeeping. Each interface named on the command line gets its own.
+ */
+typedef struct
+{
+  const char *name; /* interface name, for /sys reads and the output tag */
+  int         sock;
+  bool        rxPending;   /* edge-triggered: readable until readCan() drains it */
+  int         utilSock;    /* -pgn / -src: an unfiltered socket for the utilisation only; else -1 */
+  bool        utilPending; /* as rxPending, for utilSock */
+
+  FastPacket   fastPackets[MAX_FASTPACKETS];
+  uint16_t     fastPacketBucket[FASTPACKET_HASH_BUCKETS]; /* chain heads: slot index + 1, 0 = empty */
+  uint16_t     fastPacketFree;                            /* released slots: slot index + 1 */
+  size_t       fastPacketsAllocated;                      /* slots beyond this were never used */
+  IsoTpSession isoTp[ISO_TP_SLOTS];
+  uint32_t     rxDrops[256]; /* incomplete fast packets and ISO TP transfers per source */
+
+  unsigned int    address;
+  enum ClaimState claimState;
+  uint64_t        claimDeadline;                 /* ms; end of contention window */
+  bool            addressUsed[N2K_MAX_ADDR + 1]; /* addresses seen claimed by others */
+  long            heartbeatInterval;             /* 0 disables */
+  uint8_t         heartbeatSeq;
+  uint64_t        nextHeartbeat;   /* ms; when to send the next heartbeat */
+  uint64_t        lastProductInfo; /* ms; see sendProductInfo() */
+
+  uint64_t   nextNetworkStatus; /* ms; when to emit next */
+  uint32_t   bitrate;           /* bits/s, read once */
+  bool       seenAddr[256];     /* distinct source addresses seen */
+  LoadSample prevLoadSample;
+  bool       havePrevLoadSample;
+  BusUtil    util;
+
+  TxQueue   txQueue[TX_QUEUES];
+  size_t    txCount; /* over all queues */
+  size_t    txOverflowed;
+  TxFastSeq txFastSeq[TX_FAST_SEQ_SLOTS];
+
+  Timer claimTimer;         /* claimDeadline while scanning or pending */
+  Timer heartbeatTimer;     /* nextHeartbeat while claimed */
+  Timer networkStatusTimer; /* nextNetworkStatus */
+  Timer txRetryTimer;       /* TX_RETRY_MS after ENOBUFS */
+} CanBus;
+
+#define MAX_BUSES (4)
+static CanBus buses[MAX_BUSES];
+static size_t busCount = 0;
+
+/* -fwd: frames received on one interface are repeated on the others, only
+ * the PGNs given with -fwdpgn if there are any. */
+static bool     forward = false;
+static uint32_t forwardPgn[MAX_FILTER_PGNS];
+static size_t   forwardPgnCount = 0;
+
+/* With more than one interface the output is merged in timestamp order. A
+ * line is held until no line stamped before it can still turn up: an open
+ * fast-packet or ISO TP reassembly will be stamped with the time of its first
+ * frame, and a frame that another interface received but that has not been
+ * read yet is taken to be at most OUTPUT_HOLD_US old. Whenever the interface
+ * changes from one line to the next a "# interface=<name>" line is written
+ * first, which consumers such as the analyzer skip like any other comment. */
+#define INTERFACE_TAG_PREFIX "# interface="
+#define OUTPUT_HOLD_US (20000)
+#define MAX_PENDING_OUTPUT (16384) /* beyond this the oldest lines go out regardless */
+typedef struct
+{
+  uint64_t      whenUs;
+  const CanBus *bus;
+  size_t        offset; /* into pendingOutputText */
+  size_t        len;
+} PendingLine;
+static PendingLine  *pendingOutput; /* in timestamp order, ties in arrival order */
+static size_t        pendingOutputCount   = 0;
+static size_t        pendingOutputAlloc   = 0;
+static StringBuffer  pendingOutputText;
+static size_t        pendingOutputWritten = 0; /* bytes of pendingOutputText already written */
+static const CanBus *lastOutputBus        = NULL;
+static Timer         outputTimer; /* releases held lines when no frame wakes the loop */
+
+static uint8_t getNextFastSeq(CanBus *bus, uint32_t canId)
 {
   TxFastSeq *first_free = NULL;
   for (size_t i = 0; i < TX_FAST_SEQ_SLOTS; i++)
   {
-    TxFastSeq *slot = &txFastSeq[i];
+    TxFastSeq *slot = &bus->txFastSeq[i];
     if (slot->used && slot->canId == canId)
     {
       uint8_t s = slot->seq;
@@ -244,48 +484,71 @@ static uint8_t getNextFastSeq(uint32_t canId)
   return 0;
 }
 
-static int  openCanDevice(const char *device, int *canSocket);
-static int  readCan(int sock);
-static void handleFrame(uint32_t canId, const uint8_t *data, uint8_t len, uint64_t when);
-static void emitMessage(uint64_t when, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len);
+static int  openCanDevice(CanBus *bus);
+static int  openUtilSocket(CanBus *bus, int ifindex);
+static int  readCan(CanBus *bus);
+static int  readUtil(CanBus *bus);
+static void runEventLoop(void);
+static void handleFrame(CanBus *bus, uint32_t canId, const uint8_t *data, uint8_t len, uint64_t whenUs);
+static void emitMessage(const CanBus *bus, uint64_t whenUs, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t dst, const uint8_t *data, size_t len);
+static void outputLine(const CanBus *bus, uint64_t whenUs, const char *line);
+static void writeOutput(size_t count);
+static void flushOutput(bool all);
+static uint64_t outputDeadline(void);
 static bool isFastPacket(uint32_t pgn);
-static void parseAndWriteIn(int sock, const char *cmd);
-static void sendN2k(int sock, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t dst, const uint8_t *data, size_t len, bool echo);
-static void sendCanFrame(int sock, uint32_t canId, const uint8_t *data, uint8_t len);
-static bool txDrainOne(int sock);
-static bool readIn(void);
+static FastPacket *fastPacketFind(CanBus *bus, uint32_t pgn, uint8_t src, uint8_t seq);
+static FastPacket *fastPacketAlloc(CanBus *bus, uint32_t pgn, uint8_t src, uint8_t seq, uint64_t whenUs);
+static void        fastPacketRelease(CanBus *bus, FastPacket *fp, bool dropped);
+static void        fastPacketExpire(CanBus *bus, uint64_t nowUs);
+static void        handleIsoTpCm(CanBus *bus, uint8_t prio, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len, uint64_t whenUs);
+static void        handleIsoTpDt(CanBus *bus, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len, uint64_t whenUs);
+static void        isoTpExpire(CanBus *bus, uint64_t nowUs);
+static bool isPdu1(uint32_t pgn);
+static bool setCanFilter(CanBus *bus);
+static bool isFiltered(uint32_t pgn, uint8_t src);
+static void forwardFrame(const CanBus *from, uint32_t canId, uint32_t pgn, const uint8_t *data, uint8_t len);
+static void parseAndWriteIn(const char *cmd);
+static void sendN2k(CanBus *bus, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t dst, const uint8_t *data, size_t len, bool echo);
+static void sendCanFrame(CanBus *bus, uint32_t canId, const uint8_t *data, uint8_t len);
+static void txDrain(CanBus *bus);
+static int  readIn(void);
 static bool getInMsg(char *msg, size_t len);
 
 /* Address claim */
 static void     buildDeviceName(void);
-static void     startAddressClaim(int sock);
-static void     beginAddressClaim(int sock);
-static void     sendAddressClaim(int sock, uint8_t dst);
-static void     sendIsoRequest(int sock, uint8_t src, uint8_t dst, uint32_t pgn);
-static void     handleAddressClaim(int sock, uint8_t src, const uint8_t *data, uint8_t len);
-static void     handleIsoRequest(uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len);
-static void     handleGroupFunction(uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len);
-static void     tickAddressClaim(int sock, uint64_t now);
-static int      pickFreeAddress(void);
+static void     startAddressClaim(CanBus *bus);
+static void     beginAddressClaim(CanBus *bus);
+static void     sendAddressClaim(CanBus *bus, uint8_t dst);
+static void     sendIsoRequest(CanBus *bus, uint8_t src, uint8_t dst, uint32_t pgn);
+static void     handleAddressClaim(CanBus *bus, uint8_t src, const uint8_t *data, uint8_t len);
+static void     handleIsoRequest(CanBus *bus, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len);
+static void     handleGroupFunction(CanBus *bus, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len);
+static void     tickAddressClaim(CanBus *bus, uint64_t now);
+static int      pickFreeAddress(CanBus *bus);
 static uint64_t nameFromBytes(const uint8_t *data);
-static void     sendHeartbeat(int sock);
-static void     sendProductInfo(int sock);
-static void     sendPgnList(int sock, uint8_t dst);
-static void     sendIsoAck(int sock, uint8_t dst, uint8_t control, uint32_t pgn);
-static void     sendAckGroupFunction(int sock, uint8_t dst, uint32_t pgn, uint8_t pgnError, uint8_t paramError);
+static void     sendHeartbeat(CanBus *bus);
+static void     sendProductInfo(CanBus *bus);
+static void     sendPgnList(CanBus *bus, uint8_t dst);
+static void     sendIsoAck(CanBus *bus, uint8_t dst, uint8_t control, uint32_t pgn);
+static void     sendAckGroupFunction(CanBus *bus, uint8_t dst, uint32_t pgn, uint8_t pgnError, uint8_t paramError);
 
 /* Network status (synthetic PGN 262400) */
-static void     sendNetworkStatus(void);
+static void     sendNetworkStatus(CanBus *bus);
 static bool     readSysfsCounter(const char *iface, const char *name, uint32_t *out);
 static uint32_t readSysfsBitrate(const char *iface);
 static bool     readLoadSample(const char *iface, uint64_t now, LoadSample *out);
 static bool     computeLoadPct(const LoadSample *prev, const LoadSample *curr, uint32_t bitrate, uint8_t *out);
 
+/* Bus utilisation */
+static void     utilAccount(CanBus *bus, uint32_t pgn, uint8_t src, uint8_t len);
+static void     utilTick(CanBus *bus, uint64_t now);
+static uint32_t utilLoad(const CanBus *bus, uint64_t bits, uint64_t now);
+static size_t   utilTop(const UtilCount *count, size_t entries, size_t top[UTIL_TOP]);
+static void     utilDump(CanBus *bus, uint64_t now);
+
 int main(int argc, char **argv)
 {
-  const char *name   = argv[0];
-  const char *device = NULL;
-  int         sock;
+  const char *name = argv[0];
 
   setProgName(argv[0]);
   while (argc > 1)
@@ -317,7 +580,7 @@ int main(int argc, char **argv)
     }
     else if (strcasecmp(argv[1], "-n") == 0)
     {
-      claimState = CLAIM_DISABLED;
+      claimEnabled = false;
     }
     else if (strcasecmp(argv[1], "-t") == 0 && argc > 2)
     {
@@ -349,22 +612,105 @@ int main(int argc, char **argv)
       argc--, argv++;
       systemInstance = (unsigned int) strtoul(argv[1], 0, 10) & 0x0f;
     }
-    else if (!device)
+    else if (strcasecmp(argv[1], "-b") == 0 && argc > 2)
+    {
+      argc--, argv++;
+      rxBatch = (int) strtol(argv[1], 0, 10);
+      rxBatch = CB_MAX(1, CB_MIN(rxBatch, RX_BATCH_MAX));
+    }
+    else if (strcasecmp(argv[1], "-isotp") == 0)
+    {
+      isoTpEnabled = true;
+    }
+    else if (strcasecmp(argv[1], "-reorder") == 0)
+    {
+      fastPacketAnyOrder = true;
+    }
+    else if (strcasecmp(argv[1], "-txprio") == 0 && argc > 2)
+    {
+      argc--, argv++;
+      txUrgentPriority = (unsigned int) strtoul(argv[1], 0, 10);
+    }
+    else if (strcasecmp(argv[1], "-pgn") == 0 && argc > 2)
+    {
+      argc--, argv++;
+      if (filterPgnCount == MAX_FILTER_PGNS)
+      {
+        logAbort("Too many -pgn options, at most %d are supported\n", MAX_FILTER_PGNS);
+      }
+      filterPgn[filterPgnCount] = (uint32_t) strtoul(argv[1], 0, 10) & 0x3ffff;
+      if (isPdu1(filterPgn[filterPgnCount]))
+      {
+        filterPgn[filterPgnCount] &= ~UINT32_C(0xff); /* the low byte is the destination */
+      }
+      filterPgnCount++;
+    }
+    else if (strcasecmp(argv[1], "-src") == 0 && argc > 2)
+    {
+      argc--, argv++;
+      if (filterSrcCount == MAX_FILTER_SRCS)
+      {
+        logAbort("Too many -src options, at most %d are supported\n", MAX_FILTER_SRCS);
+      }
+      filterSrc[filterSrcCount++] = (uint8_t) strtoul(argv[1], 0, 10);
+    }
+    else if (strcasecmp(argv[1], "-ts") == 0 && argc > 2)
+    {
+      argc--, argv++;
+      if (strcasecmp(argv[1], "ms") == 0)
+      {
+        rxTimestampMode = RX_TIMESTAMP_MS;
+      }
+      else if (strcasecmp(argv[1], "us") == 0)
+      {
+        rxTimestampMode = RX_TIMESTAMP_US;
+      }
+      else if (strcasecmp(argv[1], "hw") == 0)
+      {
+        rxTimestampMode = RX_TIMESTAMP_HW;
+      }
+      else
+      {
+        busCount = 0;
+        break;
+      }
+    }
+    else if (strcasecmp(argv[1], "-fwd") == 0)
+    {
+      forward = true;
+    }
+    else if (strcasecmp(argv[1], "-fwdpgn") == 0 && argc > 2)
+    {
+      argc--, argv++;
+      if (forwardPgnCount == MAX_FILTER_PGNS)
+      {
+        logAbort("Too many -fwdpgn options, at most %d are supported\n", MAX_FILTER_PGNS);
+      }
+      forwardPgn[forwardPgnCount] = (uint32_t) strtoul(argv[1], 0, 10) & 0x3ffff;
+      if (isPdu1(forwardPgn[forwardPgnCount]))
+      {
+        forwardPgn[forwardPgnCount] &= ~UINT32_C(0xff);
+      }
+      forwardPgnCount++;
+      forward = true;
+    }
+    else if (argv[1][0] != '-' && busCount < MAX_BUSES)
     {
-      device = argv[1];
+      buses[busCount].utilSock = -1;
+      buses[busCount++].name   = argv[1];
     }
     else
     {
-      device = NULL;
+      busCount = 0;
       break;
     }
     argc--, argv++;
   }
 
-  if (!device)
+  if (busCount == 0)
   {
     fprintf(stderr,
-            "Usage: %s [-w] [-r] [-p] [-v] [-d] [-n] [-t <n>] [-a <addr>] [-u <n>] [-m <n>] [-si <n>] [-hb <ms>] <can-device>\n"
+            "Usage: %s [-w] [-r] [-p] [-v] [-d] [-n] [-t <n>] [-a <addr>] [-u <n>] [-m <n>] [-si <n>] [-hb <ms>] [-b <n>] [-reorder] [-isotp] [-txprio <n>] [-ts ms|us|hw] [-pgn <n>]... [-src <n>]... [-fwd] [-fwdpgn <n>]... <can-device>...\n"
             "\n"
             "Bridge a Linux SocketCAN interface to/from canboat FAST format.\n"
             "\n"
@@ -381,14 +727,44 @@ int main(int argc, char **argv)
             "  -m <n>    manufacturer code for the ISO NAME (default %u)\n"
             "  -si <n>   ISO NAME System Instance, 0..15 (default 15 = yield to other devices)\n"
             "  -hb <ms>  heartbeat (PGN 126993) interval in ms, default %d, 0 disables\n"
+            "  -b <n>    receive up to <n> CAN frames per system call, 1..%d (default %d)\n"
+            "  -reorder  accept the frames of a fast packet in any order\n"
+            "  -isotp    output ISO TP (BAM and RTS/CTS) transfers as single messages of up\n"
+            "            to %d bytes instead of their TP.CM and TP.DT frames\n"
+            "  -txprio <n> transmit frames with CAN priority below <n> ahead of any queued\n"
+            "            frames with a lower priority (default 0, in order of submission)\n"
+            "  -ts ms    kernel receive timestamps, printed in milliseconds (default)\n"
+            "  -ts us    nanosecond kernel receive timestamps, printed in microseconds\n"
+            "  -ts hw    CAN adapter hardware timestamps where available, else as -ts us\n"
+            "  -pgn <n>  only receive PGN <n>; may be given up to %d times\n"
+            "  -src <n>  only receive from source address <n>; may be given up to %d times\n"
+            "            (filtered by the kernel; the address claim PGNs are always received,\n"
+            "            but only printed when selected; the bus load per source and per PGN\n"
+            "            still covers every frame)\n"
+            "  -fwd      repeat the frames received on each interface on the others\n"
+            "  -fwdpgn <n> only repeat PGN <n>; may be given up to %d times, implies -fwd\n"
+            "\n"
+            "  <can-device> is a SocketCAN interface name, e.g. can0 or nmea2000. Up to %d\n"
+            "  interfaces can be given; each claims its own address, and the output is merged\n"
+            "  in timestamp order with a '" INTERFACE_TAG_PREFIX "<name>' line whenever the interface\n"
+            "  changes. The same line on stdin sends what follows to that interface only;\n"
+            "  before the first one, stdin goes to every interface.\n"
             "\n"
-            "  <can-device> is a SocketCAN interface name, e.g. can0 or nmea2000.\n"
+            "  SIGUSR1 writes the bus load per source and per PGN over the last minute to\n"
+            "  stderr as JSON; the busiest ones are also part of the network status.\n"
             "\n"
             "  Example: %s nmea2000 | analyzer\n"
             "\n" COPYRIGHT,
             name,
             manufacturerCode,
             HEARTBEAT_DEFAULT_INTERVAL,
+            RX_BATCH_MAX,
+            RX_BATCH_DEFAULT,
+            ISOTP_MAX_SIZE,
+            MAX_FILTER_PGNS,
+            MAX_FILTER_SRCS,
+            MAX_FILTER_PGNS,
+            MAX_BUSES,
             name);
     exit(1);
   }
@@ -397,159 +773,399 @@ int main(int argc, char **argv)
   {
     uniqueNumber = (uint32_t) (getpid() & 0x1fffff);
   }
-  address = preferredAddress;
+  if (claimEnabled)
+  {
+    buildDeviceName();
+  }
+  startTime = getNow();
 
   fputs(CANBOAT_FORMAT_FAST_HEADER, stdout);
-  emitCanboatStartupRecord("socketcan-serial", device);
 
-  if (openCanDevice(device, &sock))
+  for (size_t i = 0; i < busCount; i++)
   {
-    exit(1);
+    CanBus *bus = &buses[i];
+
+    if (busCount > 1)
+    {
+      printf(INTERFACE_TAG_PREFIX "%s\n", bus->name);
+      lastOutputBus = bus;
+    }
+    emitCanboatStartupRecord("socketcan-serial", bus->name);
+
+    bus->address           = preferredAddress;
+    bus->claimState        = claimEnabled ? CLAIM_PENDING : CLAIM_DISABLED;
+    bus->heartbeatInterval = heartbeatInterval;
+    if (openCanDevice(bus))
+    {
+      exit(1);
+    }
+
+    /* Network-status emission state: read the (fixed) bitrate once and arm
+     * the first emission one interval out. Disabled in writeonly mode, which
+     * suppresses all stdout output. */
+    bus->bitrate           = readSysfsBitrate(bus->name);
+    bus->util.slotStart    = startTime;
+    bus->util.slotsUsed    = 1;
+    bus->nextNetworkStatus = startTime + NETWORK_STATUS_INTERVAL_MS;
   }
 
-  if (claimState != CLAIM_DISABLED)
+  for (size_t i = 0; i < busCount; i++)
   {
-    buildDeviceName();
-    startAddressClaim(sock);
+    if (buses[i].claimState != CLAIM_DISABLED)
+    {
+      startAddressClaim(&buses[i]);
+    }
   }
 
-  /* Network-status emission state: read the (fixed) bitrate once and arm
-   * the first emission one interval out. Disabled in writeonly mode, which
-   * suppresses all stdout output. */
-  canIface          = device;
-  startTime         = getNow();
-  busBitrate        = readSysfsBitrate(device);
-  nextNetworkStatus = startTime + NETWORK_STATUS_INTERVAL_MS;
+  runEventLoop();
 
-  uint64_t lastFrame = getNow();
-
-  for (;;)
+  for (size_t i = 0; i < busCount; i++)
   {
-    fd_set         rfds, wfds;
-    struct timeval tv;
-    uint64_t       now = getNow();
-    int            r;
-    int            maxfd = sock;
-
-    FD_ZERO(&rfds);
-    FD_ZERO(&wfds);
-    FD_SET(sock, &rfds);
-    if (txCount > 0)
+    close(buses[i].sock);
+    if (buses[i].utilSock >= 0)
     {
-      FD_SET(sock, &wfds);
+      close(buses[i].utilSock);
     }
-    if (!readonly)
+  }
+  return 0;
+}
+
+/* The epoll data carries both the event source and the fd. */
+static bool eventAdd(int epfd, int fd, uint32_t events, enum EventSource source)
+{
+  struct epoll_event ev;
+
+  memset(&ev, 0, sizeof(ev));
+  ev.events   = events;
+  ev.data.u64 = ((uint64_t) source << 32) | (uint32_t) fd;
+  return epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) == 0;
+}
+
+static void timerOpen(int epfd, Timer *timer)
+{
+  timer->fd       = timerfd_create(CLOCK_REALTIME, TFD_NONBLOCK | TFD_CLOEXEC);
+  timer->deadline = 0;
+  if (timer->fd < 0)
+  {
+    logAbort("timerfd_create: %s\n", strerror(errno));
+  }
+  if (!eventAdd(epfd, timer->fd, EPOLLIN, EVENT_TIMER))
+  {
+    logAbort("epoll_ctl timer: %s\n", strerror(errno));
+  }
+}
+
+/*
+ * Arm the timer for an absolute getNow() deadline, or disarm it for 0.
+ * Only a changed deadline costs a system call.
+ */
+static void timerSet(Timer *timer, uint64_t deadline)
+{
+  struct itimerspec its;
+
+  if (deadline == timer->deadline)
+  {
+    return;
+  }
+  memset(&its, 0, sizeof(its));
+  its.it_value.tv_sec  = (time_t) (deadline / 1000);
+  its.it_value.tv_nsec = (long) (deadline % 1000) * 1000000; /* a deadline in the past fires at once */
+  if (timerfd_settime(timer->fd, TFD_TIMER_ABSTIME, &its, NULL) < 0)
+  {
+    logAbort("timerfd_settime: %s\n", strerror(errno));
+  }
+  timer->deadline = deadline;
+}
+
+/*
+ * Consume an expiry of the timer with this fd; it stays disarmed until set
+ * again. Returns the interface the timer belongs to, NULL for a global one.
+ */
+static CanBus *timerAck(int fd)
+{
+  uint64_t expirations;
+
+  if (read(fd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN)
+  {
+    logError("timerfd read: %s\n", strerror(errno));
+  }
+  if (fd == rxTimeoutTimer.fd)
+  {
+    rxTimeoutTimer.deadline = 0;
+    return NULL;
+  }
+  if (fd == outputTimer.fd)
+  {
+    outputTimer.deadline = 0;
+    return NULL;
+  }
+  for (size_t i = 0; i < busCount; i++)
+  {
+    CanBus *bus      = &buses[i];
+    Timer  *timers[] = {&bus->claimTimer, &bus->heartbeatTimer, &bus->networkStatusTimer, &bus->txRetryTimer};
+
+    for (size_t t = 0; t < ARRAY_SIZE(timers); t++)
     {
-      FD_SET(STDIN_FILENO, &rfds);
-      if (STDIN_FILENO > maxfd)
+      if (timers[t]->fd == fd)
       {
-        maxfd = STDIN_FILENO;
+        timers[t]->deadline = 0;
+        return bus;
       }
     }
+  }
+  return NULL;
+}
+
+static CanBus *busForSocket(int fd)
+{
+  for (size_t i = 0; i < busCount; i++)
+  {
+    if (buses[i].sock == fd || buses[i].utilSock == fd)
+    {
+      return &buses[i];
+    }
+  }
+  return NULL;
+}
+
+/*
+ * The main loop. Readiness is only noted while the events are collected;
+ * the work is then done in a fixed order: CAN frames (at most RX_BUDGET per
+ * interface per iteration, so a saturated bus cannot starve the rest),
+ * stdin, the protocol timers, whatever was queued for transmission and
+ * finally the merged output. As the CAN sockets and stdin are
+ * edge-triggered, each stays marked pending until a read reports that it
+ * is drained.
+ */
+static void runEventLoop(void)
+{
+  int      epfd         = epoll_create1(EPOLL_CLOEXEC);
+  int      sigfd;
+  bool     running      = true;
+  bool     stdinPending = false;
+  uint64_t lastFrame    = getNow();
+  sigset_t sigs;
+
+  if (epfd < 0)
+  {
+    logAbort("epoll_create1: %s\n", strerror(errno));
+  }
+
+  /* SIGUSR1 is blocked and read as an event, so it cannot slip in between
+   * checking for it and going to sleep. */
+  sigemptyset(&sigs);
+  sigaddset(&sigs, SIGUSR1);
+  sigprocmask(SIG_BLOCK, &sigs, NULL);
+  sigfd = signalfd(-1, &sigs, SFD_NONBLOCK | SFD_CLOEXEC);
+  if (sigfd < 0 || !eventAdd(epfd, sigfd, EPOLLIN, EVENT_SIGNAL))
+  {
+    logAbort("signalfd: %s\n", strerror(errno));
+  }
+  for (size_t i = 0; i < busCount; i++)
+  {
+    CanBus *bus = &buses[i];
 
-    /* Wake at the soonest of: the claim deadline, the next heartbeat, or a
-     * 1s poll, so the timers advance even on an otherwise silent bus.
-     * When the TX buffer is non-empty, also clamp to a short timeout as a
-     * safety net in case POLLOUT lags qdisc availability on some kernels. */
-    uint64_t waitMs = 1000;
-    if ((claimState == CLAIM_PENDING || claimState == CLAIM_SCANNING) && claimDeadline > now)
+    if (!eventAdd(epfd, bus->sock, EPOLLIN | EPOLLOUT | EPOLLET, EVENT_CAN))
     {
-      waitMs = claimDeadline - now;
+      logAbort("epoll_ctl CAN socket: %s\n", strerror(errno));
     }
-    else if (claimState == CLAIM_CLAIMED && heartbeatInterval > 0)
+    if (bus->utilSock >= 0 && !eventAdd(epfd, bus->utilSock, EPOLLIN | EPOLLET, EVENT_UTIL))
     {
-      waitMs = (nextHeartbeat > now) ? nextHeartbeat - now : 0;
+      logAbort("epoll_ctl CAN socket: %s\n", strerror(errno));
     }
-    if (!writeonly)
+    timerOpen(epfd, &bus->claimTimer);
+    timerOpen(epfd, &bus->heartbeatTimer);
+    timerOpen(epfd, &bus->networkStatusTimer);
+    timerOpen(epfd, &bus->txRetryTimer);
+  }
+  if (!readonly)
+  {
+    int flags = fcntl(STDIN_FILENO, F_GETFL, 0);
+
+    if (eventAdd(epfd, STDIN_FILENO, EPOLLIN | EPOLLET, EVENT_STDIN))
     {
-      uint64_t nsWait = (nextNetworkStatus > now) ? nextNetworkStatus - now : 0;
-      if (nsWait < waitMs)
+      if (flags >= 0)
       {
-        waitMs = nsWait;
+        fcntl(STDIN_FILENO, F_SETFL, flags | O_NONBLOCK);
       }
     }
-    if (txCount > 0 && waitMs > 5)
+    else if (errno == EPERM)
+    {
+      stdinPending = true; /* a regular file: always readable until EOF */
+    }
+    else
+    {
+      logAbort("epoll_ctl stdin: %s\n", strerror(errno));
+    }
+  }
+  timerOpen(epfd, &rxTimeoutTimer);
+  timerOpen(epfd, &outputTimer);
+
+  while (running)
+  {
+    struct epoll_event events[16];
+    bool               pending = stdinPending;
+    int                n;
+
+    for (size_t i = 0; i < busCount; i++)
     {
-      waitMs = 5;
+      pending |= buses[i].rxPending | buses[i].utilPending;
     }
-    tv.tv_sec  = waitMs / 1000;
-    tv.tv_usec = (waitMs % 1000) * 1000;
 
-    r = select(maxfd + 1, &rfds, &wfds, NULL, &tv);
-    if (r < 0)
+    /* Sleep only when nothing is left over from the previous iteration. */
+    n = epoll_wait(epfd, events, ARRAY_SIZE(events), pending ? 0 : -1);
+    if (n < 0)
     {
       if (errno == EINTR)
       {
         continue;
       }
-      logAbort("select failed: %s\n", strerror(errno));
+      logAbort("epoll_wait failed: %s\n", strerror(errno));
     }
-    if (r == 0 && timeout && (getNow() - lastFrame) >= (uint64_t) timeout * 1000)
+    for (int i = 0; i < n; i++)
     {
-      logAbort("Timeout %ld seconds; no data received\n", timeout);
-    }
+      uint32_t source = (uint32_t) (events[i].data.u64 >> 32);
+      int      fd     = (int) (uint32_t) events[i].data.u64;
+      CanBus  *bus;
 
-    /* Drain one frame per writability wakeup (or per safety-net timeout)
-     * so a single producer can't monopolise the loop; RX, stdin and the
-     * claim timers stay responsive across long fast-packet bursts. */
-    if (txCount > 0)
-    {
-      txDrainOne(sock);
+      if (source == EVENT_CAN)
+      {
+        bus = busForSocket(fd);
+        bus->rxPending |= (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) != 0;
+        if ((events[i].events & EPOLLOUT) != 0)
+        {
+          txDrain(bus);
+        }
+      }
+      else if (source == EVENT_UTIL)
+      {
+        busForSocket(fd)->utilPending = true;
+      }
+      else if (source == EVENT_STDIN)
+      {
+        stdinPending = true;
+      }
+      else if (source == EVENT_SIGNAL)
+      {
+        struct signalfd_siginfo info; /* SIGUSR1 does not queue, so there is at most one */
+
+        if (read(fd, &info, sizeof(info)) == (ssize_t) sizeof(info))
+        {
+          for (size_t b = 0; b < busCount; b++)
+          {
+            utilDump(&buses[b], getNow());
+          }
+        }
+      }
+      else
+      {
+        bus = timerAck(fd);
+        if (bus != NULL && fd == bus->txRetryTimer.fd)
+        {
+          txDrain(bus);
+        }
+      }
     }
 
-    if (FD_ISSET(sock, &rfds))
+    for (size_t i = 0; i < busCount; i++)
     {
-      lastFrame = getNow();
-      if (readCan(sock) < 0)
+      CanBus *bus = &buses[i];
+      int     r;
+
+      if (bus->utilPending)
       {
-        break;
+        r                = readUtil(bus);
+        bus->utilPending = r > 0;
+        if (r < 0)
+        {
+          running = false;
+        }
+      }
+      if (!bus->rxPending)
+      {
+        continue;
+      }
+      lastFrame      = getNow();
+      r              = readCan(bus);
+      bus->rxPending = r > 0;
+      if (r < 0)
+      {
+        running = false;
       }
     }
-    if (!readonly && FD_ISSET(STDIN_FILENO, &rfds))
+    if (stdinPending && !readonly)
     {
       char line[MAX_MSG_LINE_LENGTH];
+      int  r = readIn();
 
-      if (!readIn())
+      stdinPending = r > 0;
+      if (r == 0)
       {
         /* stdin closed: stop reading it but keep bridging the bus,
          * rather than quitting like the serial tools do. */
         logDebug("EOF on stdin, continuing read-only\n");
         readonly = 1;
+        epoll_ctl(epfd, EPOLL_CTL_DEL, STDIN_FILENO, NULL);
       }
-      else
+      while (getInMsg(line, sizeof(line)))
       {
-        while (getInMsg(line, sizeof(line)))
+        parseAndWriteIn(line);
+        if (passthru)
         {
-          parseAndWriteIn(sock, line);
-          if (passthru)
-          {
-            fputs(line, stdout);
-            fflush(stdout);
-          }
+          flushOutput(true);
+          fputs(line, stdout);
+          fflush(stdout);
         }
       }
     }
 
-    tickAddressClaim(sock, getNow());
-
-    if (claimState == CLAIM_CLAIMED && heartbeatInterval > 0 && getNow() >= nextHeartbeat)
+    if (timeout && getNow() - lastFrame >= (uint64_t) timeout * 1000)
     {
-      sendHeartbeat(sock);
-      nextHeartbeat = getNow() + (uint64_t) heartbeatInterval;
+      logAbort("Timeout %ld seconds; no data received\n", timeout);
     }
 
-    if (!writeonly && getNow() >= nextNetworkStatus)
+    for (size_t i = 0; i < busCount; i++)
     {
-      sendNetworkStatus();
-      nextNetworkStatus = getNow() + NETWORK_STATUS_INTERVAL_MS;
+      CanBus *bus = &buses[i];
+
+      tickAddressClaim(bus, getNow());
+
+      if (bus->claimState == CLAIM_CLAIMED && bus->heartbeatInterval > 0 && getNow() >= bus->nextHeartbeat)
+      {
+        sendHeartbeat(bus);
+        bus->nextHeartbeat = getNow() + (uint64_t) bus->heartbeatInterval;
+      }
+
+      utilTick(bus, getNow());
+
+      if (!writeonly && getNow() >= bus->nextNetworkStatus)
+      {
+        sendNetworkStatus(bus);
+        bus->nextNetworkStatus = getNow() + NETWORK_STATUS_INTERVAL_MS;
+      }
+
+      if (bus->txCount > 0 && bus->txRetryTimer.deadline == 0)
+      {
+        txDrain(bus);
+      }
+
+      /* Follow whatever the handlers above did to the deadlines. */
+      timerSet(&bus->claimTimer,
+               (bus->claimState == CLAIM_PENDING || bus->claimState == CLAIM_SCANNING) ? bus->claimDeadline : 0);
+      timerSet(&bus->heartbeatTimer,
+               (bus->claimState == CLAIM_CLAIMED && bus->heartbeatInterval > 0) ? bus->nextHeartbeat : 0);
+      timerSet(&bus->networkStatusTimer, writeonly ? 0 : bus->nextNetworkStatus);
     }
-  }
+    timerSet(&rxTimeoutTimer, timeout ? lastFrame + (uint64_t) timeout * 1000 : 0);
 
-  close(sock);
-  return 0;
+    flushOutput(!running);
+    timerSet(&outputTimer, outputDeadline());
+  }
+  close(sigfd);
+  close(epfd);
 }
 
-static int openCanDevice(const char *device, int *canSocket)
+static int openCanDevice(CanBus *bus)
 {
   struct sockaddr_can addr;
   struct ifreq        ifr;
@@ -563,11 +1179,18 @@ static int openCanDevice(const char *device, int *canSocket)
   }
 
   memset(&ifr, 0, sizeof(ifr));
-  strncpy(ifr.ifr_name, device, IFNAMSIZ - 1);
+  strncpy(ifr.ifr_name, bus->name, IFNAMSIZ - 1);
   ifr.ifr_ifindex = if_nametoindex(ifr.ifr_name);
   if (!ifr.ifr_ifindex)
   {
-    logError("Cannot find CAN interface '%s': %s\n", device, strerror(errno));
+    logError("Cannot find CAN interface '%s': %s\n", bus->name, strerror(errno));
+    return 1;
+  }
+
+  /* Install the filters before binding, so no unwanted frame is queued in between. */
+  bus->sock = sock;
+  if (!setCanFilter(bus))
+  {
     return 1;
   }
 
@@ -580,10 +1203,14 @@ static int openCanDevice(const char *device, int *canSocket)
     logError("bind: %s\n", strerror(errno));
     return 1;
   }
+  if ((filterPgnCount > 0 || filterSrcCount > 0) && openUtilSocket(bus, ifr.ifr_ifindex))
+  {
+    return 1;
+  }
 
   /* Non-blocking writes: a full netdev qdisc must not stall RX or the
    * claim timers. The main loop buffers TX frames and drains them via
-   * POLLOUT instead of busy-waiting in write(). */
+   * EPOLLOUT instead of busy-waiting in write(). */
   int flags = fcntl(sock, F_GETFL, 0);
   if (flags < 0 || fcntl(sock, F_SETFL, flags | O_NONBLOCK) < 0)
   {
@@ -593,271 +1220,1098 @@ static int openCanDevice(const char *device, int *canSocket)
 
   /* Kernel RX timestamps, so the emitted line carries the time the
    * frame actually arrived rather than when we got round to it. */
-  if (setsockopt(sock, SOL_SOCKET, SO_TIMESTAMP, &on, sizeof(on)) < 0)
+  if (rxTimestampMode == RX_TIMESTAMP_HW)
+  {
+    struct hwtstamp_config hwConfig;
+    int                    tsFlags;
+
+    tsFlags = SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE | SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+
+    /* Most CAN drivers stamp every frame regardless, but some only do so
+     * once asked; failing that we still get the software stamp. */
+    memset(&hwConfig, 0, sizeof(hwConfig));
+    hwConfig.tx_type   = HWTSTAMP_TX_OFF;
+    hwConfig.rx_filter = HWTSTAMP_FILTER_ALL;
+    ifr.ifr_data       = (void *) &hwConfig;
+    if (ioctl(sock, SIOCSHWTSTAMP, &ifr) < 0)
+    {
+      logDebug("SIOCSHWTSTAMP: %s\n", strerror(errno));
+    }
+    if (setsockopt(sock, SOL_SOCKET, SO_TIMESTAMPING, &tsFlags, sizeof(tsFlags)) < 0)
+    {
+      logError("SO_TIMESTAMPING: %s (falling back to software timestamps)\n", strerror(errno));
+      rxTimestampMode = RX_TIMESTAMP_US;
+    }
+  }
+  if (rxTimestampMode == RX_TIMESTAMP_US && setsockopt(sock, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on)) < 0)
+  {
+    logError("SO_TIMESTAMPNS: %s (falling back to SO_TIMESTAMP)\n", strerror(errno));
+    rxTimestampMode = RX_TIMESTAMP_MS;
+  }
+  if (rxTimestampMode == RX_TIMESTAMP_MS && setsockopt(sock, SOL_SOCKET, SO_TIMESTAMP, &on, sizeof(on)) < 0)
   {
     logError("SO_TIMESTAMP: %s (continuing without kernel timestamps)\n", strerror(errno));
   }
 
-  *canSocket = sock;
   return 0;
 }
 
 /*
- * Drain all currently-readable CAN frames. recvmsg() also yields the
- * kernel SO_TIMESTAMP ancillary data.
+ * With -pgn / -src the kernel drops every frame that was not selected before
+ * handleFrame() sees it, which would leave the utilisation (the top talkers
+ * in the network status and the SIGUSR1 dump) blind to the rest of the bus.
+ * A second socket without a filter then feeds the accounting alone. Our own
+ * frames reach it through the CAN loopback, so txDrain() leaves them to it.
  */
-static int readCan(int sock)
-{
-  /* Drain at most a batch per call, then yield to the main loop so the
-   * address-claim timers keep advancing on a busy bus. */
-  int budget = 256;
-  while (budget-- > 0)
-  {
-    struct can_frame frame;
-    struct iovec     iov;
-    struct msghdr    msg;
-    char             control[CMSG_SPACE(sizeof(struct timeval))];
-    struct cmsghdr  *cmsg;
-    ssize_t          n;
-    uint64_t         when = 0;
-
-    memset(&msg, 0, sizeof(msg));
-    iov.iov_base       = &frame;
-    iov.iov_len        = sizeof(frame);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-
-    n = recvmsg(sock, &msg, 0);
-    if (n < 0)
-    {
-      if (errno == EAGAIN || errno == EWOULDBLOCK)
-      {
-        return 0;
-      }
-      if (errno == EINTR)
-      {
-        continue;
-      }
-      logError("recvmsg: %s\n", strerror(errno));
-      return -1;
-    }
-    if (n < (ssize_t) sizeof(struct can_frame))
-    {
-      continue;
+static int openUtilSocket(CanBus *bus, int ifindex)
+{
+  struct sockaddr_can addr;
+  int                 sock;
+
+  if ((sock = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, CAN_RAW)) < 0)
+  {
+    logError("socket: %s\n", strerror(errno));
+    return 1;
+  }
+  memset(&addr, 0, sizeof(addr));
+  addr.can_family  = AF_CAN;
+  addr.can_ifindex = ifindex;
+  if (bind(sock, (struct sockaddr *) &addr, sizeof(addr)) < 0)
+  {
+    logError("bind: %s\n", strerror(errno));
+    close(sock);
+    return 1;
+  }
+  bus->utilSock = sock;
+  return 0;
+}
+
+static uint64_t timespecUs(const struct timespec *ts)
+{
+  return (uint64_t) ts->tv_sec * 1000000 + (uint64_t) ts->tv_nsec / 1000;
+}
+
+/*
+ * SO_TIMESTAMPING delivers the software stamp in ts[0] and the adapter's raw
+ * hardware stamp in ts[2]. Only use the latter when it is on wall-clock
+ * time; many CAN adapters count from their own power-up instead.
+ */
+static uint64_t rxTimestampingUs(const struct timespec ts[3])
+{
+  uint64_t sw = timespecUs(&ts[0]);
+  uint64_t hw = timespecUs(&ts[2]);
+
+  if (hw == 0)
+  {
+    return sw;
+  }
+  if (sw != 0 && (hw > sw ? hw - sw : sw - hw) > HW_TIMESTAMP_MAX_SKEW_US)
+  {
+    if (!rxHwClockWarned)
+    {
+      logInfo("CAN adapter hardware timestamps are not wall-clock time, using software timestamps\n");
+      rxHwClockWarned = true;
+    }
+    return sw;
+  }
+  return hw;
+}
+
+/*
+ * Compile the -pgn / -src options into CAN_RAW_FILTER entries, so frames
+ * nobody asked for are dropped in the kernel instead of being received,
+ * timestamped and reassembled here. The filters in the list are OR-ed, so a
+ * PGN and source selection becomes one entry per combination. A PDU1 PGN
+ * only matches on R, DP and PF, as its PS byte carries the destination.
+ */
+static bool setCanFilter(CanBus *bus)
+{
+  struct can_filter filter[(MAX_FILTER_PGNS + 2) * MAX_FILTER_SRCS + ARRAY_SIZE(rxPgnList)];
+  uint32_t          pgn[MAX_FILTER_PGNS + 2];
+  size_t            pgnCount = filterPgnCount;
+  size_t            n        = 0;
+
+  if (filterPgnCount == 0 && filterSrcCount == 0)
+  {
+    return true; /* the default filter lets everything through */
+  }
+
+  /* A selected PGN may arrive as an ISO TP transfer. */
+  memcpy(pgn, filterPgn, filterPgnCount * sizeof(pgn[0]));
+  if (isoTpEnabled && filterPgnCount > 0)
+  {
+    pgn[pgnCount++] = PGN_ISO_TP_CM;
+    pgn[pgnCount++] = PGN_ISO_TP_DT;
+  }
+
+  for (size_t i = 0; i < CB_MAX(pgnCount, 1); i++)
+  {
+    for (size_t j = 0; j < CB_MAX(filterSrcCount, 1); j++)
+    {
+      canid_t id   = CAN_EFF_FLAG;
+      canid_t mask = CAN_EFF_FLAG | CAN_RTR_FLAG;
+
+      if (pgnCount > 0)
+      {
+        id |= pgn[i] << 8;
+        mask |= isPdu1(pgn[i]) ? CAN_ID_PDU1_PGN_MASK : CAN_ID_PDU2_PGN_MASK;
+      }
+      if (filterSrcCount > 0)
+      {
+        id |= filterSrc[j];
+        mask |= CAN_ID_SRC_MASK;
+      }
+      filter[n].can_id   = id;
+      filter[n].can_mask = mask;
+      n++;
+    }
+  }
+
+  /* The address claim state machine must see claims and requests from
+   * every node, whatever the user selected. */
+  if (bus->claimState != CLAIM_DISABLED)
+  {
+    for (size_t i = 0; i < ARRAY_SIZE(rxPgnList); i++)
+    {
+      filter[n].can_id   = CAN_EFF_FLAG | (rxPgnList[i] << 8);
+      filter[n].can_mask = CAN_EFF_FLAG | CAN_RTR_FLAG | (isPdu1(rxPgnList[i]) ? CAN_ID_PDU1_PGN_MASK : CAN_ID_PDU2_PGN_MASK);
+      n++;
+    }
+  }
+
+  if (setsockopt(bus->sock, SOL_CAN_RAW, CAN_RAW_FILTER, filter, n * sizeof(filter[0])) < 0)
+  {
+    logError("CAN_RAW_FILTER: %s\n", strerror(errno));
+    return false;
+  }
+  logDebug("Installed %zu CAN receive filters\n", n);
+  return true;
+}
+
+/*
+ * True when -pgn / -src exclude this message from the output. Only the
+ * address claim PGNs get past the kernel filter without being selected.
+ */
+static bool isFiltered(uint32_t pgn, uint8_t src)
+{
+  bool pgnOk = filterPgnCount == 0;
+  bool srcOk = filterSrcCount == 0;
+
+  for (size_t i = 0; i < filterPgnCount && !pgnOk; i++)
+  {
+    pgnOk = filterPgn[i] == pgn;
+  }
+  for (size_t i = 0; i < filterSrcCount && !srcOk; i++)
+  {
+    srcOk = filterSrc[i] == src;
+  }
+  return !pgnOk || !srcOk;
+}
+
+/*
+ * Kernel timestamp of a received frame in us, or 0 when it has none.
+ */
+static uint64_t rxTimestamp(struct msghdr *msg)
+{
+  struct cmsghdr *cmsg;
+
+  for (cmsg = CMSG_FIRSTHDR(msg); cmsg != NULL; cmsg = CMSG_NXTHDR(msg, cmsg))
+  {
+    if (cmsg->cmsg_level != SOL_SOCKET)
+    {
+      continue;
+    }
+    if (cmsg->cmsg_type == SCM_TIMESTAMP)
+    {
+      struct timeval tv;
+      memcpy(&tv, CMSG_DATA(cmsg), sizeof(tv));
+      return (uint64_t) tv.tv_sec * 1000000 + (uint64_t) tv.tv_usec;
+    }
+    if (cmsg->cmsg_type == SCM_TIMESTAMPNS)
+    {
+      struct timespec ts;
+      memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+      return timespecUs(&ts);
+    }
+    if (cmsg->cmsg_type == SCM_TIMESTAMPING)
+    {
+      struct timespec ts[3];
+      memcpy(ts, CMSG_DATA(cmsg), sizeof(ts));
+      return rxTimestampingUs(ts);
+    }
+  }
+  return 0;
+}
+
+/* Point the first `want` receive headers at their frame and, if asked, their ancillary data. */
+static void rxSetup(unsigned int want, bool withControl)
+{
+  for (unsigned int i = 0; i < want; i++)
+  {
+    rxIov[i].iov_base                = &rxFrames[i];
+    rxIov[i].iov_len                 = sizeof(rxFrames[i]);
+    rxMsgs[i].msg_hdr.msg_name       = NULL;
+    rxMsgs[i].msg_hdr.msg_namelen    = 0;
+    rxMsgs[i].msg_hdr.msg_iov        = &rxIov[i];
+    rxMsgs[i].msg_hdr.msg_iovlen     = 1;
+    rxMsgs[i].msg_hdr.msg_control    = withControl ? rxControl[i] : NULL;
+    rxMsgs[i].msg_hdr.msg_controllen = withControl ? sizeof(rxControl[i]) : 0;
+    rxMsgs[i].msg_hdr.msg_flags      = 0;
+  }
+}
+
+/*
+ * Drain all currently-readable CAN frames. recvmmsg() fetches up to
+ * rxBatch frames per syscall, each with its own SO_TIMESTAMP ancillary
+ * data, so a saturated bus costs one syscall per batch instead of one
+ * per frame. Returns 0 once the socket is drained, 1 when the budget ran
+ * out first and -1 on error.
+ */
+static int readCan(CanBus *bus)
+{
+  /* Drain at most RX_BUDGET frames per call, then yield to the main loop
+   * so the address-claim timers keep advancing on a busy bus. */
+  int budget = RX_BUDGET;
+  while (budget > 0)
+  {
+    unsigned int want = (unsigned int) CB_MIN(rxBatch, budget);
+    int          n;
+
+    rxSetup(want, true);
+    n = recvmmsg(bus->sock, rxMsgs, want, MSG_DONTWAIT, NULL);
+    if (n < 0)
+    {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+      {
+        return 0;
+      }
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      logError("recvmmsg: %s\n", strerror(errno));
+      return -1;
+    }
+    budget -= n;
+
+    uint64_t now = 0;
+    for (int i = 0; i < n; i++)
+    {
+      struct can_frame *frame = &rxFrames[i];
+      uint64_t          when;
+
+      if (rxMsgs[i].msg_len < sizeof(struct can_frame))
+      {
+        continue;
+      }
+      if ((frame->can_id & CAN_ERR_FLAG) != 0)
+      {
+        continue; /* error frame, not a real message */
+      }
+      if ((frame->can_id & CAN_EFF_FLAG) == 0)
+      {
+        continue; /* CAN 1.0 / 2.0A standard (11-bit) frame, not NMEA 2000 */
+      }
+
+      when = rxTimestamp(&rxMsgs[i].msg_hdr);
+      if (when == 0)
+      {
+        if (now == 0)
+        {
+          now = getNowUs();
+        }
+        when = now;
+      }
+
+      handleFrame(bus, frame->can_id & CAN_EFF_MASK, frame->data, frame->can_dlc, when);
+    }
+
+    if ((unsigned int) n < want)
+    {
+      return 0; /* socket drained */
+    }
+  }
+  return 1; /* budget used up, more frames may be waiting */
+}
+
+/*
+ * Account the frames of the unfiltered socket, see openUtilSocket(). Same
+ * budget and return value as readCan().
+ */
+static int readUtil(CanBus *bus)
+{
+  int budget = RX_BUDGET;
+
+  while (budget > 0)
+  {
+    unsigned int want = (unsigned int) CB_MIN(rxBatch, budget);
+    int          n;
+
+    rxSetup(want, false);
+    n = recvmmsg(bus->utilSock, rxMsgs, want, MSG_DONTWAIT, NULL);
+    if (n < 0)
+    {
+      if (errno == EAGAIN || errno == EWOULDBLOCK)
+      {
+        return 0;
+      }
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      logError("recvmmsg: %s\n", strerror(errno));
+      return -1;
+    }
+    budget -= n;
+
+    for (int i = 0; i < n; i++)
+    {
+      const struct can_frame *frame = &rxFrames[i];
+      unsigned int            prio, pgn, src, dst;
+
+      if (rxMsgs[i].msg_len < sizeof(struct can_frame) || (frame->can_id & (CAN_ERR_FLAG | CAN_EFF_FLAG)) != CAN_EFF_FLAG)
+      {
+        continue;
+      }
+      getISO11783BitsFromCanId(frame->can_id & CAN_EFF_MASK, &prio, &pgn, &src, &dst);
+      bus->seenAddr[src & 0xff] = true;
+      utilAccount(bus, pgn, (uint8_t) src, frame->can_dlc);
+    }
+
+    if ((unsigned int) n < want)
+    {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void handleFrame(CanBus *bus, uint32_t canId, const uint8_t *data, uint8_t len, uint64_t whenUs)
+{
+  unsigned int prio, pgn, src, dst;
+  FastPacket  *fp;
+  uint8_t      idx, seq, bucket, offset, size;
+  uint32_t     bit, needed;
+
+  getISO11783BitsFromCanId(canId, &prio, &pgn, &src, &dst);
+
+  /* Remember every source we hear from, for the network-status device
+   * count (independent of the address-claim table, which undercounts).
+   * Behind a -pgn / -src filter readUtil() does this for every frame. */
+  if (bus->utilSock < 0)
+  {
+    bus->seenAddr[src & 0xff] = true;
+    utilAccount(bus, pgn, (uint8_t) src, len);
+  }
+
+  /* Act on the single-frame messages that drive the address-claim
+   * protocol, but still emit them to stdout like any other frame. */
+  if (bus->claimState != CLAIM_DISABLED)
+  {
+    if (pgn == PGN_ISO_ADDRESS_CLAIM)
+    {
+      handleAddressClaim(bus, (uint8_t) src, data, len);
+    }
+    else if (pgn == PGN_ISO_REQUEST)
+    {
+      handleIsoRequest(bus, (uint8_t) src, (uint8_t) dst, data, len);
+    }
+  }
+
+  /* Forward the frame as received; a fast packet is repeated frame by
+   * frame, so there is no need to wait for the reassembly. */
+  if (forward && busCount > 1)
+  {
+    forwardFrame(bus, canId, pgn, data, len);
+  }
+
+  if (isoTpEnabled && pgn == PGN_ISO_TP_CM)
+  {
+    handleIsoTpCm(bus, (uint8_t) prio, (uint8_t) src, (uint8_t) dst, data, len, whenUs);
+    return;
+  }
+  if (isoTpEnabled && pgn == PGN_ISO_TP_DT)
+  {
+    handleIsoTpDt(bus, (uint8_t) src, (uint8_t) dst, data, len, whenUs);
+    return;
+  }
+
+  if (!isFastPacket(pgn))
+  {
+    if (!writeonly && !isFiltered(pgn, (uint8_t) src))
+    {
+      emitMessage(bus, whenUs, (uint8_t) prio, pgn, (uint8_t) src, (uint8_t) dst, data, len);
+    }
+    return;
+  }
+
+  /* Fast packet: frame[0] = (seq << 5) | index, frame 0 also has the
+   * total size in frame[1] and 6 payload bytes; later frames carry 7. */
+  if (len < 1)
+  {
+    return;
+  }
+  idx = data[FASTPACKET_INDEX] & FASTPACKET_MAX_INDEX;
+  seq = data[FASTPACKET_INDEX] >> 5;
+  if (idx == 0 && len < 2)
+  {
+    return;
+  }
+  bit = UINT32_C(1) << idx;
+
+  fp = fastPacketFind(bus, pgn, (uint8_t) src, seq);
+  if (fp != NULL && whenUs > fp->when + FASTPACKET_TIMEOUT_US)
+  {
+    fastPacketRelease(bus, fp, true);
+    fp = NULL;
+  }
+  if (fp != NULL && ((fp->frames & bit) != 0 || (!fastPacketAnyOrder && fp->frames != bit - 1)))
+  {
+    /* A frame we already have starts the next packet with this sequence
+     * number; a gap means a frame was lost. Either way this one is gone. */
+    logDebug("Fast-packet pgn %u src %u seq %u: frame %u after frames %x, dropping\n", pgn, src, seq, idx, fp->frames);
+    fastPacketRelease(bus, fp, true);
+    fp = NULL;
+  }
+  if (fp != NULL && idx == 0)
+  {
+    /* Held frames that the declared size would complete at once are the
+     * body of an earlier packet that lost its frame 0 (see the analyzer). */
+    size   = (uint8_t) CB_MIN(data[FASTPACKET_SIZE], FASTPACKET_MAX_SIZE);
+    needed = (uint32_t) ((UINT64_C(1) << (1 + size / FASTPACKET_BUCKET_N_SIZE)) - 1);
+    if (needed != 1 && ((fp->frames | 1) & needed) == needed)
+    {
+      fastPacketRelease(bus, fp, true);
+      fp = NULL;
     }
-    if ((frame.can_id & CAN_ERR_FLAG) != 0)
+  }
+  if (fp == NULL)
+  {
+    if (idx != 0 && !fastPacketAnyOrder)
+    {
+      logDebug("Fast-packet continuation without start, pgn %u src %u idx %u\n", pgn, src, idx);
+      return;
+    }
+    fp = fastPacketAlloc(bus, pgn, (uint8_t) src, seq, whenUs);
+  }
+
+  if (idx == 0)
+  {
+    fp->size      = (uint8_t) CB_MIN(data[FASTPACKET_SIZE], FASTPACKET_MAX_SIZE);
+    fp->allFrames = (uint32_t) ((UINT64_C(1) << (1 + fp->size / FASTPACKET_BUCKET_N_SIZE)) - 1);
+    offset        = 0;
+    bucket        = (uint8_t) CB_MIN(FASTPACKET_BUCKET_0_SIZE, len - FASTPACKET_BUCKET_0_OFFSET);
+    memcpy(fp->data, data + FASTPACKET_BUCKET_0_OFFSET, bucket);
+  }
+  else
+  {
+    offset = (uint8_t) (FASTPACKET_BUCKET_0_SIZE + (idx - 1) * FASTPACKET_BUCKET_N_SIZE);
+    bucket = (uint8_t) CB_MIN(FASTPACKET_BUCKET_N_SIZE, len - FASTPACKET_BUCKET_N_OFFSET);
+    bucket = (uint8_t) CB_MIN(bucket, FASTPACKET_MAX_SIZE - offset);
+    memcpy(fp->data + offset, data + FASTPACKET_BUCKET_N_OFFSET, bucket);
+  }
+  fp->frames |= bit;
+
+  if (fp->frames == fp->allFrames)
+  {
+    if (!writeonly && !isFiltered(pgn, (uint8_t) src))
     {
-      continue; /* error frame, not a real message */
+      emitMessage(bus, fp->when, (uint8_t) prio, pgn, (uint8_t) src, (uint8_t) dst, fp->data, fp->size);
     }
-    if ((frame.can_id & CAN_EFF_FLAG) == 0)
+    if (bus->claimState != CLAIM_DISABLED && pgn == PGN_GROUP_FUNCTION)
     {
-      continue; /* CAN 1.0 / 2.0A standard (11-bit) frame, not NMEA 2000 */
+      handleGroupFunction(bus, (uint8_t) src, (uint8_t) dst, fp->data, fp->size);
     }
+    fastPacketRelease(bus, fp, false);
+  }
+}
+
+/*
+ * Format one message in canboat FAST format and pass it on to stdout. The
+ * timestamp keeps the usual milliseconds unless sub-millisecond receive
+ * stamps were asked for with -ts, in which case it carries six fraction
+ * digits.
+ */
+static void emitMessage(const CanBus *bus, uint64_t whenUs, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t dst, const uint8_t *data, size_t len)
+{
+  char  line[64 + 3 * MAX_PGN_SIZE];
+  char  dateStr[DATE_LENGTH];
+  char *p = line;
+  char *end = line + sizeof(line);
+
+  if (rxTimestampMode == RX_TIMESTAMP_MS)
+  {
+    fmtTimestamp(dateStr, whenUs / 1000);
+  }
+  else
+  {
+    fmtTimestampUs(dateStr, whenUs);
+  }
+  snprintf(p, end - p, "%s,%u,%u,%u,%u,%zu", dateStr, prio, pgn, src, dst, len);
+  p += strlen(p);
+  for (size_t i = 0; i < len && p < end - 4; i++)
+  {
+    snprintf(p, end - p, ",%02x", data[i]);
+    p += 3;
+  }
+
+  outputLine(bus, whenUs, line);
+}
+
+/*
+ * With a single interface a line is written straight away. With more, it
+ * is held in pendingOutput until flushOutput() can release it in timestamp
+ * order. Lines arrive nearly in that order: only a reassembled message,
+ * stamped with its first frame, goes further back, so the insertion point
+ * is searched from the end.
+ */
+static void outputLine(const CanBus *bus, uint64_t whenUs, const char *line)
+{
+  PendingLine *pl;
+  size_t       i;
+
+  if (busCount <= 1)
+  {
+    puts(line);
+    fflush(stdout);
+    return;
+  }
+  if (pendingOutputCount == MAX_PENDING_OUTPUT)
+  {
+    logDebug("Output backlog full, releasing %zu lines early\n", pendingOutputCount / 2);
+    writeOutput(pendingOutputCount / 2);
+  }
+  if (pendingOutputCount == pendingOutputAlloc)
+  {
+    pendingOutputAlloc = CB_MAX(2 * pendingOutputAlloc, 256);
+    pendingOutput      = realloc(pendingOutput, pendingOutputAlloc * sizeof(pendingOutput[0]));
+    if (pendingOutput == NULL)
+    {
+      die("Out of memory");
+    }
+  }
+  i = pendingOutputCount;
+  while (i > 0 && pendingOutput[i - 1].whenUs > whenUs)
+  {
+    i--;
+  }
+  memmove(&pendingOutput[i + 1], &pendingOutput[i], (pendingOutputCount - i) * sizeof(pendingOutput[0]));
+  pl         = &pendingOutput[i];
+  pl->whenUs = whenUs;
+  pl->bus    = bus;
+  pl->offset = sbGetLength(&pendingOutputText);
+  sbAppendString(&pendingOutputText, line);
+  sbAppendChar(&pendingOutputText, '\n');
+  pl->len = sbGetLength(&pendingOutputText) - pl->offset;
+  pendingOutputCount++;
+}
+
+/*
+ * Write the first `count` pending lines. The text of the lines still held
+ * is moved down once more than half of the buffer has been written.
+ */
+static void writeOutput(size_t count)
+{
+  const char *text = sbGet(&pendingOutputText);
+
+  if (count == 0)
+  {
+    return;
+  }
+  for (size_t i = 0; i < count; i++)
+  {
+    const PendingLine *pl = &pendingOutput[i];
+
+    if (pl->bus != lastOutputBus)
+    {
+      printf(INTERFACE_TAG_PREFIX "%s\n", pl->bus->name);
+      lastOutputBus = pl->bus;
+    }
+    fwrite(text + pl->offset, 1, pl->len, stdout);
+    pendingOutputWritten += pl->len;
+  }
+  fflush(stdout);
+  pendingOutputCount -= count;
+  memmove(&pendingOutput[0], &pendingOutput[count], pendingOutputCount * sizeof(pendingOutput[0]));
+
+  if (pendingOutputCount == 0)
+  {
+    sbEmpty(&pendingOutputText);
+    pendingOutputWritten = 0;
+  }
+  else if (pendingOutputWritten > sbGetLength(&pendingOutputText) / 2)
+  {
+    StringBuffer held = sbNew;
+
+    for (size_t i = 0; i < pendingOutputCount; i++)
+    {
+      PendingLine *pl     = &pendingOutput[i];
+      size_t       offset = sbGetLength(&held);
+
+      sbAppendData(&held, text + pl->offset, pl->len);
+      pl->offset = offset;
+    }
+    sbClean(&pendingOutputText);
+    pendingOutputText    = held;
+    pendingOutputWritten = 0;
+  }
+}
+
+/*
+ * The time before which every line has been output: the first frame of the
+ * oldest open reassembly, or OUTPUT_HOLD_US ago when that is earlier.
+ * Reassemblies that timed out are dropped first, so a lost frame cannot hold
+ * up the output for longer than the reassembly timeout. `expiryUs` is set to
+ * the earliest time at which an open reassembly times out, or UINT64_MAX.
+ */
+static uint64_t outputWatermark(uint64_t nowUs, uint64_t *expiryUs)
+{
+  uint64_t mark = nowUs - OUTPUT_HOLD_US;
+
+  *expiryUs = UINT64_MAX;
+  for (size_t b = 0; b < busCount; b++)
+  {
+    CanBus *bus = &buses[b];
+
+    fastPacketExpire(bus, nowUs);
+    for (size_t i = 0; i < bus->fastPacketsAllocated; i++)
+    {
+      const FastPacket *fp = &bus->fastPackets[i];
+
+      if (fp->used)
+      {
+        mark      = CB_MIN(mark, fp->when);
+        *expiryUs = CB_MIN(*expiryUs, fp->when + FASTPACKET_TIMEOUT_US);
+      }
+    }
+    if (!isoTpEnabled)
+    {
+      continue;
+    }
+    isoTpExpire(bus, nowUs);
+    for (size_t i = 0; i < ISO_TP_SLOTS; i++)
+    {
+      const IsoTpSession *t = &bus->isoTp[i];
+
+      if (t->used)
+      {
+        mark      = CB_MIN(mark, t->when);
+        *expiryUs = CB_MIN(*expiryUs, t->last + ISO_TP_TIMEOUT_US);
+      }
+    }
+  }
+  return mark;
+}
+
+/*
+ * Write the pending lines stamped before the watermark, or all of them.
+ */
+static void flushOutput(bool all)
+{
+  uint64_t mark;
+  uint64_t expiryUs;
+  size_t   count = 0;
+
+  if (pendingOutputCount == 0)
+  {
+    return;
+  }
+  mark = all ? UINT64_MAX : outputWatermark(getNowUs(), &expiryUs);
+  while (count < pendingOutputCount && pendingOutput[count].whenUs < mark)
+  {
+    count++;
+  }
+  writeOutput(count);
+}
+
+/*
+ * When to look at the held lines again, in ms as getNow(): once the oldest
+ * of them is OUTPUT_HOLD_US old, or, when an open reassembly is what holds
+ * it back, once that reassembly times out. 0 when nothing is held.
+ */
+static uint64_t outputDeadline(void)
+{
+  uint64_t nowUs = getNowUs();
+  uint64_t releaseUs;
+  uint64_t expiryUs;
+
+  if (pendingOutputCount == 0)
+  {
+    return 0;
+  }
+  releaseUs = pendingOutput[0].whenUs + OUTPUT_HOLD_US;
+  if (releaseUs <= nowUs)
+  {
+    outputWatermark(nowUs, &expiryUs);
+    releaseUs = CB_MAX(expiryUs, nowUs);
+    if (releaseUs == UINT64_MAX)
+    {
+      releaseUs = nowUs;
+    }
+  }
+  return releaseUs / 1000 + 1;
+}
+
+/*
+ * Repeat a received frame unchanged on the other interfaces. The network
+ * management PGNs stay on the bus they were seen on: every interface runs
+ * its own address claim, and a repeated claim or request would have the
+ * devices on one side contend with those on the other.
+ */
+static void forwardFrame(const CanBus *from, uint32_t canId, uint32_t pgn, const uint8_t *data, uint8_t len)
+{
+  bool selected = forwardPgnCount == 0;
+
+  if (pgn == PGN_ISO_ACK || pgn == PGN_ISO_REQUEST || pgn == PGN_ISO_ADDRESS_CLAIM || pgn == PGN_ISO_COMMANDED_ADDRESS)
+  {
+    return;
+  }
+  for (size_t i = 0; i < forwardPgnCount && !selected; i++)
+  {
+    selected = forwardPgn[i] == pgn;
+  }
+  if (!selected)
+  {
+    return;
+  }
+  for (size_t i = 0; i < busCount; i++)
+  {
+    if (&buses[i] != from)
+    {
+      sendCanFrame(&buses[i], canId, data, len);
+    }
+  }
+}
+
+/* PDU1 PGNs are addressed: the low byte of the PGN is the destination. */
+static bool isPdu1(uint32_t pgn)
+{
+  return ((pgn >> 8) & 0xff) < 240;
+}
+
+static bool isFastPacket(uint32_t pgn)
+{
+  if (pgn >= FASTPACKET_MIXED_START && pgn < FASTPACKET_MIXED_END)
+  {
+    return FASTPACKET_MIXED[pgn - FASTPACKET_MIXED_START];
+  }
+  if (pgn >= 0x10000 && pgn < FASTPACKET_MIXED_START)
+  {
+    return true; /* fast-packet-only range */
+  }
+  if (pgn >= CANBOAT_PGN_START)
+  {
+    return true; /* synthetic CANboat fast PGNs (not seen on the wire) */
+  }
+  return false; /* single-frame */
+}
+
+static size_t fastPacketHash(uint32_t pgn, uint8_t src, uint8_t seq)
+{
+  return (size_t) ((((pgn << 11) ^ ((uint32_t) src << 3) ^ seq) * UINT32_C(2654435761)) >> (32 - FASTPACKET_HASH_BITS));
+}
+
+static FastPacket *fastPacketFind(CanBus *bus, uint32_t pgn, uint8_t src, uint8_t seq)
+{
+  uint16_t i = bus->fastPacketBucket[fastPacketHash(pgn, src, seq)];
+
+  while (i != 0)
+  {
+    FastPacket *fp = &bus->fastPackets[i - 1];
+
+    if (fp->pgn == pgn && fp->src == src && fp->seq == seq)
+    {
+      return fp;
+    }
+    i = fp->next;
+  }
+  return NULL;
+}
+
+/*
+ * Take a slot for a new fast packet. Timed-out packets are only swept out
+ * when no slot is free, and when even that frees nothing the oldest packet
+ * makes way: new data is worth more than a packet that is probably lost.
+ */
+static FastPacket *fastPacketAlloc(CanBus *bus, uint32_t pgn, uint8_t src, uint8_t seq, uint64_t whenUs)
+{
+  FastPacket *fp;
+  uint16_t   *bucket;
+
+  if (bus->fastPacketFree == 0 && bus->fastPacketsAllocated == MAX_FASTPACKETS)
+  {
+    fastPacketExpire(bus, whenUs);
+  }
+  if (bus->fastPacketFree == 0 && bus->fastPacketsAllocated == MAX_FASTPACKETS)
+  {
+    FastPacket *oldest = &bus->fastPackets[0];
 
-    for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    for (size_t i = 1; i < MAX_FASTPACKETS; i++)
     {
-      if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SO_TIMESTAMP)
+      if (bus->fastPackets[i].when < oldest->when)
       {
-        struct timeval tv;
-        memcpy(&tv, CMSG_DATA(cmsg), sizeof(tv));
-        when = (uint64_t) tv.tv_sec * 1000 + tv.tv_usec / 1000;
+        oldest = &bus->fastPackets[i];
       }
     }
-    if (when == 0)
-    {
-      when = getNow();
-    }
+    logError("No free fast-packet slot on %s, dropping pgn %u src %u\n", bus->name, oldest->pgn, oldest->src);
+    fastPacketRelease(bus, oldest, true);
+  }
 
-    handleFrame(frame.can_id & CAN_EFF_MASK, frame.data, frame.can_dlc, when);
+  if (bus->fastPacketFree != 0)
+  {
+    fp                  = &bus->fastPackets[bus->fastPacketFree - 1];
+    bus->fastPacketFree = fp->next;
   }
-  return 0;
+  else
+  {
+    fp = &bus->fastPackets[bus->fastPacketsAllocated++];
+  }
+  bucket        = &bus->fastPacketBucket[fastPacketHash(pgn, src, seq)];
+  fp->used      = true;
+  fp->pgn       = pgn;
+  fp->src       = src;
+  fp->seq       = seq;
+  fp->size      = 0;
+  fp->frames    = 0;
+  fp->allFrames = 0;
+  fp->when      = whenUs;
+  fp->next      = *bucket;
+  *bucket       = (uint16_t) (fp - bus->fastPackets + 1);
+  return fp;
 }
 
-static void handleFrame(uint32_t canId, const uint8_t *data, uint8_t len, uint64_t when)
+/* Unlink a slot from its hash chain and free it; a dropped packet is counted against its source. */
+static void fastPacketRelease(CanBus *bus, FastPacket *fp, bool dropped)
 {
-  unsigned int prio, pgn, src, dst;
-  int          slot;
-  FastPacket  *fp;
-  uint8_t      idx, seq, bucket, offset;
+  uint16_t  self = (uint16_t) (fp - bus->fastPackets + 1);
+  uint16_t *link = &bus->fastPacketBucket[fastPacketHash(fp->pgn, fp->src, fp->seq)];
 
-  getISO11783BitsFromCanId(canId, &prio, &pgn, &src, &dst);
+  while (*link != self)
+  {
+    link = &bus->fastPackets[*link - 1].next;
+  }
+  *link               = fp->next;
+  fp->used            = false;
+  fp->next            = bus->fastPacketFree;
+  bus->fastPacketFree = self;
 
-  /* Remember every source we hear from, for the network-status device
-   * count (independent of the address-claim table, which undercounts). */
-  seenAddr[src & 0xff] = true;
+  if (dropped)
+  {
+    logDebug("Incomplete fast packet pgn %u src %u on %s, frames %x of %x\n", fp->pgn, fp->src, bus->name, fp->frames, fp->allFrames);
+    bus->rxDrops[fp->src]++;
+  }
+}
 
-  /* Act on the single-frame messages that drive the address-claim
-   * protocol, but still emit them to stdout like any other frame. */
-  if (claimState != CLAIM_DISABLED)
+static void fastPacketExpire(CanBus *bus, uint64_t nowUs)
+{
+  for (size_t i = 0; i < bus->fastPacketsAllocated; i++)
   {
-    if (pgn == PGN_ISO_ADDRESS_CLAIM)
-    {
-      handleAddressClaim(0 /* uses claimSock */, (uint8_t) src, data, len);
-    }
-    else if (pgn == PGN_ISO_REQUEST)
+    FastPacket *fp = &bus->fastPackets[i];
+
+    if (fp->used && nowUs > fp->when + FASTPACKET_TIMEOUT_US)
     {
-      handleIsoRequest((uint8_t) src, (uint8_t) dst, data, len);
+      fastPacketRelease(bus, fp, true);
     }
   }
+}
 
-  if (!isFastPacket(pgn))
+static IsoTpSession *isoTpFind(CanBus *bus, uint8_t src, uint8_t dst)
+{
+  for (size_t i = 0; i < ISO_TP_SLOTS; i++)
   {
-    if (!writeonly)
+    IsoTpSession *t = &bus->isoTp[i];
+
+    if (t->used && t->src == src && t->dst == dst)
     {
-      emitMessage(when, (uint8_t) prio, pgn, (uint8_t) src, (uint8_t) dst, data, len);
+      return t;
     }
-    return;
   }
+  return NULL;
+}
 
-  /* Fast packet: frame[0] = (seq << 5) | index, frame 0 also has the
-   * total size in frame[1] and 6 payload bytes; later frames carry 7. */
-  if (len < 1)
+static void isoTpRelease(CanBus *bus, IsoTpSession *t, bool dropped)
+{
+  t->used = false;
+  if (dropped)
   {
-    return;
+    logDebug("Incomplete ISO TP transfer of pgn %u from %u to %u on %s\n", t->pgn, t->src, t->dst, bus->name);
+    bus->rxDrops[t->src]++;
   }
-  idx = data[FASTPACKET_INDEX] & FASTPACKET_MAX_INDEX;
-  seq = data[FASTPACKET_INDEX] >> 5;
+}
 
-  /* Find an existing reassembly for this PGN+source. */
-  slot = -1;
-  for (int i = 0; i < MAX_FASTPACKETS; i++)
+static void isoTpExpire(CanBus *bus, uint64_t nowUs)
+{
+  for (size_t i = 0; i < ISO_TP_SLOTS; i++)
   {
-    if (fastPackets[i].used && fastPackets[i].pgn == pgn && fastPackets[i].src == src)
+    IsoTpSession *t = &bus->isoTp[i];
+
+    if (t->used && nowUs > t->last + ISO_TP_TIMEOUT_US)
     {
-      slot = i;
-      break;
+      isoTpRelease(bus, t, true);
     }
   }
+}
 
-  if (idx == 0)
+/*
+ * A TP.CM frame. BAM and RTS open a transfer, restarting any that the
+ * sender had open to the same destination; an abort from either side ends
+ * it. CTS and the end of message ACK are the receiver's part of an RTS/CTS
+ * transfer, which we only follow passively, so those are ignored.
+ */
+static void handleIsoTpCm(CanBus *bus, uint8_t prio, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len, uint64_t whenUs)
+{
+  IsoTpSession *t;
+  size_t        size;
+  uint8_t       packets;
+
+  if (len == 0)
   {
-    if (len < 2)
-    {
-      return;
-    }
-    if (slot < 0)
-    {
-      for (int i = 0; i < MAX_FASTPACKETS; i++)
-      {
-        if (!fastPackets[i].used)
-        {
-          slot = i;
-          break;
-        }
-      }
-    }
-    if (slot < 0)
-    {
-      logError("No free fast-packet slot, dropping pgn %u src %u\n", pgn, src);
-      return;
-    }
-    fp          = &fastPackets[slot];
-    fp->used    = true;
-    fp->pgn     = pgn;
-    fp->src     = (uint8_t) src;
-    fp->seq     = seq;
-    fp->size    = data[FASTPACKET_SIZE];
-    fp->when    = when;
-    fp->nextIdx = 1;
-    bucket      = (uint8_t) CB_MIN(FASTPACKET_BUCKET_0_SIZE, len - FASTPACKET_BUCKET_0_OFFSET);
-    bucket      = (uint8_t) CB_MIN(bucket, fp->size);
-    memcpy(fp->data, data + FASTPACKET_BUCKET_0_OFFSET, bucket);
-    fp->fill = bucket;
+    return;
   }
-  else
+  if (data[0] == ISO_TP_CM_ABORT)
   {
-    if (slot < 0)
-    {
-      logDebug("Fast-packet continuation without start, pgn %u src %u idx %u\n", pgn, src, idx);
-      return;
-    }
-    fp = &fastPackets[slot];
-    if (seq != fp->seq || idx != fp->nextIdx)
-    {
-      logDebug("Fast-packet out of order pgn %u src %u: got seq %u idx %u, want seq %u idx %u\n",
-               pgn,
-               src,
-               seq,
-               idx,
-               fp->seq,
-               fp->nextIdx);
-      fp->used = false; /* give up on this one */
-      return;
-    }
-    offset = (uint8_t) (FASTPACKET_BUCKET_0_SIZE + (idx - 1) * FASTPACKET_BUCKET_N_SIZE);
-    bucket = (uint8_t) CB_MIN(FASTPACKET_BUCKET_N_SIZE, len - FASTPACKET_BUCKET_N_OFFSET);
-    bucket = (uint8_t) CB_MIN(bucket, fp->size - fp->fill);
-    if (offset + bucket > FASTPACKET_MAX_SIZE)
+    if ((t = isoTpFind(bus, src, dst)) != NULL || (t = isoTpFind(bus, dst, src)) != NULL)
     {
-      fp->used = false;
-      return;
+      isoTpRelease(bus, t, true);
     }
-    memcpy(fp->data + offset, data + FASTPACKET_BUCKET_N_OFFSET, bucket);
-    fp->fill += bucket;
-    fp->nextIdx++;
+    return;
+  }
+  if (data[0] != ISO_TP_CM_BAM && data[0] != ISO_TP_CM_RTS)
+  {
+    return;
+  }
+  if (len < 8)
+  {
+    logError("ISO TP CM frame from source %u has %u bytes (need 8); ignoring\n", src, len);
+    return;
   }
 
-  if (fp->fill >= fp->size)
+  size    = (size_t) data[1] | ((size_t) data[2] << 8);
+  packets = data[3];
+  if (packets == 0 || size == 0 || size > ISOTP_MAX_SIZE || size > (size_t) packets * FASTPACKET_BUCKET_N_SIZE)
   {
-    if (!writeonly)
-    {
-      emitMessage(fp->when, (uint8_t) prio, pgn, (uint8_t) src, (uint8_t) dst, fp->data, fp->size);
-    }
-    if (claimState != CLAIM_DISABLED && pgn == PGN_GROUP_FUNCTION)
+    logError("ISO TP CM frame from source %u declares implausible size=%zu packets=%u; ignoring\n", src, size, packets);
+    return;
+  }
+
+  t = isoTpFind(bus, src, dst);
+  if (t != NULL)
+  {
+    isoTpRelease(bus, t, true);
+  }
+  else
+  {
+    isoTpExpire(bus, whenUs);
+  }
+  for (size_t i = 0; i < ISO_TP_SLOTS && t == NULL; i++)
+  {
+    if (!bus->isoTp[i].used)
     {
-      handleGroupFunction((uint8_t) src, (uint8_t) dst, fp->data, fp->size);
+      t = &bus->isoTp[i];
     }
-    fp->used = false;
   }
+  if (t == NULL)
+  {
+    logError("No free ISO TP slot on %s, dropping transfer from source %u\n", bus->name, src);
+    bus->rxDrops[src]++;
+    return;
+  }
+
+  t->used    = true;
+  t->src     = src;
+  t->dst     = dst;
+  t->prio    = prio;
+  t->packets = packets;
+  t->pgn     = (uint32_t) data[5] | ((uint32_t) data[6] << 8) | ((uint32_t) data[7] << 16);
+  t->size    = size;
+  t->when    = whenUs;
+  t->last    = whenUs;
+  memset(t->received, 0, sizeof(t->received));
+  memset(t->data, 0xff, size);
 }
 
-static void emitMessage(uint64_t when, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len)
+/*
+ * A TP.DT frame: seven bytes at offset (sequence - 1) * 7. The message is
+ * output, timestamped with its TP.CM, once every sequence number is in;
+ * an RTS/CTS retransmission simply overwrites what it repeats.
+ */
+static void handleIsoTpDt(CanBus *bus, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len, uint64_t whenUs)
 {
-  char  line[800];
-  char  dateStr[DATE_LENGTH];
-  char *p = line;
-  char *end = line + sizeof(line);
+  IsoTpSession *t = isoTpFind(bus, src, dst);
+  size_t        seq, offset, chunk;
 
-  snprintf(p, end - p, "%s,%u,%u,%u,%u,%u", fmtTimestamp(dateStr, when), prio, pgn, src, dst, len);
-  p += strlen(p);
-  for (uint8_t i = 0; i < len && p < end - 4; i++)
+  if (t == NULL || len < 1)
   {
-    snprintf(p, end - p, ",%02x", data[i]);
-    p += 3;
+    return; /* we missed the TP.CM */
+  }
+  if (whenUs > t->last + ISO_TP_TIMEOUT_US)
+  {
+    isoTpRelease(bus, t, true);
+    return;
+  }
+  t->last = whenUs;
+  if (data[0] == 0 || data[0] > t->packets)
+  {
+    logDebug("ISO TP DT frame from source %u has sequence %u out of range 1..%u; ignoring\n", src, data[0], t->packets);
+    return;
   }
 
-  puts(line);
-  fflush(stdout);
-}
-
-static bool isFastPacket(uint32_t pgn)
-{
-  if (pgn >= FASTPACKET_MIXED_START && pgn < FASTPACKET_MIXED_END)
+  seq    = (size_t) data[0] - 1;
+  offset = seq * FASTPACKET_BUCKET_N_SIZE;
+  chunk  = CB_MIN((size_t) FASTPACKET_BUCKET_N_SIZE, (size_t) len - 1);
+  if (offset < t->size)
   {
-    return FASTPACKET_MIXED[pgn - FASTPACKET_MIXED_START];
+    memcpy(t->data + offset, data + 1, CB_MIN(chunk, t->size - offset));
   }
-  if (pgn >= 0x10000 && pgn < FASTPACKET_MIXED_START)
+  t->received[seq / 32] |= UINT32_C(1) << (seq % 32);
+
+  for (size_t i = 0; i < t->packets; i++)
   {
-    return true; /* fast-packet-only range */
+    if ((t->received[i / 32] & (UINT32_C(1) << (i % 32))) == 0)
+    {
+      return;
+    }
   }
-  if (pgn >= CANBOAT_PGN_START)
+  if (!writeonly && !isFiltered(t->pgn, src))
   {
-    return true; /* synthetic CANboat fast PGNs (not seen on the wire) */
+    emitMessage(bus, t->when, t->prio, t->pgn, src, t->dst, t->data, t->size);
   }
-  return false; /* single-frame */
+  isoTpRelease(bus, t, false);
 }
 
 /*
  * Parse a canboat format line from stdin and transmit it as one or more
  * CAN frames. The source address is forced to our claimed address.
+ * A "# interface=<name>" line sends what follows to that interface only;
+ * until the first one, every message goes to all interfaces.
  */
-static void parseAndWriteIn(int sock, const char *cmd)
+static void parseAndWriteIn(const char *cmd)
 {
-  RawMessage m;
-  char       copy[MAX_MSG_LINE_LENGTH];
+  static bool    toAll = true;
+  static CanBus *to    = NULL;
+  RawMessage     m;
+  char           copy[MAX_MSG_LINE_LENGTH];
 
+  if (cmd != NULL && strncmp(cmd, INTERFACE_TAG_PREFIX, strlen(INTERFACE_TAG_PREFIX)) == 0)
+  {
+    const char *name = cmd + strlen(INTERFACE_TAG_PREFIX);
+    size_t      len  = strcspn(name, "\r\n");
+
+    toAll = false;
+    to    = NULL;
+    for (size_t i = 0; i < busCount; i++)
+    {
+      if (strlen(buses[i].name) == len && strncmp(buses[i].name, name, len) == 0)
+      {
+        to = &buses[i];
+      }
+    }
+    if (to == NULL)
+    {
+      logError("Unknown interface '%.*s', ignoring its messages\n", (int) len, name);
+    }
+    return;
+  }
   if (!cmd || !*cmd || *cmd == '\n' || *cmd == '#')
   {
     return;
@@ -882,14 +2336,20 @@ static void parseAndWriteIn(int sock, const char *cmd)
     return;
   }
 
-  sendN2k(sock, m.prio, m.pgn, (uint8_t) address, m.dst, m.data, m.len, false);
+  for (size_t i = 0; i < busCount; i++)
+  {
+    if (toAll || to == &buses[i])
+    {
+      sendN2k(&buses[i], m.prio, m.pgn, (uint8_t) buses[i].address, m.dst, m.data, m.len, false);
+    }
+  }
 }
 
 /*
  * Send an NMEA 2000 message, splitting into a fast packet when needed.
  * (Same wire layout as socketcan-writer.c.)
  */
-static void sendN2k(int sock, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t dst, const uint8_t *data, size_t len, bool echo)
+static void sendN2k(CanBus *bus, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t dst, const uint8_t *data, size_t len, bool echo)
 {
   uint32_t canId = getCanIdFromISO11783Bits(prio, pgn, src, dst);
 
@@ -897,7 +2357,7 @@ static void sendN2k(int sock, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t d
    * fast-framed even when short, since receivers key on the PGN type. */
   if (len <= 8 && !isFastPacket(pgn))
   {
-    sendCanFrame(sock, canId, data, (uint8_t) len);
+    sendCanFrame(bus, canId, data, (uint8_t) len);
   }
   else
   {
@@ -909,7 +2369,7 @@ static void sendN2k(int sock, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t d
      * `(seq << 5) | index`, with `seq` incrementing per-canId per
      * instance so consecutive first frames are distinguishable from
      * continuations. */
-    uint8_t seq = getNextFastSeq(canId);
+    uint8_t seq = getNextFastSeq(bus, canId);
 
     while (remaining > 0)
     {
@@ -927,7 +2387,7 @@ static void sendN2k(int sock, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t d
         chunk = CB_MIN(FASTPACKET_BUCKET_N_SIZE, remaining);
         memcpy(frame + FASTPACKET_BUCKET_N_OFFSET, data + (len - remaining), chunk);
       }
-      sendCanFrame(sock, canId, frame, (uint8_t) sizeof(frame));
+      sendCanFrame(bus, canId, frame, (uint8_t) sizeof(frame));
       remaining -= chunk;
       index++;
     }
@@ -938,118 +2398,146 @@ static void sendN2k(int sock, uint8_t prio, uint32_t pgn, uint8_t src, uint8_t d
    * bridge passes echo=false; its -p passthru handles echoing instead. */
   if (echo && !writeonly)
   {
-    emitMessage(getNow(), prio, pgn, src, dst, data, (uint8_t) len);
+    emitMessage(bus, getNowUs(), prio, pgn, src, dst, data, (uint8_t) len);
   }
 }
 
 /*
  * Enqueue a CAN frame for asynchronous transmission. The main loop drains
- * the buffer one frame at a time when select() reports POLLOUT on the CAN
- * socket. We never write() inline because the netdev qdisc is shallow
+ * the buffer when epoll reports the CAN socket writable, and after every
+ * iteration that queued something. We never write() inline because the netdev qdisc is shallow
  * (txqueuelen often 10) and a single fast-packet PGN can easily exceed
  * it — a blocking retry loop would stall RX and the claim timers for
  * tens to hundreds of milliseconds per burst.
  */
-static void sendCanFrame(int sock, uint32_t canId, const uint8_t *data, uint8_t len)
+static void sendCanFrame(CanBus *bus, uint32_t canId, const uint8_t *data, uint8_t len)
 {
-  (void) sock; /* the socket is drained by the main loop, not used here */
-  if (txCount == TX_BUFFER_CAPACITY)
+  unsigned int prio = (canId >> 26) & 0x07;
+  TxQueue     *q    = &bus->txQueue[prio < txUrgentPriority ? TX_QUEUE_URGENT : TX_QUEUE_NORMAL];
+
+  if (q->count == TX_BUFFER_CAPACITY)
   {
     /* Rate-limit the warning so a sustained overrun doesn't flood stderr. */
-    if (txOverflowed == 0)
+    if (bus->txOverflowed == 0)
     {
-      logError("CAN TX buffer full (%d frames), dropping outbound frame\n", TX_BUFFER_CAPACITY);
+      logError("CAN TX buffer of %s full (%d frames), dropping outbound frame\n", bus->name, TX_BUFFER_CAPACITY);
     }
-    txOverflowed++;
+    bus->txOverflowed++;
     return;
   }
-  struct can_frame *slot = &txBuffer[txTail];
+  struct can_frame *slot = &q->frames[q->tail];
   memset(slot, 0, sizeof(*slot));
   slot->can_id  = canId | CAN_EFF_FLAG;
   slot->can_dlc = len;
   memcpy(slot->data, data, len);
-  txTail = (txTail + 1) % TX_BUFFER_CAPACITY;
-  txCount++;
+  q->tail = (q->tail + 1) % TX_BUFFER_CAPACITY;
+  q->count++;
+  bus->txCount++;
 }
 
 /*
- * Drain one frame from the TX buffer if the kernel has room. Returns true
- * iff a frame was actually written; false on empty buffer or backpressure.
+ * Write frames from the TX queues until they are empty or the kernel
+ * pushes back, the urgent queue first. Each sendmmsg() takes up to
+ * TX_BATCH frames, so a fast-packet burst costs one system call instead of
+ * one per frame. EAGAIN is followed by an EPOLLOUT edge on the socket;
+ * ENOBUFS (a full qdisc) is not, so that arms the retry timer.
  */
-static bool txDrainOne(int sock)
+static void txDrain(CanBus *bus)
 {
-  if (txCount == 0)
-  {
-    return false;
-  }
-  const struct can_frame *f = &txBuffer[txHead];
-  ssize_t                 n = write(sock, f, sizeof(*f));
-  if (n == (ssize_t) sizeof(*f))
+  while (bus->txCount > 0)
   {
-    txHead = (txHead + 1) % TX_BUFFER_CAPACITY;
-    txCount--;
-    if (txOverflowed > 0 && txCount < TX_BUFFER_CAPACITY / 2)
+    TxQueue     *q    = &bus->txQueue[bus->txQueue[TX_QUEUE_URGENT].count > 0 ? TX_QUEUE_URGENT : TX_QUEUE_NORMAL];
+    unsigned int want = (unsigned int) CB_MIN(q->count, TX_BATCH);
+    int          n;
+
+    for (unsigned int i = 0; i < want; i++)
     {
-      logInfo("CAN TX buffer recovered (%zu frames had been dropped)\n", txOverflowed);
-      txOverflowed = 0;
+      txIov[i].iov_base = &q->frames[(q->head + i) % TX_BUFFER_CAPACITY];
+      txIov[i].iov_len  = sizeof(struct can_frame);
+      memset(&txMsgs[i].msg_hdr, 0, sizeof(txMsgs[i].msg_hdr));
+      txMsgs[i].msg_hdr.msg_iov    = &txIov[i];
+      txMsgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    /* A partial batch means the next frame met backpressure or an error;
+     * the next round reports which. */
+    n = sendmmsg(bus->sock, txMsgs, want, MSG_DONTWAIT);
+    if (n < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS))
+    {
+      /* Backpressure — leave the frames queued. */
+      if (errno == ENOBUFS)
+      {
+        timerSet(&bus->txRetryTimer, getNow() + TX_RETRY_MS);
+      }
+      return;
+    }
+    if (n < 0)
+    {
+      /* Hard error — drop the frame so the queue can't get stuck. */
+      logError("write to CAN: %s (dropping frame)\n", strerror(errno));
+      n = 1;
+    }
+    else if (bus->utilSock < 0)
+    {
+      /* Our own frames take bus time too, but the socket does not see them. */
+      for (int i = 0; i < n; i++)
+      {
+        const struct can_frame *f = &q->frames[(q->head + (size_t) i) % TX_BUFFER_CAPACITY];
+        unsigned int            prio, pgn, src, dst;
+
+        getISO11783BitsFromCanId(f->can_id & CAN_EFF_MASK, &prio, &pgn, &src, &dst);
+        utilAccount(bus, pgn, (uint8_t) src, f->can_dlc);
+      }
+    }
+    q->head = (q->head + (size_t) n) % TX_BUFFER_CAPACITY;
+    q->count -= (size_t) n;
+    bus->txCount -= (size_t) n;
+    if (bus->txOverflowed > 0 && q->count < TX_BUFFER_CAPACITY / 2)
+    {
+      logInfo("CAN TX buffer of %s recovered (%zu frames had been dropped)\n", bus->name, bus->txOverflowed);
+      bus->txOverflowed = 0;
     }
-    return true;
-  }
-  if (n < 0 && (errno == EAGAIN || errno == ENOBUFS || errno == EINTR))
-  {
-    /* Backpressure — leave the frame queued; the next POLLOUT-driven
-     * wakeup or the safety-net select() timeout will retry. */
-    return false;
   }
-  /* Hard error — drop the frame so the buffer can't get stuck. */
-  logError("write to CAN: %s (dropping frame)\n", strerror(errno));
-  txHead = (txHead + 1) % TX_BUFFER_CAPACITY;
-  txCount--;
-  return false;
 }
 
-static StringBuffer inBuffer;
+static ReadBuffer inBuffer;
 
-static bool readIn(void)
+/*
+ * Read one chunk of stdin. Returns 1 when data was read, 0 on EOF and -1
+ * when stdin has nothing more for now.
+ */
+static int readIn(void)
 {
   unsigned char buf[2000];
   ssize_t       r = read(STDIN_FILENO, buf, sizeof(buf));
 
+  if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+  {
+    return -1;
+  }
   if (r <= 0)
   {
-    return false; /* EOF on stdin */
+    return 0; /* EOF on stdin */
   }
-  sbAppendData(&inBuffer, buf, r);
-  return true;
+  rbAppendData(&inBuffer, buf, r);
+  return 1;
 }
 
 static bool getInMsg(char *msg, size_t msgLen)
 {
-  char  *p = strchr(sbGet(&inBuffer), '\n');
-  size_t len;
-
-  if (!p)
-  {
-    return false;
-  }
-  len = p - sbGet(&inBuffer) + 1;
-  if (len >= msgLen)
-  {
-    len = msgLen - 1;
-  }
-  memcpy(msg, sbGet(&inBuffer), len);
-  msg[len] = 0;
-  sbDelete(&inBuffer, 0, (p - sbGet(&inBuffer)) + 1);
-  return true;
+  return rbGetLine(&inBuffer, msg, msgLen);
 }
 
 /*
  * --- ISO address claim -------------------------------------------------
  *
- * The CAN socket has the global send pointer; handleFrame() calls the
- * claim handlers with sock==0, so we keep the socket here.
+ * Every interface claims its own address with the same NAME; the claim
+ * state lives in its CanBus.
  */
-static int claimSock = -1;
 
 static uint64_t nameFromBytes(const uint8_t *data)
 {
@@ -1071,68 +2559,67 @@ static void buildDeviceName(void)
                | ((uint64_t) (arbitraryCapable ? 1 : 0) << 63);
 }
 
-static void startAddressClaim(int sock)
+static void startAddressClaim(CanBus *bus)
 {
-  claimSock     = sock;
-  claimState    = CLAIM_SCANNING;
-  claimDeadline = getNow() + ADDRESS_SCAN_TIMEOUT;
+  bus->claimState    = CLAIM_SCANNING;
+  bus->claimDeadline = getNow() + ADDRESS_SCAN_TIMEOUT;
   /* Ask every node to (re)announce its address claim so we learn which
    * addresses are taken before we pick one. Sent from the null address
    * because we have not claimed yet. */
-  sendIsoRequest(sock, N2K_ADDR_NULL, N2K_ADDR_GLOBAL, PGN_ISO_ADDRESS_CLAIM);
+  sendIsoRequest(bus, N2K_ADDR_NULL, N2K_ADDR_GLOBAL, PGN_ISO_ADDRESS_CLAIM);
   logDebug("Scanning bus %d ms before claiming (NAME 0x%016" PRIx64 ")\n", ADDRESS_SCAN_TIMEOUT, deviceName);
 }
 
-static void beginAddressClaim(int sock)
+static void beginAddressClaim(CanBus *bus)
 {
-  if (addressUsed[preferredAddress])
+  if (bus->addressUsed[preferredAddress])
   {
-    int next = pickFreeAddress();
+    int next = pickFreeAddress(bus);
     if (next < 0)
     {
       logError("No free address available; cannot claim\n");
-      address    = N2K_ADDR_NULL;
-      claimState = CLAIM_FAILED;
-      sendAddressClaim(sock, N2K_ADDR_GLOBAL);
+      bus->address    = N2K_ADDR_NULL;
+      bus->claimState = CLAIM_FAILED;
+      sendAddressClaim(bus, N2K_ADDR_GLOBAL);
       return;
     }
     logDebug("Preferred address %u is taken, using %d\n", preferredAddress, next);
-    address = (unsigned int) next;
+    bus->address = (unsigned int) next;
   }
   else
   {
-    address = preferredAddress;
+    bus->address = preferredAddress;
   }
-  claimState    = CLAIM_PENDING;
-  claimDeadline = getNow() + ADDRESS_CLAIM_TIMEOUT;
-  sendAddressClaim(sock, N2K_ADDR_GLOBAL);
-  logDebug("Claiming address %u with NAME 0x%016" PRIx64 "\n", address, deviceName);
+  bus->claimState    = CLAIM_PENDING;
+  bus->claimDeadline = getNow() + ADDRESS_CLAIM_TIMEOUT;
+  sendAddressClaim(bus, N2K_ADDR_GLOBAL);
+  logDebug("Claiming address %u with NAME 0x%016" PRIx64 "\n", bus->address, deviceName);
 }
 
-static void sendIsoRequest(int sock, uint8_t src, uint8_t dst, uint32_t pgn)
+static void sendIsoRequest(CanBus *bus, uint8_t src, uint8_t dst, uint32_t pgn)
 {
   uint8_t data[3];
   data[0] = (uint8_t) pgn;
   data[1] = (uint8_t) (pgn >> 8);
   data[2] = (uint8_t) (pgn >> 16);
-  sendN2k(sock, 6, PGN_ISO_REQUEST, src, dst, data, sizeof(data), true);
+  sendN2k(bus, 6, PGN_ISO_REQUEST, src, dst, data, sizeof(data), true);
 }
 
-static void sendAddressClaim(int sock, uint8_t dst)
+static void sendAddressClaim(CanBus *bus, uint8_t dst)
 {
   uint8_t data[8];
   for (int i = 0; i < 8; i++)
   {
     data[i] = (uint8_t) (deviceName >> (8 * i));
   }
-  sendN2k(sock, 6, PGN_ISO_ADDRESS_CLAIM, (uint8_t) address, dst, data, sizeof(data), true);
+  sendN2k(bus, 6, PGN_ISO_ADDRESS_CLAIM, (uint8_t) bus->address, dst, data, sizeof(data), true);
 }
 
-static int pickFreeAddress(void)
+static int pickFreeAddress(CanBus *bus)
 {
   for (int a = 0; a <= N2K_MAX_ADDR; a++)
   {
-    if (!addressUsed[a])
+    if (!bus->addressUsed[a])
     {
       return a;
     }
@@ -1140,11 +2627,10 @@ static int pickFreeAddress(void)
   return -1;
 }
 
-static void handleAddressClaim(int sock, uint8_t src, const uint8_t *data, uint8_t len)
+static void handleAddressClaim(CanBus *bus, uint8_t src, const uint8_t *data, uint8_t len)
 {
   uint64_t theirName;
 
-  (void) sock;
   if (len < 8 || src > N2K_MAX_ADDR)
   {
     return;
@@ -1152,57 +2638,57 @@ static void handleAddressClaim(int sock, uint8_t src, const uint8_t *data, uint8
   theirName = nameFromBytes(data);
 
   /* While scanning we own no address yet — just learn what is in use. */
-  if (claimState == CLAIM_SCANNING)
+  if (bus->claimState == CLAIM_SCANNING)
   {
-    addressUsed[src] = true;
+    bus->addressUsed[src] = true;
     return;
   }
 
-  if (src != address)
+  if (src != bus->address)
   {
-    addressUsed[src] = true; /* remember it so we don't pick it */
+    bus->addressUsed[src] = true; /* remember it so we don't pick it */
     return;
   }
 
   /* Someone is claiming our address. Lowest NAME wins (ISO 11783-5). */
   if (deviceName < theirName)
   {
-    logDebug("Won address %u conflict (our NAME lower), re-claiming\n", address);
-    sendAddressClaim(claimSock, N2K_ADDR_GLOBAL);
-    claimState    = CLAIM_PENDING;
-    claimDeadline = getNow() + ADDRESS_CLAIM_TIMEOUT;
+    logDebug("Won address %u conflict (our NAME lower), re-claiming\n", bus->address);
+    sendAddressClaim(bus, N2K_ADDR_GLOBAL);
+    bus->claimState    = CLAIM_PENDING;
+    bus->claimDeadline = getNow() + ADDRESS_CLAIM_TIMEOUT;
     return;
   }
 
   /* We lost. */
-  addressUsed[src] = true;
+  bus->addressUsed[src] = true;
   if (arbitraryCapable)
   {
-    int next = pickFreeAddress();
+    int next = pickFreeAddress(bus);
     if (next < 0)
     {
-      logError("Lost address %u and no free address left; cannot claim\n", address);
-      address    = N2K_ADDR_NULL;
-      claimState = CLAIM_FAILED;
-      sendAddressClaim(claimSock, N2K_ADDR_GLOBAL);
+      logError("Lost address %u and no free address left; cannot claim\n", bus->address);
+      bus->address    = N2K_ADDR_NULL;
+      bus->claimState = CLAIM_FAILED;
+      sendAddressClaim(bus, N2K_ADDR_GLOBAL);
       return;
     }
-    logDebug("Lost address %u conflict, moving to %d\n", address, next);
-    address       = (unsigned int) next;
-    claimState    = CLAIM_PENDING;
-    claimDeadline = getNow() + ADDRESS_CLAIM_TIMEOUT;
-    sendAddressClaim(claimSock, N2K_ADDR_GLOBAL);
+    logDebug("Lost address %u conflict, moving to %d\n", bus->address, next);
+    bus->address       = (unsigned int) next;
+    bus->claimState    = CLAIM_PENDING;
+    bus->claimDeadline = getNow() + ADDRESS_CLAIM_TIMEOUT;
+    sendAddressClaim(bus, N2K_ADDR_GLOBAL);
   }
   else
   {
-    logError("Lost address %u conflict and not arbitrary-address-capable; cannot claim\n", address);
-    address    = N2K_ADDR_NULL;
-    claimState = CLAIM_FAILED;
-    sendAddressClaim(claimSock, N2K_ADDR_GLOBAL);
+    logError("Lost address %u conflict and not arbitrary-address-capable; cannot claim\n", bus->address);
+    bus->address    = N2K_ADDR_NULL;
+    bus->claimState = CLAIM_FAILED;
+    sendAddressClaim(bus, N2K_ADDR_GLOBAL);
   }
 }
 
-static void handleIsoRequest(uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len)
+static void handleIsoRequest(CanBus *bus, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len)
 {
   uint32_t requested;
   bool     addressed;
@@ -1212,7 +2698,7 @@ static void handleIsoRequest(uint8_t src, uint8_t dst, const uint8_t *data, uint
     return;
   }
   requested = (uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16);
-  addressed = (dst == address);
+  addressed = (dst == bus->address);
   if (!addressed && dst != N2K_ADDR_GLOBAL)
   {
     return; /* request is for some other node */
@@ -1221,15 +2707,15 @@ static void handleIsoRequest(uint8_t src, uint8_t dst, const uint8_t *data, uint
   /* The address claim must be answerable even before we are fully claimed. */
   if (requested == PGN_ISO_ADDRESS_CLAIM)
   {
-    if (claimState == CLAIM_CLAIMED || claimState == CLAIM_PENDING)
+    if (bus->claimState == CLAIM_CLAIMED || bus->claimState == CLAIM_PENDING)
     {
-      sendAddressClaim(claimSock, N2K_ADDR_GLOBAL);
+      sendAddressClaim(bus, N2K_ADDR_GLOBAL);
     }
     return;
   }
 
   /* Everything else needs a claimed address to answer from. */
-  if (claimState != CLAIM_CLAIMED)
+  if (bus->claimState != CLAIM_CLAIMED)
   {
     return;
   }
@@ -1237,20 +2723,20 @@ static void handleIsoRequest(uint8_t src, uint8_t dst, const uint8_t *data, uint
   switch (requested)
   {
     case PGN_PRODUCT_INFO:
-      sendProductInfo(claimSock);
+      sendProductInfo(bus);
       break;
     case PGN_PGN_LIST:
-      sendPgnList(claimSock, src);
+      sendPgnList(bus, src);
       break;
     case PGN_HEARTBEAT:
-      sendHeartbeat(claimSock);
+      sendHeartbeat(bus);
       break;
     default:
       /* ISO 11783-3: NAK an addressed request for a PGN we do not send;
        * silently ignore an unsupported global request. */
       if (addressed)
       {
-        sendIsoAck(claimSock, src, 1 /* NAK */, requested);
+        sendIsoAck(bus, src, 1 /* NAK */, requested);
       }
       break;
   }
@@ -1263,7 +2749,7 @@ static void handleIsoRequest(uint8_t src, uint8_t dst, const uint8_t *data, uint
  * Group Function. "whatever of the two is normal": the Request form is what
  * configures a PGN's transmission rate.
  */
-static void handleGroupFunction(uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len)
+static void handleGroupFunction(CanBus *bus, uint8_t src, uint8_t dst, const uint8_t *data, uint8_t len)
 {
   uint32_t targetPgn;
   uint32_t interval;
@@ -1274,7 +2760,7 @@ static void handleGroupFunction(uint8_t src, uint8_t dst, const uint8_t *data, u
   {
     return;
   }
-  if (claimState != CLAIM_CLAIMED)
+  if (bus->claimState != CLAIM_CLAIMED)
   {
     return;
   }
@@ -1293,19 +2779,19 @@ static void handleGroupFunction(uint8_t src, uint8_t dst, const uint8_t *data, u
   }
   else if (interval == TX_INTERVAL_RESTORE_DEFAULT)
   {
-    heartbeatInterval = HEARTBEAT_DEFAULT_INTERVAL;
-    nextHeartbeat     = getNow() + (uint64_t) heartbeatInterval;
+    bus->heartbeatInterval = HEARTBEAT_DEFAULT_INTERVAL;
+    bus->nextHeartbeat     = getNow() + (uint64_t) bus->heartbeatInterval;
     logInfo("Heartbeat interval restored to default %d ms\n", HEARTBEAT_DEFAULT_INTERVAL);
   }
   else if (interval == 0)
   {
-    heartbeatInterval = 0; /* disable */
+    bus->heartbeatInterval = 0; /* disable */
     logInfo("Heartbeat disabled by group function\n");
   }
   else if (interval >= 1000 && interval <= 60000)
   {
-    heartbeatInterval = (long) interval;
-    nextHeartbeat     = getNow() + (uint64_t) heartbeatInterval;
+    bus->heartbeatInterval = (long) interval;
+    bus->nextHeartbeat     = getNow() + (uint64_t) bus->heartbeatInterval;
     logInfo("Heartbeat interval set to %u ms by group function\n", interval);
   }
   else
@@ -1314,25 +2800,24 @@ static void handleGroupFunction(uint8_t src, uint8_t dst, const uint8_t *data, u
     logError("Requested heartbeat interval %u ms out of range\n", interval);
   }
 
-  sendAckGroupFunction(claimSock, src, PGN_HEARTBEAT, 0 /* PGN ok */, paramError);
+  sendAckGroupFunction(bus, src, PGN_HEARTBEAT, 0 /* PGN ok */, paramError);
 }
 
-static void tickAddressClaim(int sock, uint64_t now)
+static void tickAddressClaim(CanBus *bus, uint64_t now)
 {
-  (void) sock;
-  if (claimState == CLAIM_SCANNING && now >= claimDeadline)
+  if (bus->claimState == CLAIM_SCANNING && now >= bus->claimDeadline)
   {
-    beginAddressClaim(claimSock);
+    beginAddressClaim(bus);
     return;
   }
-  if (claimState == CLAIM_PENDING && now >= claimDeadline)
+  if (bus->claimState == CLAIM_PENDING && now >= bus->claimDeadline)
   {
-    claimState = CLAIM_CLAIMED;
-    logInfo("Address %u claimed\n", address);
-    sendProductInfo(claimSock); /* announce ourselves once on the bus */
-    if (heartbeatInterval > 0)
+    bus->claimState = CLAIM_CLAIMED;
+    logInfo("Address %u claimed on %s\n", bus->address, bus->name);
+    sendProductInfo(bus); /* announce ourselves once on the bus */
+    if (bus->heartbeatInterval > 0)
     {
-      nextHeartbeat = now + (uint64_t) heartbeatInterval;
+      bus->nextHeartbeat = now + (uint64_t) bus->heartbeatInterval;
     }
   }
 }
@@ -1341,14 +2826,14 @@ static void tickAddressClaim(int sock, uint64_t now)
  * NMEA 2000 Heartbeat, PGN 126993. Sent every heartbeatInterval ms once we
  * own an address, so other nodes know we are alive.
  */
-static void sendHeartbeat(int sock)
+static void sendHeartbeat(CanBus *bus)
 {
   uint8_t  data[8];
-  uint16_t offset = (uint16_t) (heartbeatInterval / 10); /* field resolution is 0.01s */
+  uint16_t offset = (uint16_t) (bus->heartbeatInterval / 10); /* field resolution is 0.01s */
 
   data[0] = (uint8_t) offset;
   data[1] = (uint8_t) (offset >> 8);
-  data[2] = heartbeatSeq;
+  data[2] = bus->heartbeatSeq;
   /* Controller 1 State = Error Active (0, normal), Controller 2 State = not
    * available (3), Equipment Status = Operational (0), reserved bits = 1. */
   data[3] = 0xCC;
@@ -1357,9 +2842,9 @@ static void sendHeartbeat(int sock)
   data[6] = 0xff;
   data[7] = 0xff;
 
-  sendN2k(sock, 7, PGN_HEARTBEAT, (uint8_t) address, N2K_ADDR_GLOBAL, data, sizeof(data), true);
+  sendN2k(bus, 7, PGN_HEARTBEAT, (uint8_t) bus->address, N2K_ADDR_GLOBAL, data, sizeof(data), true);
 
-  heartbeatSeq = (heartbeatSeq >= 252) ? 0 : heartbeatSeq + 1;
+  bus->heartbeatSeq = (bus->heartbeatSeq >= 252) ? 0 : bus->heartbeatSeq + 1;
 }
 
 /* Copy a C string into a fixed-width NUL-padded STRING_FIX field. */
@@ -1378,21 +2863,20 @@ static void putStringFix(uint8_t *dst, size_t width, const char *s)
  * Product Information, PGN 126996. Sent once when we claim an address and in
  * reply to an ISO Request, so the node is identifiable on the network.
  */
-static void sendProductInfo(int sock)
+static void sendProductInfo(CanBus *bus)
 {
-  static uint64_t lastSent = 0;
-  uint64_t        now = getNow();
-  uint8_t         data[134];
-  char            serial[32];
+  uint64_t now = getNow();
+  uint8_t  data[134];
+  char     serial[32];
 
   /* 126996 is broadcast (PDU2), so a single reply answers every requester.
    * Collapse the discovery burst that several nodes make when we appear,
    * which would otherwise overflow the small CAN TX queue. */
-  if (now - lastSent < 1000)
+  if (now - bus->lastProductInfo < 1000)
   {
     return;
   }
-  lastSent = now;
+  bus->lastProductInfo = now;
 
   memset(data, 0, sizeof(data));
   data[0] = (uint8_t) N2K_DB_VERSION;
@@ -1407,14 +2891,14 @@ static void sendProductInfo(int sock)
   data[132] = CERTIFICATION_LEVEL;
   data[133] = LOAD_EQUIVALENCY;
 
-  sendN2k(sock, 6, PGN_PRODUCT_INFO, (uint8_t) address, N2K_ADDR_GLOBAL, data, sizeof(data), true);
+  sendN2k(bus, 6, PGN_PRODUCT_INFO, (uint8_t) bus->address, N2K_ADDR_GLOBAL, data, sizeof(data), true);
 }
 
 /*
  * PGN List (Transmit and Receive), PGN 126464. Sent in reply to an ISO
  * Request for 126464: one message for the transmit list, one for receive.
  */
-static void sendOnePgnList(int sock, uint8_t dst, uint8_t functionCode, const uint32_t *list, size_t count)
+static void sendOnePgnList(CanBus *bus, uint8_t dst, uint8_t functionCode, const uint32_t *list, size_t count)
 {
   uint8_t data[1 + 7 * 3];
   size_t  n = 0;
@@ -1426,17 +2910,17 @@ static void sendOnePgnList(int sock, uint8_t dst, uint8_t functionCode, const ui
     data[n++] = (uint8_t) (list[i] >> 8);
     data[n++] = (uint8_t) (list[i] >> 16);
   }
-  sendN2k(sock, 6, PGN_PGN_LIST, (uint8_t) address, dst, data, n, true);
+  sendN2k(bus, 6, PGN_PGN_LIST, (uint8_t) bus->address, dst, data, n, true);
 }
 
-static void sendPgnList(int sock, uint8_t dst)
+static void sendPgnList(CanBus *bus, uint8_t dst)
 {
-  sendOnePgnList(sock, dst, 0 /* Transmit PGN list */, txPgnList, ARRAY_SIZE(txPgnList));
-  sendOnePgnList(sock, dst, 1 /* Receive PGN list */, rxPgnList, ARRAY_SIZE(rxPgnList));
+  sendOnePgnList(bus, dst, 0 /* Transmit PGN list */, txPgnList, ARRAY_SIZE(txPgnList));
+  sendOnePgnList(bus, dst, 1 /* Receive PGN list */, rxPgnList, ARRAY_SIZE(rxPgnList));
 }
 
 /* ISO Acknowledgement, PGN 59392. */
-static void sendIsoAck(int sock, uint8_t dst, uint8_t control, uint32_t pgn)
+static void sendIsoAck(CanBus *bus, uint8_t dst, uint8_t control, uint32_t pgn)
 {
   uint8_t data[8];
 
@@ -1449,11 +2933,11 @@ static void sendIsoAck(int sock, uint8_t dst, uint8_t control, uint32_t pgn)
   data[6] = (uint8_t) (pgn >> 8);
   data[7] = (uint8_t) (pgn >> 16);
 
-  sendN2k(sock, 6, PGN_ISO_ACK, (uint8_t) address, dst, data, sizeof(data), true);
+  sendN2k(bus, 6, PGN_ISO_ACK, (uint8_t) bus->address, dst, data, sizeof(data), true);
 }
 
 /* Acknowledge Group Function, PGN 126208 function 2. */
-static void sendAckGroupFunction(int sock, uint8_t dst, uint32_t pgn, uint8_t pgnError, uint8_t paramError)
+static void sendAckGroupFunction(CanBus *bus, uint8_t dst, uint32_t pgn, uint8_t pgnError, uint8_t paramError)
 {
   uint8_t data[6];
 
@@ -1464,7 +2948,7 @@ static void sendAckGroupFunction(int sock, uint8_t dst, uint32_t pgn, uint8_t pg
   data[4] = (uint8_t) ((pgnError & 0x0f) | ((paramError & 0x0f) << 4));
   data[5] = 0; /* Number of parameters */
 
-  sendN2k(sock, 6, PGN_GROUP_FUNCTION, (uint8_t) address, dst, data, sizeof(data), true);
+  sendN2k(bus, 6, PGN_GROUP_FUNCTION, (uint8_t) bus->address, dst, data, sizeof(data), true);
 }
 
 /*
@@ -1579,6 +3063,173 @@ static bool computeLoadPct(const LoadSample *prev, const LoadSample *curr, uint3
   return true;
 }
 
+/*
+ * Bus utilisation accounting. Every frame received or sent adds its bits
+ * to the current slot of its source and of its PGN; the window total is
+ * kept alongside, so reporting never has to add up the slots.
+ */
+static void utilAccount(CanBus *bus, uint32_t pgn, uint8_t src, uint8_t len)
+{
+  BusUtil *u    = &bus->util;
+  uint32_t bits = (uint32_t) len * 8 + CAN_EFF_OVERHEAD_BITS;
+  size_t   i    = (size_t) ((pgn * UINT32_C(2654435761)) >> 16) & (UTIL_PGNS - 1);
+
+  u->src[u->slot][src].bits += bits;
+  u->src[u->slot][src].frames++;
+  u->srcTotal[src].bits += bits;
+  u->srcTotal[src].frames++;
+
+  while (u->pgn[i] != pgn + 1)
+  {
+    if (u->pgn[i] == 0)
+    {
+      if (u->pgnCount == UTIL_PGNS - 1)
+      {
+        return; /* table full: the PGN goes uncounted, its source was not */
+      }
+      u->pgn[i] = pgn + 1;
+      u->pgnCount++;
+      break;
+    }
+    i = (i + 1) & (UTIL_PGNS - 1);
+  }
+  u->pgnSlot[u->slot][i].bits += bits;
+  u->pgnSlot[u->slot][i].frames++;
+  u->pgnTotal[i].bits += bits;
+  u->pgnTotal[i].frames++;
+}
+
+static void utilClearSlot(BusUtil *u, size_t slot)
+{
+  for (size_t i = 0; i < 256; i++)
+  {
+    u->srcTotal[i].bits -= u->src[slot][i].bits;
+    u->srcTotal[i].frames -= u->src[slot][i].frames;
+  }
+  for (size_t i = 0; i < UTIL_PGNS; i++)
+  {
+    u->pgnTotal[i].bits -= u->pgnSlot[slot][i].bits;
+    u->pgnTotal[i].frames -= u->pgnSlot[slot][i].frames;
+  }
+  memset(u->src[slot], 0, sizeof(u->src[slot]));
+  memset(u->pgnSlot[slot], 0, sizeof(u->pgnSlot[slot]));
+}
+
+/* Slide the window: each slot that has run out makes way for a fresh one. */
+static void utilTick(CanBus *bus, uint64_t now)
+{
+  BusUtil *u = &bus->util;
+
+  for (size_t n = 0; now >= u->slotStart + UTIL_SLOT_MS && n < UTIL_SLOTS; n++)
+  {
+    u->slot = (u->slot + 1) % UTIL_SLOTS;
+    utilClearSlot(u, u->slot);
+    u->slotStart += UTIL_SLOT_MS;
+    u->slotsUsed = CB_MIN(u->slotsUsed + 1, UTIL_SLOTS);
+  }
+  if (now >= u->slotStart + UTIL_SLOT_MS)
+  {
+    u->slotStart = now; /* idle for longer than the window, which is now empty */
+    u->slotsUsed = 1;
+  }
+}
+
+/* The load these bits put on the bus over the window, in 0.01 %. */
+static uint32_t utilLoad(const CanBus *bus, uint64_t bits, uint64_t now)
+{
+  uint64_t windowMs = (uint64_t) (bus->util.slotsUsed - 1) * UTIL_SLOT_MS + (now - bus->util.slotStart);
+  uint32_t bitrate  = bus->bitrate != 0 ? bus->bitrate : FALLBACK_BITRATE_BPS;
+
+  if (windowMs == 0)
+  {
+    return 0;
+  }
+  /* bits * 10000 / (bitrate * window_s) = bits * 10000000 / (bitrate * window_ms) */
+  return (uint32_t) (bits * CAN_STUFFING_NUMER / CAN_STUFFING_DENOM * 10000000 / ((uint64_t) bitrate * windowMs));
+}
+
+/* The (at most UTIL_TOP) entries with the most bits, busiest first. */
+static size_t utilTop(const UtilCount *count, size_t entries, size_t top[UTIL_TOP])
+{
+  size_t n = 0;
+
+  for (size_t i = 0; i < entries; i++)
+  {
+    size_t j;
+
+    if (count[i].bits == 0 || (n == UTIL_TOP && count[i].bits <= count[top[n - 1]].bits))
+    {
+      continue;
+    }
+    j = CB_MIN(n, UTIL_TOP - 1);
+    while (j > 0 && count[top[j - 1]].bits < count[i].bits)
+    {
+      top[j] = top[j - 1];
+      j--;
+    }
+    top[j] = i;
+    n      = CB_MIN(n + 1, UTIL_TOP);
+  }
+  return n;
+}
+
+/*
+ * Write everything the window holds for one interface to stderr as a
+ * single line of JSON, like the analyzer's -stats output.
+ */
+static void utilDump(CanBus *bus, uint64_t now)
+{
+  const BusUtil *u     = &bus->util;
+  StringBuffer   sb    = sbNew;
+  uint64_t       total = 0;
+  const char    *sep   = "";
+
+  for (size_t i = 0; i < 256; i++)
+  {
+    total += u->srcTotal[i].bits;
+  }
+  sbAppendFormat(&sb,
+                 "{\"utilisation\":{\"interface\":\"%s\",\"windowMs\":%" PRIu64 ",\"bitrate\":%u,\"load\":%.2f,\"sources\":[",
+                 bus->name,
+                 (uint64_t) (u->slotsUsed - 1) * UTIL_SLOT_MS + (now - u->slotStart),
+                 bus->bitrate != 0 ? bus->bitrate : FALLBACK_BITRATE_BPS,
+                 utilLoad(bus, total, now) / 100.0);
+  for (size_t i = 0; i < 256; i++)
+  {
+    if (u->srcTotal[i].frames != 0)
+    {
+      sbAppendFormat(&sb,
+                     "%s{\"src\":%zu,\"frames\":%u,\"bits\":%" PRIu64 ",\"load\":%.2f}",
+                     sep,
+                     i,
+                     u->srcTotal[i].frames,
+                     (uint64_t) u->srcTotal[i].bits * CAN_STUFFING_NUMER / CAN_STUFFING_DENOM,
+                     utilLoad(bus, u->srcTotal[i].bits, now) / 100.0);
+      sep = ",";
+    }
+  }
+  sbAppendString(&sb, "],\"pgns\":[");
+  sep = "";
+  for (size_t i = 0; i < UTIL_PGNS; i++)
+  {
+    if (u->pgnTotal[i].frames != 0)
+    {
+      sbAppendFormat(&sb,
+                     "%s{\"pgn\":%u,\"frames\":%u,\"bits\":%" PRIu64 ",\"load\":%.2f}",
+                     sep,
+                     u->pgn[i] - 1,
+                     u->pgnTotal[i].frames,
+                     (uint64_t) u->pgnTotal[i].bits * CAN_STUFFING_NUMER / CAN_STUFFING_DENOM,
+                     utilLoad(bus, u->pgnTotal[i].bits, now) / 100.0);
+      sep = ",";
+    }
+  }
+  sbAppendString(&sb, "]}}\n");
+  fputs(sbGet(&sb), stderr);
+  fflush(stderr);
+  sbClean(&sb);
+}
+
 /*
  * Emit the synthetic "NMEA 2000 gateway: network status" PGN (262400) to
  * stdout. Same 15-byte layout as ikonvert-serial's $PDGY heartbeat:
@@ -1589,13 +3240,25 @@ static bool computeLoadPct(const LoadSample *prev, const LoadSample *curr, uint3
  *   [10]    Gateway address
  *   [11..14] Rejected TX requests (u32 LE)
  * Fields we cannot measure are left at the 0xff / 0xffffffff "no data"
- * sentinel. This is a BEM-range PGN: it is written to stdout only, never
- * sent on the bus.
+ * sentinel.
+ *
+ * Two variable-length blocks follow, which decoders that only know the
+ * fixed fields skip. The first is the drop-source list: a count, then that
+ * many (source, u16 LE count) pairs for the sources whose fast packets or
+ * ISO TP transfers were dropped incomplete. The second is the top-talkers
+ * block: the busiest sources and the busiest PGNs over the utilisation
+ * window, each list a count followed by its entries (see below).
+ *
+ * This is a BEM-range PGN: it is written to stdout only, never sent on the
+ * bus.
  */
-static void sendNetworkStatus(void)
+static void sendNetworkStatus(CanBus *bus)
 {
   uint64_t   now = getNow();
-  uint8_t    data[15];
+  uint8_t    data[16 + 3 * NETWORK_STATUS_MAX_DROP_SOURCES + 2 + 8 * UTIL_TOP];
+  size_t     top[UTIL_TOP];
+  size_t     n;
+  size_t     len = 16;
   uint8_t    src = 0;
   uint8_t    load;
   uint32_t   counter;
@@ -1603,21 +3266,23 @@ static void sendNetworkStatus(void)
   unsigned   count = 0;
 
   memset(data, 0xff, sizeof(data));
+  fastPacketExpire(bus, now * 1000);
+  isoTpExpire(bus, now * 1000);
 
   /* [0] CAN network load: delta-sampled against the previous emission.
    * The first emission has no baseline, so load stays at the sentinel. */
-  if (readLoadSample(canIface, now, &curr))
+  if (readLoadSample(bus->name, now, &curr))
   {
-    if (havePrevLoadSample && computeLoadPct(&prevLoadSample, &curr, busBitrate, &load))
+    if (bus->havePrevLoadSample && computeLoadPct(&bus->prevLoadSample, &curr, bus->bitrate, &load))
     {
       data[0] = load;
     }
-    prevLoadSample     = curr;
-    havePrevLoadSample = true;
+    bus->prevLoadSample     = curr;
+    bus->havePrevLoadSample = true;
   }
 
   /* [1..4] Errors: kernel RX error counter. */
-  if (readSysfsCounter(canIface, "rx_errors", &counter))
+  if (readSysfsCounter(bus->name, "rx_errors", &counter))
   {
     data[1] = (uint8_t) (counter >> 0);
     data[2] = (uint8_t) (counter >> 8);
@@ -1630,7 +3295,7 @@ static void sendNetworkStatus(void)
    * 60928 — many real devices never re-announce. */
   for (int a = 0; a < 256; a++)
   {
-    if (seenAddr[a])
+    if (bus->seenAddr[a])
     {
       count++;
     }
@@ -1649,14 +3314,14 @@ static void sendNetworkStatus(void)
   /* [10] Gateway address: our claimed CAN address, if we own one. Also
    * used as the emitted message's source so downstream tools attribute
    * the status to this gateway rather than bucketing it at src=0. */
-  if (claimState == CLAIM_CLAIMED)
+  if (bus->claimState == CLAIM_CLAIMED)
   {
-    data[10] = (uint8_t) address;
-    src      = (uint8_t) address;
+    data[10] = (uint8_t) bus->address;
+    src      = (uint8_t) bus->address;
   }
 
   /* [11..14] Rejected TX requests: kernel TX-dropped counter. */
-  if (readSysfsCounter(canIface, "tx_dropped", &counter))
+  if (readSysfsCounter(bus->name, "tx_dropped", &counter))
   {
     data[11] = (uint8_t) (counter >> 0);
     data[12] = (uint8_t) (counter >> 8);
@@ -1664,5 +3329,48 @@ static void sendNetworkStatus(void)
     data[14] = (uint8_t) (counter >> 24);
   }
 
-  emitMessage(now, 7, PGN_NETWORK_STATUS, src, N2K_ADDR_GLOBAL, data, sizeof(data));
+  /* [15..] Incomplete fast packets and ISO TP transfers per source since
+   * startup, saturating. */
+  data[15] = 0;
+  for (int a = 0; a < 256 && data[15] < NETWORK_STATUS_MAX_DROP_SOURCES; a++)
+  {
+    if (bus->rxDrops[a] != 0)
+    {
+      uint16_t drops = (uint16_t) CB_MIN(bus->rxDrops[a], UINT16_MAX);
+
+      data[len++] = (uint8_t) a;
+      data[len++] = (uint8_t) (drops >> 0);
+      data[len++] = (uint8_t) (drops >> 8);
+      data[15]++;
+    }
+  }
+
+  /* Then the top talkers over the utilisation window: a count and that
+   * many (source, u16 LE load in 0.01 %), then a count and that many
+   * (PGN as u24 LE, u16 LE load in 0.01 %). */
+  n           = utilTop(bus->util.srcTotal, 256, top);
+  data[len++] = (uint8_t) n;
+  for (size_t i = 0; i < n; i++)
+  {
+    uint16_t load = (uint16_t) CB_MIN(utilLoad(bus, bus->util.srcTotal[top[i]].bits, now), UINT16_MAX);
+
+    data[len++] = (uint8_t) top[i];
+    data[len++] = (uint8_t) (load >> 0);
+    data[len++] = (uint8_t) (load >> 8);
+  }
+  n           = utilTop(bus->util.pgnTotal, UTIL_PGNS, top);
+  data[len++] = (uint8_t) n;
+  for (size_t i = 0; i < n; i++)
+  {
+    uint32_t pgn  = bus->util.pgn[top[i]] - 1;
+    uint16_t load = (uint16_t) CB_MIN(utilLoad(bus, bus->util.pgnTotal[top[i]].bits, now), UINT16_MAX);
+
+    data[len++] = (uint8_t) (pgn >> 0);
+    data[len++] = (uint8_t) (pgn >> 8);
+    data[len++] = (uint8_t) (pgn >> 16);
+    data[len++] = (uint8_t) (load >> 0);
+    data[len++] = (uint8_t) (load >> 8);
+  }
+
+  emitMessage(bus, now * 1000, 7, PGN_NETWORK_STATUS, src, N2K_ADDR_GLOBAL, data, len);
 }
@@ -0,0 +1,103 @@
+/*
+
+Drives the merged output of two interfaces without a CAN socket: frames go
+straight into handleFrame() with chosen receive times, and after each step
+the lines that flushOutput() releases are printed. socketcan-serial.c is
+included rather than linked so its static functions are reachable; its
+main() is renamed out of the way.
+
+(C) 2009-2026, Kees Verruijt, Harlingen, The Netherlands.
+
+This file is part of CANboat.
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*/
+
+#define main socketcanSerialMain
+#include "socketcan-serial.c"
+#undef main
+
+#define TEST_FAST_PGN (129029)
+#define TEST_SINGLE_PGN (127250)
+#define TEST_SRC (35)
+
+static void single(CanBus *bus, uint8_t tag, uint64_t whenUs)
+{
+  uint8_t data[8] = {tag, 0, 0, 0, 0, 0, 0, 0};
+
+  handleFrame(bus, getCanIdFromISO11783Bits(2, TEST_SINGLE_PGN, TEST_SRC, N2K_ADDR_GLOBAL), data, sizeof(data), whenUs);
+}
+
+/* Frame 0 or 1 of a 13 byte fast packet. */
+static void fastFrame(CanBus *bus, uint8_t seq, uint8_t idx, uint8_t tag, uint64_t whenUs)
+{
+  uint8_t data[8] = {(uint8_t) (seq << 5 | idx), tag, tag, tag, tag, tag, tag, tag};
+
+  if (idx == 0)
+  {
+    data[FASTPACKET_SIZE] = 13;
+  }
+  handleFrame(bus, getCanIdFromISO11783Bits(3, TEST_FAST_PGN, TEST_SRC, N2K_ADDR_GLOBAL), data, sizeof(data), whenUs);
+}
+
+static void step(const char *what, bool all)
+{
+  printf("# %s\n", what);
+  fflush(stdout);
+  flushOutput(all);
+}
+
+int main(int argc, char **argv)
+{
+  CanBus  *a = &buses[0];
+  CanBus  *b = &buses[1];
+  uint64_t base;
+
+  (void) argc;
+  setProgName(argv[0]);
+  busCount = 2;
+  a->name  = "can0";
+  b->name  = "can1";
+
+  /* A fast packet on can0 is open while later single frames arrive on both
+   * interfaces: they wait for it, and it comes out first. */
+  base = getNowUs() - 200000;
+  fastFrame(a, 1, 0, 0xa0, base);
+  single(b, 0x01, base + 1000);
+  single(a, 0x02, base + 2000);
+  step("fast packet open", false);
+  fastFrame(a, 1, 1, 0xa1, base + 3000);
+  single(b, 0x03, base + 4000);
+  step("fast packet complete", false);
+
+  /* Singles received out of order on the two interfaces in one batch. */
+  single(b, 0x05, base + 6000);
+  single(a, 0x04, base + 5000);
+  step("singles", false);
+
+  /* A line younger than OUTPUT_HOLD_US waits for the other interface. */
+  single(b, 0x06, getNowUs());
+  step("fresh line", false);
+  step("all", true);
+
+  /* A fast packet that lost its last frame holds nothing up once it has
+   * timed out. */
+  base = getNowUs() - FASTPACKET_TIMEOUT_US - 100000;
+  fastFrame(b, 2, 0, 0xb0, base);
+  single(a, 0x07, base + 1000);
+  single(b, 0x08, base + 2000);
+  step("timed out fast packet", false);
+  step("end", true);
+  return 0;
+}
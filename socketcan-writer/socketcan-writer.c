@@ -20,12 +20,15 @@ limitations under the License.
 
 */
 #define _GNU_SOURCE
+#include <errno.h>
 #include <linux/can.h>
 #include <linux/can/raw.h>
 #include <net/if.h>
+#include <poll.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/socket.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -33,75 +36,243 @@ limitations under the License.
 #include "common.h"
 #include "parse.h"
 
-static int    openCanDevice(char *device, int *socket);
-static void   writeRawPGNToCanSocket(RawMessage *msg, int socket);
-static void   sendCanFrame(struct can_frame *frame, int socket);
-static void   sendN2kFastPacket(RawMessage *msg, struct can_frame *frame, int socket);
-unsigned long time_diff(struct timeval x, struct timeval y, char *timestamp);
+#define TX_BATCH (32) /* Frames per sendmmsg() when not pacing */
+
+/* A full qdisc answers ENOBUFS without the socket ever becoming unwritable,
+ * so poll() is no help; back off and retry instead of dropping the frame. */
+#define TX_BACKOFF_MIN_NS (1000000)
+#define TX_BACKOFF_MAX_NS (64000000)
+
+/* Bits a frame occupies on the bus, as socketcan-serial estimates them */
+#define DEFAULT_BITRATE_BPS (250000)
+#define CAN_EFF_OVERHEAD_BITS (67) /* SOF+arb+ctrl+CRC+ACK+EOF+IFS, 29-bit frame */
+#define CAN_STUFFING_NUMER (120)   /* ~20% average bit-stuffing inflation */
+#define CAN_STUFFING_DENOM (100)
+#define LOAD_BURST_FRAMES (32) /* Token bucket depth: one maximum size fast packet */
+
+#define NS_PER_SEC (1000000000)
+
+/* Consecutive fast packets with the same CAN ID must carry different sequence
+ * numbers, or a receiver can merge them. One rotating 3-bit counter per CAN ID,
+ * in a table with bounded linear probing; when the probe window is full the
+ * home slot is taken over, which only restarts that counter. */
+#define FAST_SEQ_SLOTS (1024)
+#define FAST_SEQ_PROBES (8)
+
+/* Messages above FASTPACKET_MAX_SIZE go out as an ISO 11783-3 / J1939-21 BAM:
+ * a TP.CM announcement followed by the TP.DT packets, at least 50 ms (and at
+ * most 200 ms) apart. A source may only have one BAM in progress, so there is
+ * a session per source, and packets of different sources interleave with each
+ * other and with the rest of the input. Further messages of a source wait in
+ * its session's queue of BAM_QUEUE; only when that is full, or every session
+ * is taken, does reading the input wait for a transfer to finish. */
+#define PGN_ISO_TP_CM (60416)
+#define PGN_ISO_TP_DT (60160)
+#define ISO_TP_CM_BAM (32)
+#define ISO_TP_PRIORITY (7)
+#define BAM_SESSIONS (8)
+#define BAM_QUEUE (4)
+#define BAM_PACKET_INTERVAL_NS (50000000)
+
+#define INPUT_BUFFER_SIZE (65536)
+
+typedef struct FastSeq
+{
+  uint32_t canId; /* 0 = unused; N2K IDs always have CAN_EFF_FLAG set */
+  uint8_t  seq;
+} FastSeq;
+
+typedef struct BamMessage
+{
+  uint32_t pgn;
+  uint16_t len;
+  uint8_t  data[ISOTP_MAX_SIZE]; /* padded with 0xff */
+} BamMessage;
+
+typedef struct BamSession
+{
+  bool       used;
+  uint8_t    src;
+  uint8_t    packets;
+  uint8_t    next; /* 1-based sequence number of the next TP.DT */
+  uint64_t   due;  /* CLOCK_MONOTONIC ns */
+  BamMessage queue[BAM_QUEUE]; /* queue[head] is being sent */
+  size_t     head;
+  size_t     count;
+} BamSession;
+
+static bool     paceTimestamps = true; /* Send at the offsets recorded in the input timestamps */
+static uint32_t loadCeiling;           /* Bus load ceiling in percent, 0 = none */
+static uint32_t bitrate     = DEFAULT_BITRATE_BPS;
+static bool     canIsSocket = true;
+
+static struct can_frame txFrames[TX_BATCH];
+static size_t           txCount;
+
+static uint64_t msgDeadline; /* CLOCK_MONOTONIC ns at which the current message is due, 0 = now */
+static uint64_t loadTat;     /* Token bucket theoretical arrival time of the next frame */
+static uint64_t loadBurstNs;
+
+static FastSeq    fastSeq[FAST_SEQ_SLOTS];
+static BamSession bamSession[BAM_SESSIONS];
+static size_t     bamActive;
+
+static char   inputBuffer[INPUT_BUFFER_SIZE];
+static size_t inputStart;
+static size_t inputEnd;
+
+static int      openCanDevice(char *device, int *socket);
+static void     writeRawPGNToCanSocket(RawMessage *msg, int socket);
+static void     sendCanFrame(struct can_frame *frame, int socket);
+static void     sendN2kFastPacket(RawMessage *msg, struct can_frame *frame, int socket);
+static void     sendIsoTpBam(RawMessage *msg, int socket);
+static void     bamAnnounce(BamSession *s, struct can_frame *frame);
+static void     sendDueBamPackets(int socket, uint64_t now);
+static uint64_t nextBamPacketDue(void);
+static uint8_t  getNextFastSeq(uint32_t canId);
+static void     queueCanFrame(struct can_frame *frame, int socket);
+static void     flushCanFrames(int socket);
+static void     waitUntil(uint64_t deadline, int socket);
+static bool     inputLineBuffered(void);
+static bool     readInputLine(char *line, size_t size, int socket);
+static bool     parseFrameTime(const char *timestamp, uint64_t *ns);
+static uint64_t frameCostNs(const struct can_frame *frame);
+static uint64_t monotonicNs(void);
+static void     sleepUntil(uint64_t deadline);
+
+static void usage(const char *name)
+{
+  fprintf(stderr,
+          "Usage: %s [-nopace] [-load <pct>] [-bitrate <bps>] <can-device>\n"
+          "\n"
+          "Reads raw n2k ASCII data from stdin and writes it to a Linux SocketCAN device.\n"
+          "\n"
+          "Options:\n"
+          "  -nopace        ignore the input timestamps; send as fast as the bus takes the\n"
+          "                 frames, in batches of up to %d\n"
+          "  -load <pct>    never load the bus above <pct> percent, 1..100\n"
+          "  -bitrate <bps> bus bitrate used for -load (default %d)\n"
+          "\n"
+          "  By default messages are sent at the offsets between their timestamps. When\n"
+          "  the kernel queue is full the writer waits rather than dropping frames.\n"
+          "  Messages longer than a fast packet, up to %d bytes, are broadcast using ISO TP\n"
+          "  BAM, with its packets %d ms apart.\n"
+          "  <can-device> may be 'stdout' or '-' to write raw can_frame structs to stdout.\n"
+          "\n" COPYRIGHT,
+          name,
+          TX_BATCH,
+          DEFAULT_BITRATE_BPS,
+          ISOTP_MAX_SIZE,
+          BAM_PACKET_INTERVAL_NS / 1000000);
+  exit(1);
+}
 
 int main(int argc, char **argv)
 {
-  FILE          *file = stdin;
-  char           msg[MAX_MSG_LINE_LENGTH];
-  char          *milliSecond;
-  int            socket;
-  struct timeval frameTime;
-  struct timeval prevFrameTime;
-  struct tm      ctime;
-  unsigned long  usWait;
+  char     msg[MAX_MSG_LINE_LENGTH];
+  char    *name = argv[0];
+  int      socket;
+  uint64_t firstFrameNs = 0;
+  uint64_t prevFrameNs  = 0;
+  uint64_t startNs      = 0;
 
   setProgName(argv[0]);
+  while (argc > 2)
+  {
+    if (strcasecmp(argv[1], "-nopace") == 0)
+    {
+      paceTimestamps = false;
+    }
+    else if (strcasecmp(argv[1], "-load") == 0 && argc > 3)
+    {
+      loadCeiling = strtoul(argv[2], NULL, 10);
+      if (loadCeiling < 1 || loadCeiling > 100)
+      {
+        usage(name);
+      }
+      argc--, argv++;
+    }
+    else if (strcasecmp(argv[1], "-bitrate") == 0 && argc > 3)
+    {
+      bitrate = strtoul(argv[2], NULL, 10);
+      if (bitrate == 0)
+      {
+        usage(name);
+      }
+      argc--, argv++;
+    }
+    else
+    {
+      usage(name);
+    }
+    argc--, argv++;
+  }
   if (argc != 2)
   {
-    puts("Usage: socketcan-writer <can-device>");
-    exit(1);
+    usage(name);
   }
 
   if (openCanDevice(argv[1], &socket))
   {
     exit(1);
   }
+  if (loadCeiling != 0)
+  {
+    struct can_frame full = {.can_dlc = 8};
 
-  prevFrameTime.tv_sec  = 0;
-  prevFrameTime.tv_usec = 0;
+    loadBurstNs = LOAD_BURST_FRAMES * frameCostNs(&full);
+  }
 
-  while (fgets(msg, sizeof(msg) - 1, file))
+  while (readInputLine(msg, sizeof(msg), socket))
   {
     RawMessage m;
+    uint64_t   frameNs;
+
     if (parseRawFormatFast(msg, &m, false))
     {
       continue; // Parsing failed -> skip the line
     }
-    if (strlen(m.timestamp) >= 19)
+    msgDeadline = 0;
+    if (paceTimestamps && parseFrameTime(m.timestamp, &frameNs))
     {
-      m.timestamp[10] = 'T'; // to support 'T', '-' and ' ' separators
-      memset(&ctime, 0, sizeof(struct tm));
-      milliSecond = strptime(m.timestamp, "%Y-%m-%dT%H:%M:%S", &ctime);
-      if ((milliSecond != NULL) && (milliSecond - m.timestamp >= 19)) // convert in tm struct => OK
-      {
-        int usec;
-
-        frameTime.tv_sec  = mktime(&ctime);
-        frameTime.tv_usec = (sscanf(milliSecond, ".%3d", &usec) == 1) ? usec * 1000 : 0;
-        usWait
-            = ((prevFrameTime.tv_sec == 0) && (prevFrameTime.tv_usec == 0)) ? 0 : time_diff(prevFrameTime, frameTime, m.timestamp);
-        prevFrameTime = frameTime;
-      }
-      else // convert in tm struct failed
+      /* Deadlines are absolute against the first message, so the time spent
+       * parsing and writing does not accumulate into drift over a long replay. */
+      if (startNs == 0 || frameNs < prevFrameNs)
       {
-        usWait = 0;
+        if (startNs != 0)
+        {
+          logError("Timestamp back in time at %s\n", m.timestamp);
+        }
+        firstFrameNs = frameNs;
+        startNs      = monotonicNs();
       }
+      prevFrameNs = frameNs;
+      msgDeadline = startNs + (frameNs - firstFrameNs);
     }
-    else // bad timestamp format YYYY-mm-dd[T|-| ]HH:MM:SS[.xxx] & min length 19 chrs
+    writeRawPGNToCanSocket(&m, socket);
+
+    if (paceTimestamps || loadCeiling != 0)
     {
-      usWait = 0;
+      flushCanFrames(socket);
     }
-    if (usWait > 0)
+    else
     {
-      usleep(usWait);
+      struct pollfd pfd = {.fd = STDIN_FILENO, .events = POLLIN};
+
+      /* Unpaced, keep batching while more input is waiting; send what we have
+       * before blocking on stdin. */
+      if (!inputLineBuffered() && poll(&pfd, 1, 0) == 0)
+      {
+        flushCanFrames(socket);
+      }
     }
-    writeRawPGNToCanSocket(&m, socket);
   }
+  while (bamActive != 0)
+  {
+    waitUntil(nextBamPacketDue(), socket);
+    sendDueBamPackets(socket, monotonicNs());
+  }
+  flushCanFrames(socket);
 
   close(socket);
   exit(0);
@@ -117,7 +288,8 @@ static int openCanDevice(char *device, int *canSocket)
 
   if (strcmp(device, "stdout") == 0 || strcmp(device, "-") == 0)
   {
-    *canSocket = STDOUT_FILENO;
+    *canSocket  = STDOUT_FILENO;
+    canIsSocket = false;
     return 0;
   }
 
@@ -159,9 +331,14 @@ static void writeRawPGNToCanSocket(RawMessage *msg, int socket)
     return;
   }
 
-  if (msg->len > FASTPACKET_MAX_SIZE) // Only reassembly, not transmission, of ISO TP messages is implemented
+  if (msg->len > ISOTP_MAX_SIZE)
+  {
+    logError("PGN %u length %u exceeds ISO TP maximum %u. Skipping.\n", msg->pgn, msg->len, ISOTP_MAX_SIZE);
+    return;
+  }
+  if (msg->len > FASTPACKET_MAX_SIZE)
   {
-    logError("PGN %u length %u exceeds fast packet maximum %u. Skipping.\n", msg->pgn, msg->len, FASTPACKET_MAX_SIZE);
+    sendIsoTpBam(msg, socket);
     return;
   }
 
@@ -179,25 +356,125 @@ static void writeRawPGNToCanSocket(RawMessage *msg, int socket)
   }
 }
 
+/*
+  Queues the frame for the next flushCanFrames(), first waiting until it is
+  due: at the message's timestamp and within the bus load ceiling. Frames that
+  are already due are sent together.
+*/
 static void sendCanFrame(struct can_frame *frame, int socket)
 {
-  if (write(socket, frame, sizeof(struct can_frame)) != sizeof(struct can_frame))
+  uint64_t deadline = msgDeadline;
+
+  if (loadCeiling != 0)
   {
-    perror("write");
+    /* Token bucket as a virtual scheduling time: each frame advances loadTat
+       by its time on the bus at the ceiling, and may go once that is within
+       one burst of the present. */
+    uint64_t now = monotonicNs();
+
+    loadTat  = CB_MAX(loadTat, now) + frameCostNs(frame);
+    deadline = CB_MAX(deadline, loadTat > loadBurstNs ? loadTat - loadBurstNs : 0);
+  }
+  sendDueBamPackets(socket, monotonicNs());
+  waitUntil(deadline, socket);
+  queueCanFrame(frame, socket);
+}
+
+static void queueCanFrame(struct can_frame *frame, int socket)
+{
+  txFrames[txCount++] = *frame;
+  if (txCount == TX_BATCH)
+  {
+    flushCanFrames(socket);
   }
 }
 
+/*
+  Sends what is queued and sleeps until the deadline, meanwhile sending the
+  BAM packets that fall due.
+*/
+static void waitUntil(uint64_t deadline, int socket)
+{
+  uint64_t now = monotonicNs();
+
+  while (deadline > now)
+  {
+    uint64_t wake = nextBamPacketDue();
+
+    flushCanFrames(socket);
+    sleepUntil(CB_MIN(wake, deadline));
+    now = monotonicNs();
+    sendDueBamPackets(socket, now);
+  }
+}
+
+/*
+  Writes the queued frames, as one sendmmsg() where possible. A full kernel
+  queue (ENOBUFS, or EAGAIN) is waited out with an increasing backoff; any
+  other error drops the remaining frames.
+*/
+static void flushCanFrames(int socket)
+{
+  static struct mmsghdr msgs[TX_BATCH];
+  static struct iovec   iov[TX_BATCH];
+  size_t                sent    = 0;
+  uint64_t              backoff = TX_BACKOFF_MIN_NS;
+
+  for (size_t i = 0; i < txCount; i++)
+  {
+    iov[i].iov_base = &txFrames[i];
+    iov[i].iov_len  = sizeof(struct can_frame);
+    msgs[i].msg_hdr = (struct msghdr) {.msg_iov = &iov[i], .msg_iovlen = 1};
+  }
+
+  while (sent < txCount)
+  {
+    ssize_t n;
+
+    if (canIsSocket)
+    {
+      n = sendmmsg(socket, msgs + sent, txCount - sent, 0);
+    }
+    else
+    {
+      n = write(socket, (const char *) (txFrames + sent), (txCount - sent) * sizeof(struct can_frame));
+      n = n > 0 ? n / (ssize_t) sizeof(struct can_frame) : n; // stdout is a pipe or file, whole frames in practice
+    }
+    if (n > 0)
+    {
+      sent += n;
+      backoff = TX_BACKOFF_MIN_NS;
+    }
+    else if (n < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    else if (n < 0 && (errno == ENOBUFS || errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+      sleepUntil(monotonicNs() + backoff);
+      backoff = CB_MIN(backoff * 2, TX_BACKOFF_MAX_NS);
+    }
+    else
+    {
+      perror("write");
+      break;
+    }
+  }
+  txCount = 0;
+}
+
 /*
   See pgn.h for n2k fast packet data format
 */
 static void sendN2kFastPacket(RawMessage *msg, struct can_frame *frame, int socket)
 {
-  int index              = 0;
-  int remainingDataBytes = msg->len;
+  int     index              = 0;
+  int     remainingDataBytes = msg->len;
+  uint8_t seq                = getNextFastSeq(frame->can_id);
+
   while (remainingDataBytes > 0)
   {
-    frame->data[0]
-        = index; // fast packet index (increases by 1 for every CAN frame), 'order' (the 3 uppermost bits) is left as 0 for now
+    frame->data[0] = (seq << 5) | index; // fast packet sequence (per CAN ID) and index (increases by 1 for every CAN frame)
 
     if (index == 0) // 1st frame
     {
@@ -226,19 +503,327 @@ static void sendN2kFastPacket(RawMessage *msg, struct can_frame *frame, int sock
   }
 }
 
-unsigned long time_diff(struct timeval x, struct timeval y, char *timestamp)
+static uint8_t getNextFastSeq(uint32_t canId)
 {
-  double x_ms, y_ms, diff;
+  size_t home = (size_t) ((canId * 2654435761U) >> 22) % FAST_SEQ_SLOTS;
 
-  x_ms = (double) x.tv_sec * 1000000 + (double) x.tv_usec;
-  y_ms = (double) y.tv_sec * 1000000 + (double) y.tv_usec;
+  for (size_t i = 0; i < FAST_SEQ_PROBES; i++)
+  {
+    FastSeq *slot = &fastSeq[(home + i) % FAST_SEQ_SLOTS];
+
+    if (slot->canId == canId)
+    {
+      uint8_t s = slot->seq;
 
-  diff = (double) y_ms - (double) x_ms;
-  if (diff < 0.0)
+      slot->seq = (s + 1) & 0x07;
+      return s;
+    }
+    if (slot->canId == 0)
+    {
+      slot->canId = canId;
+      slot->seq   = 1;
+      return 0;
+    }
+  }
+  fastSeq[home].canId = canId;
+  fastSeq[home].seq   = 1;
+  return 0;
+}
+
+/*
+  Starts a BAM transfer of the message by sending its TP.CM; the TP.DT packets
+  follow from sendDueBamPackets(). When the source is still sending an earlier
+  BAM the message is queued behind it instead. Directed transfers need
+  RTS/CTS, which means listening for the receiver's CTS; this is a write-only
+  tool, so those are refused.
+*/
+static void sendIsoTpBam(RawMessage *msg, int socket)
+{
+  BamSession      *s = NULL;
+  BamMessage      *m;
+  struct can_frame frame;
+
+  if (((msg->pgn >> 8) & 0xff) < 240 && msg->dst != 255) // PDU1 PGN with a specific destination
   {
-    logError("Timestamp back in time at %s\n", timestamp);
-    return 0;
+    logError("PGN %u length %u to %u needs a directed (RTS/CTS) ISO TP transfer. Skipping.\n", msg->pgn, msg->len, msg->dst);
+    return;
+  }
+
+  for (size_t i = 0; i < BAM_SESSIONS; i++)
+  {
+    if (bamSession[i].used && bamSession[i].src == msg->src)
+    {
+      s = &bamSession[i];
+      break;
+    }
+  }
+  if (s != NULL && s->count == BAM_QUEUE)
+  {
+    logInfo("Source %u has %d BAM transfers queued; holding back the input\n", msg->src, BAM_QUEUE);
+    while (s->used && s->count == BAM_QUEUE)
+    {
+      waitUntil(nextBamPacketDue(), socket);
+      sendDueBamPackets(socket, monotonicNs());
+    }
+  }
+  if (s != NULL && s->used)
+  {
+    m      = &s->queue[(s->head + s->count++) % BAM_QUEUE];
+    m->pgn = msg->pgn;
+    m->len = msg->len;
+    memset(m->data, 0xff, sizeof(m->data));
+    memcpy(m->data, msg->data, msg->len);
+    return;
+  }
+
+  s = NULL;
+  for (;;)
+  {
+    for (size_t i = 0; i < BAM_SESSIONS && (s == NULL || s->used); i++)
+    {
+      s = &bamSession[i];
+    }
+    if (!s->used)
+    {
+      break;
+    }
+    logInfo("All %d BAM sessions are busy; holding back the input\n", BAM_SESSIONS);
+    waitUntil(nextBamPacketDue(), socket);
+    sendDueBamPackets(socket, monotonicNs());
+    s = NULL;
+  }
+
+  s->src   = msg->src;
+  s->head  = 0;
+  s->count = 1;
+  m        = &s->queue[0];
+  m->pgn   = msg->pgn;
+  m->len   = msg->len;
+  memset(m->data, 0xff, sizeof(m->data));
+  memcpy(m->data, msg->data, msg->len);
+  bamAnnounce(s, &frame);
+  sendCanFrame(&frame, socket);
+
+  s->used = true;
+  s->due  = monotonicNs() + BAM_PACKET_INTERVAL_NS;
+  bamActive++;
+}
+
+/* The TP.CM for the message at the head of the session's queue. */
+static void bamAnnounce(BamSession *s, struct can_frame *frame)
+{
+  const BamMessage *m = &s->queue[s->head];
+
+  memset(frame, 0, sizeof(*frame));
+  frame->can_id  = getCanIdFromISO11783Bits(ISO_TP_PRIORITY, PGN_ISO_TP_CM, s->src, 255);
+  frame->can_dlc = 8;
+  frame->data[0] = ISO_TP_CM_BAM;
+  frame->data[1] = m->len & 0xff;
+  frame->data[2] = m->len >> 8;
+  frame->data[3] = (m->len + FASTPACKET_BUCKET_N_SIZE - 1) / FASTPACKET_BUCKET_N_SIZE;
+  frame->data[4] = 0xff;
+  frame->data[5] = m->pgn & 0xff;
+  frame->data[6] = (m->pgn >> 8) & 0xff;
+  frame->data[7] = m->pgn >> 16;
+  s->packets     = frame->data[3];
+  s->next        = 1;
+}
+
+static void sendDueBamPackets(int socket, uint64_t now)
+{
+  if (bamActive == 0)
+  {
+    return;
+  }
+  for (size_t i = 0; i < BAM_SESSIONS; i++)
+  {
+    BamSession      *s = &bamSession[i];
+    struct can_frame frame;
+
+    if (!s->used || s->due > now)
+    {
+      continue;
+    }
+    memset(&frame, 0, sizeof(frame));
+    frame.can_id  = getCanIdFromISO11783Bits(ISO_TP_PRIORITY, PGN_ISO_TP_DT, s->src, 255);
+    frame.can_dlc = 8;
+    frame.data[0] = s->next;
+    memcpy(frame.data + 1, s->queue[s->head].data + (s->next - 1) * FASTPACKET_BUCKET_N_SIZE, FASTPACKET_BUCKET_N_SIZE);
+    if (loadCeiling != 0)
+    {
+      loadTat = CB_MAX(loadTat, now) + frameCostNs(&frame); // charged, but never held back
+    }
+    queueCanFrame(&frame, socket);
+
+    if (s->next == s->packets)
+    {
+      s->head = (s->head + 1) % BAM_QUEUE;
+      s->count--;
+      if (s->count == 0)
+      {
+        s->used = false;
+        bamActive--;
+        continue;
+      }
+      /* The next queued transfer of this source is announced right away; it
+         is already later than its timestamp. */
+      bamAnnounce(s, &frame);
+      if (loadCeiling != 0)
+      {
+        loadTat = CB_MAX(loadTat, now) + frameCostNs(&frame);
+      }
+      queueCanFrame(&frame, socket);
+    }
+    else
+    {
+      s->next++;
+    }
+    /* From now rather than from the previous due time: after a stall the
+       packets must still be at least the minimum interval apart. */
+    s->due = now + BAM_PACKET_INTERVAL_NS;
   }
+}
+
+static uint64_t nextBamPacketDue(void)
+{
+  uint64_t due = UINT64_MAX;
+
+  for (size_t i = 0; i < BAM_SESSIONS && bamActive != 0; i++)
+  {
+    if (bamSession[i].used)
+    {
+      due = CB_MIN(due, bamSession[i].due);
+    }
+  }
+  return due;
+}
+
+static bool inputLineBuffered(void)
+{
+  return memchr(inputBuffer + inputStart, '\n', inputEnd - inputStart) != NULL;
+}
+
+/*
+  fgets() on stdin, but buffered here so we know whether a line is waiting.
+  While a BAM is in progress it does not block on stdin past the next packet.
+  Overlong lines are truncated.
+*/
+static bool readInputLine(char *line, size_t size, int socket)
+{
+  for (;;)
+  {
+    char   *nl = memchr(inputBuffer + inputStart, '\n', inputEnd - inputStart);
+    ssize_t r;
+
+    if (nl != NULL || (inputEnd == sizeof(inputBuffer) && inputStart == 0))
+    {
+      size_t len = (nl != NULL ? (size_t) (nl - inputBuffer) + 1 : inputEnd) - inputStart;
+
+      memcpy(line, inputBuffer + inputStart, CB_MIN(len, size - 1));
+      line[CB_MIN(len, size - 1)] = '\0';
+      inputStart += len;
+      return true;
+    }
+    memmove(inputBuffer, inputBuffer + inputStart, inputEnd - inputStart);
+    inputEnd -= inputStart;
+    inputStart = 0;
+
+    while (bamActive != 0)
+    {
+      struct pollfd pfd = {.fd = STDIN_FILENO, .events = POLLIN};
+      uint64_t      due = nextBamPacketDue();
+      uint64_t      now = monotonicNs();
+
+      flushCanFrames(socket);
+      if (poll(&pfd, 1, due > now ? (int) ((due - now + 999999) / 1000000) : 0) > 0)
+      {
+        break;
+      }
+      sendDueBamPackets(socket, monotonicNs());
+    }
+
+    r = read(STDIN_FILENO, inputBuffer + inputEnd, sizeof(inputBuffer) - inputEnd);
+    if (r < 0 && errno == EINTR)
+    {
+      continue;
+    }
+    if (r <= 0)
+    {
+      if (inputEnd == 0)
+      {
+        return false;
+      }
+      memcpy(line, inputBuffer, CB_MIN(inputEnd, size - 1)); // last line without a newline
+      line[CB_MIN(inputEnd, size - 1)] = '\0';
+      inputEnd                         = 0;
+      return true;
+    }
+    inputEnd += r;
+  }
+}
+
+/*
+  Parses a YYYY-mm-dd[T|-| ]HH:MM:SS[.fraction] timestamp into nanoseconds.
+  Only differences between timestamps are used, so the time zone does not matter.
+*/
+static bool parseFrameTime(const char *timestamp, uint64_t *ns)
+{
+  char        buf[DATE_LENGTH];
+  struct tm   ctime;
+  const char *fraction;
+  time_t      t;
+  uint64_t    scale = NS_PER_SEC;
+
+  if (strlen(timestamp) < 19 || strlen(timestamp) >= sizeof(buf))
+  {
+    return false;
+  }
+  strcpy(buf, timestamp);
+  buf[10] = 'T'; // to support 'T', '-' and ' ' separators
+  memset(&ctime, 0, sizeof(ctime));
+  fraction = strptime(buf, "%Y-%m-%dT%H:%M:%S", &ctime);
+  if (fraction == NULL || fraction - buf < 19)
+  {
+    return false;
+  }
+  ctime.tm_isdst = 0;
+  t              = timegm(&ctime);
+  if (t == (time_t) -1)
+  {
+    return false;
+  }
+  *ns = (uint64_t) t * NS_PER_SEC;
+  if (*fraction == '.' || *fraction == ',')
+  {
+    for (fraction++; *fraction >= '0' && *fraction <= '9' && scale > 1; fraction++)
+    {
+      scale /= 10;
+      *ns += (uint64_t) (*fraction - '0') * scale;
+    }
+  }
+  return true;
+}
+
+/* Time the frame takes on the bus at the load ceiling. */
+static uint64_t frameCostNs(const struct can_frame *frame)
+{
+  uint64_t bits = (uint64_t) (frame->can_dlc * 8 + CAN_EFF_OVERHEAD_BITS) * CAN_STUFFING_NUMER / CAN_STUFFING_DENOM;
+
+  return bits * NS_PER_SEC * 100 / ((uint64_t) bitrate * loadCeiling);
+}
+
+static uint64_t monotonicNs(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * NS_PER_SEC + (uint64_t) ts.tv_nsec;
+}
+
+static void sleepUntil(uint64_t deadline)
+{
+  struct timespec ts = {.tv_sec = deadline / NS_PER_SEC, .tv_nsec = deadline % NS_PER_SEC};
 
-  return (unsigned long) diff;
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+    ;
 }
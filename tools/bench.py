@@ -0,0 +1,309 @@
+#!/usr/bin/env python3
+"""
+bench.py - end-to-end throughput benchmark for the canboat C tools.
+
+Builds a fixed corpus from samples/ (each input replicated up to a minimum
+line count, so that per-message cost dominates process startup), then times:
+
+  - analyzer in text, -json, -json -nv and -json -camel mode over every
+    analyzer input (plain, fast, YDWG, Garmin CSV, candump and EBL derived)
+  - analyzer-j1939 over the J1939 golden test input
+  - candump2analyzer over the candump log (incl. the .pcap captures) and the
+    PCAN-View trace
+  - actisense-serial -r over the .ebl captures
+
+For every case it records messages (lines written to stdout), the best wall
+time of N runs, messages/s, ns/message and peak RSS; per tool it records the
+startup time on empty input. The results are written as JSON. With
+--baseline they are compared against a stored report: a case whose
+ns/message grew by more than --tolerance is reported as a regression.
+Cases whose input digest differs from the baseline are not compared.
+
+Uses only the Python 3 standard library; Unix only (os.wait4).
+
+Usage:
+  python3 bench.py [--bin DIR] [--out FILE] [--baseline FILE] [--runs N]
+                   [--min-lines N] [--tolerance F] [--gate]
+"""
+import argparse
+import glob
+import hashlib
+import json
+import os
+import platform
+import statistics
+import subprocess
+import sys
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SAMPLES = os.path.join(ROOT, "samples")
+
+# Inputs the analyzer reads directly, grouped so that every file in a group
+# has the same format (the analyzer detects the format once per stream).
+ANALYZER_INPUTS = {
+    "plain": [
+        "dirona-actisense-serial.raw",
+        "furuno-fap7011c-autopilot-maneuvers.raw",
+        "raymarine-ev1.raw",
+        "susteranna-actisense-serial.raw",
+        "susteranna2020.raw",
+    ],
+    "fast": [
+        "ac42-commissioning.raw",
+        "furuno-130842*.raw",
+        "scx20.raw",
+        "simrad_mob_quick.raw",
+        "triton-engine-setup.all",
+    ],
+    "ydwg": ["merrimac-ydwg-2020.raw"],
+    "garmin-csv": ["sample3_GPSMAP4008_NMEA2000_6_21_2015_16_7_59.csv"],
+}
+CANDUMP_LOG = ["can0-*.pcap", "actisense-522.candump.log", "candump-fast.txt"]
+PCAN_TRACE = ["sample3_PCAN-View.trc"]
+EBL = ["actisense-523.rx.ebl", "actisense1.ebl", "pgn127504.ebl", "pgn129538.ebl"]
+J1939 = os.path.join(ROOT, "analyzer", "tests", "j1939-pgn-test.in")
+
+ANALYZER_MODES = {
+    "text": [],
+    "json": ["-json"],
+    "json-nv": ["-json", "-nv"],
+    "json-camel": ["-json", "-camel"],
+}
+
+
+def expand(patterns):
+    files = []
+    for p in patterns:
+        matched = sorted(glob.glob(os.path.join(SAMPLES, p)))
+        if not matched:
+            sys.exit(f"bench: no sample matches {p}")
+        files.extend(matched)
+    return files
+
+
+def read_sample(path):
+    if path.endswith(".pcap"):
+        # The C tools do not read pcap; convert with the repo's own script.
+        return subprocess.run(
+            [sys.executable, os.path.join(ROOT, "pcap2candump", "pcap2candump.py"), path],
+            check=True, stdout=subprocess.PIPE).stdout
+    with open(path, "rb") as f:
+        data = f.read()
+    if data and not data.endswith(b"\n") and not path.endswith(".ebl"):
+        data += b"\n"
+    return data
+
+
+def replicate(data, min_lines, binary=False):
+    """Repeat data until it holds at least min_lines lines (or, for binary
+    captures, min_lines * 16 bytes, roughly a frame per 16 bytes)."""
+    unit = len(data) // 16 if binary else data.count(b"\n")
+    copies = max(1, -(-min_lines // max(1, unit)))
+    return data * copies
+
+
+def digest(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+def high_water_mark(pid):
+    """VmHWM of a running process in KiB, or 0. Unlike ru_maxrss this is
+    per address space, so it does not include the RSS of the Python process
+    that forked the tool."""
+    try:
+        with open(f"/proc/{pid}/status") as f:
+            for line in f:
+                if line.startswith("VmHWM:"):
+                    return int(line.split()[1])
+    except OSError:
+        pass
+    return 0
+
+
+def run(cmd, stdin_path):
+    """Run cmd once; return (seconds, stdout lines, peak RSS in KiB)."""
+    with open(stdin_path, "rb") as stdin:
+        start = time.perf_counter()
+        proc = subprocess.Popen(cmd, stdin=stdin, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+        lines = 0
+        rss = 0
+        while True:
+            chunk = proc.stdout.read(1 << 16)
+            rss = max(rss, high_water_mark(proc.pid))
+            if not chunk:
+                break
+            lines += chunk.count(b"\n")
+        _, status, usage = os.wait4(proc.pid, 0)
+        elapsed = time.perf_counter() - start
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    if proc.returncode != 0:
+        sys.exit(f"bench: {' '.join(cmd)} < {stdin_path} exited with {proc.returncode}")
+    if not os.path.isdir("/proc"):
+        # No per-process high-water mark; ru_maxrss (bytes on macOS) is an upper bound
+        rss = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+    return elapsed, lines, rss
+
+
+def measure(cmd, stdin_path, runs):
+    best = None
+    peak = 0
+    lines = 0
+    for _ in range(runs):
+        elapsed, lines, rss = run(cmd, stdin_path)
+        best = elapsed if best is None else min(best, elapsed)
+        peak = max(peak, rss)
+    return {
+        "messages": lines,
+        "seconds": round(best, 6),
+        "msgs_per_sec": round(lines / best) if best > 0 else 0,
+        "ns_per_msg": round(best * 1e9 / lines, 1) if lines else None,
+        "peak_rss_kib": peak,
+    }
+
+
+def build_corpus(bindir, workdir, min_lines):
+    """Write the corpus files; returns {name: (path, digest)}."""
+    os.makedirs(workdir, exist_ok=True)
+    corpus = {}
+
+    def add(name, data, source=None):
+        # Derived inputs are identified by their source: the tools that
+        # produce them may stamp messages with the current time.
+        path = os.path.join(workdir, name)
+        with open(path, "wb") as f:
+            f.write(data)
+        corpus[name] = (path, digest(data if source is None else source))
+
+    for name, patterns in ANALYZER_INPUTS.items():
+        add(name, replicate(b"".join(read_sample(f) for f in expand(patterns)), min_lines))
+    add("candump-log", replicate(b"".join(read_sample(f) for f in expand(CANDUMP_LOG)), min_lines))
+    add("pcan-trace", replicate(b"".join(read_sample(f) for f in expand(PCAN_TRACE)), min_lines))
+    add("ebl", replicate(b"".join(read_sample(f) for f in expand(EBL)), min_lines, binary=True))
+
+    # Analyzer inputs derived from the parsers' output, so the analyzer is
+    # also timed on the formats they produce. Not timed here.
+    def convert(cmd):
+        return subprocess.run(cmd, check=True, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL).stdout
+
+    add("candump",
+        convert([os.path.join(bindir, "candump2analyzer"), corpus["candump-log"][0]]),
+        corpus["candump-log"][1].encode())
+    add("ebl-analyzer",
+        convert([os.path.join(bindir, "actisense-serial"), "-r", corpus["ebl"][0]]),
+        corpus["ebl"][1].encode())
+    with open(J1939, "rb") as f:
+        source = f.read()
+    add("j1939",
+        replicate(convert([os.path.join(bindir, "candump2analyzer"), J1939]), min_lines),
+        b"%d:%s" % (min_lines, source))
+    return corpus
+
+
+def cases(bindir, corpus):
+    """Yield (case name, corpus input, command); the input is fed on stdin."""
+    analyzer = os.path.join(bindir, "analyzer")
+    for mode, args in ANALYZER_MODES.items():
+        for name in list(ANALYZER_INPUTS) + ["candump", "ebl-analyzer"]:
+            yield f"analyzer/{mode}/{name}", name, [analyzer] + args
+    yield "analyzer-j1939/json/j1939", "j1939", [os.path.join(bindir, "analyzer-j1939"), "-json"]
+    for name in ("candump-log", "pcan-trace"):
+        # candump2analyzer only reads a file named on the command line
+        yield f"candump2analyzer/{name}", name, [os.path.join(bindir, "candump2analyzer"), corpus[name][0]]
+    yield "actisense-serial/ebl", "ebl", [os.path.join(bindir, "actisense-serial"), "-r", corpus["ebl"][0]]
+
+
+def startup(bindir, workdir, runs):
+    """Median wall time, in ms, of each tool on empty input."""
+    empty = os.path.join(workdir, "empty")
+    open(empty, "wb").close()
+    empty_ebl = os.path.join(workdir, "empty.ebl")
+    open(empty_ebl, "wb").close()
+    tools = {
+        "analyzer": [os.path.join(bindir, "analyzer")],
+        "analyzer-j1939": [os.path.join(bindir, "analyzer-j1939")],
+        "candump2analyzer": [os.path.join(bindir, "candump2analyzer"), empty],
+        "actisense-serial": [os.path.join(bindir, "actisense-serial"), "-r", empty_ebl],
+    }
+    result = {}
+    for tool, cmd in tools.items():
+        times = [run(cmd, empty)[0] for _ in range(max(5, runs))]
+        result[tool] = round(statistics.median(times) * 1e3, 3)
+    return result
+
+
+def compare(report, baseline, tolerance):
+    """Print the comparison; return the number of regressions."""
+    regressions = 0
+    print(f"\n{'case':<38} {'ns/msg':>10} {'baseline':>10} {'change':>8}")
+    for name, case in report["cases"].items():
+        base = baseline.get("cases", {}).get(name)
+        if base is None:
+            print(f"{name:<38} {case['ns_per_msg']:>10} {'(new)':>10}")
+            continue
+        if base.get("input") != case["input"] or not base.get("ns_per_msg") or not case["ns_per_msg"]:
+            print(f"{name:<38} {case['ns_per_msg']:>10} {'(input changed)':>19}")
+            continue
+        change = case["ns_per_msg"] / base["ns_per_msg"] - 1.0
+        flag = ""
+        if change > tolerance:
+            flag = "  REGRESSION"
+            regressions += 1
+        print(f"{name:<38} {case['ns_per_msg']:>10} {base['ns_per_msg']:>10} {change * 100:>+7.1f}%{flag}")
+    for tool, ms in report["startup_ms"].items():
+        base = baseline.get("startup_ms", {}).get(tool)
+        if base:
+            print(f"startup {tool:<30} {ms:>8.3f}ms {base:>8.3f}ms {(ms / base - 1.0) * 100:>+7.1f}%")
+    return regressions
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    plat = f"{platform.system().lower()}-{platform.machine()}"
+    ap.add_argument("--bin", default=os.path.join(ROOT, "rel", plat), help="directory with the built tools")
+    ap.add_argument("--out", help="write the JSON report here (default: <bin>/bench.json)")
+    ap.add_argument("--baseline", help="compare against this earlier report")
+    ap.add_argument("--runs", type=int, default=3, help="runs per case; the fastest counts (default 3)")
+    ap.add_argument("--min-lines", type=int, default=100000, help="replicate each input to this many lines")
+    ap.add_argument("--tolerance", type=float, default=0.10, help="allowed ns/message growth (default 0.10)")
+    ap.add_argument("--gate", action="store_true", help="exit 1 when a case regressed")
+    args = ap.parse_args()
+
+    workdir = os.path.join(args.bin, "bench")
+    corpus = build_corpus(args.bin, workdir, args.min_lines)
+    report = {
+        "platform": plat,
+        "runs": args.runs,
+        "min_lines": args.min_lines,
+        "inputs": {name: digest for name, (_, digest) in corpus.items()},
+        "startup_ms": startup(args.bin, workdir, args.runs),
+        "cases": {},
+    }
+    print(f"{'case':<38} {'messages':>9} {'msgs/s':>10} {'ns/msg':>10} {'RSS KiB':>8}")
+    for name, inp, cmd in cases(args.bin, corpus):
+        r = measure(cmd, corpus[inp][0], args.runs)
+        r["input"] = corpus[inp][1]
+        report["cases"][name] = r
+        print(f"{name:<38} {r['messages']:>9} {r['msgs_per_sec']:>10} {r['ns_per_msg']:>10} {r['peak_rss_kib']:>8}")
+
+    out = args.out or os.path.join(args.bin, "bench.json")
+    with open(out, "w") as f:
+        json.dump(report, f, indent=2)
+        f.write("\n")
+    print(f"\nbench: report written to {out}")
+
+    if args.baseline:
+        if not os.path.exists(args.baseline):
+            print(f"bench: no baseline {args.baseline}; run 'make bench-baseline' to store one")
+            return 0
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressions = compare(report, baseline, args.tolerance)
+        print(f"bench: {regressions} regression(s) over {args.tolerance * 100:.0f}% against {args.baseline}")
+        if regressions and args.gate:
+            return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())